@@ -2,6 +2,13 @@
 #include "pch.h"
 // clang-format on
 
+// Note: Image buffers are pooled; see image_decoding.h.
+#include "image_decoding.h"
+#define STBI_MALLOC(_size_bytes_in) AllocateImageBuffer(_size_bytes_in)
+#define STBI_REALLOC_SIZED(_buffer_in, _old_size_bytes_in, _new_size_bytes_in) \
+    ReallocateImageBuffer(_buffer_in, _old_size_bytes_in, _new_size_bytes_in)
+#define STBI_FREE(_buffer_in) FreeImageBuffer(_buffer_in)
+
 #define STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "stb_image.h"
@@ -0,0 +1,95 @@
+#!/bin/sh
+
+#------------------------------
+#
+# Release / Debug
+#
+#------------------------------
+RELEASE_BUILD=1
+
+
+#------------------------------
+#
+# Environment Settings
+#
+#------------------------------
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+APP_NAME=asset_cooker
+CXX="${CXX:-g++}"
+
+
+#------------------------------
+#
+# Compilation
+# Requires GCC 11 or Clang 14 (C++20); the cooker does not use OpenGL or a window.
+#
+#------------------------------
+
+#
+# Store compiler clutter elsewhere
+#---------------------------------
+mkdir -p "$SCRIPT_DIR/gcc_landfill"
+
+#
+# Compile & Link Options
+#------------------------------
+# Note: Third party headers are included as system headers, so that their warnings are not
+#       treated as errors.
+# Note: -mavx2 builds the AVX and AVX2 kernels, so the cooker requires an AVX2 CPU
+#       (Intel Haswell / AMD Excavator or newer).
+GeneralParameters="-std=c++20 -Wall -Werror -pthread -mavx2"
+DebugParameters="-O0 -g -D_ENGINE_DEBUG_"
+ReleaseParameters="-O2 -DNDEBUG"
+
+IncludeParameters="-I$SCRIPT_DIR/.. \
+-I$SCRIPT_DIR/../.. \
+-isystem $SCRIPT_DIR/../../include \
+-isystem $SCRIPT_DIR/../../include/glm \
+-isystem $SCRIPT_DIR/../../include/stb \
+-I$SCRIPT_DIR/../../src/common \
+-I$SCRIPT_DIR/../../src/common/platform"
+
+#
+# Source Files
+#-------------
+SourceFiles="$SCRIPT_DIR/src/$APP_NAME.cpp \
+$SCRIPT_DIR/../../include/stb/stb_image.c \
+$SCRIPT_DIR/../../src/common/logging.cpp \
+$SCRIPT_DIR/../../src/common/vertex_layout.cpp \
+$SCRIPT_DIR/../../src/common/model_import.cpp \
+$SCRIPT_DIR/../../src/common/cooked_mesh.cpp \
+$SCRIPT_DIR/../../src/common/cooked_texture.cpp \
+$SCRIPT_DIR/../../src/common/mip_generator.cpp \
+$SCRIPT_DIR/../../src/common/block_compression.cpp \
+$SCRIPT_DIR/../../src/common/mesh_codec.cpp \
+$SCRIPT_DIR/../../src/common/mesh_tools.cpp \
+$SCRIPT_DIR/../../src/common/meshlet.cpp \
+$SCRIPT_DIR/../../src/common/tangent_space.cpp \
+$SCRIPT_DIR/../../src/common/bounds.cpp \
+$SCRIPT_DIR/../../src/common/gltf.cpp \
+$SCRIPT_DIR/../../src/common/job_system.cpp \
+$SCRIPT_DIR/../../src/common/image_tools.cpp \
+$SCRIPT_DIR/../../src/common/image_decoding.cpp \
+$SCRIPT_DIR/../../src/common/texture_atlas.cpp \
+$SCRIPT_DIR/../../src/common/fileio.cpp \
+$SCRIPT_DIR/../../src/common/timer.cpp"
+
+#
+# Compiler Invocation
+#--------------------
+if [ "$RELEASE_BUILD" = "1" ]; then
+    echo "Building [ release ]..."
+    ModeParameters="$ReleaseParameters"
+else
+    echo "Building [ debug ]..."
+    ModeParameters="$DebugParameters"
+fi
+
+# Note: stb_image.c includes pch.h, and is compiled as C++ as it is by the Windows builds.
+"$CXX" $GeneralParameters $ModeParameters $IncludeParameters -x c++ $SourceFiles \
+    -o "$SCRIPT_DIR/gcc_landfill/$APP_NAME" || exit 1
+
+mkdir -p "$SCRIPT_DIR/../../bin"
+cp "$SCRIPT_DIR/gcc_landfill/$APP_NAME" "$SCRIPT_DIR/../../bin/"
+echo "Done."
+echo
@@ -0,0 +1,1300 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "block_compression.h"
+#include "cooked_mesh.h"
+#include "cooked_texture.h"
+#include "fileio.h"
+#include "image_decoding.h"
+#include "image_tools.h"
+#include "job_system.h"
+#include "logging.h"
+#include "mesh_tools.h"
+#include "mip_generator.h"
+#include "model_import.h"
+#include "texture_atlas.h"
+#include "timer.h"
+
+//
+// Note: Offline asset cooker. Walks an asset directory and cooks every mesh on a job system:
+//
+//       import -> weld -> optimize -> meshlets -> cooked mesh write
+//
+//       which is the pipeline LoadModelFromPlyFile(...), LoadModelFromObjFile(...) and
+//       LoadModelFromGlbFile(...) run on a cooked mesh miss, such that the applications find
+//       every cooked mesh current at startup.
+//       The importers run import through meshlets in one call, so the manifest times them
+//       together as "import".
+//
+//       Meshes are not cooked quantized. The applications generate levels of detail from the
+//       float positions before quantizing (see model_streaming.h), so the cooker only quantizes
+//       each mesh (see QuantizeVertices(...) in mesh_tools.h) to report the vertex size the
+//       applications upload.
+//
+//       Images are cooked to textures with a full mip chain (see cooked_texture.h), which
+//       glt::GetTexture2DFromImage(...) uploads in place of decoding the image. Unlike cooked
+//       meshes, cooked textures are only written here.
+//
+//       Textures may be block compressed (see block_compression.h); the peak signal to noise
+//       ratio of the full resolution level to its image is then reported in the manifest.
+//
+//       Before anything else is cooked, the images of each `<name>.atlas` directory are packed
+//       into a texture atlas (see texture_atlas.h): `<name>.png` beside the directory, cooked as
+//       any other image, and its description `<name>.png.atlas`. Images within atlas directories
+//       are not cooked on their own. Atlases are rebuilt when their images, or the options they
+//       are built with, change.
+//
+//       Assets whose cooked file matches the size and content hash of the source are skipped;
+//       textures must also have been cooked with the same mip and compression options.
+//
+//       A JSON manifest with the status, timings and sizes of every asset is written when done.
+//
+// Usage: asset_cooker <asset_directory> [--threads <count>] [--manifest <file>] [--force]
+//                     [--mip-filter <box|kaiser|lanczos>] [--srgb-mips]
+//                     [--alpha-coverage <reference>] [--texture-compression <none|bc1|bc3|bc5|bc7>]
+//                     [--compression-quality <fast|high>] [--atlas-mip-safe-levels <count>]
+//        --threads         Worker thread count. Defaults to std::thread::hardware_concurrency().
+//        --manifest        Defaults to <asset_directory>/asset_manifest.json.
+//        --force           Cook every asset, even when its cooked file is current.
+//        --mip-filter      Filter the mip chains of textures are generated with (see
+//                          mip_generator.h). Defaults to box, as glGenerateMipmap.
+//        --srgb-mips       Filter the color of textures in linear space, as sRGB encoded,
+//                          and write them with sRGB formats.
+//        --alpha-coverage  Preserve the alpha test coverage of textures, at this reference
+//                          alpha in (0, 1), through their mip chains.
+//        --texture-compression
+//                          Block format textures are compressed to. Defaults to none, which
+//                          stores RGB or RGBA as the image has.
+//        --compression-quality
+//                          Defaults to fast, for iteration; high is slower, for shipping.
+//        --atlas-mip-safe-levels
+//                          Mip levels of texture atlases, below the full resolution, that
+//                          sub-images do not bleed into each other on. Defaults to 3.
+//
+constexpr const char* const default_manifest_file_name = "asset_manifest.json";
+
+// Attribute indices belong to the program a mesh is drawn with; they are not cooked.
+constexpr GLuint cooker_vao_id                             = 0;
+constexpr GLuint cooker_position_attribute_index           = 0;
+constexpr GLuint cooker_normal_attribute_index             = 1;
+constexpr GLuint cooker_texture_coordinate_attribute_index = 2;
+constexpr GLuint cooker_tangent_attribute_index            = 3;
+
+enum class AssetType
+{
+    PLY_MESH = 0,
+    OBJ_MESH,
+    GLB_MESH,
+    IMAGE,
+    ATLAS
+};
+
+enum class CookStatus
+{
+    FAILED = 0,
+    COOKED,
+    UP_TO_DATE
+};
+
+struct CookerOptions
+{
+    std::filesystem::path asset_directory;
+    std::filesystem::path manifest_path;
+    size_t                thread_count = 0;
+    bool                  force        = false;
+    CookedTextureOptions  texture_options;
+    TextureAtlasOptions   atlas_options;
+};
+
+// Note: Written by exactly one job, then read by the main thread once every job has completed.
+struct AssetReport
+{
+    std::filesystem::path source_path;
+    AssetType             asset_type = AssetType::PLY_MESH;
+    CookStatus            status     = CookStatus::FAILED;
+
+    uint64_t source_size_bytes = 0;
+    uint64_t output_size_bytes = 0;
+
+    size_t vertex_count                = 0;
+    size_t triangle_count              = 0;
+    size_t meshlet_count               = 0;
+    size_t vertex_data_size_bytes      = 0;
+    size_t quantized_vertex_size_bytes = 0;
+
+    int    image_width     = 0;
+    int    image_height    = 0;
+    int    image_channels  = 0;
+    size_t mip_level_count = 0;
+
+    bool        texture_compressed   = false;
+    BlockFormat texture_block_format = BlockFormat::BC1;
+    double      texture_psnr         = 0.0;
+
+    size_t sub_image_count = 0;
+
+    float hash_milliseconds     = 0.0f;
+    float import_milliseconds   = 0.0f;
+    float quantize_milliseconds = 0.0f;
+    float write_milliseconds    = 0.0f;
+    float total_milliseconds    = 0.0f;
+};
+
+static void
+ParseCookerArguments(bool& _success_out, int argc, char** argv, CookerOptions& _options_out)
+{
+    _success_out = false;
+    if (2 > argc)
+    {
+        Log_e("Usage: asset_cooker <asset_directory> [--threads <count>] [--manifest <file>] "
+              "[--force] [--mip-filter <box|kaiser|lanczos>] [--srgb-mips] "
+              "[--alpha-coverage <reference>] [--texture-compression <none|bc1|bc3|bc5|bc7>] "
+              "[--compression-quality <fast|high>] [--atlas-mip-safe-levels <count>]");
+        return;
+    }
+
+    _options_out.asset_directory = argv[1];
+    for (int argument_index = 2; argument_index < argc; argument_index++)
+    {
+        const std::string_view argument = argv[argument_index];
+        const bool             has_value = (argument_index + 1) < argc;
+        if (("--threads" == argument) && (true == has_value))
+        {
+            const char* const value = argv[++argument_index];
+            const std::from_chars_result result = std::from_chars(
+              value, value + std::strlen(value), _options_out.thread_count);
+            if (std::errc() != result.ec)
+            {
+                std::stringstream ss;
+                ss << "Invalid thread count: " << value;
+                Log_e(ss);
+                return;
+            }
+        }
+        else if (("--manifest" == argument) && (true == has_value))
+        {
+            _options_out.manifest_path = argv[++argument_index];
+        }
+        else if ("--force" == argument)
+        {
+            _options_out.force = true;
+        }
+        else if (("--mip-filter" == argument) && (true == has_value))
+        {
+            const std::string_view value = argv[++argument_index];
+            if ("box" == value)
+            {
+                _options_out.texture_options.mip_options.filter = MipFilter::BOX;
+            }
+            else if ("kaiser" == value)
+            {
+                _options_out.texture_options.mip_options.filter = MipFilter::KAISER;
+            }
+            else if ("lanczos" == value)
+            {
+                _options_out.texture_options.mip_options.filter = MipFilter::LANCZOS;
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "Invalid mip filter: " << value;
+                Log_e(ss);
+                return;
+            }
+        }
+        else if ("--srgb-mips" == argument)
+        {
+            _options_out.texture_options.mip_options.srgb = true;
+        }
+        else if (("--alpha-coverage" == argument) && (true == has_value))
+        {
+            const char* const value     = argv[++argument_index];
+            float& reference = _options_out.texture_options.mip_options.alpha_coverage_reference;
+            const std::from_chars_result result = std::from_chars(
+              value, value + std::strlen(value), reference);
+            if ((std::errc() != result.ec) || (0.0f >= reference) || (1.0f <= reference))
+            {
+                std::stringstream ss;
+                ss << "Invalid alpha coverage reference: " << value;
+                Log_e(ss);
+                return;
+            }
+        }
+        else if (("--texture-compression" == argument) && (true == has_value))
+        {
+            constexpr std::pair<std::string_view, BlockFormat> block_formats[] = {
+                { "bc1", BlockFormat::BC1 },
+                { "bc3", BlockFormat::BC3 },
+                { "bc5", BlockFormat::BC5 },
+                { "bc7", BlockFormat::BC7 },
+            };
+
+            const std::string_view value = argv[++argument_index];
+            _options_out.texture_options.compress = false;
+            for (const auto& [block_format_name, block_format] : block_formats)
+            {
+                if (block_format_name == value)
+                {
+                    _options_out.texture_options.compress     = true;
+                    _options_out.texture_options.block_format = block_format;
+                }
+            }
+
+            if ((false == _options_out.texture_options.compress) && ("none" != value))
+            {
+                std::stringstream ss;
+                ss << "Invalid texture compression: " << value;
+                Log_e(ss);
+                return;
+            }
+        }
+        else if (("--compression-quality" == argument) && (true == has_value))
+        {
+            const std::string_view value = argv[++argument_index];
+            if ("fast" == value)
+            {
+                _options_out.texture_options.compression_quality = BlockCompressionQuality::FAST;
+            }
+            else if ("high" == value)
+            {
+                _options_out.texture_options.compression_quality = BlockCompressionQuality::HIGH;
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "Invalid compression quality: " << value;
+                Log_e(ss);
+                return;
+            }
+        }
+        else if (("--atlas-mip-safe-levels" == argument) && (true == has_value))
+        {
+            const char* const value = argv[++argument_index];
+            int& mip_safe_level_count = _options_out.atlas_options.mip_safe_level_count;
+            const std::from_chars_result result = std::from_chars(
+              value, value + std::strlen(value), mip_safe_level_count);
+            if ((std::errc() != result.ec) || (0 > mip_safe_level_count))
+            {
+                std::stringstream ss;
+                ss << "Invalid atlas mip safe level count: " << value;
+                Log_e(ss);
+                return;
+            }
+        }
+        else
+        {
+            std::stringstream ss;
+            ss << "Unknown or incomplete argument: " << argument;
+            Log_e(ss);
+            return;
+        }
+    }
+
+    if (false == std::filesystem::is_directory(_options_out.asset_directory))
+    {
+        std::stringstream ss;
+        ss << "Asset directory does not exist: " << _options_out.asset_directory.string();
+        Log_e(ss);
+        return;
+    }
+
+    if (true == _options_out.manifest_path.empty())
+    {
+        _options_out.manifest_path = _options_out.asset_directory / default_manifest_file_name;
+    }
+
+    _success_out = true;
+}
+
+static void
+GetLowercaseExtension(const std::filesystem::path& _path_in, std::string& _extension_out)
+{
+    _extension_out = _path_in.extension().string();
+    std::transform(_extension_out.begin(),
+                   _extension_out.end(),
+                   _extension_out.begin(),
+                   [](const unsigned char _character_in)
+                   { return static_cast<char>(std::tolower(_character_in)); });
+}
+
+// Note: Returns false for files the cooker does not handle, including its own outputs.
+static bool
+GetAssetType(const std::filesystem::path& _file_path_in, AssetType& _asset_type_out)
+{
+    std::string extension;
+    GetLowercaseExtension(_file_path_in, extension);
+
+    if (".ply" == extension)
+    {
+        _asset_type_out = AssetType::PLY_MESH;
+        return true;
+    }
+
+    if (".obj" == extension)
+    {
+        _asset_type_out = AssetType::OBJ_MESH;
+        return true;
+    }
+
+    if (".glb" == extension)
+    {
+        _asset_type_out = AssetType::GLB_MESH;
+        return true;
+    }
+
+    if ((".png" == extension) || (".jpg" == extension) || (".jpeg" == extension) ||
+        (".tga" == extension) || (".bmp" == extension))
+    {
+        _asset_type_out = AssetType::IMAGE;
+        return true;
+    }
+
+    return false;
+}
+
+// Note: Sorted by path, so that manifests of the same directory are comparable.
+static void
+SortAssetReports(std::vector<AssetReport>& _asset_reports_in_out)
+{
+    std::sort(_asset_reports_in_out.begin(),
+              _asset_reports_in_out.end(),
+              [](const AssetReport& _a_in, const AssetReport& _b_in)
+              { return _a_in.source_path < _b_in.source_path; });
+}
+
+// Note: Atlas directories are collected as one asset each; the images within them are not.
+static void
+CollectAssets(bool&                        _success_out,
+              const std::filesystem::path& _asset_directory_in,
+              std::vector<AssetReport>&    _asset_reports_out)
+{
+    std::error_code error_code;
+    for (auto iterator = std::filesystem::recursive_directory_iterator(
+           _asset_directory_in,
+           std::filesystem::directory_options::skip_permission_denied,
+           error_code);
+         (false == static_cast<bool>(error_code)) &&
+         (std::filesystem::recursive_directory_iterator() != iterator);
+         iterator.increment(error_code))
+    {
+        std::string extension;
+        GetLowercaseExtension(iterator->path(), extension);
+        if ((true == iterator->is_directory()) && (texture_atlas_directory_extension == extension))
+        {
+            iterator.disable_recursion_pending();
+
+            AssetReport asset_report;
+            asset_report.source_path = iterator->path();
+            asset_report.asset_type  = AssetType::ATLAS;
+            _asset_reports_out.push_back(asset_report);
+            continue;
+        }
+
+        AssetType asset_type = AssetType::PLY_MESH;
+        if ((false == iterator->is_regular_file()) ||
+            (false == GetAssetType(iterator->path(), asset_type)))
+        {
+            continue;
+        }
+
+        AssetReport asset_report;
+        asset_report.source_path = iterator->path();
+        asset_report.asset_type  = asset_type;
+        _asset_reports_out.push_back(asset_report);
+    }
+
+    if (true == static_cast<bool>(error_code))
+    {
+        std::stringstream ss;
+        ss << "Unable to walk asset directory: " << _asset_directory_in.string() << std::endl
+           << "   Note: " << error_code.message();
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    SortAssetReports(_asset_reports_out);
+    _success_out = true;
+}
+
+// Note: A current cooked mesh is left as-is; its header provides the counts for the manifest.
+static void
+IsCookedMeshCurrent(bool& _current_out, AssetReport& _asset_report_in_out)
+{
+    _current_out = false;
+
+    const std::string source_path           = _asset_report_in_out.source_path.string();
+    bool              has_source_write_time = false;
+    uint64_t          source_write_time     = 0;
+    GetFileWriteTime(has_source_write_time, source_path.c_str(), source_write_time);
+
+    // Note: Mapping does not read the source; it is only read when it must be hashed.
+    MappedFile source_file;
+    bool       mapped = false;
+    MapFileToMemory(mapped, source_path.c_str(), source_file);
+    if (false == mapped)
+    {
+        return;
+    }
+
+    const std::string cooked_mesh_path = source_path + cooked_mesh_file_extension;
+    CookedMesh        cooked_mesh;
+    MapCookedMesh(_current_out,
+                  cooked_mesh_path.c_str(),
+                  source_file,
+                  source_write_time,
+                  cooked_mesh);
+    if (false == _current_out)
+    {
+        return;
+    }
+
+    _asset_report_in_out.output_size_bytes = cooked_mesh.file.size_bytes;
+    _asset_report_in_out.vertex_count      = cooked_mesh.header->vertex_count;
+    _asset_report_in_out.triangle_count    = cooked_mesh.header->element_count / 3;
+    _asset_report_in_out.meshlet_count     = cooked_mesh.header->meshlet_count;
+    _asset_report_in_out.vertex_data_size_bytes = cooked_mesh.header->vertex_data_size_bytes;
+}
+
+static void
+CookMesh(const bool& _force_in, JobSystem* const _job_system_in, AssetReport& _asset_report_in_out)
+{
+    Timer timer;
+
+    const std::string source_path      = _asset_report_in_out.source_path.string();
+    const std::string cooked_mesh_path = source_path + cooked_mesh_file_extension;
+    if (true == _force_in)
+    {
+        std::error_code error_code;
+        std::filesystem::remove(cooked_mesh_path, error_code);
+    }
+    else
+    {
+        bool current = false;
+        timer.StartTimer();
+        IsCookedMeshCurrent(current, _asset_report_in_out);
+        timer.StopTimer();
+        timer.TimerElapsedMs(_asset_report_in_out.hash_milliseconds);
+
+        if (true == current)
+        {
+            _asset_report_in_out.status = CookStatus::UP_TO_DATE;
+            return;
+        }
+    }
+
+    // Note: The modification time is read before the source, such that a change made while it
+    //       is cooked leaves the cooked mesh stale.
+    bool     success           = false;
+    uint64_t source_write_time = 0;
+    GetFileWriteTime(success, source_path.c_str(), source_write_time);
+
+    MappedFile source_file;
+    MapFileToMemory(success, source_path.c_str(), source_file);
+    if (false == success)
+    {
+        std::stringstream ss;
+        ss << "Unable to cook mesh: " << source_path;
+        Log_e(ss);
+        return;
+    }
+
+    uint64_t source_content_hash = 0;
+    timer.StartTimer();
+    HashMemory(source_content_hash, source_file.data, source_file.size_bytes);
+    timer.StopTimer();
+    timer.TimerElapsedMs(_asset_report_in_out.hash_milliseconds);
+
+    size_t                                      vertex_count = 0;
+    std::vector<float>                          buffer_data;
+    std::vector<GLuint>                         buffer_elements_array;
+    GLenum                                      element_data_type = GL_UNSIGNED_INT;
+    std::vector<Meshlet>                        meshlets;
+    BoundingVolume                              bounding_volume;
+    std::vector<glt::VertexDataType>            vertex_data_type_order;
+    std::vector<glt::VertexAttributeDescriptor> vertex_attribute_pointers;
+
+    // Note: The importer parses, welds and optimizes the source without touching the cooked
+    //       mesh, which is written below such that the write is timed on its own. Large ascii
+    //       PLY files are parsed in chunks on the cooker's job system, which waits only on
+    //       those chunks.
+    timer.StartTimer();
+    if (AssetType::PLY_MESH == _asset_report_in_out.asset_type)
+    {
+        LoadModelFromPlyFile(success,
+                             std::move(cooker_vao_id),
+                             source_path.c_str(),
+                             std::move(cooker_position_attribute_index),
+                             std::move(cooker_normal_attribute_index),
+                             std::move(cooker_texture_coordinate_attribute_index),
+                             std::move(cooker_tangent_attribute_index),
+                             vertex_count,
+                             buffer_data,
+                             buffer_elements_array,
+                             element_data_type,
+                             meshlets,
+                             bounding_volume,
+                             vertex_data_type_order,
+                             vertex_attribute_pointers,
+                             false,
+                             _job_system_in);
+    }
+    else if (AssetType::OBJ_MESH == _asset_report_in_out.asset_type)
+    {
+        LoadModelFromObjFile(success,
+                             std::move(cooker_vao_id),
+                             source_path.c_str(),
+                             std::move(cooker_position_attribute_index),
+                             std::move(cooker_normal_attribute_index),
+                             std::move(cooker_texture_coordinate_attribute_index),
+                             std::move(cooker_tangent_attribute_index),
+                             vertex_count,
+                             buffer_data,
+                             buffer_elements_array,
+                             element_data_type,
+                             meshlets,
+                             bounding_volume,
+                             vertex_data_type_order,
+                             vertex_attribute_pointers,
+                             false);
+    }
+    else
+    {
+        LoadModelFromGlbFile(success,
+                             std::move(cooker_vao_id),
+                             source_path.c_str(),
+                             std::move(cooker_position_attribute_index),
+                             std::move(cooker_normal_attribute_index),
+                             std::move(cooker_texture_coordinate_attribute_index),
+                             std::move(cooker_tangent_attribute_index),
+                             vertex_count,
+                             buffer_data,
+                             buffer_elements_array,
+                             element_data_type,
+                             meshlets,
+                             bounding_volume,
+                             vertex_data_type_order,
+                             vertex_attribute_pointers,
+                             false);
+    }
+    timer.StopTimer();
+    timer.TimerElapsedMs(_asset_report_in_out.import_milliseconds);
+
+    if (true == success)
+    {
+        timer.StartTimer();
+        WriteCookedMesh(success,
+                        cooked_mesh_path.c_str(),
+                        source_file.size_bytes,
+                        source_content_hash,
+                        source_write_time,
+                        vertex_count,
+                        buffer_data,
+                        buffer_elements_array,
+                        std::move(element_data_type),
+                        meshlets,
+                        bounding_volume,
+                        vertex_attribute_pointers);
+        timer.StopTimer();
+        timer.TimerElapsedMs(_asset_report_in_out.write_milliseconds);
+    }
+
+    if (false == success)
+    {
+        std::stringstream ss;
+        ss << "Unable to cook mesh: " << source_path;
+        Log_e(ss);
+        return;
+    }
+
+    _asset_report_in_out.output_size_bytes      = std::filesystem::file_size(cooked_mesh_path);
+    _asset_report_in_out.vertex_count           = vertex_count;
+    _asset_report_in_out.triangle_count         = buffer_elements_array.size() / 3;
+    _asset_report_in_out.meshlet_count          = meshlets.size();
+    _asset_report_in_out.vertex_data_size_bytes = buffer_data.size() * sizeof(float);
+
+    std::vector<unsigned char>                  quantized_buffer_data;
+    std::vector<glt::VertexAttributeDescriptor> quantized_vertex_attribute_pointers;
+    VertexQuantizationReport                    quantization_report;
+    timer.StartTimer();
+    QuantizeVertices(success,
+                     PositionQuantization::HALF_FLOAT,
+                     vertex_count,
+                     buffer_data,
+                     vertex_attribute_pointers,
+                     quantized_buffer_data,
+                     quantized_vertex_attribute_pointers,
+                     quantization_report);
+    timer.StopTimer();
+    timer.TimerElapsedMs(_asset_report_in_out.quantize_milliseconds);
+
+    if (false == success)
+    {
+        std::stringstream ss;
+        ss << "Unable to quantize mesh: " << source_path;
+        Log_e(ss);
+        return;
+    }
+
+    _asset_report_in_out.quantized_vertex_size_bytes = quantized_buffer_data.size();
+    _asset_report_in_out.status                      = CookStatus::COOKED;
+}
+
+// Note: A current cooked texture is left as-is; its header provides the sizes for the manifest.
+static void
+CookImage(const bool&                 _force_in,
+          const CookedTextureOptions& _texture_options_in,
+          AssetReport&                _asset_report_in_out)
+{
+    Timer timer;
+
+    const std::string source_path         = _asset_report_in_out.source_path.string();
+    const std::string cooked_texture_path = source_path + cooked_texture_file_extension;
+    if (true == _force_in)
+    {
+        std::error_code error_code;
+        std::filesystem::remove(cooked_texture_path, error_code);
+    }
+    else
+    {
+        bool          current = false;
+        CookedTexture cooked_texture;
+        timer.StartTimer();
+        MapCurrentCookedTexture(current, source_path.c_str(), cooked_texture, &_texture_options_in);
+        timer.StopTimer();
+        timer.TimerElapsedMs(_asset_report_in_out.hash_milliseconds);
+
+        if (true == current)
+        {
+            _asset_report_in_out.output_size_bytes    = cooked_texture.file.size_bytes;
+            _asset_report_in_out.image_width          = cooked_texture.levels[0].width;
+            _asset_report_in_out.image_height         = cooked_texture.levels[0].height;
+            _asset_report_in_out.image_channels       = cooked_texture.channel_count;
+            _asset_report_in_out.mip_level_count      = cooked_texture.levels.size();
+            _asset_report_in_out.texture_compressed   = cooked_texture.compressed;
+            _asset_report_in_out.texture_block_format = cooked_texture.block_format;
+            _asset_report_in_out.status               = CookStatus::UP_TO_DATE;
+            return;
+        }
+    }
+
+    // Note: The modification time is read before the image, such that a change made while it
+    //       is cooked leaves the cooked texture stale.
+    bool     success           = false;
+    uint64_t source_write_time = 0;
+    GetFileWriteTime(success, source_path.c_str(), source_write_time);
+
+    MappedFile source_file;
+    MapFileToMemory(success, source_path.c_str(), source_file);
+    if (false == success)
+    {
+        std::stringstream ss;
+        ss << "Unable to cook image: " << source_path;
+        Log_e(ss);
+        return;
+    }
+
+    uint64_t source_content_hash = 0;
+    timer.StartTimer();
+    HashMemory(source_content_hash, source_file.data, source_file.size_bytes);
+    timer.StopTimer();
+    timer.TimerElapsedMs(_asset_report_in_out.hash_milliseconds);
+
+    unsigned char* image_data = nullptr;
+    timer.StartTimer();
+    LoadImageToMemory(success,
+                      source_path.c_str(),
+                      &image_data,
+                      _asset_report_in_out.image_width,
+                      _asset_report_in_out.image_height,
+                      _asset_report_in_out.image_channels);
+    timer.StopTimer();
+    timer.TimerElapsedMs(_asset_report_in_out.import_milliseconds);
+
+    if (true == success)
+    {
+        timer.StartTimer();
+        WriteCookedTexture(success,
+                           cooked_texture_path.c_str(),
+                           source_file.size_bytes,
+                           source_content_hash,
+                           source_write_time,
+                           image_data,
+                           _asset_report_in_out.image_width,
+                           _asset_report_in_out.image_height,
+                           _asset_report_in_out.image_channels,
+                           _texture_options_in);
+        timer.StopTimer();
+        timer.TimerElapsedMs(_asset_report_in_out.write_milliseconds);
+    }
+
+    // Note: The full resolution level is decoded from the written file, and compared with the
+    //       image over the channels the block format stores.
+    if ((true == success) && (true == _texture_options_in.compress))
+    {
+        CookedTexture cooked_texture;
+        MapCookedTexture(success,
+                         cooked_texture_path.c_str(),
+                         source_file.size_bytes,
+                         source_content_hash,
+                         cooked_texture,
+                         &_texture_options_in);
+
+        std::vector<unsigned char> decompressed_image_data;
+        if (true == success)
+        {
+            DecompressImageBlocks(success,
+                                  cooked_texture.levels[0].data,
+                                  cooked_texture.levels[0].size_bytes,
+                                  cooked_texture.levels[0].width,
+                                  cooked_texture.levels[0].height,
+                                  cooked_texture.block_format,
+                                  decompressed_image_data);
+        }
+
+        if (true == success)
+        {
+            _asset_report_in_out.texture_compressed   = true;
+            _asset_report_in_out.texture_block_format = cooked_texture.block_format;
+            _asset_report_in_out.texture_psnr         = GetImagePsnr(
+              image_data,
+              decompressed_image_data.data(),
+              static_cast<size_t>(_asset_report_in_out.image_width) *
+                _asset_report_in_out.image_height,
+              cooked_texture.channel_count);
+        }
+    }
+
+    if (nullptr != image_data)
+    {
+        stbi_image_free(image_data);
+    }
+
+    if (false == success)
+    {
+        std::stringstream ss;
+        ss << "Unable to cook image: " << source_path;
+        Log_e(ss);
+        return;
+    }
+
+    _asset_report_in_out.output_size_bytes = std::filesystem::file_size(cooked_texture_path);
+    _asset_report_in_out.mip_level_count   = std::bit_width(static_cast<uint32_t>(
+      std::max(_asset_report_in_out.image_width, _asset_report_in_out.image_height)));
+    _asset_report_in_out.status = CookStatus::COOKED;
+}
+
+static void
+CookAsset(const bool&                 _force_in,
+          const CookedTextureOptions& _texture_options_in,
+          JobSystem* const            _job_system_in,
+          AssetReport&                _asset_report_in_out)
+{
+    Timer timer;
+    timer.StartTimer();
+
+    std::error_code error_code;
+    _asset_report_in_out.source_size_bytes = std::filesystem::file_size(
+      _asset_report_in_out.source_path, error_code);
+
+    if (AssetType::IMAGE == _asset_report_in_out.asset_type)
+    {
+        CookImage(_force_in, _texture_options_in, _asset_report_in_out);
+    }
+    else
+    {
+        CookMesh(_force_in, _job_system_in, _asset_report_in_out);
+    }
+
+    timer.StopTimer();
+    timer.TimerElapsedMs(_asset_report_in_out.total_milliseconds);
+}
+
+// Note: Every image within the atlas directory, sorted by path, such that atlases of the same
+//       images are packed alike.
+static void
+CollectAtlasImages(bool&                               _success_out,
+                   const std::filesystem::path&        _atlas_directory_in,
+                   std::vector<std::filesystem::path>& _image_paths_out)
+{
+    std::error_code error_code;
+    for (auto iterator = std::filesystem::recursive_directory_iterator(
+           _atlas_directory_in,
+           std::filesystem::directory_options::skip_permission_denied,
+           error_code);
+         (false == static_cast<bool>(error_code)) &&
+         (std::filesystem::recursive_directory_iterator() != iterator);
+         iterator.increment(error_code))
+    {
+        AssetType asset_type = AssetType::PLY_MESH;
+        if ((true == iterator->is_regular_file()) &&
+            (true == GetAssetType(iterator->path(), asset_type)) &&
+            (AssetType::IMAGE == asset_type))
+        {
+            _image_paths_out.push_back(iterator->path());
+        }
+    }
+
+    if (true == static_cast<bool>(error_code))
+    {
+        std::stringstream ss;
+        ss << "Unable to walk atlas directory: " << _atlas_directory_in.string() << std::endl
+           << "   Note: " << error_code.message();
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    std::sort(_image_paths_out.begin(), _image_paths_out.end());
+    _success_out = (false == _image_paths_out.empty());
+    if (false == _success_out)
+    {
+        std::stringstream ss;
+        ss << "Atlas directory has no images: " << _atlas_directory_in.string();
+        Log_e(ss);
+    }
+}
+
+// Note: `<directory>/../<name>.png` for the atlas directory `<name>.atlas`.
+static void
+GetAtlasImagePath(const std::filesystem::path& _atlas_directory_in,
+                  std::filesystem::path&       _atlas_image_path_out)
+{
+    _atlas_image_path_out = _atlas_directory_in.parent_path() / _atlas_directory_in.stem();
+    _atlas_image_path_out += ".png";
+}
+
+// Note: A current atlas is left as-is; its description provides the sizes for the manifest.
+static void
+CookAtlas(const bool&                _force_in,
+          const TextureAtlasOptions& _atlas_options_in,
+          ImageDecoder&              _image_decoder_in_out,
+          AssetReport&               _asset_report_in_out)
+{
+    Timer timer;
+
+    const std::filesystem::path& atlas_directory = _asset_report_in_out.source_path;
+    std::filesystem::path        atlas_image_path;
+    GetAtlasImagePath(atlas_directory, atlas_image_path);
+    const std::string atlas_image_path_string       = atlas_image_path.string();
+    const std::string atlas_description_path_string = atlas_image_path_string +
+                                                      texture_atlas_file_extension;
+
+    bool                               success = false;
+    std::vector<std::filesystem::path> image_paths;
+    CollectAtlasImages(success, atlas_directory, image_paths);
+    if (false == success)
+    {
+        std::stringstream ss;
+        ss << "Unable to cook atlas: " << atlas_directory.string();
+        Log_e(ss);
+        return;
+    }
+
+    // Note: The atlas is identified by the name and content of every image, and the options it
+    //       is built with.
+    std::vector<std::string> sub_image_names;
+    std::vector<uint64_t>    source_hashes;
+    timer.StartTimer();
+    for (const std::filesystem::path& image_path : image_paths)
+    {
+        MappedFile image_file;
+        MapFileToMemory(success, image_path.string().c_str(), image_file);
+        if (false == success)
+        {
+            std::stringstream ss;
+            ss << "Unable to cook atlas: " << atlas_directory.string() << std::endl
+               << "   Note: Unable to read " << image_path.string();
+            Log_e(ss);
+            return;
+        }
+
+        sub_image_names.push_back(image_path.lexically_relative(atlas_directory).generic_string());
+
+        uint64_t content_hash = 0;
+        uint64_t name_hash    = 0;
+        HashMemory(content_hash, image_file.data, image_file.size_bytes);
+        HashMemory(name_hash, sub_image_names.back().data(), sub_image_names.back().size());
+        source_hashes.push_back(content_hash);
+        source_hashes.push_back(name_hash);
+        _asset_report_in_out.source_size_bytes += image_file.size_bytes;
+    }
+    source_hashes.push_back(texture_atlas_version);
+    source_hashes.push_back(static_cast<uint64_t>(_atlas_options_in.mip_safe_level_count));
+    source_hashes.push_back(static_cast<uint64_t>(_atlas_options_in.max_dimension));
+
+    uint64_t source_content_hash = 0;
+    HashMemory(source_content_hash,
+               source_hashes.data(),
+               source_hashes.size() * sizeof(uint64_t));
+    timer.StopTimer();
+    timer.TimerElapsedMs(_asset_report_in_out.hash_milliseconds);
+
+    if (false == _force_in)
+    {
+        bool         current = false;
+        TextureAtlas texture_atlas;
+        ReadTextureAtlas(current, atlas_image_path_string.c_str(), texture_atlas);
+
+        bool image_exists = false;
+        bool image_empty  = true;
+        FileExistsOrEmpty(atlas_image_path_string.c_str(), image_exists, image_empty);
+        if ((true == current) && (source_content_hash == texture_atlas.source_content_hash) &&
+            (true == image_exists) && (false == image_empty))
+        {
+            _asset_report_in_out.output_size_bytes = std::filesystem::file_size(
+                                                       atlas_image_path_string) +
+                                                     std::filesystem::file_size(
+                                                       atlas_description_path_string);
+            _asset_report_in_out.image_width     = texture_atlas.width;
+            _asset_report_in_out.image_height    = texture_atlas.height;
+            _asset_report_in_out.sub_image_count = texture_atlas.sub_images.size();
+            _asset_report_in_out.status          = CookStatus::UP_TO_DATE;
+            return;
+        }
+    }
+
+    std::vector<ImageDecodeRequest> requests;
+    for (const std::filesystem::path& image_path : image_paths)
+    {
+        requests.push_back({ image_path.string() });
+    }
+
+    std::vector<DecodedImage> decoded_images;
+    timer.StartTimer();
+    _image_decoder_in_out.DecodeImages(success, requests, decoded_images);
+    timer.StopTimer();
+    timer.TimerElapsedMs(_asset_report_in_out.import_milliseconds);
+
+    TextureAtlas texture_atlas;
+    timer.StartTimer();
+    if (true == success)
+    {
+        std::vector<TextureAtlasSource> sources;
+        for (size_t index = 0; index < decoded_images.size(); index++)
+        {
+            sources.push_back({ sub_image_names[index],
+                                decoded_images[index].image_data,
+                                decoded_images[index].image_width,
+                                decoded_images[index].image_height });
+        }
+
+        BuildTextureAtlas(success, sources, _atlas_options_in, texture_atlas);
+    }
+
+    for (DecodedImage& decoded_image : decoded_images)
+    {
+        ReleaseDecodedImage(decoded_image);
+    }
+
+    if (true == success)
+    {
+        texture_atlas.source_content_hash = source_content_hash;
+        WriteTextureAtlas(success, atlas_image_path_string.c_str(), texture_atlas);
+    }
+    timer.StopTimer();
+    timer.TimerElapsedMs(_asset_report_in_out.write_milliseconds);
+
+    if (false == success)
+    {
+        std::stringstream ss;
+        ss << "Unable to cook atlas: " << atlas_directory.string();
+        Log_e(ss);
+        return;
+    }
+
+    _asset_report_in_out.output_size_bytes = std::filesystem::file_size(atlas_image_path_string) +
+                                             std::filesystem::file_size(
+                                               atlas_description_path_string);
+    _asset_report_in_out.image_width       = texture_atlas.width;
+    _asset_report_in_out.image_height      = texture_atlas.height;
+    _asset_report_in_out.sub_image_count   = texture_atlas.sub_images.size();
+    _asset_report_in_out.status            = CookStatus::COOKED;
+}
+
+// Note: Cooks every atlas on the main thread, decoding the images of each in parallel, then
+//       collects the atlas images written for the first time, such that they are cooked along
+//       with every other image.
+static void
+CookAtlases(const CookerOptions& _options_in, std::vector<AssetReport>& _asset_reports_in_out)
+{
+    const bool has_atlases = std::any_of(
+      _asset_reports_in_out.begin(),
+      _asset_reports_in_out.end(),
+      [](const AssetReport& _asset_report_in)
+      { return AssetType::ATLAS == _asset_report_in.asset_type; });
+    if (false == has_atlases)
+    {
+        return;
+    }
+
+    bool         success = false;
+    ImageDecoder image_decoder;
+    image_decoder.Start(success, std::move(_options_in.thread_count));
+    if (false == success)
+    {
+        Log_e("Unable to start the image decoder; no atlas was cooked.");
+        return;
+    }
+
+    std::vector<AssetReport> atlas_image_reports;
+    for (AssetReport& asset_report : _asset_reports_in_out)
+    {
+        if (AssetType::ATLAS != asset_report.asset_type)
+        {
+            continue;
+        }
+
+        Timer timer;
+        timer.StartTimer();
+        CookAtlas(_options_in.force, _options_in.atlas_options, image_decoder, asset_report);
+        timer.StopTimer();
+        timer.TimerElapsedMs(asset_report.total_milliseconds);
+
+        if (CookStatus::FAILED == asset_report.status)
+        {
+            continue;
+        }
+
+        AssetReport atlas_image_report;
+        GetAtlasImagePath(asset_report.source_path, atlas_image_report.source_path);
+        atlas_image_report.asset_type    = AssetType::IMAGE;
+        const bool atlas_image_collected = std::any_of(
+          _asset_reports_in_out.begin(),
+          _asset_reports_in_out.end(),
+          [&atlas_image_report](const AssetReport& _asset_report_in)
+          { return atlas_image_report.source_path == _asset_report_in.source_path; });
+        if (false == atlas_image_collected)
+        {
+            atlas_image_reports.push_back(atlas_image_report);
+        }
+    }
+
+    image_decoder.Stop();
+
+    _asset_reports_in_out.insert(_asset_reports_in_out.end(),
+                                 atlas_image_reports.begin(),
+                                 atlas_image_reports.end());
+    SortAssetReports(_asset_reports_in_out);
+}
+
+static void
+WriteJsonString(std::ostream& _stream_in_out, const std::string& _string_in)
+{
+    _stream_in_out << '"';
+    for (const char character : _string_in)
+    {
+        if (('"' == character) || ('\\' == character))
+        {
+            _stream_in_out << '\\' << character;
+        }
+        else if (0x20 > static_cast<unsigned char>(character))
+        {
+            _stream_in_out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                           << static_cast<int>(character) << std::dec << std::setfill(' ');
+        }
+        else
+        {
+            _stream_in_out << character;
+        }
+    }
+    _stream_in_out << '"';
+}
+
+static void
+WriteManifest(bool&                           _success_out,
+              const CookerOptions&            _options_in,
+              const std::vector<AssetReport>& _asset_reports_in,
+              const size_t&                   _thread_count_in,
+              const float&                    _total_milliseconds_in)
+{
+    constexpr const char* const asset_type_names[]  = { "ply_mesh", "obj_mesh", "glb_mesh",
+                                                        "image",    "atlas" };
+    constexpr const char* const cook_status_names[] = { "failed", "cooked", "up_to_date" };
+    constexpr const char* const block_format_names[] = { "bc1", "bc3", "bc5", "bc7" };
+
+    std::stringstream manifest_ss;
+    manifest_ss << std::fixed << std::setprecision(3) << "{\n  \"asset_directory\": ";
+    WriteJsonString(manifest_ss, _options_in.asset_directory.generic_string());
+    manifest_ss << ",\n  \"thread_count\": " << _thread_count_in
+                << ",\n  \"total_milliseconds\": " << _total_milliseconds_in
+                << ",\n  \"assets\": [";
+
+    for (size_t asset_index = 0; asset_index < _asset_reports_in.size(); asset_index++)
+    {
+        const AssetReport& asset_report = _asset_reports_in[asset_index];
+
+        // Note: Outputs smaller than their source have a size ratio below one.
+        const double size_ratio = (0 == asset_report.source_size_bytes)
+                                    ? 0.0
+                                    : static_cast<double>(asset_report.output_size_bytes) /
+                                        static_cast<double>(asset_report.source_size_bytes);
+
+        manifest_ss << ((0 == asset_index) ? "\n" : ",\n") << "    {\n      \"path\": ";
+        WriteJsonString(manifest_ss,
+                        asset_report.source_path.lexically_relative(_options_in.asset_directory)
+                          .generic_string());
+        manifest_ss
+          << ",\n      \"type\": \""
+          << asset_type_names[static_cast<size_t>(asset_report.asset_type)] << "\""
+          << ",\n      \"status\": \""
+          << cook_status_names[static_cast<size_t>(asset_report.status)] << "\""
+          << ",\n      \"source_bytes\": " << asset_report.source_size_bytes
+          << ",\n      \"output_bytes\": " << asset_report.output_size_bytes
+          << ",\n      \"output_to_source_ratio\": " << size_ratio;
+
+        if (AssetType::IMAGE == asset_report.asset_type)
+        {
+            manifest_ss << ",\n      \"width\": " << asset_report.image_width
+                        << ",\n      \"height\": " << asset_report.image_height
+                        << ",\n      \"channels\": " << asset_report.image_channels
+                        << ",\n      \"mip_levels\": " << asset_report.mip_level_count;
+
+            if (true == asset_report.texture_compressed)
+            {
+                manifest_ss
+                  << ",\n      \"compression\": \""
+                  << block_format_names[static_cast<size_t>(asset_report.texture_block_format)]
+                  << "\"";
+            }
+
+            // Note: Textures that were up to date were not decoded, and so not compared. JSON
+            //       has no infinity; identical images are reported as null.
+            if ((true == asset_report.texture_compressed) &&
+                (CookStatus::COOKED == asset_report.status))
+            {
+                manifest_ss << ",\n      \"psnr_db\": ";
+                if (true == std::isinf(asset_report.texture_psnr))
+                {
+                    manifest_ss << "null";
+                }
+                else
+                {
+                    manifest_ss << asset_report.texture_psnr;
+                }
+            }
+        }
+        else if (AssetType::ATLAS == asset_report.asset_type)
+        {
+            manifest_ss << ",\n      \"width\": " << asset_report.image_width
+                        << ",\n      \"height\": " << asset_report.image_height
+                        << ",\n      \"sub_images\": " << asset_report.sub_image_count;
+        }
+        else
+        {
+            manifest_ss << ",\n      \"vertices\": " << asset_report.vertex_count
+                        << ",\n      \"triangles\": " << asset_report.triangle_count
+                        << ",\n      \"meshlets\": " << asset_report.meshlet_count
+                        << ",\n      \"vertex_bytes\": " << asset_report.vertex_data_size_bytes;
+
+            // Note: Meshes that were up to date were not loaded, and so not quantized.
+            if (CookStatus::COOKED == asset_report.status)
+            {
+                manifest_ss << ",\n      \"quantized_vertex_bytes\": "
+                            << asset_report.quantized_vertex_size_bytes;
+            }
+        }
+
+        manifest_ss << ",\n      \"milliseconds\": { \"hash\": " << asset_report.hash_milliseconds
+                    << ", \"import\": " << asset_report.import_milliseconds
+                    << ", \"quantize\": " << asset_report.quantize_milliseconds
+                    << ", \"write\": " << asset_report.write_milliseconds
+                    << ", \"total\": " << asset_report.total_milliseconds << " }\n    }";
+    }
+
+    manifest_ss << "\n  ]\n}\n";
+
+    const std::string manifest = manifest_ss.str();
+    std::ofstream     file_stream(_options_in.manifest_path, std::ios::binary | std::ios::trunc);
+    file_stream.write(manifest.data(), manifest.size());
+
+    _success_out = file_stream.good();
+    if (false == _success_out)
+    {
+        std::stringstream ss;
+        ss << "Unable to write manifest: " << _options_in.manifest_path.string();
+        Log_e(ss);
+    }
+}
+
+int
+main(int argc, char** argv)
+{
+    bool          success = false;
+    CookerOptions options;
+    ParseCookerArguments(success, argc, argv, options);
+    if (false == success)
+    {
+        return EXIT_FAILURE;
+    }
+
+    Timer timer;
+    timer.StartTimer();
+
+    std::vector<AssetReport> asset_reports;
+    CollectAssets(success, options.asset_directory, asset_reports);
+    if (false == success)
+    {
+        return EXIT_FAILURE;
+    }
+
+    CookAtlases(options, asset_reports);
+
+    JobSystem job_system;
+    job_system.Start(success, std::move(options.thread_count));
+    if (false == success)
+    {
+        return EXIT_FAILURE;
+    }
+
+    // Note: Each job owns exactly one report; the vector is not resized while jobs run. Atlases
+    //       were cooked above.
+    for (auto& asset_report : asset_reports)
+    {
+        if (AssetType::ATLAS == asset_report.asset_type)
+        {
+            continue;
+        }
+
+        AssetReport* const          asset_report_pointer = &asset_report;
+        const bool                  force                = options.force;
+        const CookedTextureOptions& texture_options      = options.texture_options;
+        JobSystem* const            job_system_pointer   = &job_system;
+        job_system.Submit(
+          [asset_report_pointer, force, texture_options, job_system_pointer]()
+          { CookAsset(force, texture_options, job_system_pointer, *asset_report_pointer); });
+    }
+
+    job_system.Wait();
+    const size_t thread_count = job_system.GetThreadCount();
+    job_system.Stop();
+
+    timer.StopTimer();
+    float total_milliseconds = 0.0f;
+    timer.TimerElapsedMs(total_milliseconds);
+
+    size_t status_counts[3] = { 0 };
+    for (auto& asset_report : asset_reports)
+    {
+        status_counts[static_cast<size_t>(asset_report.status)]++;
+    }
+
+    WriteManifest(success, options, asset_reports, thread_count, total_milliseconds);
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << "Asset cooking complete." << std::endl
+       << "   Directory:  " << options.asset_directory.string() << std::endl
+       << "   Manifest:   " << options.manifest_path.string() << std::endl
+       << "   Threads:    " << thread_count << std::endl
+       << "   Cooked:     " << status_counts[static_cast<size_t>(CookStatus::COOKED)] << std::endl
+       << "   Up to date: " << status_counts[static_cast<size_t>(CookStatus::UP_TO_DATE)]
+       << std::endl
+       << "   Failed:     " << status_counts[static_cast<size_t>(CookStatus::FAILED)] << std::endl
+       << "   Time:       " << total_milliseconds << " ms";
+    Log_i(ss);
+
+    const bool all_succeeded = (true == success) &&
+                               (0 == status_counts[static_cast<size_t>(CookStatus::FAILED)]);
+    return (true == all_succeeded) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
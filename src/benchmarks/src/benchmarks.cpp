@@ -0,0 +1,2056 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "block_compression.h"
+#include "bounds.h"
+#include "cooked_texture.h"
+#include "fileio.h"
+#include "gltf.h"
+#include "image_decoding.h"
+#include "image_tools.h"
+#include "job_system.h"
+#include "logging.h"
+#include "mesh_codec.h"
+#include "meshlet.h"
+#include "mip_generator.h"
+#include "model.h"
+#include "tangent_space.h"
+#include "timer.h"
+
+// Note: Paths are relative to the bin directory, where each application is run from.
+constexpr const char* const blender_monkey_ply_path =
+  "./../src/common/test_assets/blender_monkey.ply";
+constexpr const char* const brick_png_path = "./../src/common/test_assets/brick.png";
+
+// Note: Converted and synthetic assets are written next to the binary and reused across runs.
+constexpr const char* const blender_monkey_glb_path    = "./benchmark_blender_monkey.glb";
+constexpr const char* const synthetic_ply_path         = "./benchmark_synthetic_10m.ply";
+constexpr size_t            synthetic_ply_vertex_count = 10'000'000;
+constexpr const char* const synthetic_typed_ply_path   = "./benchmark_synthetic_typed_10m.ply";
+constexpr const char* const benchmark_brick_png_path   = "./benchmark_brick.png";
+constexpr const char* const synthetic_png_path         = "./benchmark_synthetic_2048.png";
+constexpr int               synthetic_png_size         = 2048;
+
+// Attribute indices are irrelevant to the CPU-side benchmarks but required for import.
+constexpr GLuint benchmark_vao_id                            = 1;
+constexpr GLuint benchmark_position_attribute_index          = 0;
+constexpr GLuint benchmark_normal_attribute_index            = 1;
+constexpr GLuint benchmark_texture_coordinate_attribute_index = 2;
+constexpr GLuint benchmark_tangent_attribute_index           = 3;
+
+struct Benchmark
+{
+    const char* const                name;
+    const std::function<void(bool&)> run;
+};
+
+// Writes an ascii PLY grid of (at least) _vertex_count_in vertices, two triangles per grid cell.
+static void
+WriteSyntheticAsciiPlyFile(bool&             _success_out,
+                           const char* const _file_path_in,
+                           const size_t&&    _vertex_count_in)
+{
+    _success_out = true;
+
+    const size_t grid_width  = static_cast<size_t>(std::ceil(std::sqrt(_vertex_count_in)));
+    const size_t grid_height = (_vertex_count_in + grid_width - 1) / grid_width;
+    const size_t face_count  = (grid_width - 1) * (grid_height - 1) * 2;
+
+    std::ofstream file_stream(_file_path_in, std::ios::binary | std::ios::trunc);
+    if (false == file_stream.is_open())
+    {
+        std::stringstream ss;
+        ss << "Unable to open synthetic benchmark file for writing: " << _file_path_in;
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    file_stream << "ply\n"
+                << "format ascii 1.0\n"
+                << "comment Synthetic benchmark grid\n"
+                << "element vertex " << grid_width * grid_height << "\n"
+                << "property float x\nproperty float y\nproperty float z\n"
+                << "property float nx\nproperty float ny\nproperty float nz\n"
+                << "property float s\nproperty float t\n"
+                << "element face " << face_count << "\n"
+                << "property list uchar uint vertex_indices\n"
+                << "end_header\n";
+
+    constexpr size_t flush_threshold_bytes = 1 << 20;
+    std::string      line_buffer;
+    line_buffer.reserve(flush_threshold_bytes + 256);
+
+    char number_buffer[32];
+    auto append_float = [&](const float& _value_in, const char&& _separator_in)
+    {
+        const std::to_chars_result result = std::to_chars(number_buffer,
+                                                          number_buffer + sizeof(number_buffer),
+                                                          _value_in,
+                                                          std::chars_format::fixed,
+                                                          6);
+        line_buffer.append(number_buffer, result.ptr);
+        line_buffer.push_back(_separator_in);
+    };
+
+    auto append_unsigned = [&](const size_t& _value_in, const char&& _separator_in)
+    {
+        const std::to_chars_result result = std::to_chars(number_buffer,
+                                                          number_buffer + sizeof(number_buffer),
+                                                          _value_in);
+        line_buffer.append(number_buffer, result.ptr);
+        line_buffer.push_back(_separator_in);
+    };
+
+    auto flush_if_full = [&]()
+    {
+        if (flush_threshold_bytes <= line_buffer.size())
+        {
+            file_stream.write(line_buffer.data(), line_buffer.size());
+            line_buffer.clear();
+        }
+    };
+
+    const float inverse_width  = 1.0f / static_cast<float>(grid_width - 1);
+    const float inverse_height = 1.0f / static_cast<float>(grid_height - 1);
+    for (size_t row = 0; row < grid_height; row++)
+    {
+        for (size_t column = 0; column < grid_width; column++)
+        {
+            const float s = static_cast<float>(column) * inverse_width;
+            const float t = static_cast<float>(row) * inverse_height;
+
+            append_float(s * 2.0f - 1.0f, ' ');
+            append_float(t * 2.0f - 1.0f, ' ');
+            append_float(0.05f * std::sin(s * 40.0f) * std::cos(t * 40.0f), ' ');
+            append_float(0.0f, ' ');
+            append_float(0.0f, ' ');
+            append_float(1.0f, ' ');
+            append_float(s, ' ');
+            append_float(t, '\n');
+            flush_if_full();
+        }
+    }
+
+    for (size_t row = 0; row < (grid_height - 1); row++)
+    {
+        for (size_t column = 0; column < (grid_width - 1); column++)
+        {
+            const size_t top_left     = (row * grid_width) + column;
+            const size_t bottom_left  = top_left + grid_width;
+            const size_t top_right    = top_left + 1;
+            const size_t bottom_right = bottom_left + 1;
+
+            line_buffer.append("3 ");
+            append_unsigned(top_left, ' ');
+            append_unsigned(bottom_left, ' ');
+            append_unsigned(top_right, '\n');
+
+            line_buffer.append("3 ");
+            append_unsigned(top_right, ' ');
+            append_unsigned(bottom_left, ' ');
+            append_unsigned(bottom_right, '\n');
+            flush_if_full();
+        }
+    }
+
+    file_stream.write(line_buffer.data(), line_buffer.size());
+    if (false == file_stream.good())
+    {
+        std::stringstream ss;
+        ss << "Unable to write synthetic benchmark file: " << _file_path_in;
+        Log_e(ss);
+        _success_out = false;
+    }
+}
+
+// Writes the grid of WriteSyntheticAsciiPlyFile(...) as binary little endian, with the property
+// mix of scanner and photogrammetry exports: double attributes, uchar colors and int indices.
+static void
+WriteSyntheticTypedBinaryPlyFile(bool&             _success_out,
+                                 const char* const _file_path_in,
+                                 const size_t&&    _vertex_count_in)
+{
+    _success_out = true;
+
+    const size_t grid_width  = static_cast<size_t>(std::ceil(std::sqrt(_vertex_count_in)));
+    const size_t grid_height = (_vertex_count_in + grid_width - 1) / grid_width;
+    const size_t face_count  = (grid_width - 1) * (grid_height - 1) * 2;
+
+    std::ofstream file_stream(_file_path_in, std::ios::binary | std::ios::trunc);
+    if (false == file_stream.is_open())
+    {
+        std::stringstream ss;
+        ss << "Unable to open synthetic benchmark file for writing: " << _file_path_in;
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    file_stream << "ply\n"
+                << "format binary_little_endian 1.0\n"
+                << "comment Synthetic benchmark grid\n"
+                << "element vertex " << grid_width * grid_height << "\n"
+                << "property double x\nproperty double y\nproperty double z\n"
+                << "property double nx\nproperty double ny\nproperty double nz\n"
+                << "property double s\nproperty double t\n"
+                << "property uchar red\nproperty uchar green\nproperty uchar blue\n"
+                << "property uchar alpha\n"
+                << "element face " << face_count << "\n"
+                << "property list uchar int vertex_indices\n"
+                << "end_header\n";
+
+    // Note: Records are written as the host lays them out; this is little endian on every
+    //       platform the engine builds for.
+    static_assert(std::endian::little == std::endian::native);
+
+    constexpr size_t           flush_threshold_bytes = 1 << 20;
+    std::vector<unsigned char> record_buffer;
+    record_buffer.reserve(flush_threshold_bytes + 256);
+
+    auto append_value = [&](const void* const _value_in, const size_t&& _size_bytes_in)
+    {
+        const unsigned char* const value = static_cast<const unsigned char*>(_value_in);
+        record_buffer.insert(record_buffer.end(), value, value + _size_bytes_in);
+    };
+
+    auto flush_if_full = [&]()
+    {
+        if (flush_threshold_bytes <= record_buffer.size())
+        {
+            file_stream.write(reinterpret_cast<const char*>(record_buffer.data()),
+                              record_buffer.size());
+            record_buffer.clear();
+        }
+    };
+
+    const double inverse_width  = 1.0 / static_cast<double>(grid_width - 1);
+    const double inverse_height = 1.0 / static_cast<double>(grid_height - 1);
+    for (size_t row = 0; row < grid_height; row++)
+    {
+        for (size_t column = 0; column < grid_width; column++)
+        {
+            const double        s         = static_cast<double>(column) * inverse_width;
+            const double        t         = static_cast<double>(row) * inverse_height;
+            const double        values[8] = { s * 2.0 - 1.0,
+                                              t * 2.0 - 1.0,
+                                              0.05 * std::sin(s * 40.0) * std::cos(t * 40.0),
+                                              0.0,
+                                              0.0,
+                                              1.0,
+                                              s,
+                                              t };
+            const unsigned char color[4]  = { static_cast<unsigned char>(s * 255.0),
+                                              static_cast<unsigned char>(t * 255.0),
+                                              128,
+                                              255 };
+            append_value(values, sizeof(values));
+            append_value(color, sizeof(color));
+            flush_if_full();
+        }
+    }
+
+    for (size_t row = 0; row < (grid_height - 1); row++)
+    {
+        for (size_t column = 0; column < (grid_width - 1); column++)
+        {
+            const int32_t top_left     = static_cast<int32_t>((row * grid_width) + column);
+            const int32_t bottom_left  = top_left + static_cast<int32_t>(grid_width);
+            const int32_t top_right    = top_left + 1;
+            const int32_t bottom_right = bottom_left + 1;
+
+            const unsigned char corner_count = 3;
+            const int32_t       faces[2][3]  = { { top_left, bottom_left, top_right },
+                                                 { top_right, bottom_left, bottom_right } };
+            append_value(&corner_count, sizeof(corner_count));
+            append_value(faces[0], sizeof(faces[0]));
+            append_value(&corner_count, sizeof(corner_count));
+            append_value(faces[1], sizeof(faces[1]));
+            flush_if_full();
+        }
+    }
+
+    file_stream.write(reinterpret_cast<const char*>(record_buffer.data()), record_buffer.size());
+    if (false == file_stream.good())
+    {
+        std::stringstream ss;
+        ss << "Unable to write synthetic benchmark file: " << _file_path_in;
+        Log_e(ss);
+        _success_out = false;
+    }
+}
+
+// Reports the best and mean load throughput of LoadModelFromPlyFile(...) in MB/s of PLY source.
+// Note: When `_use_cooked_mesh_in` is set, an untimed load first ensures the cooked mesh exists.
+static void
+BenchmarkPlyLoadThroughput(bool&             _success_out,
+                           const char* const _ply_file_path_in,
+                           const size_t&&    _iteration_count_in,
+                           const bool&&      _use_cooked_mesh_in,
+                           JobSystem* const  _job_system_in)
+{
+    _success_out = true;
+
+    bool file_exists = false;
+    bool file_empty  = true;
+    FileExistsOrEmpty(_ply_file_path_in, file_exists, file_empty);
+    if ((false == file_exists) || (true == file_empty))
+    {
+        std::stringstream ss;
+        ss << "Benchmark input does not exist or is empty: " << _ply_file_path_in;
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    const double file_size_megabytes = static_cast<double>(
+                                         std::filesystem::file_size(_ply_file_path_in)) /
+                                       (1024.0 * 1024.0);
+
+    size_t                                      vertex_count = 0;
+    std::vector<float>                          buffer_data;
+    std::vector<GLuint>                         buffer_elements_array;
+    GLenum                                      element_data_type = GL_UNSIGNED_INT;
+    std::vector<Meshlet>                        meshlets;
+    BoundingVolume                              bounding_volume;
+    std::vector<glt::VertexDataType>            vertex_data_type_order;
+    std::vector<glt::VertexAttributeDescriptor> vertex_attribute_pointers;
+
+    Timer timer;
+    float elapsed_milliseconds      = 0.0f;
+    float best_elapsed_milliseconds = std::numeric_limits<float>::max();
+    float total_elapsed_millseconds = 0.0f;
+    const size_t total_iteration_count = _iteration_count_in + (_use_cooked_mesh_in ? 1 : 0);
+    for (size_t iteration = 0; iteration < total_iteration_count; iteration++)
+    {
+        vertex_attribute_pointers.clear();
+
+        timer.StartTimer();
+        LoadModelFromPlyFile(_success_out,
+                             std::move(benchmark_vao_id),
+                             _ply_file_path_in,
+                             std::move(benchmark_position_attribute_index),
+                             std::move(benchmark_normal_attribute_index),
+                             std::move(benchmark_texture_coordinate_attribute_index),
+                             std::move(benchmark_tangent_attribute_index),
+                             vertex_count,
+                             buffer_data,
+                             buffer_elements_array,
+                             element_data_type,
+                             meshlets,
+                             bounding_volume,
+                             vertex_data_type_order,
+                             vertex_attribute_pointers,
+                             std::move(_use_cooked_mesh_in),
+                             _job_system_in);
+        timer.StopTimer();
+
+        if (false == _success_out)
+        {
+            Log_e("Benchmark model failed to load.");
+            return;
+        }
+
+        if ((true == _use_cooked_mesh_in) && (0 == iteration))
+        {
+            continue;
+        }
+
+        timer.TimerElapsedMs(elapsed_milliseconds);
+        best_elapsed_milliseconds = std::min(best_elapsed_milliseconds, elapsed_milliseconds);
+        total_elapsed_millseconds += elapsed_milliseconds;
+    }
+
+    const double mean_elapsed_milliseconds = total_elapsed_millseconds /
+                                             static_cast<double>(_iteration_count_in);
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << "[ benchmark ] PLY load throughput" << std::endl
+       << "   File:       " << _ply_file_path_in << std::endl
+       << "   Size:       " << file_size_megabytes << " MB" << std::endl
+       << "   Vertices:   " << vertex_count << std::endl
+       << "   Faces:      " << buffer_elements_array.size() / 3 << std::endl
+       << "   Cooked:     " << (_use_cooked_mesh_in ? "yes" : "no") << std::endl
+       << "   Threads:    "
+       << ((nullptr == _job_system_in) ? 1 : _job_system_in->GetThreadCount()) << std::endl
+       << "   Iterations: " << _iteration_count_in << std::endl
+       << "   Best:       " << best_elapsed_milliseconds << " ms ("
+       << file_size_megabytes / (best_elapsed_milliseconds / 1000.0) << " MB/s)" << std::endl
+       << "   Mean:       " << mean_elapsed_milliseconds << " ms ("
+       << file_size_megabytes / (mean_elapsed_milliseconds / 1000.0) << " MB/s)";
+    Log_i(ss);
+}
+
+static void
+BenchmarkPlyParseBlenderMonkey(bool& _success_out)
+{
+    BenchmarkPlyLoadThroughput(_success_out, blender_monkey_ply_path, 200, false, nullptr);
+}
+
+static void
+BenchmarkCookedMeshLoadBlenderMonkey(bool& _success_out)
+{
+    BenchmarkPlyLoadThroughput(_success_out, blender_monkey_ply_path, 200, true, nullptr);
+}
+
+static void
+EnsureSyntheticAsciiPlyFile(bool& _success_out)
+{
+    _success_out = true;
+
+    bool file_exists = false;
+    bool file_empty  = true;
+    FileExistsOrEmpty(synthetic_ply_path, file_exists, file_empty);
+    if ((false == file_exists) || (true == file_empty))
+    {
+        Log_i("Writing synthetic 10M vertex PLY benchmark file...");
+        WriteSyntheticAsciiPlyFile(_success_out,
+                                   synthetic_ply_path,
+                                   std::move(synthetic_ply_vertex_count));
+    }
+}
+
+static void
+BenchmarkPlyParseSynthetic(bool& _success_out)
+{
+    EnsureSyntheticAsciiPlyFile(_success_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    BenchmarkPlyLoadThroughput(_success_out, synthetic_ply_path, 3, false, nullptr);
+}
+
+static void
+BenchmarkCookedMeshLoadSynthetic(bool& _success_out)
+{
+    EnsureSyntheticAsciiPlyFile(_success_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    BenchmarkPlyLoadThroughput(_success_out, synthetic_ply_path, 3, true, nullptr);
+}
+
+// Note: Every vertex property and face index of this file is converted; none may be copied.
+static void
+BenchmarkPlyParseSyntheticTyped(bool& _success_out)
+{
+    _success_out = true;
+
+    bool file_exists = false;
+    bool file_empty  = true;
+    FileExistsOrEmpty(synthetic_typed_ply_path, file_exists, file_empty);
+    if ((false == file_exists) || (true == file_empty))
+    {
+        Log_i("Writing synthetic 10M vertex typed binary PLY benchmark file...");
+        WriteSyntheticTypedBinaryPlyFile(_success_out,
+                                         synthetic_typed_ply_path,
+                                         std::move(synthetic_ply_vertex_count));
+        if (false == _success_out)
+        {
+            return;
+        }
+    }
+
+    BenchmarkPlyLoadThroughput(_success_out, synthetic_typed_ply_path, 3, false, nullptr);
+}
+
+// Note: Parses the synthetic file serially, then on 2, 4, 8 and 16 threads.
+static void
+BenchmarkPlyParseSyntheticThreadScaling(bool& _success_out)
+{
+    EnsureSyntheticAsciiPlyFile(_success_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    for (size_t thread_count = 1; thread_count <= 16; thread_count *= 2)
+    {
+        JobSystem job_system;
+        job_system.Start(_success_out, std::move(thread_count));
+        if (false == _success_out)
+        {
+            return;
+        }
+
+        BenchmarkPlyLoadThroughput(_success_out, synthetic_ply_path, 3, false, &job_system);
+        job_system.Stop();
+        if (false == _success_out)
+        {
+            return;
+        }
+    }
+}
+
+// Note: Counts the triangles of `_elements_in` which are front facing (counter-clockwise) from
+//       `_camera_position_in` and not entirely outside any one frustum plane. Meshlet culling must
+//       never remove one of these.
+static size_t
+CountVisibleTriangles(const std::vector<float>&  _vertex_data_in,
+                      const size_t&              _floats_per_vertex_in,
+                      const std::vector<GLuint>& _elements_in,
+                      const glm::mat4&           _view_projection_in,
+                      const glm::vec3&           _camera_position_in)
+{
+    glm::vec4 frustum_planes[6];
+    ExtractFrustumPlanes(_view_projection_in, frustum_planes);
+
+    size_t visible_triangle_count = 0;
+    for (size_t element_index = 0; element_index < _elements_in.size(); element_index += 3)
+    {
+        glm::vec3 corners[3];
+        for (size_t corner = 0; corner < 3; corner++)
+        {
+            const float* const position =
+              &_vertex_data_in[_elements_in[element_index + corner] * _floats_per_vertex_in];
+            corners[corner] = glm::vec3(position[0], position[1], position[2]);
+        }
+
+        const glm::vec3 normal = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+        if (0.0f >= glm::dot(normal, _camera_position_in - corners[0]))
+        {
+            continue;
+        }
+
+        bool outside_frustum = false;
+        for (auto& plane : frustum_planes)
+        {
+            if (((glm::dot(glm::vec3(plane), corners[0]) + plane.w) < 0.0f) &&
+                ((glm::dot(glm::vec3(plane), corners[1]) + plane.w) < 0.0f) &&
+                ((glm::dot(glm::vec3(plane), corners[2]) + plane.w) < 0.0f))
+            {
+                outside_frustum = true;
+                break;
+            }
+        }
+
+        if (false == outside_frustum)
+        {
+            visible_triangle_count++;
+        }
+    }
+
+    return visible_triangle_count;
+}
+
+// Note: Culls the monkey's meshlets from several camera positions, reporting the triangles
+//       submitted after culling against the triangles that are actually visible.
+static void
+BenchmarkMeshletCullingBlenderMonkey(bool& _success_out)
+{
+    size_t                                      vertex_count = 0;
+    std::vector<float>                          buffer_data;
+    std::vector<GLuint>                         buffer_elements_array;
+    GLenum                                      element_data_type = GL_UNSIGNED_INT;
+    std::vector<Meshlet>                        meshlets;
+    BoundingVolume                              bounding_volume;
+    std::vector<glt::VertexDataType>            vertex_data_type_order;
+    std::vector<glt::VertexAttributeDescriptor> vertex_attribute_pointers;
+    LoadModelFromPlyFile(_success_out,
+                         std::move(benchmark_vao_id),
+                         blender_monkey_ply_path,
+                         std::move(benchmark_position_attribute_index),
+                         std::move(benchmark_normal_attribute_index),
+                         std::move(benchmark_texture_coordinate_attribute_index),
+                         std::move(benchmark_tangent_attribute_index),
+                         vertex_count,
+                         buffer_data,
+                         buffer_elements_array,
+                         element_data_type,
+                         meshlets,
+                         bounding_volume,
+                         vertex_data_type_order,
+                         vertex_attribute_pointers);
+
+    if (false == _success_out)
+    {
+        Log_e("Benchmark model failed to load.");
+        return;
+    }
+
+    // Note: The cull itself does not depend on the attribute layout, but the ground truth reads
+    //       positions directly; the importer places them first.
+    for (auto& descriptor : vertex_attribute_pointers)
+    {
+        if ((glt::VertexDataType::POSITION == descriptor.vertex_data_type) &&
+            (nullptr != descriptor.first_component_byte_offset))
+        {
+            Log_e("Benchmark expects positions at the start of each vertex.");
+            _success_out = false;
+            return;
+        }
+    }
+
+    struct CameraView
+    {
+        const char* const name;
+        const glm::vec3   position;
+        const glm::vec3   target;
+    };
+
+    const CameraView camera_views[] = {
+        { "Front, near", glm::vec3(0.0f, 0.0f, 3.0f), glm::vec3(0.0f) },
+        { "Front, far", glm::vec3(0.0f, 0.0f, 12.0f), glm::vec3(0.0f) },
+        { "Side", glm::vec3(3.0f, 0.0f, 0.0f), glm::vec3(0.0f) },
+        { "Behind", glm::vec3(0.0f, 0.0f, -3.0f), glm::vec3(0.0f) },
+        { "Above", glm::vec3(0.0f, 3.0f, 0.01f), glm::vec3(0.0f) },
+        { "Front, close up", glm::vec3(0.3f, 0.2f, 1.5f), glm::vec3(0.3f, 0.2f, 0.0f) },
+    };
+
+    constexpr size_t iteration_count = 1000;
+    const glm::mat4  projection      = glm::perspective(glm::radians(45.0f),
+                                                  16.0f / 9.0f,
+                                                  0.1f,
+                                                  100.0f);
+
+    const size_t             floats_per_vertex = buffer_data.size() / vertex_count;
+    std::vector<GLuint>      visible_elements;
+    MeshletCullingStatistics statistics;
+    Timer                    timer;
+    for (auto& camera_view : camera_views)
+    {
+        const glm::mat4 view_projection = projection * glm::lookAt(camera_view.position,
+                                                                   camera_view.target,
+                                                                   glm::vec3(0.0f, 1.0f, 0.0f));
+
+        float elapsed_milliseconds = 0.0f;
+        timer.StartTimer();
+        for (size_t iteration = 0; iteration < iteration_count; iteration++)
+        {
+            CullMeshlets(meshlets,
+                         buffer_elements_array,
+                         view_projection,
+                         camera_view.position,
+                         visible_elements,
+                         statistics);
+        }
+        timer.StopTimer();
+        timer.TimerElapsedMs(elapsed_milliseconds);
+
+        const size_t visible_triangle_count = CountVisibleTriangles(buffer_data,
+                                                                    floats_per_vertex,
+                                                                    buffer_elements_array,
+                                                                    view_projection,
+                                                                    camera_view.position);
+        const size_t submitted_visible_triangle_count = CountVisibleTriangles(
+          buffer_data,
+          floats_per_vertex,
+          visible_elements,
+          view_projection,
+          camera_view.position);
+
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2) << "[ benchmark ] Meshlet culling" << std::endl
+           << "   File:       " << blender_monkey_ply_path << std::endl
+           << "   View:       " << camera_view.name << std::endl
+           << "   Meshlets:   " << statistics.meshlet_count << " ("
+           << statistics.frustum_culled_meshlet_count << " frustum culled, "
+           << statistics.backface_culled_meshlet_count << " backface culled)" << std::endl
+           << "   Triangles:  " << statistics.triangle_count << std::endl
+           << "   Submitted:  " << statistics.submitted_triangle_count << std::endl
+           << "   Visible:    " << visible_triangle_count << std::endl
+           << "   Cull time:  "
+           << (elapsed_milliseconds * 1000.0f) / static_cast<float>(iteration_count) << " us";
+        Log_i(ss);
+
+        if (submitted_visible_triangle_count != visible_triangle_count)
+        {
+            std::stringstream error_ss;
+            error_ss << "Meshlet culling removed "
+                     << visible_triangle_count - submitted_visible_triangle_count
+                     << " visible triangles.";
+            Log_e(error_ss);
+            _success_out = false;
+            return;
+        }
+    }
+}
+
+// Writes the interleaved float vertices and 32-bit elements of an imported model as a glTF
+// binary file, with one accessor per vertex attribute over a single strided buffer view.
+static void
+WriteGlbFile(bool&                                              _success_out,
+             const char* const                                  _file_path_in,
+             const size_t&                                      _vertex_count_in,
+             const std::vector<float>&                          _vertex_data_in,
+             const std::vector<GLuint>&                         _elements_in,
+             const std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_in)
+{
+    _success_out = false;
+    if (0 == _vertex_attribute_pointers_in.size())
+    {
+        Log_e("No vertex attributes to write.");
+        return;
+    }
+
+    const size_t vertex_data_size_bytes = _vertex_data_in.size() * sizeof(float);
+    const size_t element_size_bytes     = _elements_in.size() * sizeof(GLuint);
+    const size_t bin_chunk_size_bytes   = vertex_data_size_bytes + element_size_bytes;
+
+    std::stringstream json_ss;
+    json_ss << "{\"asset\":{\"version\":\"2.0\",\"generator\":\"OGLengine benchmarks\"},"
+            << "\"buffers\":[{\"byteLength\":" << bin_chunk_size_bytes << "}],"
+            << "\"bufferViews\":[{\"buffer\":0,\"byteLength\":" << vertex_data_size_bytes
+            << ",\"byteStride\":" << _vertex_attribute_pointers_in[0].byte_stride_between_elements
+            << "},{\"buffer\":0,\"byteOffset\":" << vertex_data_size_bytes
+            << ",\"byteLength\":" << element_size_bytes << "}],\"accessors\":[";
+
+    std::stringstream attributes_ss;
+    for (size_t attribute_index = 0; attribute_index < _vertex_attribute_pointers_in.size();
+         attribute_index++)
+    {
+        const glt::VertexAttributeDescriptor& descriptor =
+          _vertex_attribute_pointers_in[attribute_index];
+        json_ss << "{\"bufferView\":0,\"byteOffset\":"
+                << reinterpret_cast<uintptr_t>(descriptor.first_component_byte_offset)
+                << ",\"componentType\":" << GL_FLOAT << ",\"count\":" << _vertex_count_in
+                << ",\"type\":\"VEC" << descriptor.component_count << "\"},";
+
+        const char* const attribute_name =
+          (glt::VertexDataType::POSITION == descriptor.vertex_data_type)  ? "POSITION"
+          : (glt::VertexDataType::NORMAL == descriptor.vertex_data_type)  ? "NORMAL"
+          : (glt::VertexDataType::TANGENT == descriptor.vertex_data_type) ? "TANGENT"
+                                                                          : "TEXCOORD_0";
+        attributes_ss << ((0 == attribute_index) ? "" : ",") << "\"" << attribute_name
+                      << "\":" << attribute_index;
+    }
+
+    json_ss << "{\"bufferView\":1,\"componentType\":" << GL_UNSIGNED_INT
+            << ",\"count\":" << _elements_in.size() << ",\"type\":\"SCALAR\"}],"
+            << "\"meshes\":[{\"primitives\":[{\"attributes\":{" << attributes_ss.str()
+            << "},\"indices\":" << _vertex_attribute_pointers_in.size() << "}]}]}";
+
+    // Note: Chunks are padded to four bytes; the JSON chunk with spaces.
+    std::string json_chunk = json_ss.str();
+    json_chunk.append((4 - (json_chunk.size() % 4)) % 4, ' ');
+
+    const uint32_t header[] = { glb_magic,
+                                glb_version,
+                                static_cast<uint32_t>(12 + 8 + json_chunk.size() + 8 +
+                                                      bin_chunk_size_bytes),
+                                static_cast<uint32_t>(json_chunk.size()),
+                                glb_json_chunk_type };
+    const uint32_t bin_chunk_header[] = { static_cast<uint32_t>(bin_chunk_size_bytes),
+                                          glb_bin_chunk_type };
+
+    std::ofstream file_stream(_file_path_in, std::ios::binary | std::ios::trunc);
+    if (false == file_stream.is_open())
+    {
+        std::stringstream ss;
+        ss << "Unable to open glTF benchmark file for writing: " << _file_path_in;
+        Log_e(ss);
+        return;
+    }
+
+    file_stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file_stream.write(json_chunk.data(), json_chunk.size());
+    file_stream.write(reinterpret_cast<const char*>(bin_chunk_header), sizeof(bin_chunk_header));
+    file_stream.write(reinterpret_cast<const char*>(_vertex_data_in.data()),
+                      vertex_data_size_bytes);
+    file_stream.write(reinterpret_cast<const char*>(_elements_in.data()), element_size_bytes);
+
+    _success_out = file_stream.good();
+    if (false == _success_out)
+    {
+        std::stringstream ss;
+        ss << "Unable to write glTF benchmark file: " << _file_path_in;
+        Log_e(ss);
+    }
+}
+
+// Note: Converts the monkey to a glTF binary file and reports the load time of
+//       LoadModelFromGlbFile(...); compare with ply_parse_monkey.
+static void
+BenchmarkGlbLoadBlenderMonkey(bool& _success_out)
+{
+    size_t                                      vertex_count = 0;
+    std::vector<float>                          buffer_data;
+    std::vector<GLuint>                         buffer_elements_array;
+    GLenum                                      element_data_type = GL_UNSIGNED_INT;
+    std::vector<Meshlet>                        meshlets;
+    BoundingVolume                              bounding_volume;
+    std::vector<glt::VertexDataType>            vertex_data_type_order;
+    std::vector<glt::VertexAttributeDescriptor> vertex_attribute_pointers;
+    LoadModelFromPlyFile(_success_out,
+                         std::move(benchmark_vao_id),
+                         blender_monkey_ply_path,
+                         std::move(benchmark_position_attribute_index),
+                         std::move(benchmark_normal_attribute_index),
+                         std::move(benchmark_texture_coordinate_attribute_index),
+                         std::move(benchmark_tangent_attribute_index),
+                         vertex_count,
+                         buffer_data,
+                         buffer_elements_array,
+                         element_data_type,
+                         meshlets,
+                         bounding_volume,
+                         vertex_data_type_order,
+                         vertex_attribute_pointers);
+
+    if (false == _success_out)
+    {
+        Log_e("Benchmark model failed to load.");
+        return;
+    }
+
+    WriteGlbFile(_success_out,
+                 blender_monkey_glb_path,
+                 vertex_count,
+                 buffer_data,
+                 buffer_elements_array,
+                 vertex_attribute_pointers);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    constexpr size_t iteration_count           = 200;
+    Timer            timer;
+    float            elapsed_milliseconds      = 0.0f;
+    float            best_elapsed_milliseconds = std::numeric_limits<float>::max();
+    float            total_elapsed_millseconds = 0.0f;
+    for (size_t iteration = 0; iteration < iteration_count; iteration++)
+    {
+        GlbModel glb_model;
+
+        timer.StartTimer();
+        LoadModelFromGlbFile(_success_out, blender_monkey_glb_path, glb_model);
+        timer.StopTimer();
+
+        if (false == _success_out)
+        {
+            Log_e("Benchmark glTF binary file failed to load.");
+            return;
+        }
+
+        if ((1 != glb_model.primitives.size()) ||
+            (vertex_count != static_cast<size_t>(glb_model.primitives[0].vertex_count)) ||
+            (buffer_elements_array.size() !=
+             static_cast<size_t>(glb_model.primitives[0].elements.element_count)) ||
+            (0 != std::memcmp(glb_model.primitives[0].array_buffer_data,
+                              buffer_data.data(),
+                              buffer_data.size() * sizeof(float))))
+        {
+            Log_e("Benchmark glTF binary file does not match the model it was written from.");
+            _success_out = false;
+            return;
+        }
+
+        timer.TimerElapsedMs(elapsed_milliseconds);
+        best_elapsed_milliseconds = std::min(best_elapsed_milliseconds, elapsed_milliseconds);
+        total_elapsed_millseconds += elapsed_milliseconds;
+    }
+
+    const double mean_elapsed_milliseconds = total_elapsed_millseconds /
+                                             static_cast<double>(iteration_count);
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3) << "[ benchmark ] glTF binary load" << std::endl
+       << "   File:       " << blender_monkey_glb_path << std::endl
+       << "   Size:       " << std::filesystem::file_size(blender_monkey_glb_path)
+       << " bytes (PLY: " << std::filesystem::file_size(blender_monkey_ply_path) << " bytes)"
+       << std::endl
+       << "   Vertices:   " << vertex_count << std::endl
+       << "   Faces:      " << buffer_elements_array.size() / 3 << std::endl
+       << "   Iterations: " << iteration_count << std::endl
+       << "   Best:       " << best_elapsed_milliseconds << " ms" << std::endl
+       << "   Mean:       " << mean_elapsed_milliseconds << " ms";
+    Log_i(ss);
+}
+
+// Note: Reports the throughput of ComputeBoundingVolume(...) over a synthetic stream of
+//       synthetic_ply_vertex_count vertices laid out as the importers lay them out (position,
+//       normal, texture coordinates), and of TransformBoundingVolumes(...) over a scene of
+//       rotated, scaled and translated copies of the resulting volume.
+static void
+BenchmarkBoundingVolumes(bool& _success_out)
+{
+    constexpr size_t floats_per_vertex = 8;
+    constexpr size_t vertex_count      = synthetic_ply_vertex_count;
+    constexpr size_t iteration_count   = 10;
+
+    // Note: A noisy spiral, so that the sphere keeps growing through the stream.
+    std::vector<float> vertex_data(vertex_count * floats_per_vertex, 0.0f);
+    for (size_t vertex_index = 0; vertex_index < vertex_count; vertex_index++)
+    {
+        const float  angle    = static_cast<float>(vertex_index) * 0.001f;
+        const float  radius   = 1.0f + (static_cast<float>(vertex_index % 977) / 977.0f);
+        float* const position = &vertex_data[vertex_index * floats_per_vertex];
+        position[0]           = std::cos(angle) * radius;
+        position[1]           = std::sin(angle * 0.37f) * 2.0f;
+        position[2]           = std::sin(angle) * radius;
+    }
+
+    BoundingVolume bounding_volume;
+    Timer          timer;
+    float          elapsed_milliseconds      = 0.0f;
+    float          best_elapsed_milliseconds = std::numeric_limits<float>::max();
+    for (size_t iteration = 0; iteration < iteration_count; iteration++)
+    {
+        timer.StartTimer();
+        ComputeBoundingVolume(_success_out,
+                              vertex_data.data(),
+                              floats_per_vertex,
+                              0,
+                              vertex_count,
+                              bounding_volume);
+        timer.StopTimer();
+
+        if (false == _success_out)
+        {
+            Log_e("Benchmark bounding volume failed to compute.");
+            return;
+        }
+
+        timer.TimerElapsedMs(elapsed_milliseconds);
+        best_elapsed_milliseconds = std::min(best_elapsed_milliseconds, elapsed_milliseconds);
+    }
+
+    glm::vec3 minimum(std::numeric_limits<float>::max());
+    glm::vec3 maximum(std::numeric_limits<float>::lowest());
+    bool      is_enclosed = true;
+    for (size_t vertex_index = 0; vertex_index < vertex_count; vertex_index++)
+    {
+        const glm::vec3 position = glm::make_vec3(&vertex_data[vertex_index * floats_per_vertex]);
+        minimum                  = glm::min(minimum, position);
+        maximum                  = glm::max(maximum, position);
+        is_enclosed &= (glm::distance(position, bounding_volume.bounding_sphere_center) <=
+                        bounding_volume.bounding_sphere_radius);
+    }
+
+    if ((minimum != bounding_volume.aabb_minimum) || (maximum != bounding_volume.aabb_maximum) ||
+        (false == is_enclosed))
+    {
+        Log_e("Benchmark bounding volume does not enclose its vertices.");
+        _success_out = false;
+        return;
+    }
+
+    constexpr size_t            instance_count = 100'000;
+    std::vector<BoundingVolume> local_bounding_volumes(instance_count, bounding_volume);
+    std::vector<BoundingVolume> world_bounding_volumes;
+    std::vector<glm::mat4>      world_matrices(instance_count);
+    for (size_t instance_index = 0; instance_index < instance_count; instance_index++)
+    {
+        const float offset             = static_cast<float>(instance_index);
+        world_matrices[instance_index] = glm::scale(
+          glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(offset, 0.0f, -offset)),
+                      offset * 0.01f,
+                      glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))),
+          glm::vec3(1.0f + (offset * 0.0001f)));
+    }
+
+    float best_transform_milliseconds = std::numeric_limits<float>::max();
+    for (size_t iteration = 0; iteration < iteration_count; iteration++)
+    {
+        timer.StartTimer();
+        TransformBoundingVolumes(local_bounding_volumes, world_matrices, world_bounding_volumes);
+        timer.StopTimer();
+        timer.TimerElapsedMs(elapsed_milliseconds);
+        best_transform_milliseconds = std::min(best_transform_milliseconds, elapsed_milliseconds);
+    }
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3) << "[ benchmark ] Bounding volumes" << std::endl
+       << "   Vertices:        " << vertex_count << " (" << floats_per_vertex * sizeof(float)
+       << " bytes each)" << std::endl
+       << "   Compute:         " << best_elapsed_milliseconds << " ms ("
+       << static_cast<double>(vertex_count) / (best_elapsed_milliseconds * 1000.0)
+       << " M vertices/s)" << std::endl
+       << "   Sphere radius:   " << bounding_volume.bounding_sphere_radius << " (AABB sphere: "
+       << glm::length(maximum - minimum) * 0.5f << ")" << std::endl
+       << "   Volumes:         " << instance_count << std::endl
+       << "   Transform:       " << best_transform_milliseconds << " ms ("
+       << static_cast<double>(instance_count) / (best_transform_milliseconds * 1000.0)
+       << " M volumes/s)";
+    Log_i(ss);
+}
+
+// Note: Reports the time GenerateTangents(...) takes over a synthetic height field of about 5M
+//       triangles, laid out as the importers lay them out, serially and on every hardware
+//       thread. Tangents are checked against the analytic surface derivative.
+static void
+BenchmarkTangentGeneration(bool& _success_out)
+{
+    constexpr size_t grid_width      = 1583;
+    constexpr size_t vertex_count    = grid_width * grid_width;
+    constexpr float  height_scale    = 8.0f;
+    constexpr float  height_period   = 0.02f;
+    constexpr size_t iteration_count = 3;
+
+    // Note: u runs along +x and v along -z, so that bitangents follow cross(normal, tangent).
+    std::vector<float> vertex_data(vertex_count * 8);
+    for (size_t row = 0; row < grid_width; row++)
+    {
+        for (size_t column = 0; column < grid_width; column++)
+        {
+            const float  x      = static_cast<float>(column);
+            const float  z      = static_cast<float>(row);
+            const float  height = height_scale * std::sin(x * height_period) *
+                                 std::cos(z * height_period);
+            const float  dx     = height_scale * height_period * std::cos(x * height_period) *
+                             std::cos(z * height_period);
+            const float  dz     = -height_scale * height_period * std::sin(x * height_period) *
+                              std::sin(z * height_period);
+            const glm::vec3 normal = glm::normalize(glm::vec3(-dx, 1.0f, -dz));
+
+            float* const vertex = &vertex_data[((row * grid_width) + column) * 8];
+            vertex[0]           = x;
+            vertex[1]           = height;
+            vertex[2]           = z;
+            vertex[3]           = normal.x;
+            vertex[4]           = normal.y;
+            vertex[5]           = normal.z;
+            vertex[6]           = x / static_cast<float>(grid_width - 1);
+            vertex[7]           = 1.0f - (z / static_cast<float>(grid_width - 1));
+        }
+    }
+
+    std::vector<GLuint> elements;
+    elements.reserve((grid_width - 1) * (grid_width - 1) * 6);
+    for (size_t row = 0; row < (grid_width - 1); row++)
+    {
+        for (size_t column = 0; column < (grid_width - 1); column++)
+        {
+            const GLuint corner = static_cast<GLuint>((row * grid_width) + column);
+            elements.insert(elements.end(),
+                            { corner,
+                              corner + static_cast<GLuint>(grid_width),
+                              corner + 1,
+                              corner + 1,
+                              corner + static_cast<GLuint>(grid_width),
+                              corner + static_cast<GLuint>(grid_width) + 1 });
+        }
+    }
+
+    JobSystem job_system;
+    job_system.Start(_success_out, 0);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    std::vector<float> serial_vertex_data;
+    for (size_t threaded = 0; threaded < 2; threaded++)
+    {
+        float                                       best_elapsed_milliseconds = 0.0f;
+        size_t                                      tangent_vertex_count = 0;
+        std::vector<float>                          tangent_vertex_data;
+        std::vector<GLuint>                         tangent_elements;
+        std::vector<glt::VertexDataType>            vertex_data_types;
+        std::vector<glt::VertexAttributeDescriptor> vertex_attribute_pointers;
+        TangentGenerationReport                     report;
+        for (size_t iteration = 0; iteration < iteration_count; iteration++)
+        {
+            tangent_vertex_count = vertex_count;
+            tangent_vertex_data  = vertex_data;
+            tangent_elements     = elements;
+            vertex_data_types    = { glt::VertexDataType::POSITION,
+                                    glt::VertexDataType::NORMAL,
+                                    glt::VertexDataType::TEXTURE };
+            vertex_attribute_pointers.clear();
+            const GLvoid* offsets[] = { nullptr,
+                                        reinterpret_cast<const GLvoid*>(3 * sizeof(float)),
+                                        reinterpret_cast<const GLvoid*>(6 * sizeof(float)) };
+            const GLint   component_counts[] = { 3, 3, 2 };
+            for (size_t attribute = 0; attribute < 3; attribute++)
+            {
+                vertex_attribute_pointers.push_back(
+                  glt::VertexAttributeDescriptor(std::move(benchmark_vao_id),
+                                                 static_cast<GLuint>(attribute),
+                                                 std::move(component_counts[attribute]),
+                                                 GL_FLOAT,
+                                                 GL_FALSE,
+                                                 8 * sizeof(float),
+                                                 std::move(offsets[attribute]),
+                                                 std::move(vertex_data_types[attribute])));
+            }
+
+            Timer timer;
+            float elapsed_milliseconds = 0.0f;
+            timer.StartTimer();
+            GenerateTangents(_success_out,
+                             tangent_vertex_count,
+                             tangent_elements,
+                             3,
+                             tangent_vertex_data,
+                             vertex_data_types,
+                             vertex_attribute_pointers,
+                             report,
+                             (0 == threaded) ? nullptr : &job_system);
+            timer.StopTimer();
+            timer.TimerElapsedMs(elapsed_milliseconds);
+            if (false == _success_out)
+            {
+                Log_e("Benchmark tangents failed to generate.");
+                return;
+            }
+
+            best_elapsed_milliseconds = (0 == iteration)
+                                          ? elapsed_milliseconds
+                                          : std::min(best_elapsed_milliseconds,
+                                                     elapsed_milliseconds);
+        }
+
+        // Note: The interior of the grid is smooth; its tangents follow the x derivative of the
+        //       surface to within the angle the grid resolves, and no vertex is split.
+        float max_tangent_error_degrees = 0.0f;
+        for (size_t row = 1; row < (grid_width - 1); row++)
+        {
+            for (size_t column = 1; column < (grid_width - 1); column++)
+            {
+                const float* const vertex  = &tangent_vertex_data[((row * grid_width) + column) *
+                                                                 12];
+                const glm::vec3    normal  = glm::make_vec3(vertex + 3);
+                const glm::vec3    tangent = glm::make_vec3(vertex + 8);
+                const float        x       = static_cast<float>(column);
+                const float        z       = static_cast<float>(row);
+                const glm::vec3    expected = glm::normalize(
+                  glm::vec3(1.0f,
+                            height_scale * height_period * std::cos(x * height_period) *
+                              std::cos(z * height_period),
+                            0.0f));
+                const glm::vec3 projected = glm::normalize(expected -
+                                                           (normal * glm::dot(normal, expected)));
+                max_tangent_error_degrees = std::max(
+                  max_tangent_error_degrees,
+                  glm::degrees(std::acos(std::clamp(glm::dot(projected, tangent), -1.0f, 1.0f))));
+            }
+        }
+
+        if ((1.0f < max_tangent_error_degrees) || (0 != report.mirrored_vertex_count) ||
+            (0 != report.fallback_vertex_count) || (0 != report.split_vertex_count))
+        {
+            std::stringstream error_ss;
+            error_ss << "Benchmark tangents are incorrect." << std::endl
+                     << "   Max error: " << max_tangent_error_degrees << " degrees" << std::endl
+                     << "   Mirrored:  " << report.mirrored_vertex_count << std::endl
+                     << "   Fallback:  " << report.fallback_vertex_count << std::endl
+                     << "   Split:     " << report.split_vertex_count;
+            Log_e(error_ss);
+            _success_out = false;
+            return;
+        }
+
+        if (true == serial_vertex_data.empty())
+        {
+            serial_vertex_data.swap(tangent_vertex_data);
+        }
+        else if (serial_vertex_data != tangent_vertex_data)
+        {
+            Log_e("Benchmark tangents differ between serial and parallel generation.");
+            _success_out = false;
+            return;
+        }
+
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(3) << "[ benchmark ] Tangent generation" << std::endl
+           << "   Vertices:   " << vertex_count << std::endl
+           << "   Triangles:  " << elements.size() / 3 << std::endl
+           << "   Threads:    " << ((0 == threaded) ? 1 : job_system.GetThreadCount())
+           << std::endl
+           << "   Chunks:     " << report.chunk_count << std::endl
+           << "   Max error:  " << max_tangent_error_degrees << " degrees" << std::endl
+           << "   Best:       " << best_elapsed_milliseconds << " ms ("
+           << static_cast<double>(elements.size() / 3) / (best_elapsed_milliseconds * 1000.0)
+           << " M triangles/s)";
+        Log_i(ss);
+    }
+}
+
+// Note: Reports the size of the synthetic mesh once encoded by the codec cooked meshes are stored
+//       with (see mesh_codec.h), and how quickly it decodes. Decoded vertices must match
+//       byte for byte, and decoded triangles may only start at a different corner.
+static void
+BenchmarkMeshCodec(bool& _success_out)
+{
+    constexpr size_t iteration_count = 5;
+
+    EnsureSyntheticAsciiPlyFile(_success_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    size_t                                      vertex_count = 0;
+    std::vector<float>                          buffer_data;
+    std::vector<GLuint>                         buffer_elements_array;
+    GLenum                                      element_data_type = GL_UNSIGNED_INT;
+    std::vector<Meshlet>                        meshlets;
+    BoundingVolume                              bounding_volume;
+    std::vector<glt::VertexDataType>            vertex_data_type_order;
+    std::vector<glt::VertexAttributeDescriptor> vertex_attribute_pointers;
+    LoadModelFromPlyFile(_success_out,
+                         std::move(benchmark_vao_id),
+                         synthetic_ply_path,
+                         std::move(benchmark_position_attribute_index),
+                         std::move(benchmark_normal_attribute_index),
+                         std::move(benchmark_texture_coordinate_attribute_index),
+                         std::move(benchmark_tangent_attribute_index),
+                         vertex_count,
+                         buffer_data,
+                         buffer_elements_array,
+                         element_data_type,
+                         meshlets,
+                         bounding_volume,
+                         vertex_data_type_order,
+                         vertex_attribute_pointers,
+                         false);
+
+    if ((false == _success_out) || (0 == vertex_count))
+    {
+        Log_e("Benchmark model failed to load.");
+        _success_out = false;
+        return;
+    }
+
+    const size_t vertex_data_size_bytes  = buffer_data.size() * sizeof(float);
+    const size_t element_data_size_bytes = buffer_elements_array.size() * sizeof(GLuint);
+    const size_t vertex_size_bytes       = vertex_data_size_bytes / vertex_count;
+
+    Timer                      timer;
+    std::vector<unsigned char> encoded_vertex_data;
+    std::vector<unsigned char> encoded_elements;
+    timer.StartTimer();
+    EncodeVertexBuffer(_success_out,
+                       buffer_data.data(),
+                       vertex_count,
+                       vertex_size_bytes,
+                       encoded_vertex_data);
+    if (true == _success_out)
+    {
+        EncodeIndexBuffer(_success_out, buffer_elements_array, encoded_elements);
+    }
+    timer.StopTimer();
+
+    if (false == _success_out)
+    {
+        Log_e("Benchmark mesh failed to encode.");
+        return;
+    }
+
+    float encode_milliseconds = 0.0f;
+    timer.TimerElapsedMs(encode_milliseconds);
+
+    std::vector<float>  decoded_buffer_data(buffer_data.size());
+    std::vector<GLuint> decoded_elements(buffer_elements_array.size());
+    float               elapsed_milliseconds             = 0.0f;
+    float               best_vertex_decode_milliseconds  = std::numeric_limits<float>::max();
+    float               best_element_decode_milliseconds = std::numeric_limits<float>::max();
+    for (size_t iteration = 0; iteration < iteration_count; iteration++)
+    {
+        timer.StartTimer();
+        DecodeVertexBuffer(_success_out,
+                           encoded_vertex_data.data(),
+                           encoded_vertex_data.size(),
+                           vertex_count,
+                           vertex_size_bytes,
+                           decoded_buffer_data.data());
+        timer.StopTimer();
+        timer.TimerElapsedMs(elapsed_milliseconds);
+        best_vertex_decode_milliseconds = std::min(best_vertex_decode_milliseconds,
+                                                   elapsed_milliseconds);
+
+        if (true == _success_out)
+        {
+            timer.StartTimer();
+            DecodeIndexBuffer(_success_out,
+                              encoded_elements.data(),
+                              encoded_elements.size(),
+                              buffer_elements_array.size(),
+                              vertex_count,
+                              GL_UNSIGNED_INT,
+                              decoded_elements.data());
+            timer.StopTimer();
+            timer.TimerElapsedMs(elapsed_milliseconds);
+            best_element_decode_milliseconds = std::min(best_element_decode_milliseconds,
+                                                         elapsed_milliseconds);
+        }
+
+        if (false == _success_out)
+        {
+            Log_e("Benchmark mesh failed to decode.");
+            return;
+        }
+    }
+
+    bool is_lossless = (0 == std::memcmp(decoded_buffer_data.data(),
+                                         buffer_data.data(),
+                                         vertex_data_size_bytes));
+    for (size_t element_index = 0; element_index < decoded_elements.size(); element_index += 3)
+    {
+        const GLuint* const triangle         = &buffer_elements_array[element_index];
+        const GLuint* const decoded_triangle = &decoded_elements[element_index];
+        bool                is_same_triangle = false;
+        for (size_t corner = 0; corner < 3; corner++)
+        {
+            is_same_triangle |= ((triangle[0] == decoded_triangle[corner]) &&
+                                 (triangle[1] == decoded_triangle[(corner + 1) % 3]) &&
+                                 (triangle[2] == decoded_triangle[(corner + 2) % 3]));
+        }
+
+        is_lossless &= is_same_triangle;
+    }
+
+    if (false == is_lossless)
+    {
+        Log_e("Benchmark mesh does not match once decoded.");
+        _success_out = false;
+        return;
+    }
+
+    const double megabyte = 1024.0 * 1024.0;
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << "[ benchmark ] Mesh codec" << std::endl
+       << "   Vertices:        " << vertex_count << " (" << vertex_size_bytes << " bytes each)"
+       << std::endl
+       << "   Vertex data:     " << vertex_data_size_bytes / megabyte << " MB -> "
+       << encoded_vertex_data.size() / megabyte << " MB ("
+       << (100.0 * encoded_vertex_data.size()) / vertex_data_size_bytes << "%)" << std::endl
+       << "   Vertex decode:   " << best_vertex_decode_milliseconds << " ms ("
+       << (vertex_data_size_bytes / megabyte) / (best_vertex_decode_milliseconds / 1000.0)
+       << " MB/s)" << std::endl
+       << "   Triangles:       " << buffer_elements_array.size() / 3 << std::endl
+       << "   Element data:    " << element_data_size_bytes / megabyte << " MB -> "
+       << encoded_elements.size() / megabyte << " MB ("
+       << (3.0 * encoded_elements.size()) / buffer_elements_array.size() << " bytes/triangle)"
+       << std::endl
+       << "   Element decode:  " << best_element_decode_milliseconds << " ms ("
+       << (element_data_size_bytes / megabyte) / (best_element_decode_milliseconds / 1000.0)
+       << " MB/s)" << std::endl
+       << "   Encode:          " << encode_milliseconds << " ms";
+    Log_i(ss);
+}
+
+// Writes an RGBA PNG of smooth gradients with a little noise, which compresses about as well as
+// a photographic texture.
+static void
+WriteSyntheticPngFile(bool& _success_out, const char* const _file_path_in, const int&& _size_in)
+{
+    std::vector<unsigned char> pixels(static_cast<size_t>(_size_in) * _size_in * 4);
+    unsigned char*             pixel       = pixels.data();
+    uint32_t                   noise_state = 0x9E3779B9;
+    for (int row = 0; row < _size_in; row++)
+    {
+        for (int column = 0; column < _size_in; column++, pixel += 4)
+        {
+            noise_state ^= noise_state << 13;
+            noise_state ^= noise_state >> 17;
+            noise_state ^= noise_state << 5;
+
+            const int noise = static_cast<int>(noise_state & 7);
+            pixel[0]        = static_cast<unsigned char>(((column * 247) / _size_in) + noise);
+            pixel[1]        = static_cast<unsigned char>(((row * 247) / _size_in) + noise);
+            pixel[2]        = static_cast<unsigned char>(((row + column) / 16) & 0xFF);
+            pixel[3]        = 255;
+        }
+    }
+
+    _success_out = (0 != stbi_write_png(_file_path_in,
+                                        _size_in,
+                                        _size_in,
+                                        4,
+                                        pixels.data(),
+                                        _size_in * 4));
+    if (false == _success_out)
+    {
+        std::stringstream ss;
+        ss << "Unable to write synthetic benchmark image: " << _file_path_in;
+        Log_e(ss);
+    }
+}
+
+// Note: Cooks `<image>.ktx2` as the asset cooker does, unless it is current.
+static void
+EnsureCookedTexture(bool& _success_out, const char* const _image_file_path_in)
+{
+    const CookedTextureOptions texture_options;
+    CookedTexture              cooked_texture;
+    MapCurrentCookedTexture(_success_out, _image_file_path_in, cooked_texture, &texture_options);
+    if (true == _success_out)
+    {
+        return;
+    }
+
+    // Note: The modification time is read before the image, such that a change made while it
+    //       is read leaves the cooked texture stale.
+    bool     has_source_write_time = false;
+    uint64_t source_write_time     = 0;
+    GetFileWriteTime(has_source_write_time, _image_file_path_in, source_write_time);
+
+    MappedFile image_file;
+    MapFileToMemory(_success_out, _image_file_path_in, image_file);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    uint64_t source_content_hash = 0;
+    HashMemory(source_content_hash, image_file.data, image_file.size_bytes);
+
+    unsigned char* image_data     = nullptr;
+    int            image_width    = 0;
+    int            image_height   = 0;
+    int            image_channels = 0;
+    LoadImageToMemory(_success_out,
+                      _image_file_path_in,
+                      &image_data,
+                      image_width,
+                      image_height,
+                      image_channels);
+    if (true == _success_out)
+    {
+        const std::string cooked_texture_path = std::string(_image_file_path_in) +
+                                                cooked_texture_file_extension;
+        WriteCookedTexture(_success_out,
+                           cooked_texture_path.c_str(),
+                           image_file.size_bytes,
+                           source_content_hash,
+                           source_write_time,
+                           image_data,
+                           image_width,
+                           image_height,
+                           image_channels,
+                           texture_options);
+    }
+
+    if (nullptr != image_data)
+    {
+        stbi_image_free(image_data);
+    }
+}
+
+// Note: Measures the CPU side of texture creation. The image path decodes the PNG, after which
+//       the driver still generates mipmaps; the cooked path maps the cooked texture, checks it
+//       against the image, and reads every level once as glTexImage2D would.
+static void
+BenchmarkTextureLoad(bool& _success_out, const char* const _image_file_path_in)
+{
+    constexpr size_t iteration_count = 5;
+
+    EnsureCookedTexture(_success_out, _image_file_path_in);
+    if (false == _success_out)
+    {
+        Log_e("Benchmark texture failed to cook.");
+        return;
+    }
+
+    Timer  timer;
+    float  elapsed_milliseconds      = 0.0f;
+    float  best_image_milliseconds   = std::numeric_limits<float>::max();
+    float  best_cooked_milliseconds  = std::numeric_limits<float>::max();
+    int    image_width               = 0;
+    int    image_height              = 0;
+    int    image_channels            = 0;
+    size_t cooked_texture_size_bytes = 0;
+    size_t cooked_level_count        = 0;
+    for (size_t iteration = 0; iteration < iteration_count; iteration++)
+    {
+        unsigned char* image_data = nullptr;
+        timer.StartTimer();
+        LoadImageToMemory(_success_out,
+                          _image_file_path_in,
+                          &image_data,
+                          image_width,
+                          image_height,
+                          image_channels);
+        timer.StopTimer();
+        timer.TimerElapsedMs(elapsed_milliseconds);
+        best_image_milliseconds = std::min(best_image_milliseconds, elapsed_milliseconds);
+
+        if (nullptr != image_data)
+        {
+            stbi_image_free(image_data);
+        }
+
+        if (false == _success_out)
+        {
+            Log_e("Benchmark image failed to load.");
+            return;
+        }
+
+        uint64_t level_hash = 0;
+        timer.StartTimer();
+        {
+            CookedTexture cooked_texture;
+            MapCurrentCookedTexture(_success_out, _image_file_path_in, cooked_texture);
+            for (const CookedTextureLevel& level : cooked_texture.levels)
+            {
+                HashMemory(level_hash, level.data, level.size_bytes);
+            }
+
+            cooked_texture_size_bytes = cooked_texture.file.size_bytes;
+            cooked_level_count        = cooked_texture.levels.size();
+        }
+        timer.StopTimer();
+        timer.TimerElapsedMs(elapsed_milliseconds);
+        best_cooked_milliseconds = std::min(best_cooked_milliseconds, elapsed_milliseconds);
+
+        if (false == _success_out)
+        {
+            Log_e("Benchmark cooked texture failed to load.");
+            return;
+        }
+    }
+
+    const double megabyte = 1024.0 * 1024.0;
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << "[ benchmark ] Texture load" << std::endl
+       << "   File:            " << _image_file_path_in << std::endl
+       << "   Image:           " << image_width << "x" << image_height << ", " << image_channels
+       << " channels, " << std::filesystem::file_size(_image_file_path_in) / megabyte << " MB"
+       << std::endl
+       << "   Cooked texture:  " << cooked_level_count << " levels, "
+       << cooked_texture_size_bytes / megabyte << " MB" << std::endl
+       << "   Image decode:    " << best_image_milliseconds << " ms (before mipmap generation)"
+       << std::endl
+       << "   Cooked load:     " << best_cooked_milliseconds << " ms (every level)" << std::endl
+       << "   Speedup:         " << best_image_milliseconds / best_cooked_milliseconds << "x";
+    Log_i(ss);
+}
+
+static void
+BenchmarkTextureLoadBrick(bool& _success_out)
+{
+    // Note: Copied, so that the cooked texture is written beside the copy rather than into the
+    //       test assets.
+    std::error_code error_code;
+    std::filesystem::copy_file(brick_png_path,
+                               benchmark_brick_png_path,
+                               std::filesystem::copy_options::update_existing,
+                               error_code);
+    if (true == static_cast<bool>(error_code))
+    {
+        std::stringstream ss;
+        ss << "Unable to copy benchmark image: " << brick_png_path;
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    BenchmarkTextureLoad(_success_out, benchmark_brick_png_path);
+}
+
+static void
+EnsureSyntheticPngFile(bool& _success_out)
+{
+    _success_out = true;
+
+    bool file_exists = false;
+    bool file_empty  = true;
+    FileExistsOrEmpty(synthetic_png_path, file_exists, file_empty);
+    if ((false == file_exists) || (true == file_empty))
+    {
+        Log_i("Writing synthetic 2048x2048 PNG benchmark file...");
+        WriteSyntheticPngFile(_success_out, synthetic_png_path, std::move(synthetic_png_size));
+    }
+}
+
+static void
+BenchmarkTextureLoadSynthetic(bool& _success_out)
+{
+    EnsureSyntheticPngFile(_success_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    BenchmarkTextureLoad(_success_out, synthetic_png_path);
+}
+
+// Note: Measures mip chain generation (see mip_generator.h) for each filter, on the calling
+//       thread and tiled across a job system. Throughput counts the source pixels read by every
+//       level. The box filter's first level must match a plain 2x2 average exactly.
+static void
+BenchmarkMipGeneration(bool& _success_out)
+{
+    constexpr size_t iteration_count = 5;
+
+    EnsureSyntheticPngFile(_success_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    unsigned char* image_data     = nullptr;
+    int            image_width    = 0;
+    int            image_height   = 0;
+    int            image_channels = 0;
+    LoadImageToMemory(_success_out,
+                      synthetic_png_path,
+                      &image_data,
+                      image_width,
+                      image_height,
+                      image_channels);
+    if (false == _success_out)
+    {
+        Log_e("Benchmark image failed to load.");
+        return;
+    }
+
+    std::vector<unsigned char> image(image_data,
+                                     image_data +
+                                       (static_cast<size_t>(image_width) * image_height * 4));
+    stbi_image_free(image_data);
+
+    JobSystem job_system;
+    job_system.Start(_success_out, 0);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    struct MipGenerationCase
+    {
+        const char* const    name;
+        MipGenerationOptions options;
+    };
+
+    MipGenerationCase cases[] = {
+        { "Box", {} },
+        { "Box, sRGB", {} },
+        { "Kaiser", {} },
+        { "Kaiser, sRGB", {} },
+        { "Lanczos", {} },
+        { "Lanczos, sRGB", {} },
+    };
+    for (size_t case_index = 0; case_index < std::size(cases); case_index++)
+    {
+        cases[case_index].options.filter = static_cast<MipFilter>(case_index / 2);
+        cases[case_index].options.srgb   = (1 == (case_index % 2));
+    }
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << "[ benchmark ] Mip generation" << std::endl
+       << "   Image:           " << image_width << "x" << image_height << ", "
+       << job_system.GetThreadCount() << " worker threads";
+
+    Timer                 timer;
+    std::vector<MipLevel> levels;
+    for (const MipGenerationCase& mip_generation_case : cases)
+    {
+        float best_milliseconds[2] = { std::numeric_limits<float>::max(),
+                                       std::numeric_limits<float>::max() };
+        for (size_t threaded = 0; threaded < 2; threaded++)
+        {
+            for (size_t iteration = 0; iteration < iteration_count; iteration++)
+            {
+                float elapsed_milliseconds = 0.0f;
+                timer.StartTimer();
+                GenerateMipChain(_success_out,
+                                 image.data(),
+                                 image_width,
+                                 image_height,
+                                 mip_generation_case.options,
+                                 (0 == threaded) ? nullptr : &job_system,
+                                 levels);
+                timer.StopTimer();
+                timer.TimerElapsedMs(elapsed_milliseconds);
+                best_milliseconds[threaded] = std::min(best_milliseconds[threaded],
+                                                       elapsed_milliseconds);
+
+                if (false == _success_out)
+                {
+                    Log_e("Benchmark mip chain failed to generate.");
+                    job_system.Stop();
+                    return;
+                }
+            }
+        }
+
+        size_t source_pixel_count = static_cast<size_t>(image_width) * image_height;
+        for (size_t level = 0; (level + 1) < levels.size(); level++)
+        {
+            source_pixel_count += static_cast<size_t>(levels[level].width) * levels[level].height;
+        }
+
+        const double source_megapixels = static_cast<double>(source_pixel_count) / 1e6;
+        ss << std::endl
+           << "   " << std::left << std::setw(15) << mip_generation_case.name << std::right
+           << "  " << best_milliseconds[0] << " ms, " << source_megapixels / best_milliseconds[0]
+           << " GPixel/s; threaded " << best_milliseconds[1] << " ms, "
+           << source_megapixels / best_milliseconds[1] << " GPixel/s";
+
+        if ((MipFilter::BOX != mip_generation_case.options.filter) ||
+            (true == mip_generation_case.options.srgb))
+        {
+            continue;
+        }
+
+        const MipLevel& level         = levels[0];
+        const size_t    source_stride = static_cast<size_t>(image_width) * 4;
+        for (size_t row = 0; (row < static_cast<size_t>(level.height)) && (true == _success_out);
+             row++)
+        {
+            const unsigned char* const source      = image.data() + (row * 2 * source_stride);
+            const unsigned char* const destination = level.pixels.data() + (row * level.width * 4);
+            for (size_t component = 0; component < (static_cast<size_t>(level.width) * 4);
+                 component++)
+            {
+                const size_t source_index = ((component / 4) * 8) + (component % 4);
+                const int    sum          = source[source_index] + source[source_index + 4] +
+                                   source[source_stride + source_index] +
+                                   source[source_stride + source_index + 4];
+                if (((sum + 2) / 4) != destination[component])
+                {
+                    Log_e("Box filtered mip level does not match its reference.");
+                    _success_out = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    job_system.Stop();
+    if (true == _success_out)
+    {
+        Log_i(ss);
+    }
+}
+
+// Note: Measures block compression (see block_compression.h) of the brick texture to each format
+//       at each quality, on the calling thread and tiled across a job system, and reports the
+//       peak signal to noise ratio of the decoded blocks over the channels each format stores.
+static void
+BenchmarkBlockCompression(bool& _success_out)
+{
+    constexpr size_t iteration_count = 3;
+    constexpr double minimum_psnr    = 30.0;
+
+    unsigned char* image_data     = nullptr;
+    int            image_width    = 0;
+    int            image_height   = 0;
+    int            image_channels = 0;
+    LoadImageToMemory(_success_out,
+                      brick_png_path,
+                      &image_data,
+                      image_width,
+                      image_height,
+                      image_channels);
+    if (false == _success_out)
+    {
+        Log_e("Benchmark image failed to load.");
+        return;
+    }
+
+    const size_t               pixel_count = static_cast<size_t>(image_width) * image_height;
+    std::vector<unsigned char> image(image_data, image_data + (pixel_count * 4));
+    stbi_image_free(image_data);
+
+    JobSystem job_system;
+    job_system.Start(_success_out, 0);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    struct BlockCompressionCase
+    {
+        const char* const       name;
+        BlockFormat             block_format;
+        BlockCompressionQuality quality;
+        int                     channel_count;
+    };
+
+    const BlockCompressionCase cases[] = {
+        { "BC1, fast", BlockFormat::BC1, BlockCompressionQuality::FAST, 3 },
+        { "BC1, high", BlockFormat::BC1, BlockCompressionQuality::HIGH, 3 },
+        { "BC3, fast", BlockFormat::BC3, BlockCompressionQuality::FAST, 4 },
+        { "BC3, high", BlockFormat::BC3, BlockCompressionQuality::HIGH, 4 },
+        { "BC5, fast", BlockFormat::BC5, BlockCompressionQuality::FAST, 2 },
+        { "BC5, high", BlockFormat::BC5, BlockCompressionQuality::HIGH, 2 },
+        { "BC7, fast", BlockFormat::BC7, BlockCompressionQuality::FAST, 4 },
+        { "BC7, high", BlockFormat::BC7, BlockCompressionQuality::HIGH, 4 },
+    };
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << "[ benchmark ] Block compression" << std::endl
+       << "   Image:        " << image_width << "x" << image_height << ", "
+       << job_system.GetThreadCount() << " worker threads";
+
+    Timer                      timer;
+    std::vector<unsigned char> blocks;
+    std::vector<unsigned char> decompressed_image;
+    for (const BlockCompressionCase& block_compression_case : cases)
+    {
+        float best_milliseconds[2] = { std::numeric_limits<float>::max(),
+                                       std::numeric_limits<float>::max() };
+        for (size_t threaded = 0; threaded < 2; threaded++)
+        {
+            for (size_t iteration = 0; iteration < iteration_count; iteration++)
+            {
+                float elapsed_milliseconds = 0.0f;
+                timer.StartTimer();
+                CompressImageBlocks(_success_out,
+                                    image.data(),
+                                    image_width,
+                                    image_height,
+                                    block_compression_case.block_format,
+                                    block_compression_case.quality,
+                                    (0 == threaded) ? nullptr : &job_system,
+                                    blocks);
+                timer.StopTimer();
+                timer.TimerElapsedMs(elapsed_milliseconds);
+                best_milliseconds[threaded] = std::min(best_milliseconds[threaded],
+                                                       elapsed_milliseconds);
+
+                if (false == _success_out)
+                {
+                    Log_e("Benchmark image failed to compress.");
+                    job_system.Stop();
+                    return;
+                }
+            }
+        }
+
+        DecompressImageBlocks(_success_out,
+                              blocks.data(),
+                              blocks.size(),
+                              image_width,
+                              image_height,
+                              block_compression_case.block_format,
+                              decompressed_image);
+        if (false == _success_out)
+        {
+            Log_e("Benchmark blocks failed to decompress.");
+            job_system.Stop();
+            return;
+        }
+
+        const double psnr       = GetImagePsnr(image.data(),
+                                         decompressed_image.data(),
+                                         pixel_count,
+                                         block_compression_case.channel_count);
+        const double megapixels = static_cast<double>(pixel_count) / 1e6;
+        ss << std::endl
+           << "   " << std::left << std::setw(12) << block_compression_case.name << std::right
+           << "  " << psnr << " dB; " << best_milliseconds[0] << " ms, "
+           << (megapixels * 1000.0) / best_milliseconds[0] << " MPixel/s; threaded "
+           << best_milliseconds[1] << " ms, " << (megapixels * 1000.0) / best_milliseconds[1]
+           << " MPixel/s";
+
+        if (minimum_psnr > psnr)
+        {
+            std::stringstream psnr_ss;
+            psnr_ss << "Block compressed image is below " << minimum_psnr
+                    << " dB: " << block_compression_case.name;
+            Log_e(psnr_ss);
+            _success_out = false;
+        }
+    }
+
+    job_system.Stop();
+    if (true == _success_out)
+    {
+        Log_i(ss);
+    }
+}
+
+// Note: Measures decoding a batch of images, as a scene's textures are loaded, one after another
+//       with LoadImageToMemory(...) and in parallel with an ImageDecoder. Every image in the
+//       batch is the brick texture, whose parallel decode must match the serial one; one is
+//       decoded unflipped, and must match with its rows reversed.
+static void
+BenchmarkImageDecode(bool& _success_out)
+{
+    constexpr size_t iteration_count   = 3;
+    constexpr size_t batch_image_count = 64;
+
+    std::vector<ImageDecodeRequest> requests(batch_image_count, { brick_png_path, true });
+    requests.back().flip_vertically = false;
+
+    ImageDecoder image_decoder;
+    image_decoder.Start(_success_out, 0);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    Timer                     timer;
+    float                     elapsed_milliseconds       = 0.0f;
+    float                     best_serial_milliseconds   = std::numeric_limits<float>::max();
+    float                     best_parallel_milliseconds = std::numeric_limits<float>::max();
+    int                       image_width                = 0;
+    int                       image_height               = 0;
+    int                       image_channels             = 0;
+    std::vector<DecodedImage> decoded_images;
+    for (size_t iteration = 0; iteration < iteration_count; iteration++)
+    {
+        std::vector<unsigned char*> serial_image_data(batch_image_count, nullptr);
+        timer.StartTimer();
+        for (size_t image_index = 0; image_index < batch_image_count; image_index++)
+        {
+            LoadImageToMemory(_success_out,
+                              brick_png_path,
+                              &serial_image_data[image_index],
+                              image_width,
+                              image_height,
+                              image_channels);
+            if (false == _success_out)
+            {
+                break;
+            }
+        }
+        timer.StopTimer();
+        timer.TimerElapsedMs(elapsed_milliseconds);
+        best_serial_milliseconds = std::min(best_serial_milliseconds, elapsed_milliseconds);
+
+        if (true == _success_out)
+        {
+            timer.StartTimer();
+            image_decoder.DecodeImages(_success_out, requests, decoded_images);
+            timer.StopTimer();
+            timer.TimerElapsedMs(elapsed_milliseconds);
+            best_parallel_milliseconds = std::min(best_parallel_milliseconds,
+                                                  elapsed_milliseconds);
+        }
+
+        if (true == _success_out)
+        {
+            const size_t row_size_bytes = static_cast<size_t>(image_width) * 4;
+            for (size_t image_index = 0; image_index < batch_image_count; image_index++)
+            {
+                const DecodedImage& decoded_image = decoded_images[image_index];
+                for (int row = 0; (row < image_height) && (true == _success_out); row++)
+                {
+                    const int serial_row = (true == requests[image_index].flip_vertically)
+                                             ? row
+                                             : (image_height - 1 - row);
+                    _success_out = (0 == std::memcmp(decoded_image.image_data +
+                                                       (row * row_size_bytes),
+                                                     serial_image_data[image_index] +
+                                                       (serial_row * row_size_bytes),
+                                                     row_size_bytes));
+                }
+            }
+
+            if (false == _success_out)
+            {
+                Log_e("Images decoded in parallel do not match those decoded serially.");
+            }
+        }
+
+        for (unsigned char* const image_data : serial_image_data)
+        {
+            if (nullptr != image_data)
+            {
+                stbi_image_free(image_data);
+            }
+        }
+
+        for (DecodedImage& decoded_image : decoded_images)
+        {
+            ReleaseDecodedImage(decoded_image);
+        }
+
+        if (false == _success_out)
+        {
+            Log_e("Benchmark images failed to decode.");
+            return;
+        }
+    }
+
+    ImageBufferPoolStatistics pool_statistics;
+    GetImageBufferPoolStatistics(pool_statistics);
+    TrimImageBufferPool();
+
+    const double megabyte = 1024.0 * 1024.0;
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << "[ benchmark ] Image decode" << std::endl
+       << "   Batch:           " << batch_image_count << " images, " << image_width << "x"
+       << image_height << ", " << image_decoder.GetThreadCount() << " worker threads"
+       << std::endl
+       << "   Serial:          " << best_serial_milliseconds << " ms" << std::endl
+       << "   Parallel:        " << best_parallel_milliseconds << " ms" << std::endl
+       << "   Speedup:         " << best_serial_milliseconds / best_parallel_milliseconds << "x"
+       << std::endl
+       << "   Buffer pool:     " << pool_statistics.reused_buffer_count << " reused, "
+       << pool_statistics.allocated_buffer_count << " allocated, "
+       << pool_statistics.retained_bytes / megabyte << " MB retained";
+    Log_i(ss);
+}
+
+// Usage: benchmarks.exe [benchmark_name ...]
+//        Every benchmark is run when no names are provided.
+int
+main(int argc, char** argv)
+{
+    const std::vector<Benchmark> benchmarks = {
+        { "ply_parse_monkey", BenchmarkPlyParseBlenderMonkey },
+        { "ply_parse_synthetic", BenchmarkPlyParseSynthetic },
+        { "ply_parse_synthetic_threads", BenchmarkPlyParseSyntheticThreadScaling },
+        { "ply_parse_synthetic_typed", BenchmarkPlyParseSyntheticTyped },
+        { "cooked_mesh_load_monkey", BenchmarkCookedMeshLoadBlenderMonkey },
+        { "cooked_mesh_load_synthetic", BenchmarkCookedMeshLoadSynthetic },
+        { "meshlet_culling_monkey", BenchmarkMeshletCullingBlenderMonkey },
+        { "glb_load_monkey", BenchmarkGlbLoadBlenderMonkey },
+        { "bounding_volumes", BenchmarkBoundingVolumes },
+        { "tangents_synthetic", BenchmarkTangentGeneration },
+        { "mesh_codec_synthetic", BenchmarkMeshCodec },
+        { "texture_load_brick", BenchmarkTextureLoadBrick },
+        { "texture_load_synthetic", BenchmarkTextureLoadSynthetic },
+        { "mip_generation_synthetic", BenchmarkMipGeneration },
+        { "block_compression_brick", BenchmarkBlockCompression },
+        { "image_decode_brick", BenchmarkImageDecode },
+    };
+
+    std::vector<const Benchmark*> selected_benchmarks;
+    for (int argument_index = 1; argument_index < argc; argument_index++)
+    {
+        const Benchmark* selected_benchmark = nullptr;
+        for (auto& benchmark : benchmarks)
+        {
+            if (0 == std::strcmp(benchmark.name, argv[argument_index]))
+            {
+                selected_benchmark = &benchmark;
+                break;
+            }
+        }
+
+        if (nullptr == selected_benchmark)
+        {
+            std::stringstream ss;
+            ss << "Unknown benchmark: " << argv[argument_index] << ". Available benchmarks:";
+            for (auto& benchmark : benchmarks)
+            {
+                ss << std::endl << "   " << benchmark.name;
+            }
+            Log_e(ss);
+            std::exit(EXIT_FAILURE);
+        }
+
+        selected_benchmarks.push_back(selected_benchmark);
+    }
+
+    if (0 == selected_benchmarks.size())
+    {
+        for (auto& benchmark : benchmarks)
+        {
+            selected_benchmarks.push_back(&benchmark);
+        }
+    }
+
+    bool all_succeeded = true;
+    for (auto& benchmark : selected_benchmarks)
+    {
+        bool success = false;
+        benchmark->run(success);
+        if (false == success)
+        {
+            std::stringstream ss;
+            ss << "Benchmark failed: " << benchmark->name;
+            Log_e(ss);
+            all_succeeded = false;
+        }
+    }
+
+    std::exit((true == all_succeeded) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
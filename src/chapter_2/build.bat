@@ -80,6 +80,7 @@ pushd msvc_landfill >nul
 :: /Od 	                Disables optimization.
 :: /Qpar                Enable parallel code generation.
 :: /Ot                  Favor fast code (over small code).
+:: /arch:AVX2          Enable AVX2 (and AVX) code generation. Requires Intel Haswell / AMD Excavator or newer.
 :: /Ob2                 Enable full inline expansion. Note: Debugging impact.
 :: /Z7	                Full symbolic debug info. No pdb. (See /Zi, /Zl).
 :: /GS	                Detect buffer overruns.
@@ -94,7 +95,7 @@ pushd msvc_landfill >nul
 :: /LIBPATH:<arg>       Specify library directory/directories.
 
 :: General Parameters
-@SET GeneralParameters=/Oi /Qpar /EHsc /GL /GS /nologo /Ot /std:c++latest /DGLEW_STATIC
+@SET GeneralParameters=/Oi /Qpar /EHsc /GL /GS /nologo /Ot /arch:AVX2 /std:c++latest /DGLEW_STATIC
 
 :: Debug Paramters
 @SET DebugParameters=/Od /W4 /WX /Z7 /MTd
@@ -143,7 +144,12 @@ odbccp32.lib
 %SCRIPT_DIR%\..\..\include\GL\glew.c ^
 %SCRIPT_DIR%\..\..\src\common\logging.cpp ^
 %SCRIPT_DIR%\..\..\src\common\gl_tools.cpp ^
+%SCRIPT_DIR%\..\..\src\common\cooked_texture.cpp ^
+%SCRIPT_DIR%\..\..\src\common\mip_generator.cpp ^
+%SCRIPT_DIR%\..\..\src\common\block_compression.cpp ^
+%SCRIPT_DIR%\..\..\src\common\job_system.cpp ^
 %SCRIPT_DIR%\..\..\src\common\image_tools.cpp ^
+%SCRIPT_DIR%\..\..\src\common\image_decoding.cpp ^
 %SCRIPT_DIR%\..\..\src\common\fileio.cpp
 
 :: STB Image
@@ -83,6 +83,7 @@ pushd msvc_landfill >nul
 :: /Od 	                Disables optimization.
 :: /Qpar                Enable parallel code generation.
 :: /Ot                  Favor fast code (over small code).
+:: /arch:AVX2          Enable AVX2 (and AVX) code generation. Requires Intel Haswell / AMD Excavator or newer.
 :: /Ob2                 Enable full inline expansion. Note: Debugging impact.
 :: /Z7	                Full symbolic debug info. No pdb. (See /Zi, /Zl).
 :: /GS	                Detect buffer overruns.
@@ -98,7 +99,7 @@ pushd msvc_landfill >nul
 :: /LIBPATH:<arg>       Specify library directory/directories.
 
 :: General Parameters
-@SET GeneralParameters=/W4 /WX /GA /Oi /Qpar /EHsc /GL /nologo /Ot /TP /std:c++latest
+@SET GeneralParameters=/W4 /WX /GA /Oi /Qpar /EHsc /GL /nologo /Ot /arch:AVX2 /TP /std:c++latest
 
 :: Debug Paramters
 @SET DebugParameters=/Od /W4 /WX /Z7 /MTd /D_ENGINE_DEBUG_
@@ -147,13 +148,31 @@ odbccp32.lib
 %SCRIPT_DIR%\..\..\include\stb\stb_image.c ^
 %SCRIPT_DIR%\..\..\src\common\logging.cpp ^
 %SCRIPT_DIR%\..\..\src\common\gl_tools.cpp ^
+%SCRIPT_DIR%\..\..\src\common\vertex_layout.cpp ^
 %SCRIPT_DIR%\..\..\src\common\app_window.cpp ^
 %SCRIPT_DIR%\..\..\src\common\camera.cpp ^
 %SCRIPT_DIR%\..\..\src\common\model.cpp ^
+%SCRIPT_DIR%\..\..\src\common\model_import.cpp ^
+%SCRIPT_DIR%\..\..\src\common\model_streaming.cpp ^
+%SCRIPT_DIR%\..\..\src\common\job_system.cpp ^
+%SCRIPT_DIR%\..\..\src\common\cooked_mesh.cpp ^
+%SCRIPT_DIR%\..\..\src\common\cooked_texture.cpp ^
+%SCRIPT_DIR%\..\..\src\common\mip_generator.cpp ^
+%SCRIPT_DIR%\..\..\src\common\block_compression.cpp ^
+%SCRIPT_DIR%\..\..\src\common\mesh_codec.cpp ^
+%SCRIPT_DIR%\..\..\src\common\mesh_tools.cpp ^
+%SCRIPT_DIR%\..\..\src\common\meshlet.cpp ^
+%SCRIPT_DIR%\..\..\src\common\bounds.cpp ^
+%SCRIPT_DIR%\..\..\src\common\tangent_space.cpp ^
+%SCRIPT_DIR%\..\..\src\common\gltf.cpp ^
 %SCRIPT_DIR%\..\..\src\common\object3.cpp ^
 %SCRIPT_DIR%\..\..\src\common\orientation.cpp ^
 %SCRIPT_DIR%\..\..\src\common\position.cpp ^
 %SCRIPT_DIR%\..\..\src\common\image_tools.cpp ^
+%SCRIPT_DIR%\..\..\src\common\image_decoding.cpp ^
+%SCRIPT_DIR%\..\..\src\common\texture_atlas.cpp ^
+%SCRIPT_DIR%\..\..\src\common\texture_cache.cpp ^
+%SCRIPT_DIR%\..\..\src\common\texture_streaming.cpp ^
 %SCRIPT_DIR%\..\..\src\common\fileio.cpp ^
 %SCRIPT_DIR%\..\..\src\common\state_tools.cpp ^
 %SCRIPT_DIR%\..\..\src\common\timer.cpp ^
@@ -8,8 +8,11 @@
 #include "gl_tools.h"
 #include "image_tools.h"
 #include "logging.h"
+#include "mesh_tools.h"
 #include "model.h"
+#include "model_streaming.h"
 #include "state_tools.h"
+#include "texture_streaming.h"
 #include "timer.h"
 #include "windows_platform.h"
 
@@ -23,6 +26,9 @@ GLuint projection_matrix_uniform_location;
 std::stack<glm::mat4> matrix_stack = {};
 Camera                camera;
 TexturedModel         test_model;
+ModelStreamer         model_streamer;
+ModelLoadHandle       test_model_load;
+TextureStreamer       texture_streamer;
 Timer                 timer;
 float                 display_loop_miliseconds = 0.0f;
 
@@ -32,6 +38,18 @@ struct DisplayVars
 };
 DisplayVars dv;
 
+constexpr float test_model_scale = 4.25f;
+
+// Note: Streamed models are uploaded within this much of each frame.
+constexpr size_t model_upload_budget_bytes        = 8 << 20;
+constexpr float  model_upload_budget_milliseconds = 2.0f;
+
+// Note: Streamed texture levels are uploaded within this much of each frame, and kept resident
+//       within the residency budget.
+constexpr size_t texture_upload_budget_bytes        = 4 << 20;
+constexpr float  texture_upload_budget_milliseconds = 1.0f;
+constexpr size_t texture_residency_budget_bytes     = 64 << 20;
+
 void
 DisplayLoop(bool& _success_out)
 {
@@ -59,6 +77,28 @@ DisplayLoop(bool& _success_out)
         glfn::DepthFunc(GL_LEQUAL);
     }
 
+    //
+    // Model Streaming
+    //
+    {
+        ModelUploadReport upload_report;
+        model_streamer.UploadLoadedModels(std::move(model_upload_budget_bytes),
+                                          std::move(model_upload_budget_milliseconds),
+                                          upload_report);
+
+        if (ModelLoadStatus::FAILED == test_model_load.GetStatus())
+        {
+            Log_e("Unable to stream in the test model.");
+            _success_out = false;
+            return;
+        }
+
+        TextureStreamingReport streaming_report;
+        texture_streamer.Update(std::move(texture_upload_budget_bytes),
+                                std::move(texture_upload_budget_milliseconds),
+                                streaming_report);
+    }
+
     //
     // Camera -- LookAt
     //
@@ -69,8 +109,9 @@ DisplayLoop(bool& _success_out)
     }
 
     //
-    // Test Model
+    // Test Model, once streamed in
     //
+    if (ModelLoadStatus::UPLOADED == test_model_load.GetStatus())
     {
         // Matrix Stacks
         test_model.GetPosition(dv.v3.x, dv.v3.y, dv.v3.z);
@@ -85,7 +126,37 @@ DisplayLoop(bool& _success_out)
 
         matrix_stack.push(matrix_stack.top()); // Scale slot
         matrix_stack.top() *= glm::scale(glm::mat4(1.0f),
-                                         glm::vec3(4.25f, 4.25f, 4.25f)); // Scale matrix
+                                         glm::vec3(test_model_scale)); // Scale matrix
+
+        // Level of detail: errors are in model units, so the distance is scaled to match.
+        {
+            glm::vec3 camera_position;
+            camera.GetPosition(camera_position.x, camera_position.y, camera_position.z);
+
+            const float projection_scale = state_cache->window_state.p_mat[1][1] *
+                                           static_cast<float>(
+                                             state_cache->window_state.window_height) *
+                                           0.5f;
+            const float distance = glm::distance(camera_position, dv.v3);
+
+            // Note: Streamed textures are prioritized by the model's size on screen, in pixels.
+            test_model.SetStreamedTexturePriority(projection_scale * test_model_scale /
+                                                  std::max(distance, 1.0f));
+
+            test_model.SelectLevelOfDetail(distance / test_model_scale,
+                                           std::move(projection_scale),
+                                           1.0f);
+        }
+
+        // Meshlet culling: the frustum and the camera are taken into model space.
+        {
+            const glm::mat4& model_view_matrix = matrix_stack.top();
+
+            MeshletCullingStatistics meshlet_culling_statistics;
+            test_model.CullMeshlets(state_cache->window_state.p_mat * model_view_matrix,
+                                    glm::vec3(glm::inverse(model_view_matrix)[3]),
+                                    meshlet_culling_statistics);
+        }
 
         // Copy matrices to corresponding uniform values (no view yet).
         test_model.ModifyUniformMatrix(std::move(state_cache->opengl_state->program_id),
@@ -133,36 +204,76 @@ SetupModels(bool& _success_out)
     camera.SetPosition(0.0f, 0.0f, 15.0f);
     test_model.SetPosition(0.0f, 0.0f, 0.0f);
 
-    GLuint test_model_vao = 0;
-    test_model.AddVertexArrayObject(_success_out, test_model_vao);
+    model_streamer.Start(_success_out, 0);
     if (false == _success_out)
     {
-        Log_e("Unable to add a vertex array object.");
+        Log_e("Unable to start the model streamer.");
         return;
     }
 
-    size_t                                      vertex_count;
-    std::vector<float>                          buffer_data;
-    std::vector<GLuint>                         buffer_elements_array;
-    std::vector<glt::VertexDataType>            vertex_data_type_order;
-    std::vector<glt::VertexAttributeDescriptor> vertex_attribute_pointers;
+    texture_streamer.Start(_success_out, 0, std::move(texture_residency_budget_bytes));
+    if (false == _success_out)
+    {
+        Log_e("Unable to start the texture streamer.");
+        return;
+    }
 
     // Attribute indices from shader layout declarations.
     constexpr GLuint position_attribute_index = 0;
     constexpr GLuint normal_attribute_index = 1; // Note: currently unused, but required for import.
     constexpr GLuint texture_coordinates_attribute_index = 2;
 
-    LoadModelFromAsciiPlyFile(_success_out,
-                              std::move(test_model_vao),
-                              "./../src/common/test_assets/blender_monkey.ply",
-                              std::move(position_attribute_index),
-                              std::move(normal_attribute_index),
-                              std::move(texture_coordinates_attribute_index),
-                              vertex_count,
-                              buffer_data,
-                              buffer_elements_array,
-                              vertex_data_type_order,
-                              vertex_attribute_pointers);
+    ModelLoadOptions test_model_load_options;
+    test_model_load_options.position_attribute_index            = position_attribute_index;
+    test_model_load_options.normal_attribute_index              = normal_attribute_index;
+    test_model_load_options.texture_coordinates_attribute_index =
+      texture_coordinates_attribute_index;
+
+    // Note: The texture needs the vertex buffer, so it is added once the model is uploaded.
+    model_streamer.LoadModel(
+      _success_out,
+      "./../src/common/test_assets/blender_monkey.ply",
+      test_model,
+      test_model_load_options,
+      [texture_coordinates_attribute_index](bool& _upload_success_out, const GLuint& _vbo_id_in)
+      {
+          // Note: The texture is streamed when it was cooked, and loaded whole otherwise.
+          GLuint texture_id;
+          test_model.AddStreamedTexture(_upload_success_out,
+                                        texture_streamer,
+                                        "./../src/common/test_assets/brick.png",
+                                        std::move(_vbo_id_in),
+                                        std::move(texture_coordinates_attribute_index),
+                                        GL_TEXTURE0,
+                                        GL_TEXTURE_2D,
+                                        texture_id);
+          if (false == _upload_success_out)
+          {
+              Log_w("Unable to stream texture; loading it instead.");
+              test_model.AddTexture(_upload_success_out,
+                                    "./../src/common/test_assets/brick.png",
+                                    std::move(_vbo_id_in),
+                                    std::move(texture_coordinates_attribute_index),
+                                    GL_TEXTURE0,
+                                    GL_TEXTURE_2D,
+                                    texture_id);
+          }
+
+          if (false == _upload_success_out)
+          {
+              Log_e("Unable to add texture.");
+              return;
+          }
+
+          test_model.EnableTexture(_upload_success_out, std::move(texture_id));
+
+          if (false == _upload_success_out)
+          {
+              Log_e("Unable to enable texture.");
+              return;
+          }
+      },
+      test_model_load);
 
     if (false == _success_out)
     {
@@ -170,102 +281,30 @@ SetupModels(bool& _success_out)
         return;
     }
 
-    // [ cfarvin::TODO ] Should this "Test Model" scope resolution operator be moved up a few lines?
-    // Test Model
+    // Add matrices.
     {
-        const GLenum draw_type                     = GL_TRIANGLES;
-        GLuint       test_model_pos_norm_tc_vbo_id = 0;
+        const state::StateCache* const state_cache = state::StateCache::GetInstance();
 
-        //  Packed: positions, normals, texture coordinates.
-        {
-            test_model_pos_norm_tc_vbo_id = test_model.AddArrayBuffer(
-              _success_out,
-              buffer_data.data(),
-              buffer_data.size() * sizeof(GL_FLOAT),
-              static_cast<GLsizei>(vertex_count),
-              GL_STATIC_DRAW,
-              std::move(draw_type),
-              vertex_attribute_pointers);
-
-            if (false == _success_out)
-            {
-                Log_e("Unable to create position buffer.");
-                return;
-            }
-
-            test_model.EnableVertexAttribute(_success_out, std::move(position_attribute_index));
-
-            if (false == _success_out)
-            {
-                Log_e("Unable to enable position vertex attribute.");
-                return;
-            }
-        }
-
-        // ElementArray
-        {
-            test_model.AddElementBuffer(_success_out,
-                                        buffer_elements_array.data(),
-                                        buffer_elements_array.size() * sizeof(GL_UNSIGNED_INT),
-                                        static_cast<GLsizei>(buffer_elements_array.size()),
-                                        GL_STATIC_DRAW,
-                                        std::move(draw_type));
-
-            if (false == _success_out)
-            {
-                Log_e("Unable to add element buffer.");
-                return;
-            }
-        }
+        // [ cfarvin::TEMPORARY ] There is currently only one rendering program in use.
+        test_model.AddUniformMatrix(_success_out,
+                                    std::move(state_cache->opengl_state->program_id),
+                                    MatrixType::mtMODEL_VIEW_MATRIX,
+                                    "mv_matrix");
 
-        // Texture image.
-        {
-            GLuint texture_id;
-            test_model.AddTexture(_success_out,
-                                  "./../src/common/test_assets/brick.png",
-                                  std::move(test_model_pos_norm_tc_vbo_id),
-                                  std::move(texture_coordinates_attribute_index),
-                                  GL_TEXTURE0,
-                                  GL_TEXTURE_2D,
-                                  texture_id);
-
-            if (false == _success_out)
-            {
-                Log_e("Unable to add texture.");
-                return;
-            }
-
-            test_model.EnableVertexAttribute(_success_out,
-                                             std::move(texture_coordinates_attribute_index));
-
-            if (false == _success_out)
-            {
-                Log_e("Unable to enable texture coordinate vertex attribute.");
-                return;
-            }
-
-            test_model.EnableTexture(_success_out, std::move(texture_id));
-
-            if (false == _success_out)
-            {
-                Log_e("Unable to enable texture.");
-                return;
-            }
-        }
-
-        // Add matrices.
+        test_model.ModifyUniformMatrix(std::move(state_cache->opengl_state->program_id),
+                                       MatrixType::mtMODEL_VIEW_MATRIX,
+                                       glm::mat4(1.0f));
+
+        // Note: The vertex shader transforms texture coordinates for atlas textures; the test
+        //       model's texture is not one, and is drawn with the identity transform.
+        test_model.SetTextureCoordinatesTransformUniform(
+          _success_out,
+          std::move(state_cache->opengl_state->program_id),
+          "texture_coordinates_transform");
+        if (false == _success_out)
         {
-            const state::StateCache* const state_cache = state::StateCache::GetInstance();
-
-            // [ cfarvin::TEMPORARY ] There is currently only one rendering program in use.
-            test_model.AddUniformMatrix(_success_out,
-                                        std::move(state_cache->opengl_state->program_id),
-                                        MatrixType::mtMODEL_VIEW_MATRIX,
-                                        "mv_matrix");
-
-            test_model.ModifyUniformMatrix(std::move(state_cache->opengl_state->program_id),
-                                           MatrixType::mtMODEL_VIEW_MATRIX,
-                                           glm::mat4(1.0f));
+            Log_e("Unable to set the texture coordinates transform uniform.");
+            return;
         }
     }
 
@@ -379,6 +418,8 @@ main()
         Log_e("Error during render loop.");
     }
 
+    test_model.ReleaseTextures();
+    texture_streamer.Stop();
     state_cache->DumpState();
 
     if (true == success)
@@ -7,6 +7,9 @@ layout (location = 2) in vec2 _texture_coordinates;
 uniform mat4 proj_matrix;
 uniform mat4 mv_matrix;
 
+// Note: Maps texture coordinates onto a texture atlas sub-image; (1, 1, 0, 0) otherwise.
+uniform vec4 texture_coordinates_transform;
+
 out vec2 texture_coordinates;
 out vec3 position;
 
@@ -72,6 +75,7 @@ mat4 GetRotateZMatrix(float rad)
 void main()
 {
     gl_Position = proj_matrix * mv_matrix * vec4(_position, 1.0);
-    texture_coordinates = _texture_coordinates;
+    texture_coordinates = (_texture_coordinates * texture_coordinates_transform.xy) +
+                          texture_coordinates_transform.zw;
     position = _position;
 }
@@ -0,0 +1,1682 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "block_compression.h"
+
+#include "logging.h"
+
+// Note: Rows of blocks are split into tiles of at least this many blocks, one job each.
+constexpr size_t block_tile_minimum_block_count = 1024;
+
+// Note: Of the 64 BC7 two subset partitions, the best estimated are encoded in full.
+constexpr size_t bc7_mode_1_candidate_partition_count = 4;
+
+constexpr size_t block_refinement_iteration_count = 2;
+
+// Note: Palette position of each index, as a fraction of the way from the first endpoint to the
+//       second.
+constexpr float bc1_index_weights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+constexpr float bc4_index_weights[8] = { 0.0f,        1.0f,        1.0f / 7.0f, 2.0f / 7.0f,
+                                         3.0f / 7.0f, 4.0f / 7.0f, 5.0f / 7.0f, 6.0f / 7.0f };
+
+// Note: BC7 interpolation weights, out of 64, for three and four bit indices.
+constexpr int bc7_weights_3[8]  = { 0, 9, 18, 27, 37, 46, 55, 64 };
+constexpr int bc7_weights_4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+// Note: BC7 two subset partitions; bit `pixel` is set for pixels of the second subset.
+constexpr uint16_t bc7_partitions_2[64] = {
+    0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80,
+    0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000, 0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310,
+    0x3100, 0x8CCE, 0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C, 0xAAAA,
+    0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC,
+    0x6996, 0xC33C, 0x9966, 0x0660, 0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6,
+    0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+};
+
+// Note: The pixel of the second subset whose index drops its most significant bit.
+constexpr uint8_t bc7_anchors_2[64] = { 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+                                        15, 15, 15, 15, 2,  8,  2,  2,  8,  8,  15, 2,  8,
+                                        2,  2,  8,  8,  2,  2,  15, 15, 6,  8,  2,  8,  15,
+                                        15, 2,  8,  2,  2,  2,  15, 15, 6,  6,  2,  6,  8,
+                                        15, 15, 2,  2,  15, 15, 15, 15, 15, 2,  2,  15 };
+
+// Note: Planar, such that four pixels fill one SSE register.
+struct PixelBlock
+{
+    alignas(16) float channels[4][16];
+};
+
+// Note: Endpoints of a line through color space, before they are quantized.
+struct BlockEndpoints
+{
+    float start[4] = { 0.0f };
+    float end[4]   = { 0.0f };
+};
+
+struct Bc1Block
+{
+    uint16_t color_0     = 0;
+    uint16_t color_1     = 0;
+    uint8_t  indices[16] = { 0 };
+    float    error       = std::numeric_limits<float>::max();
+};
+
+struct Bc4Block
+{
+    uint8_t endpoint_0  = 0;
+    uint8_t endpoint_1  = 0;
+    uint8_t indices[16] = { 0 };
+    float   error       = std::numeric_limits<float>::max();
+};
+
+// Note: Endpoints are stored as seven bits, and extended to eight by a bit per endpoint.
+struct Bc7Mode6Block
+{
+    uint8_t endpoints[2][4] = { { 0 } };
+    uint8_t p_bits[2]       = { 0 };
+    uint8_t indices[16]     = { 0 };
+    float   error           = std::numeric_limits<float>::max();
+};
+
+// Note: Endpoints are stored as six bits, and extended by a bit per subset; alpha is opaque.
+struct Bc7Mode1Block
+{
+    uint8_t partition          = 0;
+    uint8_t endpoints[2][2][3] = { { { 0 } } };
+    uint8_t p_bits[2]          = { 0 };
+    uint8_t indices[16]        = { 0 };
+    float   error              = std::numeric_limits<float>::max();
+};
+
+static inline bool
+IsPixelInMask(const uint16_t& _pixel_mask_in, const int& _pixel_in)
+{
+    return 0 != ((_pixel_mask_in >> _pixel_in) & 1);
+}
+
+static void
+LoadPixelBlock(const unsigned char* const _image_data_in,
+               const int&                 _image_width_in,
+               const int&                 _image_height_in,
+               const int&                 _block_column_in,
+               const int&                 _block_row_in,
+               PixelBlock&                _pixel_block_out)
+{
+    for (int row = 0; row < 4; row++)
+    {
+        const size_t image_row = std::min((_block_row_in * 4) + row, _image_height_in - 1);
+        for (int column = 0; column < 4; column++)
+        {
+            const size_t image_column = std::min((_block_column_in * 4) + column,
+                                                 _image_width_in - 1);
+            const unsigned char* const pixel = _image_data_in +
+                                               (((image_row * _image_width_in) + image_column) *
+                                                4);
+            for (int channel = 0; channel < 4; channel++)
+            {
+                _pixel_block_out.channels[channel][(row * 4) + column] = pixel[channel];
+            }
+        }
+    }
+}
+
+// Note: Gives each pixel of `_pixel_mask_in` the index of the nearest palette entry over the
+//       channels [`_first_channel_in`, `_first_channel_in` + `_channel_count_in`), and returns
+//       their summed squared error. Other pixels keep their index.
+static float
+AssignBlockIndices(const PixelBlock& _pixel_block_in,
+                   const int&        _first_channel_in,
+                   const int&        _channel_count_in,
+                   const float (*const _palette_in)[4],
+                   const int&      _palette_size_in,
+                   const uint16_t& _pixel_mask_in,
+                   uint8_t (&_indices_in_out)[16])
+{
+    const int end_channel = _first_channel_in + _channel_count_in;
+
+    alignas(16) float   errors[16];
+    alignas(16) int32_t indices[16];
+#if defined(_ENGINE_SIMD_SSE_)
+    for (int quad = 0; quad < 4; quad++)
+    {
+        __m128  best_error = _mm_set1_ps(std::numeric_limits<float>::max());
+        __m128i best_index = _mm_setzero_si128();
+        for (int entry = 0; entry < _palette_size_in; entry++)
+        {
+            __m128 error = _mm_setzero_ps();
+            for (int channel = _first_channel_in; channel < end_channel; channel++)
+            {
+                const __m128 difference = _mm_sub_ps(
+                  _mm_load_ps(&_pixel_block_in.channels[channel][quad * 4]),
+                  _mm_set1_ps(_palette_in[entry][channel]));
+                error = _mm_add_ps(error, _mm_mul_ps(difference, difference));
+            }
+
+            const __m128i closer = _mm_castps_si128(_mm_cmplt_ps(error, best_error));
+            best_error           = _mm_min_ps(error, best_error);
+            best_index           = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(entry)),
+                                      _mm_andnot_si128(closer, best_index));
+        }
+
+        _mm_store_ps(errors + (quad * 4), best_error);
+        _mm_store_si128(reinterpret_cast<__m128i*>(indices + (quad * 4)), best_index);
+    }
+#else
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        errors[pixel]  = std::numeric_limits<float>::max();
+        indices[pixel] = 0;
+        for (int entry = 0; entry < _palette_size_in; entry++)
+        {
+            float error = 0.0f;
+            for (int channel = _first_channel_in; channel < end_channel; channel++)
+            {
+                const float difference = _pixel_block_in.channels[channel][pixel] -
+                                         _palette_in[entry][channel];
+                error += difference * difference;
+            }
+
+            if (error < errors[pixel])
+            {
+                errors[pixel]  = error;
+                indices[pixel] = entry;
+            }
+        }
+    }
+#endif // _ENGINE_SIMD_SSE_
+
+    float error_sum = 0.0f;
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        if (true == IsPixelInMask(_pixel_mask_in, pixel))
+        {
+            _indices_in_out[pixel] = static_cast<uint8_t>(indices[pixel]);
+            error_sum += errors[pixel];
+        }
+    }
+
+    return error_sum;
+}
+
+// Note: Spans the bounding box of the pixels, along the diagonal which follows their correlation
+//       with the widest channel, inset by a sixteenth of each channel's range.
+static void
+FitEndpointsToExtent(const PixelBlock& _pixel_block_in,
+                     const int&        _first_channel_in,
+                     const int&        _channel_count_in,
+                     const uint16_t&   _pixel_mask_in,
+                     BlockEndpoints&   _endpoints_out)
+{
+    const int end_channel = _first_channel_in + _channel_count_in;
+
+    float minimum[4] = { 255.0f, 255.0f, 255.0f, 255.0f };
+    float maximum[4] = { 0.0f };
+    float mean[4]    = { 0.0f };
+    int   count      = 0;
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        if (false == IsPixelInMask(_pixel_mask_in, pixel))
+        {
+            continue;
+        }
+
+        count++;
+        for (int channel = _first_channel_in; channel < end_channel; channel++)
+        {
+            const float value = _pixel_block_in.channels[channel][pixel];
+            minimum[channel]  = std::min(minimum[channel], value);
+            maximum[channel]  = std::max(maximum[channel], value);
+            mean[channel] += value;
+        }
+    }
+
+    int widest_channel = _first_channel_in;
+    for (int channel = _first_channel_in; channel < end_channel; channel++)
+    {
+        mean[channel] /= std::max(count, 1);
+        if ((maximum[channel] - minimum[channel]) >
+            (maximum[widest_channel] - minimum[widest_channel]))
+        {
+            widest_channel = channel;
+        }
+    }
+
+    for (int channel = _first_channel_in; channel < end_channel; channel++)
+    {
+        float covariance = 0.0f;
+        for (int pixel = 0; pixel < 16; pixel++)
+        {
+            if (true == IsPixelInMask(_pixel_mask_in, pixel))
+            {
+                covariance += (_pixel_block_in.channels[widest_channel][pixel] -
+                               mean[widest_channel]) *
+                              (_pixel_block_in.channels[channel][pixel] - mean[channel]);
+            }
+        }
+
+        if (0.0f > covariance)
+        {
+            std::swap(minimum[channel], maximum[channel]);
+        }
+
+        const float inset             = (maximum[channel] - minimum[channel]) / 16.0f;
+        _endpoints_out.start[channel] = minimum[channel] + inset;
+        _endpoints_out.end[channel]   = maximum[channel] - inset;
+    }
+}
+
+// Note: Spans the projection of the pixels onto their principal axis, found by power iteration
+//       on their covariance.
+static void
+FitEndpointsToPrincipalAxis(const PixelBlock& _pixel_block_in,
+                            const int&        _first_channel_in,
+                            const int&        _channel_count_in,
+                            const uint16_t&   _pixel_mask_in,
+                            BlockEndpoints&   _endpoints_out)
+{
+    constexpr size_t power_iteration_count = 8;
+
+    const int end_channel = _first_channel_in + _channel_count_in;
+
+    float mean[4] = { 0.0f };
+    int   count   = 0;
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        if (true == IsPixelInMask(_pixel_mask_in, pixel))
+        {
+            count++;
+            for (int channel = _first_channel_in; channel < end_channel; channel++)
+            {
+                mean[channel] += _pixel_block_in.channels[channel][pixel];
+            }
+        }
+    }
+
+    for (int channel = _first_channel_in; channel < end_channel; channel++)
+    {
+        mean[channel] /= std::max(count, 1);
+    }
+
+    float covariance[4][4] = { { 0.0f } };
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        if (false == IsPixelInMask(_pixel_mask_in, pixel))
+        {
+            continue;
+        }
+
+        for (int row = _first_channel_in; row < end_channel; row++)
+        {
+            for (int column = _first_channel_in; column < end_channel; column++)
+            {
+                covariance[row][column] += (_pixel_block_in.channels[row][pixel] - mean[row]) *
+                                           (_pixel_block_in.channels[column][pixel] -
+                                            mean[column]);
+            }
+        }
+    }
+
+    // Note: Starting from the covariance of the widest channel keeps the axis from starting
+    //       orthogonal to the principal one.
+    int widest_channel = _first_channel_in;
+    for (int channel = _first_channel_in; channel < end_channel; channel++)
+    {
+        if (covariance[channel][channel] > covariance[widest_channel][widest_channel])
+        {
+            widest_channel = channel;
+        }
+    }
+
+    float axis[4] = { 0.0f };
+    for (int channel = _first_channel_in; channel < end_channel; channel++)
+    {
+        axis[channel] = covariance[widest_channel][channel];
+    }
+
+    float axis_length_squared = 0.0f;
+    for (size_t iteration = 0; iteration < power_iteration_count; iteration++)
+    {
+        float next_axis[4] = { 0.0f };
+        for (int row = _first_channel_in; row < end_channel; row++)
+        {
+            for (int column = _first_channel_in; column < end_channel; column++)
+            {
+                next_axis[row] += covariance[row][column] * axis[column];
+            }
+        }
+
+        axis_length_squared = 0.0f;
+        for (int channel = _first_channel_in; channel < end_channel; channel++)
+        {
+            axis_length_squared += next_axis[channel] * next_axis[channel];
+        }
+
+        if (axis_length_squared < 1e-12f)
+        {
+            break;
+        }
+
+        const float inverse_axis_length = 1.0f / std::sqrt(axis_length_squared);
+        for (int channel = _first_channel_in; channel < end_channel; channel++)
+        {
+            axis[channel] = next_axis[channel] * inverse_axis_length;
+        }
+    }
+
+    float minimum_projection = 0.0f;
+    float maximum_projection = 0.0f;
+    if (axis_length_squared >= 1e-12f)
+    {
+        minimum_projection = std::numeric_limits<float>::max();
+        maximum_projection = -std::numeric_limits<float>::max();
+        for (int pixel = 0; pixel < 16; pixel++)
+        {
+            if (false == IsPixelInMask(_pixel_mask_in, pixel))
+            {
+                continue;
+            }
+
+            float projection = 0.0f;
+            for (int channel = _first_channel_in; channel < end_channel; channel++)
+            {
+                projection += (_pixel_block_in.channels[channel][pixel] - mean[channel]) *
+                              axis[channel];
+            }
+
+            minimum_projection = std::min(minimum_projection, projection);
+            maximum_projection = std::max(maximum_projection, projection);
+        }
+    }
+
+    for (int channel = _first_channel_in; channel < end_channel; channel++)
+    {
+        _endpoints_out.start[channel] = std::clamp(
+          mean[channel] + (axis[channel] * minimum_projection), 0.0f, 255.0f);
+        _endpoints_out.end[channel] = std::clamp(
+          mean[channel] + (axis[channel] * maximum_projection), 0.0f, 255.0f);
+    }
+}
+
+// Note: Solves for the endpoints which minimize the squared error of the pixels, given the
+//       palette position each was assigned. Fails when the positions do not span a line.
+static bool
+RefineEndpoints(const PixelBlock&  _pixel_block_in,
+                const int&         _first_channel_in,
+                const int&         _channel_count_in,
+                const uint16_t&    _pixel_mask_in,
+                const uint8_t (&_indices_in)[16],
+                const float* const _index_weights_in,
+                BlockEndpoints&    _endpoints_out)
+{
+    const int end_channel = _first_channel_in + _channel_count_in;
+
+    float start_start    = 0.0f;
+    float start_end      = 0.0f;
+    float end_end        = 0.0f;
+    float start_value[4] = { 0.0f };
+    float end_value[4]   = { 0.0f };
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        if (false == IsPixelInMask(_pixel_mask_in, pixel))
+        {
+            continue;
+        }
+
+        const float end_weight   = _index_weights_in[_indices_in[pixel]];
+        const float start_weight = 1.0f - end_weight;
+        start_start += start_weight * start_weight;
+        start_end += start_weight * end_weight;
+        end_end += end_weight * end_weight;
+        for (int channel = _first_channel_in; channel < end_channel; channel++)
+        {
+            start_value[channel] += start_weight * _pixel_block_in.channels[channel][pixel];
+            end_value[channel] += end_weight * _pixel_block_in.channels[channel][pixel];
+        }
+    }
+
+    const float determinant = (start_start * end_end) - (start_end * start_end);
+    if (std::abs(determinant) < 1e-6f)
+    {
+        return false;
+    }
+
+    for (int channel = _first_channel_in; channel < end_channel; channel++)
+    {
+        _endpoints_out.start[channel] = std::clamp(
+          ((end_end * start_value[channel]) - (start_end * end_value[channel])) / determinant,
+          0.0f,
+          255.0f);
+        _endpoints_out.end[channel] = std::clamp(
+          ((start_start * end_value[channel]) - (start_end * start_value[channel])) / determinant,
+          0.0f,
+          255.0f);
+    }
+
+    return true;
+}
+
+static inline void
+WriteBlockBits(unsigned char* const _block_in_out,
+               size_t&              _bit_offset_in_out,
+               const uint32_t&      _value_in,
+               const size_t&        _bit_count_in)
+{
+    for (size_t bit = 0; bit < _bit_count_in; bit++, _bit_offset_in_out++)
+    {
+        if (0 != ((_value_in >> bit) & 1))
+        {
+            _block_in_out[_bit_offset_in_out / 8] |= static_cast<unsigned char>(
+              1 << (_bit_offset_in_out % 8));
+        }
+    }
+}
+
+static inline uint32_t
+ReadBlockBits(const unsigned char* const _block_in,
+              size_t&                    _bit_offset_in_out,
+              const size_t&              _bit_count_in)
+{
+    uint32_t value = 0;
+    for (size_t bit = 0; bit < _bit_count_in; bit++, _bit_offset_in_out++)
+    {
+        value |= ((_block_in[_bit_offset_in_out / 8] >> (_bit_offset_in_out % 8)) & 1u) << bit;
+    }
+
+    return value;
+}
+
+//
+// BC1
+//
+static inline uint16_t
+PackColor565(const float (&_color_in)[4])
+{
+    const int red   = static_cast<int>((std::clamp(_color_in[0], 0.0f, 255.0f) * 31.0f / 255.0f) +
+                                     0.5f);
+    const int green = static_cast<int>((std::clamp(_color_in[1], 0.0f, 255.0f) * 63.0f / 255.0f) +
+                                       0.5f);
+    const int blue  = static_cast<int>((std::clamp(_color_in[2], 0.0f, 255.0f) * 31.0f / 255.0f) +
+                                      0.5f);
+    return static_cast<uint16_t>((red << 11) | (green << 5) | blue);
+}
+
+// Note: The four colors a BC1 color block selects from. Blocks whose first color is not greater
+//       than their second have three, and black, unless `_four_colors_in` as in BC3.
+static void
+BuildBc1Palette(const uint16_t& _color_0_in,
+                const uint16_t& _color_1_in,
+                const bool&     _four_colors_in,
+                int (&_palette_out)[4][4])
+{
+    const uint16_t colors[2] = { _color_0_in, _color_1_in };
+    for (int endpoint = 0; endpoint < 2; endpoint++)
+    {
+        const int red   = (colors[endpoint] >> 11) & 31;
+        const int green = (colors[endpoint] >> 5) & 63;
+        const int blue  = colors[endpoint] & 31;
+
+        _palette_out[endpoint][0] = (red << 3) | (red >> 2);
+        _palette_out[endpoint][1] = (green << 2) | (green >> 4);
+        _palette_out[endpoint][2] = (blue << 3) | (blue >> 2);
+        _palette_out[endpoint][3] = 255;
+    }
+
+    for (int channel = 0; channel < 3; channel++)
+    {
+        const int value_0 = _palette_out[0][channel];
+        const int value_1 = _palette_out[1][channel];
+        if ((true == _four_colors_in) || (_color_0_in > _color_1_in))
+        {
+            _palette_out[2][channel] = ((2 * value_0) + value_1) / 3;
+            _palette_out[3][channel] = (value_0 + (2 * value_1)) / 3;
+        }
+        else
+        {
+            _palette_out[2][channel] = (value_0 + value_1) / 2;
+            _palette_out[3][channel] = 0;
+        }
+    }
+
+    _palette_out[2][3] = 255;
+    _palette_out[3][3] = 255;
+}
+
+// Note: Always four colors. Equal endpoints select only the first.
+static void
+EvaluateBc1Endpoints(const PixelBlock&     _pixel_block_in,
+                     const BlockEndpoints& _endpoints_in,
+                     Bc1Block&             _bc1_block_out)
+{
+    _bc1_block_out.color_0 = PackColor565(_endpoints_in.start);
+    _bc1_block_out.color_1 = PackColor565(_endpoints_in.end);
+    if (_bc1_block_out.color_0 < _bc1_block_out.color_1)
+    {
+        std::swap(_bc1_block_out.color_0, _bc1_block_out.color_1);
+    }
+
+    int palette_values[4][4];
+    BuildBc1Palette(_bc1_block_out.color_0, _bc1_block_out.color_1, true, palette_values);
+
+    float palette[4][4];
+    for (int entry = 0; entry < 4; entry++)
+    {
+        for (int channel = 0; channel < 4; channel++)
+        {
+            palette[entry][channel] = static_cast<float>(palette_values[entry][channel]);
+        }
+    }
+
+    const int palette_size = (_bc1_block_out.color_0 == _bc1_block_out.color_1) ? 1 : 4;
+    _bc1_block_out.error   = AssignBlockIndices(_pixel_block_in,
+                                              0,
+                                              3,
+                                              palette,
+                                              palette_size,
+                                              0xFFFF,
+                                              _bc1_block_out.indices);
+}
+
+static void
+EncodeBc1Block(const PixelBlock&              _pixel_block_in,
+               const BlockCompressionQuality& _quality_in,
+               unsigned char* const           _block_out)
+{
+    BlockEndpoints endpoints;
+    Bc1Block       bc1_block;
+    FitEndpointsToExtent(_pixel_block_in, 0, 3, 0xFFFF, endpoints);
+    EvaluateBc1Endpoints(_pixel_block_in, endpoints, bc1_block);
+
+    if (BlockCompressionQuality::HIGH == _quality_in)
+    {
+        Bc1Block candidate;
+        FitEndpointsToPrincipalAxis(_pixel_block_in, 0, 3, 0xFFFF, endpoints);
+        EvaluateBc1Endpoints(_pixel_block_in, endpoints, candidate);
+        if (candidate.error < bc1_block.error)
+        {
+            bc1_block = candidate;
+        }
+
+        for (size_t iteration = 0; iteration < block_refinement_iteration_count; iteration++)
+        {
+            if (false == RefineEndpoints(_pixel_block_in,
+                                         0,
+                                         3,
+                                         0xFFFF,
+                                         bc1_block.indices,
+                                         bc1_index_weights,
+                                         endpoints))
+            {
+                break;
+            }
+
+            EvaluateBc1Endpoints(_pixel_block_in, endpoints, candidate);
+            if (candidate.error >= bc1_block.error)
+            {
+                break;
+            }
+
+            bc1_block = candidate;
+        }
+    }
+
+    uint32_t indices = 0;
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        indices |= static_cast<uint32_t>(bc1_block.indices[pixel]) << (pixel * 2);
+    }
+
+    std::memcpy(_block_out, &bc1_block.color_0, sizeof(uint16_t));
+    std::memcpy(_block_out + 2, &bc1_block.color_1, sizeof(uint16_t));
+    std::memcpy(_block_out + 4, &indices, sizeof(uint32_t));
+}
+
+static void
+DecodeBc1Block(const unsigned char* const _block_in,
+               const bool&                _four_colors_in,
+               unsigned char (&_pixels_out)[16][4])
+{
+    uint16_t color_0 = 0;
+    uint16_t color_1 = 0;
+    uint32_t indices = 0;
+    std::memcpy(&color_0, _block_in, sizeof(uint16_t));
+    std::memcpy(&color_1, _block_in + 2, sizeof(uint16_t));
+    std::memcpy(&indices, _block_in + 4, sizeof(uint32_t));
+
+    int palette[4][4];
+    BuildBc1Palette(color_0, color_1, _four_colors_in, palette);
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        const int index = (indices >> (pixel * 2)) & 3;
+        for (int channel = 0; channel < 4; channel++)
+        {
+            _pixels_out[pixel][channel] = static_cast<unsigned char>(palette[index][channel]);
+        }
+    }
+}
+
+//
+// BC4, the alpha block of BC3 and each channel of BC5
+//
+
+// Note: Eight values when the first endpoint is greater; six, zero and 255 otherwise.
+static void
+BuildBc4Palette(const int& _endpoint_0_in, const int& _endpoint_1_in, int (&_palette_out)[8])
+{
+    _palette_out[0] = _endpoint_0_in;
+    _palette_out[1] = _endpoint_1_in;
+    if (_endpoint_0_in > _endpoint_1_in)
+    {
+        for (int index = 2; index < 8; index++)
+        {
+            _palette_out[index] = (((8 - index) * _endpoint_0_in) +
+                                   ((index - 1) * _endpoint_1_in) + 3) /
+                                  7;
+        }
+    }
+    else
+    {
+        for (int index = 2; index < 6; index++)
+        {
+            _palette_out[index] = (((6 - index) * _endpoint_0_in) +
+                                   ((index - 1) * _endpoint_1_in) + 2) /
+                                  5;
+        }
+
+        _palette_out[6] = 0;
+        _palette_out[7] = 255;
+    }
+}
+
+static void
+EvaluateBc4Endpoints(const PixelBlock& _pixel_block_in,
+                     const int&        _channel_in,
+                     const int&        _endpoint_0_in,
+                     const int&        _endpoint_1_in,
+                     Bc4Block&         _bc4_block_out)
+{
+    _bc4_block_out.endpoint_0 = static_cast<uint8_t>(_endpoint_0_in);
+    _bc4_block_out.endpoint_1 = static_cast<uint8_t>(_endpoint_1_in);
+
+    int palette_values[8];
+    BuildBc4Palette(_endpoint_0_in, _endpoint_1_in, palette_values);
+
+    float palette[8][4] = { { 0.0f } };
+    for (int entry = 0; entry < 8; entry++)
+    {
+        palette[entry][_channel_in] = static_cast<float>(palette_values[entry]);
+    }
+
+    _bc4_block_out.error = AssignBlockIndices(_pixel_block_in,
+                                              _channel_in,
+                                              1,
+                                              palette,
+                                              8,
+                                              0xFFFF,
+                                              _bc4_block_out.indices);
+}
+
+static void
+EncodeBc4Block(const PixelBlock&              _pixel_block_in,
+               const int&                     _channel_in,
+               const BlockCompressionQuality& _quality_in,
+               unsigned char* const           _block_out)
+{
+    const float* const values = _pixel_block_in.channels[_channel_in];
+
+    float minimum = 255.0f;
+    float maximum = 0.0f;
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        minimum = std::min(minimum, values[pixel]);
+        maximum = std::max(maximum, values[pixel]);
+    }
+
+    Bc4Block bc4_block;
+    EvaluateBc4Endpoints(_pixel_block_in,
+                         _channel_in,
+                         static_cast<int>(maximum),
+                         static_cast<int>(minimum),
+                         bc4_block);
+
+    if ((BlockCompressionQuality::HIGH == _quality_in) && (maximum > minimum))
+    {
+        Bc4Block       candidate;
+        BlockEndpoints endpoints;
+        for (size_t iteration = 0; iteration < block_refinement_iteration_count; iteration++)
+        {
+            if ((bc4_block.endpoint_0 <= bc4_block.endpoint_1) ||
+                (false == RefineEndpoints(_pixel_block_in,
+                                          _channel_in,
+                                          1,
+                                          0xFFFF,
+                                          bc4_block.indices,
+                                          bc4_index_weights,
+                                          endpoints)))
+            {
+                break;
+            }
+
+            int endpoint_0 = static_cast<int>(endpoints.start[_channel_in] + 0.5f);
+            int endpoint_1 = static_cast<int>(endpoints.end[_channel_in] + 0.5f);
+            if (endpoint_0 == endpoint_1)
+            {
+                break;
+            }
+
+            if (endpoint_0 < endpoint_1)
+            {
+                std::swap(endpoint_0, endpoint_1);
+            }
+
+            EvaluateBc4Endpoints(_pixel_block_in, _channel_in, endpoint_0, endpoint_1, candidate);
+            if (candidate.error >= bc4_block.error)
+            {
+                break;
+            }
+
+            bc4_block = candidate;
+        }
+
+        // Note: Six values span only the pixels between the extremes, which zero and 255 cover.
+        float inner_minimum = 255.0f;
+        float inner_maximum = 0.0f;
+        for (int pixel = 0; pixel < 16; pixel++)
+        {
+            if ((0.0f < values[pixel]) && (255.0f > values[pixel]))
+            {
+                inner_minimum = std::min(inner_minimum, values[pixel]);
+                inner_maximum = std::max(inner_maximum, values[pixel]);
+            }
+        }
+
+        if (inner_minimum <= inner_maximum)
+        {
+            EvaluateBc4Endpoints(_pixel_block_in,
+                                 _channel_in,
+                                 static_cast<int>(inner_minimum),
+                                 static_cast<int>(inner_maximum),
+                                 candidate);
+            if (candidate.error < bc4_block.error)
+            {
+                bc4_block = candidate;
+            }
+        }
+    }
+
+    uint64_t indices = 0;
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        indices |= static_cast<uint64_t>(bc4_block.indices[pixel]) << (pixel * 3);
+    }
+
+    _block_out[0] = bc4_block.endpoint_0;
+    _block_out[1] = bc4_block.endpoint_1;
+    for (int byte = 0; byte < 6; byte++)
+    {
+        _block_out[2 + byte] = static_cast<unsigned char>(indices >> (byte * 8));
+    }
+}
+
+static void
+DecodeBc4Block(const unsigned char* const _block_in,
+               const int&                 _channel_in,
+               unsigned char (&_pixels_out)[16][4])
+{
+    int palette[8];
+    BuildBc4Palette(_block_in[0], _block_in[1], palette);
+
+    uint64_t indices = 0;
+    for (int byte = 0; byte < 6; byte++)
+    {
+        indices |= static_cast<uint64_t>(_block_in[2 + byte]) << (byte * 8);
+    }
+
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        _pixels_out[pixel][_channel_in] = static_cast<unsigned char>(
+          palette[(indices >> (pixel * 3)) & 7]);
+    }
+}
+
+//
+// BC7
+//
+static inline int
+InterpolateBc7(const int& _endpoint_0_in, const int& _endpoint_1_in, const int& _weight_in)
+{
+    return (((64 - _weight_in) * _endpoint_0_in) + (_weight_in * _endpoint_1_in) + 32) >> 6;
+}
+
+static inline int
+ExpandBc7Mode1Endpoint(const int& _endpoint_in, const int& _p_bit_in)
+{
+    const int endpoint = (_endpoint_in << 1) | _p_bit_in;
+    return (endpoint << 1) | (endpoint >> 6);
+}
+
+// Note: Chooses each endpoint's bit along with its seven bits, to the least error overall.
+static void
+QuantizeBc7Mode6Endpoint(const float (&_endpoint_in)[4],
+                         uint8_t (&_endpoint_out)[4],
+                         uint8_t& _p_bit_out)
+{
+    float best_error = std::numeric_limits<float>::max();
+    for (int p_bit = 0; p_bit < 2; p_bit++)
+    {
+        uint8_t endpoint[4];
+        float   error = 0.0f;
+        for (int channel = 0; channel < 4; channel++)
+        {
+            const int   value      = std::clamp(
+              static_cast<int>(std::lround((_endpoint_in[channel] - p_bit) / 2.0f)), 0, 127);
+            const float difference = static_cast<float>((value << 1) | p_bit) -
+                                     _endpoint_in[channel];
+            endpoint[channel]      = static_cast<uint8_t>(value);
+            error += difference * difference;
+        }
+
+        if (error < best_error)
+        {
+            best_error = error;
+            std::memcpy(_endpoint_out, endpoint, sizeof(endpoint));
+            _p_bit_out = static_cast<uint8_t>(p_bit);
+        }
+    }
+}
+
+static void
+EvaluateBc7Mode6Endpoints(const PixelBlock&     _pixel_block_in,
+                          const BlockEndpoints& _endpoints_in,
+                          Bc7Mode6Block&        _bc7_block_out)
+{
+    QuantizeBc7Mode6Endpoint(_endpoints_in.start,
+                             _bc7_block_out.endpoints[0],
+                             _bc7_block_out.p_bits[0]);
+    QuantizeBc7Mode6Endpoint(_endpoints_in.end,
+                             _bc7_block_out.endpoints[1],
+                             _bc7_block_out.p_bits[1]);
+
+    float palette[16][4];
+    for (int channel = 0; channel < 4; channel++)
+    {
+        const int endpoint_0 = (_bc7_block_out.endpoints[0][channel] << 1) |
+                               _bc7_block_out.p_bits[0];
+        const int endpoint_1 = (_bc7_block_out.endpoints[1][channel] << 1) |
+                               _bc7_block_out.p_bits[1];
+        for (int entry = 0; entry < 16; entry++)
+        {
+            palette[entry][channel] = static_cast<float>(
+              InterpolateBc7(endpoint_0, endpoint_1, bc7_weights_4[entry]));
+        }
+    }
+
+    _bc7_block_out.error = AssignBlockIndices(_pixel_block_in,
+                                              0,
+                                              4,
+                                              palette,
+                                              16,
+                                              0xFFFF,
+                                              _bc7_block_out.indices);
+}
+
+// Note: Chooses the subset's shared bit along with both endpoints' six bits.
+static void
+QuantizeBc7Mode1Subset(const BlockEndpoints& _endpoints_in,
+                       uint8_t (&_endpoints_out)[2][3],
+                       uint8_t& _p_bit_out)
+{
+    const float* const endpoints[2] = { _endpoints_in.start, _endpoints_in.end };
+
+    float best_error = std::numeric_limits<float>::max();
+    for (int p_bit = 0; p_bit < 2; p_bit++)
+    {
+        uint8_t quantized[2][3];
+        float   error = 0.0f;
+        for (int endpoint = 0; endpoint < 2; endpoint++)
+        {
+            for (int channel = 0; channel < 3; channel++)
+            {
+                const int estimate        = static_cast<int>(endpoints[endpoint][channel] / 4.0f);
+                float     best_difference = std::numeric_limits<float>::max();
+                for (int value = std::max(estimate - 1, 0); value <= std::min(estimate + 1, 63);
+                     value++)
+                {
+                    const float difference = std::abs(
+                      static_cast<float>(ExpandBc7Mode1Endpoint(value, p_bit)) -
+                      endpoints[endpoint][channel]);
+                    if (difference < best_difference)
+                    {
+                        best_difference              = difference;
+                        quantized[endpoint][channel] = static_cast<uint8_t>(value);
+                    }
+                }
+
+                error += best_difference * best_difference;
+            }
+        }
+
+        if (error < best_error)
+        {
+            best_error = error;
+            std::memcpy(_endpoints_out, quantized, sizeof(quantized));
+            _p_bit_out = static_cast<uint8_t>(p_bit);
+        }
+    }
+}
+
+static inline uint16_t
+GetBc7SubsetMask(const int& _partition_in, const int& _subset_in)
+{
+    return (0 == _subset_in) ? static_cast<uint16_t>(~bc7_partitions_2[_partition_in])
+                             : bc7_partitions_2[_partition_in];
+}
+
+static void
+EvaluateBc7Mode1Endpoints(const PixelBlock& _pixel_block_in,
+                          const int&        _partition_in,
+                          const BlockEndpoints (&_subset_endpoints_in)[2],
+                          Bc7Mode1Block& _bc7_block_out)
+{
+    _bc7_block_out.partition = static_cast<uint8_t>(_partition_in);
+    _bc7_block_out.error     = 0.0f;
+    for (int subset = 0; subset < 2; subset++)
+    {
+        QuantizeBc7Mode1Subset(_subset_endpoints_in[subset],
+                               _bc7_block_out.endpoints[subset],
+                               _bc7_block_out.p_bits[subset]);
+
+        float palette[8][4];
+        for (int channel = 0; channel < 3; channel++)
+        {
+            const int endpoint_0 = ExpandBc7Mode1Endpoint(
+              _bc7_block_out.endpoints[subset][0][channel], _bc7_block_out.p_bits[subset]);
+            const int endpoint_1 = ExpandBc7Mode1Endpoint(
+              _bc7_block_out.endpoints[subset][1][channel], _bc7_block_out.p_bits[subset]);
+            for (int entry = 0; entry < 8; entry++)
+            {
+                palette[entry][channel] = static_cast<float>(
+                  InterpolateBc7(endpoint_0, endpoint_1, bc7_weights_3[entry]));
+            }
+        }
+
+        _bc7_block_out.error += AssignBlockIndices(_pixel_block_in,
+                                                   0,
+                                                   3,
+                                                   palette,
+                                                   8,
+                                                   GetBc7SubsetMask(_partition_in, subset),
+                                                   _bc7_block_out.indices);
+    }
+}
+
+// Note: Estimates how well a line fits each subset of every partition, by the scatter of its
+//       pixels off their principal axis, and returns the best estimated partitions first.
+static void
+RankBc7Mode1Partitions(const PixelBlock& _pixel_block_in,
+                       int (&_partitions_out)[bc7_mode_1_candidate_partition_count])
+{
+    // Note: Per pixel: 1, r, g, b, rr, rg, rb, gg, gb, bb; summed, they give a subset's scatter.
+    constexpr int moment_count = 10;
+
+    float pixel_moments[16][moment_count];
+    float block_moments[moment_count] = { 0.0f };
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        const float red   = _pixel_block_in.channels[0][pixel];
+        const float green = _pixel_block_in.channels[1][pixel];
+        const float blue  = _pixel_block_in.channels[2][pixel];
+        const float moments[moment_count] = { 1.0f,          red,           green,
+                                              blue,          red * red,     red * green,
+                                              red * blue,    green * green, green * blue,
+                                              blue * blue };
+        for (int moment = 0; moment < moment_count; moment++)
+        {
+            pixel_moments[pixel][moment] = moments[moment];
+            block_moments[moment] += moments[moment];
+        }
+    }
+
+    std::pair<float, int> partition_errors[64];
+    for (int partition = 0; partition < 64; partition++)
+    {
+        float subset_moments[2][moment_count] = { { 0.0f } };
+        for (int pixel = 0; pixel < 16; pixel++)
+        {
+            if (true == IsPixelInMask(bc7_partitions_2[partition], pixel))
+            {
+                for (int moment = 0; moment < moment_count; moment++)
+                {
+                    subset_moments[1][moment] += pixel_moments[pixel][moment];
+                }
+            }
+        }
+
+        float error = 0.0f;
+        for (int moment = 0; moment < moment_count; moment++)
+        {
+            subset_moments[0][moment] = block_moments[moment] - subset_moments[1][moment];
+        }
+
+        for (const float (&moments)[moment_count] : subset_moments)
+        {
+            const float count   = moments[0];
+            const float mean[3] = { moments[1] / count, moments[2] / count, moments[3] / count };
+            const float scatter[3][3] = {
+                { moments[4] - (count * mean[0] * mean[0]),
+                  moments[5] - (count * mean[0] * mean[1]),
+                  moments[6] - (count * mean[0] * mean[2]) },
+                { moments[5] - (count * mean[0] * mean[1]),
+                  moments[7] - (count * mean[1] * mean[1]),
+                  moments[8] - (count * mean[1] * mean[2]) },
+                { moments[6] - (count * mean[0] * mean[2]),
+                  moments[8] - (count * mean[1] * mean[2]),
+                  moments[9] - (count * mean[2] * mean[2]) }
+            };
+
+            float axis[3] = { 1.0f, 1.0f, 1.0f };
+            for (int iteration = 0; iteration < 4; iteration++)
+            {
+                float next_axis[3] = { 0.0f };
+                float length       = 0.0f;
+                for (int row = 0; row < 3; row++)
+                {
+                    next_axis[row] = (scatter[row][0] * axis[0]) + (scatter[row][1] * axis[1]) +
+                                     (scatter[row][2] * axis[2]);
+                    length         = std::max(length, std::abs(next_axis[row]));
+                }
+
+                if (length < 1e-6f)
+                {
+                    break;
+                }
+
+                for (int row = 0; row < 3; row++)
+                {
+                    axis[row] = next_axis[row] / length;
+                }
+            }
+
+            float axis_scatter  = 0.0f;
+            float axis_length_2 = 0.0f;
+            for (int row = 0; row < 3; row++)
+            {
+                axis_scatter += axis[row] * ((scatter[row][0] * axis[0]) +
+                                             (scatter[row][1] * axis[1]) +
+                                             (scatter[row][2] * axis[2]));
+                axis_length_2 += axis[row] * axis[row];
+            }
+
+            error += (scatter[0][0] + scatter[1][1] + scatter[2][2]) -
+                     (axis_scatter / axis_length_2);
+        }
+
+        partition_errors[partition] = { error, partition };
+    }
+
+    std::partial_sort(std::begin(partition_errors),
+                      std::begin(partition_errors) + bc7_mode_1_candidate_partition_count,
+                      std::end(partition_errors));
+    for (size_t candidate = 0; candidate < bc7_mode_1_candidate_partition_count; candidate++)
+    {
+        _partitions_out[candidate] = partition_errors[candidate].second;
+    }
+}
+
+// Note: The first pixel of each subset is stored with one index bit fewer, so its index must
+//       fall in the lower half; the endpoints are swapped otherwise.
+static void
+WriteBc7Mode6Block(Bc7Mode6Block& _bc7_block_in_out, unsigned char* const _block_out)
+{
+    if (8 <= _bc7_block_in_out.indices[0])
+    {
+        std::swap(_bc7_block_in_out.endpoints[0], _bc7_block_in_out.endpoints[1]);
+        std::swap(_bc7_block_in_out.p_bits[0], _bc7_block_in_out.p_bits[1]);
+        for (uint8_t& index : _bc7_block_in_out.indices)
+        {
+            index = static_cast<uint8_t>(15 - index);
+        }
+    }
+
+    std::memset(_block_out, 0, 16);
+
+    size_t bit_offset = 0;
+    WriteBlockBits(_block_out, bit_offset, 1 << 6, 7);
+    for (int channel = 0; channel < 4; channel++)
+    {
+        WriteBlockBits(_block_out, bit_offset, _bc7_block_in_out.endpoints[0][channel], 7);
+        WriteBlockBits(_block_out, bit_offset, _bc7_block_in_out.endpoints[1][channel], 7);
+    }
+
+    WriteBlockBits(_block_out, bit_offset, _bc7_block_in_out.p_bits[0], 1);
+    WriteBlockBits(_block_out, bit_offset, _bc7_block_in_out.p_bits[1], 1);
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        WriteBlockBits(_block_out,
+                       bit_offset,
+                       _bc7_block_in_out.indices[pixel],
+                       (0 == pixel) ? 3 : 4);
+    }
+
+    assert(128 == bit_offset);
+}
+
+static void
+WriteBc7Mode1Block(Bc7Mode1Block& _bc7_block_in_out, unsigned char* const _block_out)
+{
+    const int anchors[2] = { 0, bc7_anchors_2[_bc7_block_in_out.partition] };
+    for (int subset = 0; subset < 2; subset++)
+    {
+        if (4 > _bc7_block_in_out.indices[anchors[subset]])
+        {
+            continue;
+        }
+
+        std::swap(_bc7_block_in_out.endpoints[subset][0], _bc7_block_in_out.endpoints[subset][1]);
+        const uint16_t subset_mask = GetBc7SubsetMask(_bc7_block_in_out.partition, subset);
+        for (int pixel = 0; pixel < 16; pixel++)
+        {
+            if (true == IsPixelInMask(subset_mask, pixel))
+            {
+                _bc7_block_in_out.indices[pixel] = static_cast<uint8_t>(
+                  7 - _bc7_block_in_out.indices[pixel]);
+            }
+        }
+    }
+
+    std::memset(_block_out, 0, 16);
+
+    size_t bit_offset = 0;
+    WriteBlockBits(_block_out, bit_offset, 1 << 1, 2);
+    WriteBlockBits(_block_out, bit_offset, _bc7_block_in_out.partition, 6);
+    for (int channel = 0; channel < 3; channel++)
+    {
+        for (int subset = 0; subset < 2; subset++)
+        {
+            WriteBlockBits(_block_out,
+                           bit_offset,
+                           _bc7_block_in_out.endpoints[subset][0][channel],
+                           6);
+            WriteBlockBits(_block_out,
+                           bit_offset,
+                           _bc7_block_in_out.endpoints[subset][1][channel],
+                           6);
+        }
+    }
+
+    WriteBlockBits(_block_out, bit_offset, _bc7_block_in_out.p_bits[0], 1);
+    WriteBlockBits(_block_out, bit_offset, _bc7_block_in_out.p_bits[1], 1);
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        const bool anchor = (anchors[0] == pixel) || (anchors[1] == pixel);
+        WriteBlockBits(_block_out, bit_offset, _bc7_block_in_out.indices[pixel], anchor ? 2 : 3);
+    }
+
+    assert(128 == bit_offset);
+}
+
+static void
+EncodeBc7Block(const PixelBlock&              _pixel_block_in,
+               const BlockCompressionQuality& _quality_in,
+               unsigned char* const           _block_out)
+{
+    BlockEndpoints endpoints;
+    Bc7Mode6Block  mode_6_block;
+    FitEndpointsToExtent(_pixel_block_in, 0, 4, 0xFFFF, endpoints);
+    EvaluateBc7Mode6Endpoints(_pixel_block_in, endpoints, mode_6_block);
+    if (BlockCompressionQuality::FAST == _quality_in)
+    {
+        WriteBc7Mode6Block(mode_6_block, _block_out);
+        return;
+    }
+
+    Bc7Mode6Block mode_6_candidate;
+    FitEndpointsToPrincipalAxis(_pixel_block_in, 0, 4, 0xFFFF, endpoints);
+    EvaluateBc7Mode6Endpoints(_pixel_block_in, endpoints, mode_6_candidate);
+    if (mode_6_candidate.error < mode_6_block.error)
+    {
+        mode_6_block = mode_6_candidate;
+    }
+
+    float weights_4[16];
+    for (int index = 0; index < 16; index++)
+    {
+        weights_4[index] = bc7_weights_4[index] / 64.0f;
+    }
+
+    for (size_t iteration = 0; iteration < block_refinement_iteration_count; iteration++)
+    {
+        if (false == RefineEndpoints(_pixel_block_in,
+                                     0,
+                                     4,
+                                     0xFFFF,
+                                     mode_6_block.indices,
+                                     weights_4,
+                                     endpoints))
+        {
+            break;
+        }
+
+        EvaluateBc7Mode6Endpoints(_pixel_block_in, endpoints, mode_6_candidate);
+        if (mode_6_candidate.error >= mode_6_block.error)
+        {
+            break;
+        }
+
+        mode_6_block = mode_6_candidate;
+    }
+
+    // Note: Mode 1 has no alpha, and is only tried for opaque blocks.
+    const float* const alpha = _pixel_block_in.channels[3];
+    if (std::any_of(alpha, alpha + 16, [](const float& _alpha_in) { return 255.0f > _alpha_in; }))
+    {
+        WriteBc7Mode6Block(mode_6_block, _block_out);
+        return;
+    }
+
+    float weights_3[8];
+    for (int index = 0; index < 8; index++)
+    {
+        weights_3[index] = bc7_weights_3[index] / 64.0f;
+    }
+
+    int partitions[bc7_mode_1_candidate_partition_count];
+    RankBc7Mode1Partitions(_pixel_block_in, partitions);
+
+    Bc7Mode1Block mode_1_block;
+    for (const int& partition : partitions)
+    {
+        BlockEndpoints subset_endpoints[2];
+        for (int subset = 0; subset < 2; subset++)
+        {
+            FitEndpointsToPrincipalAxis(_pixel_block_in,
+                                        0,
+                                        3,
+                                        GetBc7SubsetMask(partition, subset),
+                                        subset_endpoints[subset]);
+        }
+
+        Bc7Mode1Block mode_1_candidate;
+        EvaluateBc7Mode1Endpoints(_pixel_block_in, partition, subset_endpoints, mode_1_candidate);
+
+        // Note: Subsets refine independently; a subset which does not span a line keeps its fit.
+        Bc7Mode1Block refined_candidate;
+        for (int subset = 0; subset < 2; subset++)
+        {
+            RefineEndpoints(_pixel_block_in,
+                            0,
+                            3,
+                            GetBc7SubsetMask(partition, subset),
+                            mode_1_candidate.indices,
+                            weights_3,
+                            subset_endpoints[subset]);
+        }
+
+        EvaluateBc7Mode1Endpoints(_pixel_block_in, partition, subset_endpoints, refined_candidate);
+        if (refined_candidate.error < mode_1_candidate.error)
+        {
+            mode_1_candidate = refined_candidate;
+        }
+
+        if (mode_1_candidate.error < mode_1_block.error)
+        {
+            mode_1_block = mode_1_candidate;
+        }
+    }
+
+    if (mode_1_block.error < mode_6_block.error)
+    {
+        WriteBc7Mode1Block(mode_1_block, _block_out);
+    }
+    else
+    {
+        WriteBc7Mode6Block(mode_6_block, _block_out);
+    }
+}
+
+static bool
+DecodeBc7Block(const unsigned char* const _block_in, unsigned char (&_pixels_out)[16][4])
+{
+    size_t bit_offset = 0;
+    if (0x40 == (_block_in[0] & 0x7F))
+    {
+        bit_offset = 7;
+
+        int endpoints[2][4];
+        for (int channel = 0; channel < 4; channel++)
+        {
+            endpoints[0][channel] = static_cast<int>(ReadBlockBits(_block_in, bit_offset, 7));
+            endpoints[1][channel] = static_cast<int>(ReadBlockBits(_block_in, bit_offset, 7));
+        }
+
+        for (int endpoint = 0; endpoint < 2; endpoint++)
+        {
+            const int p_bit = static_cast<int>(ReadBlockBits(_block_in, bit_offset, 1));
+            for (int channel = 0; channel < 4; channel++)
+            {
+                endpoints[endpoint][channel] = (endpoints[endpoint][channel] << 1) | p_bit;
+            }
+        }
+
+        for (int pixel = 0; pixel < 16; pixel++)
+        {
+            const uint32_t index = ReadBlockBits(_block_in, bit_offset, (0 == pixel) ? 3 : 4);
+            for (int channel = 0; channel < 4; channel++)
+            {
+                _pixels_out[pixel][channel] = static_cast<unsigned char>(InterpolateBc7(
+                  endpoints[0][channel], endpoints[1][channel], bc7_weights_4[index]));
+            }
+        }
+
+        return true;
+    }
+
+    if (0x02 == (_block_in[0] & 0x03))
+    {
+        bit_offset          = 2;
+        const int partition = static_cast<int>(ReadBlockBits(_block_in, bit_offset, 6));
+
+        int endpoints[2][2][3];
+        for (int channel = 0; channel < 3; channel++)
+        {
+            for (int subset = 0; subset < 2; subset++)
+            {
+                endpoints[subset][0][channel] = static_cast<int>(
+                  ReadBlockBits(_block_in, bit_offset, 6));
+                endpoints[subset][1][channel] = static_cast<int>(
+                  ReadBlockBits(_block_in, bit_offset, 6));
+            }
+        }
+
+        for (int subset = 0; subset < 2; subset++)
+        {
+            const int p_bit = static_cast<int>(ReadBlockBits(_block_in, bit_offset, 1));
+            for (int channel = 0; channel < 3; channel++)
+            {
+                endpoints[subset][0][channel] = ExpandBc7Mode1Endpoint(
+                  endpoints[subset][0][channel], p_bit);
+                endpoints[subset][1][channel] = ExpandBc7Mode1Endpoint(
+                  endpoints[subset][1][channel], p_bit);
+            }
+        }
+
+        for (int pixel = 0; pixel < 16; pixel++)
+        {
+            const int      subset = IsPixelInMask(bc7_partitions_2[partition], pixel) ? 1 : 0;
+            const bool     anchor = (0 == pixel) || (bc7_anchors_2[partition] == pixel);
+            const uint32_t index  = ReadBlockBits(_block_in, bit_offset, anchor ? 2 : 3);
+            for (int channel = 0; channel < 3; channel++)
+            {
+                _pixels_out[pixel][channel] = static_cast<unsigned char>(
+                  InterpolateBc7(endpoints[subset][0][channel],
+                                 endpoints[subset][1][channel],
+                                 bc7_weights_3[index]));
+            }
+
+            _pixels_out[pixel][3] = 255;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+static void
+CompressBlockRows(const unsigned char* const     _image_data_in,
+                  const int&                     _image_width_in,
+                  const int&                     _image_height_in,
+                  const BlockFormat&             _block_format_in,
+                  const BlockCompressionQuality& _quality_in,
+                  const int&                     _first_block_row_in,
+                  const int&                     _end_block_row_in,
+                  unsigned char* const           _blocks_out)
+{
+    const int    block_column_count = (_image_width_in + 3) / 4;
+    const size_t block_size_bytes   = GetBlockSizeBytes(_block_format_in);
+
+    PixelBlock pixel_block;
+    for (int block_row = _first_block_row_in; block_row < _end_block_row_in; block_row++)
+    {
+        for (int block_column = 0; block_column < block_column_count; block_column++)
+        {
+            LoadPixelBlock(_image_data_in,
+                           _image_width_in,
+                           _image_height_in,
+                           block_column,
+                           block_row,
+                           pixel_block);
+
+            unsigned char* const block = _blocks_out +
+                                         ((static_cast<size_t>(block_row) * block_column_count +
+                                           block_column) *
+                                          block_size_bytes);
+            switch (_block_format_in)
+            {
+                case BlockFormat::BC1:
+                {
+                    EncodeBc1Block(pixel_block, _quality_in, block);
+                    break;
+                }
+                case BlockFormat::BC3:
+                {
+                    EncodeBc4Block(pixel_block, 3, _quality_in, block);
+                    EncodeBc1Block(pixel_block, _quality_in, block + 8);
+                    break;
+                }
+                case BlockFormat::BC5:
+                {
+                    EncodeBc4Block(pixel_block, 0, _quality_in, block);
+                    EncodeBc4Block(pixel_block, 1, _quality_in, block + 8);
+                    break;
+                }
+                case BlockFormat::BC7:
+                {
+                    EncodeBc7Block(pixel_block, _quality_in, block);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+size_t
+GetBlockSizeBytes(const BlockFormat& _block_format_in) noexcept
+{
+    return (BlockFormat::BC1 == _block_format_in) ? 8 : 16;
+}
+
+size_t
+GetBlockCompressedImageSizeBytes(const BlockFormat& _block_format_in,
+                                 const int&         _image_width_in,
+                                 const int&         _image_height_in) noexcept
+{
+    const size_t block_column_count = (static_cast<size_t>(_image_width_in) + 3) / 4;
+    const size_t block_row_count    = (static_cast<size_t>(_image_height_in) + 3) / 4;
+    return block_column_count * block_row_count * GetBlockSizeBytes(_block_format_in);
+}
+
+void
+CompressImageBlocks(bool&                          _success_out,
+                    const unsigned char* const     _image_data_in,
+                    const int&                     _image_width_in,
+                    const int&                     _image_height_in,
+                    const BlockFormat&             _block_format_in,
+                    const BlockCompressionQuality& _quality_in,
+                    JobSystem* const               _job_system_in,
+                    std::vector<unsigned char>&    _blocks_out)
+{
+    _success_out = false;
+    _blocks_out.clear();
+
+    if ((nullptr == _image_data_in) || (0 >= _image_width_in) || (0 >= _image_height_in))
+    {
+        Log_e("Invalid image provided.");
+        return;
+    }
+
+    _blocks_out.resize(
+      GetBlockCompressedImageSizeBytes(_block_format_in, _image_width_in, _image_height_in));
+
+    const int block_column_count = (_image_width_in + 3) / 4;
+    const int block_row_count    = (_image_height_in + 3) / 4;
+    const int rows_per_tile      = static_cast<int>(
+      std::max<size_t>(1, block_tile_minimum_block_count / block_column_count));
+    if ((nullptr == _job_system_in) || (rows_per_tile >= block_row_count))
+    {
+        CompressBlockRows(_image_data_in,
+                          _image_width_in,
+                          _image_height_in,
+                          _block_format_in,
+                          _quality_in,
+                          0,
+                          block_row_count,
+                          _blocks_out.data());
+        _success_out = true;
+        return;
+    }
+
+    unsigned char* const blocks = _blocks_out.data();
+    JobBatch             batch;
+    for (int first_block_row = 0; first_block_row < block_row_count;
+         first_block_row += rows_per_tile)
+    {
+        const int end_block_row = std::min(first_block_row + rows_per_tile, block_row_count);
+        _job_system_in->Submit(
+          [=, &_block_format_in, &_quality_in]()
+          {
+              CompressBlockRows(_image_data_in,
+                                _image_width_in,
+                                _image_height_in,
+                                _block_format_in,
+                                _quality_in,
+                                first_block_row,
+                                end_block_row,
+                                blocks);
+          },
+          &batch);
+    }
+
+    _job_system_in->Wait(batch);
+    _success_out = true;
+}
+
+void
+DecompressImageBlocks(bool&                       _success_out,
+                      const unsigned char* const  _blocks_in,
+                      const size_t&               _blocks_size_bytes_in,
+                      const int&                  _image_width_in,
+                      const int&                  _image_height_in,
+                      const BlockFormat&          _block_format_in,
+                      std::vector<unsigned char>& _image_data_out)
+{
+    _success_out = false;
+    _image_data_out.clear();
+
+    if ((nullptr == _blocks_in) || (0 >= _image_width_in) || (0 >= _image_height_in) ||
+        (GetBlockCompressedImageSizeBytes(_block_format_in, _image_width_in, _image_height_in) !=
+         _blocks_size_bytes_in))
+    {
+        Log_e("Invalid compressed image provided.");
+        return;
+    }
+
+    _image_data_out.resize(static_cast<size_t>(_image_width_in) * _image_height_in * 4);
+
+    const int    block_column_count = (_image_width_in + 3) / 4;
+    const int    block_row_count    = (_image_height_in + 3) / 4;
+    const size_t block_size_bytes   = GetBlockSizeBytes(_block_format_in);
+    for (int block_row = 0; block_row < block_row_count; block_row++)
+    {
+        for (int block_column = 0; block_column < block_column_count; block_column++)
+        {
+            const unsigned char* const block = _blocks_in +
+                                               ((static_cast<size_t>(block_row) *
+                                                   block_column_count +
+                                                 block_column) *
+                                                block_size_bytes);
+
+            unsigned char pixels[16][4];
+            switch (_block_format_in)
+            {
+                case BlockFormat::BC1:
+                {
+                    DecodeBc1Block(block, false, pixels);
+                    break;
+                }
+                case BlockFormat::BC3:
+                {
+                    DecodeBc1Block(block + 8, true, pixels);
+                    DecodeBc4Block(block, 3, pixels);
+                    break;
+                }
+                case BlockFormat::BC5:
+                {
+                    DecodeBc4Block(block, 0, pixels);
+                    DecodeBc4Block(block + 8, 1, pixels);
+                    for (auto& pixel : pixels)
+                    {
+                        pixel[2] = 0;
+                        pixel[3] = 255;
+                    }
+                    break;
+                }
+                case BlockFormat::BC7:
+                {
+                    if (false == DecodeBc7Block(block, pixels))
+                    {
+                        std::stringstream ss;
+                        ss << "Unsupported BC7 block mode in block (" << block_column << ", "
+                           << block_row << ").";
+                        Log_e(ss);
+                        _image_data_out.clear();
+                        return;
+                    }
+                    break;
+                }
+            }
+
+            for (int pixel = 0; pixel < 16; pixel++)
+            {
+                const int row    = (block_row * 4) + (pixel / 4);
+                const int column = (block_column * 4) + (pixel % 4);
+                if ((row < _image_height_in) && (column < _image_width_in))
+                {
+                    std::memcpy(_image_data_out.data() +
+                                  (((static_cast<size_t>(row) * _image_width_in) + column) * 4),
+                                pixels[pixel],
+                                4);
+                }
+            }
+        }
+    }
+
+    _success_out = true;
+}
+
+double
+GetImagePsnr(const unsigned char* const _image_data_in,
+             const unsigned char* const _other_image_data_in,
+             const size_t&              _pixel_count_in,
+             const int&                 _channel_count_in)
+{
+    uint64_t squared_error_sum = 0;
+    for (size_t pixel = 0; pixel < _pixel_count_in; pixel++)
+    {
+        for (int channel = 0; channel < _channel_count_in; channel++)
+        {
+            const int difference = static_cast<int>(_image_data_in[(pixel * 4) + channel]) -
+                                   _other_image_data_in[(pixel * 4) + channel];
+            squared_error_sum += static_cast<uint64_t>(difference * difference);
+        }
+    }
+
+    if (0 == squared_error_sum)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const double mean_squared_error = static_cast<double>(squared_error_sum) /
+                                      (static_cast<double>(_pixel_count_in) * _channel_count_in);
+    return 10.0 * std::log10((255.0 * 255.0) / mean_squared_error);
+}
@@ -0,0 +1,83 @@
+#ifndef block_compression_h
+#define block_compression_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "job_system.h"
+
+//
+// Note: Encodes RGBA images, eight bits per channel, as loaded by LoadImageToMemory(...) in
+//       image_tools.h, to the block compressed formats GPUs sample without decompressing. Each
+//       4x4 block of pixels is stored in 8 or 16 bytes:
+//
+//       BC1  8 bytes   RGB as two 565 endpoints and four colors between them. Alpha is dropped.
+//       BC3  16 bytes  BC1 color, and alpha as two endpoints and eight values between them.
+//       BC5  16 bytes  Red and green, each stored as BC3 stores alpha; for normal maps.
+//       BC7  16 bytes  RGBA. Higher quality than BC3 at the same size, and slower to encode.
+//
+//       FAST fits the endpoints of each block to the extent of its pixels. HIGH also fits them
+//       to the principal axis of its pixels, refines them by least squares and, for BC7 blocks
+//       without alpha, searches the two subset partitions (mode 1) besides mode 6.
+//
+//       Blocks are stored in rows, from the first row of the image. Blocks which overhang an
+//       image whose size is not a multiple of four repeat its last row and column.
+//
+enum class BlockFormat
+{
+    BC1 = 0,
+    BC3,
+    BC5,
+    BC7
+};
+
+enum class BlockCompressionQuality
+{
+    FAST = 0,
+    HIGH
+};
+
+constexpr int block_compression_block_dimension = 4;
+
+size_t
+GetBlockSizeBytes(const BlockFormat& _block_format_in) noexcept;
+
+size_t
+GetBlockCompressedImageSizeBytes(const BlockFormat& _block_format_in,
+                                 const int&         _image_width_in,
+                                 const int&         _image_height_in) noexcept;
+
+// Note: Rows of blocks are tiled across `_job_system_in` when provided, and only those jobs are
+//       waited on; see JobSystem::Wait(JobBatch&). The calling thread does the work otherwise.
+void
+CompressImageBlocks(bool&                          _success_out,
+                    const unsigned char* const     _image_data_in,
+                    const int&                     _image_width_in,
+                    const int&                     _image_height_in,
+                    const BlockFormat&             _block_format_in,
+                    const BlockCompressionQuality& _quality_in,
+                    JobSystem* const               _job_system_in,
+                    std::vector<unsigned char>&    _blocks_out);
+
+// Note: Decodes to four channels per pixel, as GL samples the format: BC1 and BC5 decode alpha
+//       as 255, and BC5 decodes blue as zero. Of BC7, only the modes CompressImageBlocks(...)
+//       writes are decoded.
+void
+DecompressImageBlocks(bool&                       _success_out,
+                      const unsigned char* const  _blocks_in,
+                      const size_t&               _blocks_size_bytes_in,
+                      const int&                  _image_width_in,
+                      const int&                  _image_height_in,
+                      const BlockFormat&          _block_format_in,
+                      std::vector<unsigned char>& _image_data_out);
+
+// Note: Peak signal to noise ratio, in decibels, over the first `_channel_count_in` channels of
+//       two RGBA images. Infinite when the images are identical.
+double
+GetImagePsnr(const unsigned char* const _image_data_in,
+             const unsigned char* const _other_image_data_in,
+             const size_t&              _pixel_count_in,
+             const int&                 _channel_count_in);
+
+#endif // block_compression_h
@@ -0,0 +1,508 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "bounds.h"
+
+#include "logging.h"
+
+static_assert(std::is_trivially_copyable<BoundingVolume>::value,
+              "Bounding volumes are written to and mapped from cooked mesh files.");
+
+// Note: The SIMD paths load each vec3 of a BoundingVolume as four floats, reading into the
+//       following member.
+static_assert(sizeof(BoundingVolume) == (10 * sizeof(float)),
+              "Bounding volume members must be tightly packed floats.");
+
+// Note: Ritter's sphere is grown in single precision; each step may leave the previously
+//       enclosed points outside by a rounding error. The final radius is padded to cover it.
+constexpr float bounding_sphere_radius_padding = 1.0e-5f;
+
+// Note: `_positions_in` points to the position of the first vertex, as do the `_positions_in`
+//       of the SIMD helpers below.
+static void
+ExpandAabb(const float* const _positions_in,
+           const size_t&      _floats_per_vertex_in,
+           const size_t&      _first_vertex_in,
+           const size_t&      _end_vertex_in,
+           glm::vec3&         _minimum_in_out,
+           glm::vec3&         _maximum_in_out) noexcept
+{
+    for (size_t vertex_index = _first_vertex_in; vertex_index < _end_vertex_in; vertex_index++)
+    {
+        const float* const position = _positions_in + (vertex_index * _floats_per_vertex_in);
+        const glm::vec3    point(position[0], position[1], position[2]);
+        _minimum_in_out = glm::min(_minimum_in_out, point);
+        _maximum_in_out = glm::max(_maximum_in_out, point);
+    }
+}
+
+// Note: Grows the sphere just enough to enclose `_position_in`, keeping the far side fixed.
+static void
+GrowBoundingSphere(const float* const _position_in,
+                   glm::vec3&         _center_in_out,
+                   float&             _radius_in_out) noexcept
+{
+    const glm::vec3 offset = glm::vec3(_position_in[0], _position_in[1], _position_in[2]) -
+                             _center_in_out;
+    const float     distance_squared = glm::dot(offset, offset);
+    if (distance_squared <= (_radius_in_out * _radius_in_out))
+    {
+        return;
+    }
+
+    const float distance     = std::sqrt(distance_squared);
+    const float grown_radius = (_radius_in_out + distance) * 0.5f;
+    _center_in_out += offset * ((grown_radius - _radius_in_out) / distance);
+    _radius_in_out = grown_radius;
+}
+
+static void
+GrowBoundingSphere(const float* const _positions_in,
+                   const size_t&      _floats_per_vertex_in,
+                   const size_t&      _first_vertex_in,
+                   const size_t&      _end_vertex_in,
+                   glm::vec3&         _center_in_out,
+                   float&             _radius_in_out) noexcept
+{
+    for (size_t vertex_index = _first_vertex_in; vertex_index < _end_vertex_in; vertex_index++)
+    {
+        GrowBoundingSphere(_positions_in + (vertex_index * _floats_per_vertex_in),
+                           _center_in_out,
+                           _radius_in_out);
+    }
+}
+
+#if defined(_ENGINE_SIMD_SSE_)
+static float
+HorizontalMinimum(const __m128& _values_in) noexcept
+{
+    __m128 minimum = _mm_min_ps(_values_in,
+                                _mm_shuffle_ps(_values_in, _values_in, _MM_SHUFFLE(2, 3, 0, 1)));
+    minimum        = _mm_min_ps(minimum, _mm_shuffle_ps(minimum, minimum, _MM_SHUFFLE(1, 0, 3, 2)));
+    return _mm_cvtss_f32(minimum);
+}
+
+static float
+HorizontalMaximum(const __m128& _values_in) noexcept
+{
+    __m128 maximum = _mm_max_ps(_values_in,
+                                _mm_shuffle_ps(_values_in, _values_in, _MM_SHUFFLE(2, 3, 0, 1)));
+    maximum        = _mm_max_ps(maximum, _mm_shuffle_ps(maximum, maximum, _MM_SHUFFLE(1, 0, 3, 2)));
+    return _mm_cvtss_f32(maximum);
+}
+
+// Note: Loads the positions of four consecutive vertices as lanes of x, y and z. Each position
+//       is read as four floats, so the last vertex of the buffer must never be loaded.
+static void
+LoadPositions(const float* const _positions_in,
+              const size_t&      _floats_per_vertex_in,
+              __m128&            _x_out,
+              __m128&            _y_out,
+              __m128&            _z_out) noexcept
+{
+    __m128 vertex_0 = _mm_loadu_ps(_positions_in);
+    __m128 vertex_1 = _mm_loadu_ps(_positions_in + _floats_per_vertex_in);
+    __m128 vertex_2 = _mm_loadu_ps(_positions_in + (2 * _floats_per_vertex_in));
+    __m128 vertex_3 = _mm_loadu_ps(_positions_in + (3 * _floats_per_vertex_in));
+    _MM_TRANSPOSE4_PS(vertex_0, vertex_1, vertex_2, vertex_3);
+
+    _x_out = vertex_0;
+    _y_out = vertex_1;
+    _z_out = vertex_2;
+}
+#endif // _ENGINE_SIMD_SSE_
+
+#if defined(_ENGINE_SIMD_AVX_)
+// Note: As LoadPositions(...) above, for eight consecutive vertices. Lanes hold vertices
+//       0, 1, 2, 3 in the low half and 4, 5, 6, 7 in the high half.
+static void
+LoadPositions(const float* const _positions_in,
+              const size_t&      _floats_per_vertex_in,
+              __m256&            _x_out,
+              __m256&            _y_out,
+              __m256&            _z_out) noexcept
+{
+    const float* const positions_4 = _positions_in + (4 * _floats_per_vertex_in);
+
+    __m256 vertices_0_4 = _mm256_insertf128_ps(
+      _mm256_castps128_ps256(_mm_loadu_ps(_positions_in)), _mm_loadu_ps(positions_4), 1);
+    __m256 vertices_1_5 = _mm256_insertf128_ps(
+      _mm256_castps128_ps256(_mm_loadu_ps(_positions_in + _floats_per_vertex_in)),
+      _mm_loadu_ps(positions_4 + _floats_per_vertex_in),
+      1);
+    __m256 vertices_2_6 = _mm256_insertf128_ps(
+      _mm256_castps128_ps256(_mm_loadu_ps(_positions_in + (2 * _floats_per_vertex_in))),
+      _mm_loadu_ps(positions_4 + (2 * _floats_per_vertex_in)),
+      1);
+    __m256 vertices_3_7 = _mm256_insertf128_ps(
+      _mm256_castps128_ps256(_mm_loadu_ps(_positions_in + (3 * _floats_per_vertex_in))),
+      _mm_loadu_ps(positions_4 + (3 * _floats_per_vertex_in)),
+      1);
+
+    const __m256 xy_0_1 = _mm256_unpacklo_ps(vertices_0_4, vertices_1_5);
+    const __m256 zw_0_1 = _mm256_unpackhi_ps(vertices_0_4, vertices_1_5);
+    const __m256 xy_2_3 = _mm256_unpacklo_ps(vertices_2_6, vertices_3_7);
+    const __m256 zw_2_3 = _mm256_unpackhi_ps(vertices_2_6, vertices_3_7);
+
+    _x_out = _mm256_shuffle_ps(xy_0_1, xy_2_3, _MM_SHUFFLE(1, 0, 1, 0));
+    _y_out = _mm256_shuffle_ps(xy_0_1, xy_2_3, _MM_SHUFFLE(3, 2, 3, 2));
+    _z_out = _mm256_shuffle_ps(zw_0_1, zw_2_3, _MM_SHUFFLE(1, 0, 1, 0));
+}
+#endif // _ENGINE_SIMD_AVX_
+
+static void
+ComputeAabb(const float* const _positions_in,
+            const size_t&      _floats_per_vertex_in,
+            const size_t&      _vertex_count_in,
+            glm::vec3&         _minimum_out,
+            glm::vec3&         _maximum_out) noexcept
+{
+    _minimum_out = glm::vec3(std::numeric_limits<float>::max());
+    _maximum_out = glm::vec3(std::numeric_limits<float>::lowest());
+
+    size_t vertex_index = 0;
+
+#if defined(_ENGINE_SIMD_SSE_)
+    __m128 minimum_x = _mm_set1_ps(std::numeric_limits<float>::max());
+    __m128 minimum_y = minimum_x;
+    __m128 minimum_z = minimum_x;
+    __m128 maximum_x = _mm_set1_ps(std::numeric_limits<float>::lowest());
+    __m128 maximum_y = maximum_x;
+    __m128 maximum_z = maximum_x;
+
+    // Note: Blocks end before the last vertex; see LoadPositions(...).
+#if defined(_ENGINE_SIMD_AVX_)
+    {
+        __m256 wide_minimum_x = _mm256_set1_ps(std::numeric_limits<float>::max());
+        __m256 wide_minimum_y = wide_minimum_x;
+        __m256 wide_minimum_z = wide_minimum_x;
+        __m256 wide_maximum_x = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+        __m256 wide_maximum_y = wide_maximum_x;
+        __m256 wide_maximum_z = wide_maximum_x;
+        for (; (vertex_index + 8) < _vertex_count_in; vertex_index += 8)
+        {
+            __m256 x, y, z;
+            LoadPositions(_positions_in + (vertex_index * _floats_per_vertex_in),
+                          _floats_per_vertex_in,
+                          x,
+                          y,
+                          z);
+            wide_minimum_x = _mm256_min_ps(wide_minimum_x, x);
+            wide_minimum_y = _mm256_min_ps(wide_minimum_y, y);
+            wide_minimum_z = _mm256_min_ps(wide_minimum_z, z);
+            wide_maximum_x = _mm256_max_ps(wide_maximum_x, x);
+            wide_maximum_y = _mm256_max_ps(wide_maximum_y, y);
+            wide_maximum_z = _mm256_max_ps(wide_maximum_z, z);
+        }
+
+        minimum_x = _mm_min_ps(_mm256_castps256_ps128(wide_minimum_x),
+                               _mm256_extractf128_ps(wide_minimum_x, 1));
+        minimum_y = _mm_min_ps(_mm256_castps256_ps128(wide_minimum_y),
+                               _mm256_extractf128_ps(wide_minimum_y, 1));
+        minimum_z = _mm_min_ps(_mm256_castps256_ps128(wide_minimum_z),
+                               _mm256_extractf128_ps(wide_minimum_z, 1));
+        maximum_x = _mm_max_ps(_mm256_castps256_ps128(wide_maximum_x),
+                               _mm256_extractf128_ps(wide_maximum_x, 1));
+        maximum_y = _mm_max_ps(_mm256_castps256_ps128(wide_maximum_y),
+                               _mm256_extractf128_ps(wide_maximum_y, 1));
+        maximum_z = _mm_max_ps(_mm256_castps256_ps128(wide_maximum_z),
+                               _mm256_extractf128_ps(wide_maximum_z, 1));
+    }
+#endif // _ENGINE_SIMD_AVX_
+
+    for (; (vertex_index + 4) < _vertex_count_in; vertex_index += 4)
+    {
+        __m128 x, y, z;
+        LoadPositions(_positions_in + (vertex_index * _floats_per_vertex_in),
+                      _floats_per_vertex_in,
+                      x,
+                      y,
+                      z);
+        minimum_x = _mm_min_ps(minimum_x, x);
+        minimum_y = _mm_min_ps(minimum_y, y);
+        minimum_z = _mm_min_ps(minimum_z, z);
+        maximum_x = _mm_max_ps(maximum_x, x);
+        maximum_y = _mm_max_ps(maximum_y, y);
+        maximum_z = _mm_max_ps(maximum_z, z);
+    }
+
+    _minimum_out = glm::vec3(HorizontalMinimum(minimum_x),
+                             HorizontalMinimum(minimum_y),
+                             HorizontalMinimum(minimum_z));
+    _maximum_out = glm::vec3(HorizontalMaximum(maximum_x),
+                             HorizontalMaximum(maximum_y),
+                             HorizontalMaximum(maximum_z));
+#endif // _ENGINE_SIMD_SSE_
+
+    ExpandAabb(_positions_in,
+               _floats_per_vertex_in,
+               vertex_index,
+               _vertex_count_in,
+               _minimum_out,
+               _maximum_out);
+}
+
+// Note: Points found outside the sphere are handed to GrowBoundingSphere(...) one at a time.
+//       A grown sphere encloses the previous one, so points of a block that were inside before
+//       a lane grew it remain inside.
+static void
+ComputeBoundingSphere(const float* const _positions_in,
+                      const size_t&      _floats_per_vertex_in,
+                      const size_t&      _vertex_count_in,
+                      glm::vec3&         _center_in_out,
+                      float&             _radius_in_out) noexcept
+{
+    size_t vertex_index = 0;
+
+#if defined(_ENGINE_SIMD_AVX_)
+    {
+        __m256 center_x       = _mm256_set1_ps(_center_in_out.x);
+        __m256 center_y       = _mm256_set1_ps(_center_in_out.y);
+        __m256 center_z       = _mm256_set1_ps(_center_in_out.z);
+        __m256 radius_squared = _mm256_set1_ps(_radius_in_out * _radius_in_out);
+        for (; (vertex_index + 8) < _vertex_count_in; vertex_index += 8)
+        {
+            const float* const positions = _positions_in + (vertex_index * _floats_per_vertex_in);
+
+            __m256 x, y, z;
+            LoadPositions(positions, _floats_per_vertex_in, x, y, z);
+            x = _mm256_sub_ps(x, center_x);
+            y = _mm256_sub_ps(y, center_y);
+            z = _mm256_sub_ps(z, center_z);
+
+            const __m256 distance_squared = _mm256_add_ps(
+              _mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z));
+            const int outside_lanes = _mm256_movemask_ps(
+              _mm256_cmp_ps(distance_squared, radius_squared, _CMP_GT_OQ));
+            if (0 == outside_lanes)
+            {
+                continue;
+            }
+
+            for (size_t lane = 0; lane < 8; lane++)
+            {
+                if (0 != (outside_lanes & (1 << lane)))
+                {
+                    GrowBoundingSphere(positions + (lane * _floats_per_vertex_in),
+                                       _center_in_out,
+                                       _radius_in_out);
+                }
+            }
+
+            center_x       = _mm256_set1_ps(_center_in_out.x);
+            center_y       = _mm256_set1_ps(_center_in_out.y);
+            center_z       = _mm256_set1_ps(_center_in_out.z);
+            radius_squared = _mm256_set1_ps(_radius_in_out * _radius_in_out);
+        }
+    }
+#endif // _ENGINE_SIMD_AVX_
+
+#if defined(_ENGINE_SIMD_SSE_)
+    {
+        __m128 center_x       = _mm_set1_ps(_center_in_out.x);
+        __m128 center_y       = _mm_set1_ps(_center_in_out.y);
+        __m128 center_z       = _mm_set1_ps(_center_in_out.z);
+        __m128 radius_squared = _mm_set1_ps(_radius_in_out * _radius_in_out);
+        for (; (vertex_index + 4) < _vertex_count_in; vertex_index += 4)
+        {
+            const float* const positions = _positions_in + (vertex_index * _floats_per_vertex_in);
+
+            __m128 x, y, z;
+            LoadPositions(positions, _floats_per_vertex_in, x, y, z);
+            x = _mm_sub_ps(x, center_x);
+            y = _mm_sub_ps(y, center_y);
+            z = _mm_sub_ps(z, center_z);
+
+            const __m128 distance_squared = _mm_add_ps(
+              _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+            const int outside_lanes = _mm_movemask_ps(_mm_cmpgt_ps(distance_squared,
+                                                                   radius_squared));
+            if (0 == outside_lanes)
+            {
+                continue;
+            }
+
+            for (size_t lane = 0; lane < 4; lane++)
+            {
+                if (0 != (outside_lanes & (1 << lane)))
+                {
+                    GrowBoundingSphere(positions + (lane * _floats_per_vertex_in),
+                                       _center_in_out,
+                                       _radius_in_out);
+                }
+            }
+
+            center_x       = _mm_set1_ps(_center_in_out.x);
+            center_y       = _mm_set1_ps(_center_in_out.y);
+            center_z       = _mm_set1_ps(_center_in_out.z);
+            radius_squared = _mm_set1_ps(_radius_in_out * _radius_in_out);
+        }
+    }
+#endif // _ENGINE_SIMD_SSE_
+
+    GrowBoundingSphere(_positions_in,
+                       _floats_per_vertex_in,
+                       vertex_index,
+                       _vertex_count_in,
+                       _center_in_out,
+                       _radius_in_out);
+}
+
+void
+ComputeBoundingVolume(bool&              _success_out,
+                      const float* const _vertex_data_in,
+                      const size_t&      _floats_per_vertex_in,
+                      const size_t&      _position_offset_in,
+                      const size_t&      _vertex_count_in,
+                      BoundingVolume&    _bounding_volume_out)
+{
+    _success_out         = true;
+    _bounding_volume_out = BoundingVolume();
+
+    if ((_position_offset_in + 3) > _floats_per_vertex_in)
+    {
+        std::stringstream ss;
+        ss << "Positions at offset " << _position_offset_in
+           << " do not fit in a vertex of " << _floats_per_vertex_in << " floats.";
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    if (0 == _vertex_count_in)
+    {
+        return;
+    }
+
+    if (nullptr == _vertex_data_in)
+    {
+        Log_e("Unable to compute the bounding volume of null vertex data.");
+        _success_out = false;
+        return;
+    }
+
+    const float* const positions = _vertex_data_in + _position_offset_in;
+    glm::vec3          minimum;
+    glm::vec3          maximum;
+    ComputeAabb(positions, _floats_per_vertex_in, _vertex_count_in, minimum, maximum);
+
+    // Note: No sphere is smaller than half the largest extent of the AABB, which makes it the
+    //       starting radius.
+    const glm::vec3 extent = maximum - minimum;
+    glm::vec3       center = (minimum + maximum) * 0.5f;
+    float           radius = std::max(extent.x, std::max(extent.y, extent.z)) * 0.5f;
+    ComputeBoundingSphere(positions, _floats_per_vertex_in, _vertex_count_in, center, radius);
+    radius *= (1.0f + bounding_sphere_radius_padding);
+
+    const float aabb_sphere_radius = glm::length(extent) * 0.5f;
+    if (aabb_sphere_radius < radius)
+    {
+        center = (minimum + maximum) * 0.5f;
+        radius = aabb_sphere_radius;
+    }
+
+    _bounding_volume_out.aabb_minimum           = minimum;
+    _bounding_volume_out.aabb_maximum           = maximum;
+    _bounding_volume_out.bounding_sphere_center = center;
+    _bounding_volume_out.bounding_sphere_radius = radius;
+}
+
+void
+TransformBoundingVolumes(const std::vector<BoundingVolume>& _bounding_volumes_in,
+                         const std::vector<glm::mat4>&      _world_matrices_in,
+                         std::vector<BoundingVolume>&       _bounding_volumes_out) noexcept
+{
+    assert(_bounding_volumes_in.size() == _world_matrices_in.size());
+    assert(&_bounding_volumes_in != &_bounding_volumes_out);
+
+    _bounding_volumes_out.resize(_bounding_volumes_in.size());
+
+#if defined(_ENGINE_SIMD_SSE_)
+    const __m128 absolute_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 half          = _mm_set1_ps(0.5f);
+#endif // _ENGINE_SIMD_SSE_
+
+    for (size_t volume_index = 0; volume_index < _bounding_volumes_in.size(); volume_index++)
+    {
+        const BoundingVolume& local_volume = _bounding_volumes_in[volume_index];
+        const glm::mat4&      world_matrix = _world_matrices_in[volume_index];
+        BoundingVolume&       world_volume = _bounding_volumes_out[volume_index];
+
+#if defined(_ENGINE_SIMD_SSE_)
+        // Note: Columns of glm::mat4 are contiguous. Lane w of every local vector is unused.
+        const __m128 column_0 = _mm_loadu_ps(&world_matrix[0][0]);
+        const __m128 column_1 = _mm_loadu_ps(&world_matrix[1][0]);
+        const __m128 column_2 = _mm_loadu_ps(&world_matrix[2][0]);
+        const __m128 column_3 = _mm_loadu_ps(&world_matrix[3][0]);
+
+        const __m128 minimum = _mm_loadu_ps(&local_volume.aabb_minimum.x);
+        const __m128 maximum = _mm_loadu_ps(&local_volume.aabb_maximum.x);
+        const __m128 center  = _mm_mul_ps(_mm_add_ps(minimum, maximum), half);
+        const __m128 extent  = _mm_mul_ps(_mm_sub_ps(maximum, minimum), half);
+        const __m128 sphere  = _mm_loadu_ps(&local_volume.bounding_sphere_center.x);
+
+        const __m128 world_center = _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(column_0, _mm_shuffle_ps(center, center, _MM_SHUFFLE(0, 0, 0, 0))),
+                     _mm_mul_ps(column_1, _mm_shuffle_ps(center, center, _MM_SHUFFLE(1, 1, 1, 1)))),
+          _mm_add_ps(_mm_mul_ps(column_2, _mm_shuffle_ps(center, center, _MM_SHUFFLE(2, 2, 2, 2))),
+                     column_3));
+        const __m128 world_extent = _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(_mm_and_ps(column_0, absolute_mask),
+                                _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(0, 0, 0, 0))),
+                     _mm_mul_ps(_mm_and_ps(column_1, absolute_mask),
+                                _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(1, 1, 1, 1)))),
+          _mm_mul_ps(_mm_and_ps(column_2, absolute_mask),
+                     _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(2, 2, 2, 2))));
+        const __m128 world_sphere_center = _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(column_0, _mm_shuffle_ps(sphere, sphere, _MM_SHUFFLE(0, 0, 0, 0))),
+                     _mm_mul_ps(column_1, _mm_shuffle_ps(sphere, sphere, _MM_SHUFFLE(1, 1, 1, 1)))),
+          _mm_add_ps(_mm_mul_ps(column_2, _mm_shuffle_ps(sphere, sphere, _MM_SHUFFLE(2, 2, 2, 2))),
+                     column_3));
+
+        // Note: Transposing the squared columns sums their x, y and z into one lane per column.
+        __m128 squares_0 = _mm_mul_ps(column_0, column_0);
+        __m128 squares_1 = _mm_mul_ps(column_1, column_1);
+        __m128 squares_2 = _mm_mul_ps(column_2, column_2);
+        __m128 squares_3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(squares_0, squares_1, squares_2, squares_3);
+        const float largest_scale = std::sqrt(
+          HorizontalMaximum(_mm_add_ps(_mm_add_ps(squares_0, squares_1), squares_2)));
+
+        float world_minimum[4];
+        float world_maximum[4];
+        float world_sphere[4];
+        _mm_storeu_ps(world_minimum, _mm_sub_ps(world_center, world_extent));
+        _mm_storeu_ps(world_maximum, _mm_add_ps(world_center, world_extent));
+        _mm_storeu_ps(world_sphere, world_sphere_center);
+
+        world_volume.aabb_minimum = glm::vec3(world_minimum[0], world_minimum[1], world_minimum[2]);
+        world_volume.aabb_maximum = glm::vec3(world_maximum[0], world_maximum[1], world_maximum[2]);
+        world_volume.bounding_sphere_center = glm::vec3(world_sphere[0],
+                                                        world_sphere[1],
+                                                        world_sphere[2]);
+        world_volume.bounding_sphere_radius = local_volume.bounding_sphere_radius * largest_scale;
+#else
+        const glm::mat3 linear_part(world_matrix);
+        const glm::mat3 absolute_linear_part(glm::abs(linear_part[0]),
+                                             glm::abs(linear_part[1]),
+                                             glm::abs(linear_part[2]));
+
+        const glm::vec3 center = (local_volume.aabb_minimum + local_volume.aabb_maximum) * 0.5f;
+        const glm::vec3 extent = (local_volume.aabb_maximum - local_volume.aabb_minimum) * 0.5f;
+        const glm::vec3 world_center = glm::vec3(world_matrix * glm::vec4(center, 1.0f));
+        const glm::vec3 world_extent = absolute_linear_part * extent;
+
+        const float largest_scale = std::sqrt(std::max(
+          glm::dot(linear_part[0], linear_part[0]),
+          std::max(glm::dot(linear_part[1], linear_part[1]),
+                   glm::dot(linear_part[2], linear_part[2]))));
+
+        world_volume.aabb_minimum           = world_center - world_extent;
+        world_volume.aabb_maximum           = world_center + world_extent;
+        world_volume.bounding_sphere_center = glm::vec3(
+          world_matrix * glm::vec4(local_volume.bounding_sphere_center, 1.0f));
+        world_volume.bounding_sphere_radius = local_volume.bounding_sphere_radius * largest_scale;
+#endif // _ENGINE_SIMD_SSE_
+    }
+}
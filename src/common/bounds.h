@@ -0,0 +1,53 @@
+#ifndef bounds_h
+#define bounds_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+//
+// Note: Bounding volumes of whole meshes, computed once at import over the position stream and
+//       transformed into world space every frame, in batches, for culling:
+//
+//       std::vector<BoundingVolume> world_bounding_volumes;
+//       TransformBoundingVolumes(local_bounding_volumes, world_matrices, world_bounding_volumes);
+//
+//       Both run on SSE, and on AVX in the /arch:AVX2 (-mavx2) builds, with a scalar fallback.
+//
+
+// Note: Trivially copyable, and stored as-is in cooked meshes (see cooked_mesh.h). An empty
+//       mesh has a zero sized volume at the origin.
+struct BoundingVolume
+{
+    glm::vec3 aabb_minimum           = glm::vec3(0.0f);
+    glm::vec3 aabb_maximum           = glm::vec3(0.0f);
+    glm::vec3 bounding_sphere_center = glm::vec3(0.0f);
+    float     bounding_sphere_radius = 0.0f;
+};
+
+// Note: Positions are read as three floats at `_position_offset_in` floats into each vertex of
+//       `_floats_per_vertex_in` floats.
+//
+//       The sphere is Ritter's, "An Efficient Bounding Sphere" (Graphics Gems, 1990), grown from
+//       the largest extent of the AABB rather than from a pair of extreme points, or the sphere
+//       around the AABB when that is smaller. Expect it within 5-20% of the minimal radius.
+void
+ComputeBoundingVolume(bool&              _success_out,
+                      const float* const _vertex_data_in,
+                      const size_t&      _floats_per_vertex_in,
+                      const size_t&      _position_offset_in,
+                      const size_t&      _vertex_count_in,
+                      BoundingVolume&    _bounding_volume_out);
+
+// Note: Transforms each of `_bounding_volumes_in` by the matching affine matrix of
+//       `_world_matrices_in`, replacing the contents of `_bounding_volumes_out`. The AABB of a
+//       transformed AABB is found after Arvo, "Transforming Axis-Aligned Bounding Boxes"
+//       (Graphics Gems, 1990); spheres are scaled by the largest axis scale of the matrix.
+//
+//       Expected to be called every frame; inputs are asserted rather than reported.
+void
+TransformBoundingVolumes(const std::vector<BoundingVolume>& _bounding_volumes_in,
+                         const std::vector<glm::mat4>&      _world_matrices_in,
+                         std::vector<BoundingVolume>&       _bounding_volumes_out) noexcept;
+
+#endif // bounds_h
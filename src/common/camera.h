@@ -9,6 +9,8 @@
 
 struct Camera : protected Object3
 {
+    using Object3::GetPosition;
+
     Camera() noexcept;
 
     void
@@ -0,0 +1,318 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "cooked_mesh.h"
+
+#include "logging.h"
+#include "mesh_tools.h"
+
+static inline size_t
+AlignCookedMeshOffset(const size_t& _offset_in)
+{
+    return (_offset_in + (cooked_mesh_alignment - 1)) & ~(cooked_mesh_alignment - 1);
+}
+
+static void
+ReportCookedMeshError(const char* const _cooked_mesh_file_path_in, const char* const _note_in)
+{
+    std::stringstream ss;
+    ss << "Ignoring cooked mesh file." << std::endl
+       << "   File: " << _cooked_mesh_file_path_in << std::endl
+       << "   Note: " << _note_in;
+    Log_w(ss);
+}
+
+void
+MapCookedMesh(bool&             _success_out,
+              const char* const _cooked_mesh_file_path_in,
+              const MappedFile& _source_file_in,
+              const uint64_t&   _source_write_time_in,
+              CookedMesh&       _cooked_mesh_out)
+{
+    _success_out = false;
+
+    _cooked_mesh_out.header              = nullptr;
+    _cooked_mesh_out.attributes          = nullptr;
+    _cooked_mesh_out.encoded_vertex_data = nullptr;
+    _cooked_mesh_out.encoded_elements    = nullptr;
+    _cooked_mesh_out.meshlets            = nullptr;
+
+    bool file_exists = false;
+    bool file_empty  = true;
+    FileExistsOrEmpty(_cooked_mesh_file_path_in, file_exists, file_empty);
+    if ((false == file_exists) || (true == file_empty))
+    {
+        return;
+    }
+
+    MapFileToMemory(_success_out, _cooked_mesh_file_path_in, _cooked_mesh_out.file);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    _success_out = false;
+
+    const char* const data       = _cooked_mesh_out.file.data;
+    const size_t      size_bytes = _cooked_mesh_out.file.size_bytes;
+    if (sizeof(CookedMeshHeader) > size_bytes)
+    {
+        ReportCookedMeshError(_cooked_mesh_file_path_in, "File is smaller than its header.");
+        return;
+    }
+
+    // Note: Mapped views are page aligned, so every offset aligned within the file is aligned
+    //       in memory as well.
+    const CookedMeshHeader* const header = reinterpret_cast<const CookedMeshHeader*>(data);
+    if ((cooked_mesh_magic != header->magic) || (cooked_mesh_version != header->version))
+    {
+        ReportCookedMeshError(_cooked_mesh_file_path_in, "Unrecognized magic or version.");
+        return;
+    }
+
+    // Note: A source of the recorded size and modification time is taken as the one cooked.
+    if (_source_file_in.size_bytes != header->source_size_bytes)
+    {
+        // Note: The source changed since it was cooked. Not an error; the caller recooks.
+        return;
+    }
+
+    if ((0 == _source_write_time_in) || (_source_write_time_in != header->source_write_time))
+    {
+        uint64_t source_content_hash = 0;
+        HashMemory(source_content_hash, _source_file_in.data, _source_file_in.size_bytes);
+        if (source_content_hash != header->source_content_hash)
+        {
+            return;
+        }
+    }
+
+    switch (header->element_data_type)
+    {
+        case GL_UNSIGNED_BYTE:
+        case GL_UNSIGNED_SHORT:
+        case GL_UNSIGNED_INT:
+        {
+            break;
+        }
+        default:
+        {
+            ReportCookedMeshError(_cooked_mesh_file_path_in, "Unsupported element data type.");
+            return;
+        }
+    }
+
+    // Note: The vertex codec works on whole vertices of at most vertex_codec_max_vertex_size
+    //       bytes, and the index codec on whole triangles.
+    if ((0 != header->vertex_count) &&
+        ((0 != (header->vertex_data_size_bytes % header->vertex_count)) ||
+         (vertex_codec_max_vertex_size < (header->vertex_data_size_bytes / header->vertex_count))))
+    {
+        ReportCookedMeshError(_cooked_mesh_file_path_in, "Unsupported vertex size.");
+        return;
+    }
+
+    if (0 != (header->element_count % 3))
+    {
+        ReportCookedMeshError(_cooked_mesh_file_path_in, "Elements are not whole triangles.");
+        return;
+    }
+
+    const size_t attribute_table_end = sizeof(CookedMeshHeader) +
+                                       (header->attribute_count * sizeof(CookedVertexAttribute));
+    const size_t vertex_data_end = header->vertex_data_offset_bytes +
+                                   header->vertex_data_encoded_size_bytes;
+    const size_t element_data_end = header->element_data_offset_bytes +
+                                    header->element_data_encoded_size_bytes;
+    const size_t meshlet_data_end = header->meshlet_data_offset_bytes +
+                                    (header->meshlet_count * sizeof(Meshlet));
+    if ((glt::array_buffer_count < header->attribute_count) ||
+        (0 != (header->vertex_data_offset_bytes % cooked_mesh_alignment)) ||
+        (0 != (header->element_data_offset_bytes % cooked_mesh_alignment)) ||
+        (0 != (header->meshlet_data_offset_bytes % cooked_mesh_alignment)) ||
+        (attribute_table_end > header->vertex_data_offset_bytes) ||
+        (vertex_data_end > header->element_data_offset_bytes) ||
+        (element_data_end > header->meshlet_data_offset_bytes) || (meshlet_data_end > size_bytes))
+    {
+        ReportCookedMeshError(_cooked_mesh_file_path_in, "Section offsets are out of bounds.");
+        return;
+    }
+
+    _cooked_mesh_out.header              = header;
+    _cooked_mesh_out.attributes          = reinterpret_cast<const CookedVertexAttribute*>(
+      data + sizeof(CookedMeshHeader));
+    _cooked_mesh_out.encoded_vertex_data = reinterpret_cast<const unsigned char*>(
+      data + header->vertex_data_offset_bytes);
+    _cooked_mesh_out.encoded_elements    = reinterpret_cast<const unsigned char*>(
+      data + header->element_data_offset_bytes);
+    _cooked_mesh_out.meshlets            = reinterpret_cast<const Meshlet*>(
+      data + header->meshlet_data_offset_bytes);
+
+    _success_out = true;
+}
+
+void
+DecodeCookedVertexData(bool&             _success_out,
+                       const CookedMesh& _cooked_mesh_in,
+                       void* const       _vertex_data_out)
+{
+    const CookedMeshHeader& header = *_cooked_mesh_in.header;
+    if (0 == header.vertex_count)
+    {
+        _success_out = true;
+        return;
+    }
+
+    DecodeVertexBuffer(_success_out,
+                       _cooked_mesh_in.encoded_vertex_data,
+                       header.vertex_data_encoded_size_bytes,
+                       header.vertex_count,
+                       header.vertex_data_size_bytes / header.vertex_count,
+                       _vertex_data_out);
+}
+
+void
+DecodeCookedElements(bool&             _success_out,
+                     const CookedMesh& _cooked_mesh_in,
+                     const GLenum&&    _element_data_type_in,
+                     void* const       _element_data_out)
+{
+    const CookedMeshHeader& header = *_cooked_mesh_in.header;
+    DecodeIndexBuffer(_success_out,
+                      _cooked_mesh_in.encoded_elements,
+                      header.element_data_encoded_size_bytes,
+                      header.element_count,
+                      header.vertex_count,
+                      std::move(_element_data_type_in),
+                      _element_data_out);
+}
+
+void
+WriteCookedMesh(bool&                                              _success_out,
+                const char* const                                  _cooked_mesh_file_path_in,
+                const uint64_t&                                    _source_size_bytes_in,
+                const uint64_t&                                    _source_content_hash_in,
+                const uint64_t&                                    _source_write_time_in,
+                const size_t&                                      _vertex_count_in,
+                const std::vector<float>&                          _vertex_data_in,
+                const std::vector<GLuint>&                         _elements_in,
+                const GLenum&&                                     _element_data_type_in,
+                const std::vector<Meshlet>&                        _meshlets_in,
+                const BoundingVolume&                              _bounding_volume_in,
+                const std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_in)
+{
+    std::vector<unsigned char> vertex_data;
+    if (0 != _vertex_count_in)
+    {
+        EncodeVertexBuffer(_success_out,
+                           _vertex_data_in.data(),
+                           _vertex_count_in,
+                           (_vertex_data_in.size() * sizeof(float)) / _vertex_count_in,
+                           vertex_data);
+        if (false == _success_out)
+        {
+            return;
+        }
+    }
+
+    std::vector<unsigned char> element_data;
+    EncodeIndexBuffer(_success_out, _elements_in, element_data);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    CookedMeshHeader header;
+    header.source_size_bytes   = _source_size_bytes_in;
+    header.source_content_hash = _source_content_hash_in;
+    header.source_write_time   = _source_write_time_in;
+    header.vertex_count        = _vertex_count_in;
+    header.attribute_count     = static_cast<uint32_t>(_vertex_attribute_pointers_in.size());
+    header.element_count       = _elements_in.size();
+    header.element_data_type   = _element_data_type_in;
+    header.meshlet_count       = _meshlets_in.size();
+    header.bounding_volume     = _bounding_volume_in;
+
+    header.vertex_data_size_bytes          = _vertex_data_in.size() * sizeof(float);
+    header.vertex_data_encoded_size_bytes  = vertex_data.size();
+    header.element_data_encoded_size_bytes = element_data.size();
+
+    header.vertex_data_offset_bytes  = AlignCookedMeshOffset(
+      sizeof(CookedMeshHeader) + (header.attribute_count * sizeof(CookedVertexAttribute)));
+    header.element_data_offset_bytes = AlignCookedMeshOffset(header.vertex_data_offset_bytes +
+                                                             vertex_data.size());
+    header.meshlet_data_offset_bytes = AlignCookedMeshOffset(header.element_data_offset_bytes +
+                                                             element_data.size());
+
+    std::vector<CookedVertexAttribute> attributes;
+    attributes.reserve(_vertex_attribute_pointers_in.size());
+    for (auto& descriptor : _vertex_attribute_pointers_in)
+    {
+        CookedVertexAttribute attribute;
+        attribute.vertex_data_type             = static_cast<uint32_t>(descriptor.vertex_data_type);
+        attribute.component_count              = descriptor.component_count;
+        attribute.data_type                    = descriptor.data_type;
+        attribute.should_be_normalized_by_gpu  = descriptor.should_be_normalized_by_gpu;
+        attribute.byte_stride_between_elements = descriptor.byte_stride_between_elements;
+        attribute.first_component_byte_offset  = reinterpret_cast<uintptr_t>(
+          descriptor.first_component_byte_offset);
+        attributes.push_back(attribute);
+    }
+
+    // Note: Unique per thread, as the same mesh may be loaded (and cooked) on several at once.
+    std::stringstream temporary_file_path_ss;
+    temporary_file_path_ss << _cooked_mesh_file_path_in << "." << std::this_thread::get_id()
+                           << ".tmp";
+    const std::string temporary_file_path = temporary_file_path_ss.str();
+    {
+        std::ofstream file_stream(temporary_file_path, std::ios::binary | std::ios::trunc);
+        if (false == file_stream.is_open())
+        {
+            std::stringstream ss;
+            ss << "Unable to open cooked mesh file for writing: " << temporary_file_path;
+            Log_w(ss);
+            _success_out = false;
+            return;
+        }
+
+        const char padding[cooked_mesh_alignment] = { 0 };
+
+        file_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file_stream.write(reinterpret_cast<const char*>(attributes.data()),
+                          attributes.size() * sizeof(CookedVertexAttribute));
+        file_stream.write(padding,
+                          header.vertex_data_offset_bytes - sizeof(CookedMeshHeader) -
+                            (attributes.size() * sizeof(CookedVertexAttribute)));
+        file_stream.write(reinterpret_cast<const char*>(vertex_data.data()),
+                          vertex_data.size());
+        file_stream.write(padding,
+                          header.element_data_offset_bytes - header.vertex_data_offset_bytes -
+                            vertex_data.size());
+        file_stream.write(reinterpret_cast<const char*>(element_data.data()),
+                          element_data.size());
+        file_stream.write(padding,
+                          header.meshlet_data_offset_bytes - header.element_data_offset_bytes -
+                            element_data.size());
+        file_stream.write(reinterpret_cast<const char*>(_meshlets_in.data()),
+                          _meshlets_in.size() * sizeof(Meshlet));
+
+        _success_out = file_stream.good();
+    }
+
+    std::error_code error_code;
+    if (true == _success_out)
+    {
+        std::filesystem::rename(temporary_file_path, _cooked_mesh_file_path_in, error_code);
+        _success_out = (false == static_cast<bool>(error_code));
+    }
+
+    if (false == _success_out)
+    {
+        std::filesystem::remove(temporary_file_path, error_code);
+
+        std::stringstream ss;
+        ss << "Unable to write cooked mesh file: " << _cooked_mesh_file_path_in;
+        Log_w(ss);
+    }
+}
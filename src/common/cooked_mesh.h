@@ -0,0 +1,137 @@
+#ifndef cooked_mesh_h
+#define cooked_mesh_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "bounds.h"
+#include "fileio.h"
+#include "gl_tools.h"
+#include "mesh_codec.h"
+#include "meshlet.h"
+
+//
+// Note: A cooked mesh is the binary form of an imported model. It is memory mapped and used
+//       without parsing; the vertex and element data are compressed (see mesh_codec.h) and
+//       decoded straight into the buffers handed to OpenGL:
+//
+//       CookedMeshHeader
+//       CookedVertexAttribute[attribute_count]
+//       (padding to 16 bytes)
+//       Encoded interleaved vertex data, vertex_data_encoded_size_bytes
+//       (padding to 16 bytes)
+//       Encoded element data, element_data_encoded_size_bytes
+//       (padding to 16 bytes)
+//       Meshlet[meshlet_count]
+//
+//       vertex_data_size_bytes is the size of the decoded vertex data. Elements are drawn with
+//       element_data_type, the smallest that can index the vertex data (see
+//       SelectElementDataType(...) in mesh_tools.h). Meshlets index the element data (see
+//       meshlet.h).
+//
+//       Cooked meshes record the size, content hash and modification time of the file they were
+//       cooked from, and are considered stale when the size or content hash no longer matches.
+//
+constexpr uint32_t cooked_mesh_magic            = 0x48534D43; // "CMSH"
+constexpr uint32_t cooked_mesh_version          = 9;
+constexpr size_t   cooked_mesh_alignment        = 16;
+constexpr char     cooked_mesh_file_extension[] = ".cmesh";
+
+struct CookedMeshHeader
+{
+    uint32_t magic   = cooked_mesh_magic;
+    uint32_t version = cooked_mesh_version;
+
+    uint64_t source_size_bytes   = 0;
+    uint64_t source_content_hash = 0;
+
+    // Note: See GetFileWriteTime(...) in fileio.h; zero when unknown.
+    uint64_t source_write_time = 0;
+
+    uint64_t vertex_count                   = 0;
+    uint64_t vertex_data_offset_bytes       = 0;
+    uint64_t vertex_data_size_bytes         = 0;
+    uint64_t vertex_data_encoded_size_bytes = 0;
+
+    uint64_t element_count                   = 0;
+    uint64_t element_data_offset_bytes       = 0;
+    uint64_t element_data_encoded_size_bytes = 0;
+    uint32_t element_data_type               = GL_UNSIGNED_INT;
+
+    uint32_t attribute_count = 0;
+
+    uint64_t meshlet_count             = 0;
+    uint64_t meshlet_data_offset_bytes = 0;
+
+    BoundingVolume bounding_volume;
+};
+
+// Note: Serialized glt::VertexAttributeDescriptor. The vertex array object and attribute index
+//       belong to the program the mesh is drawn with, and are supplied when the mesh is loaded.
+struct CookedVertexAttribute
+{
+    uint32_t vertex_data_type             = 0;
+    int32_t  component_count              = 0;
+    uint32_t data_type                    = 0;
+    uint32_t should_be_normalized_by_gpu  = 0;
+    int32_t  byte_stride_between_elements = 0;
+    uint32_t padding                      = 0;
+    uint64_t first_component_byte_offset  = 0;
+};
+
+// Read-only view of a cooked mesh file. Pointers are valid for the lifetime of the object.
+struct CookedMesh
+{
+    MappedFile file;
+
+    const CookedMeshHeader*      header              = nullptr;
+    const CookedVertexAttribute* attributes          = nullptr;
+    const unsigned char*         encoded_vertex_data = nullptr;
+    const unsigned char*         encoded_elements    = nullptr;
+    const Meshlet*               meshlets            = nullptr;
+};
+
+// Note: Maps the cooked mesh if it was cooked from the current contents of `_source_file_in`,
+//       whose modification time is `_source_write_time_in`. The source is only read, and
+//       hashed, when its modification time differs from the one recorded but its size does not.
+//       Fails without logging an error if the file does not exist or is out of date, so that
+//       either may be treated as a cache miss. Malformed files are logged.
+void
+MapCookedMesh(bool&             _success_out,
+              const char* const _cooked_mesh_file_path_in,
+              const MappedFile& _source_file_in,
+              const uint64_t&   _source_write_time_in,
+              CookedMesh&       _cooked_mesh_out);
+
+// Note: Writes header->vertex_data_size_bytes bytes to `_vertex_data_out`.
+void
+DecodeCookedVertexData(bool&             _success_out,
+                       const CookedMesh& _cooked_mesh_in,
+                       void* const       _vertex_data_out);
+
+// Note: Writes header->element_count elements of `_element_data_type_in` to `_element_data_out`;
+//       usually header->element_data_type, though any type able to index the vertex data will do.
+void
+DecodeCookedElements(bool&             _success_out,
+                     const CookedMesh& _cooked_mesh_in,
+                     const GLenum&&    _element_data_type_in,
+                     void* const       _element_data_out);
+
+// Note: The file is written to a temporary path and renamed into place, such that a concurrent
+//       reader never observes a partially written cooked mesh.
+void
+WriteCookedMesh(bool&                                              _success_out,
+                const char* const                                  _cooked_mesh_file_path_in,
+                const uint64_t&                                    _source_size_bytes_in,
+                const uint64_t&                                    _source_content_hash_in,
+                const uint64_t&                                    _source_write_time_in,
+                const size_t&                                      _vertex_count_in,
+                const std::vector<float>&                          _vertex_data_in,
+                const std::vector<GLuint>&                         _elements_in,
+                const GLenum&&                                     _element_data_type_in,
+                const std::vector<Meshlet>&                        _meshlets_in,
+                const BoundingVolume&                              _bounding_volume_in,
+                const std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_in);
+
+#endif // cooked_mesh_h
@@ -0,0 +1,886 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "cooked_texture.h"
+
+#include "block_compression.h"
+#include "logging.h"
+#include "mip_generator.h"
+
+// Note: Uncompressed formats are stored as blocks of one texel.
+struct CookedTextureFormat
+{
+    uint32_t    vk_format;
+    uint32_t    block_size_bytes;
+    uint32_t    block_dimension;
+    uint32_t    channel_count;
+    bool        compressed;
+    BlockFormat block_format;
+    bool        srgb;
+    GLenum      internal_format;
+    GLenum      pixel_format;
+    GLenum      pixel_type;
+};
+
+static constexpr CookedTextureFormat cooked_texture_formats[] = {
+    { ktx2_vk_format_r8g8b8_unorm,
+      3,
+      1,
+      3,
+      false,
+      BlockFormat::BC1,
+      false,
+      GL_RGB8,
+      GL_RGB,
+      GL_UNSIGNED_BYTE },
+    { ktx2_vk_format_r8g8b8_srgb,
+      3,
+      1,
+      3,
+      false,
+      BlockFormat::BC1,
+      true,
+      GL_SRGB8,
+      GL_RGB,
+      GL_UNSIGNED_BYTE },
+    { ktx2_vk_format_r8g8b8a8_unorm,
+      4,
+      1,
+      4,
+      false,
+      BlockFormat::BC1,
+      false,
+      GL_RGBA8,
+      GL_RGBA,
+      GL_UNSIGNED_BYTE },
+    { ktx2_vk_format_r8g8b8a8_srgb,
+      4,
+      1,
+      4,
+      false,
+      BlockFormat::BC1,
+      true,
+      GL_SRGB8_ALPHA8,
+      GL_RGBA,
+      GL_UNSIGNED_BYTE },
+    { ktx2_vk_format_bc1_rgb_unorm,
+      8,
+      block_compression_block_dimension,
+      3,
+      true,
+      BlockFormat::BC1,
+      false,
+      GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+      GL_NONE,
+      GL_NONE },
+    { ktx2_vk_format_bc1_rgb_srgb,
+      8,
+      block_compression_block_dimension,
+      3,
+      true,
+      BlockFormat::BC1,
+      true,
+      GL_COMPRESSED_SRGB_S3TC_DXT1_EXT,
+      GL_NONE,
+      GL_NONE },
+    { ktx2_vk_format_bc3_unorm,
+      16,
+      block_compression_block_dimension,
+      4,
+      true,
+      BlockFormat::BC3,
+      false,
+      GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+      GL_NONE,
+      GL_NONE },
+    { ktx2_vk_format_bc3_srgb,
+      16,
+      block_compression_block_dimension,
+      4,
+      true,
+      BlockFormat::BC3,
+      true,
+      GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,
+      GL_NONE,
+      GL_NONE },
+    { ktx2_vk_format_bc5_unorm,
+      16,
+      block_compression_block_dimension,
+      2,
+      true,
+      BlockFormat::BC5,
+      false,
+      GL_COMPRESSED_RG_RGTC2,
+      GL_NONE,
+      GL_NONE },
+    { ktx2_vk_format_bc7_unorm,
+      16,
+      block_compression_block_dimension,
+      4,
+      true,
+      BlockFormat::BC7,
+      false,
+      GL_COMPRESSED_RGBA_BPTC_UNORM,
+      GL_NONE,
+      GL_NONE },
+    { ktx2_vk_format_bc7_srgb,
+      16,
+      block_compression_block_dimension,
+      4,
+      true,
+      BlockFormat::BC7,
+      true,
+      GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM,
+      GL_NONE,
+      GL_NONE },
+};
+
+// Note: Value of the KTXorientation key: rows run right, and bottom to top.
+constexpr char ktx2_orientation_key[]   = "KTXorientation";
+constexpr char ktx2_orientation_value[] = "ru";
+
+static const CookedTextureFormat*
+FindCookedTextureFormat(const uint32_t& _vk_format_in)
+{
+    for (const CookedTextureFormat& format : cooked_texture_formats)
+    {
+        if (_vk_format_in == format.vk_format)
+        {
+            return &format;
+        }
+    }
+
+    return nullptr;
+}
+
+// Note: The sRGB format of the block format when `_srgb_in` is set and there is one; its
+//       UNORM format otherwise.
+static const CookedTextureFormat*
+FindCookedTextureFormat(const BlockFormat& _block_format_in, const bool& _srgb_in)
+{
+    const CookedTextureFormat* unorm_format = nullptr;
+    for (const CookedTextureFormat& format : cooked_texture_formats)
+    {
+        if ((false == format.compressed) || (_block_format_in != format.block_format))
+        {
+            continue;
+        }
+
+        if (_srgb_in == format.srgb)
+        {
+            return &format;
+        }
+
+        if (false == format.srgb)
+        {
+            unorm_format = &format;
+        }
+    }
+
+    return unorm_format;
+}
+
+// Note: KTX2 aligns each mip level to the least common multiple of the block size and four.
+static inline size_t
+GetLevelAlignment(const uint32_t& _block_size_bytes_in)
+{
+    if (0 == (_block_size_bytes_in % 4))
+    {
+        return _block_size_bytes_in;
+    }
+
+    return (0 == (_block_size_bytes_in % 2)) ? (_block_size_bytes_in * 2)
+                                              : (_block_size_bytes_in * 4);
+}
+
+// Note: Blocks which overhang the level are stored whole.
+static inline uint64_t
+GetLevelSizeBytes(const CookedTextureFormat& _format_in,
+                  const GLsizei&             _width_in,
+                  const GLsizei&             _height_in)
+{
+    const uint64_t block_column_count = (static_cast<uint64_t>(_width_in) +
+                                         (_format_in.block_dimension - 1)) /
+                                        _format_in.block_dimension;
+    const uint64_t block_row_count    = (static_cast<uint64_t>(_height_in) +
+                                      (_format_in.block_dimension - 1)) /
+                                     _format_in.block_dimension;
+    return block_column_count * block_row_count * _format_in.block_size_bytes;
+}
+
+static inline size_t
+AlignCookedTextureOffset(const size_t& _offset_in, const size_t& _alignment_in)
+{
+    return ((_offset_in + (_alignment_in - 1)) / _alignment_in) * _alignment_in;
+}
+
+static inline uint32_t
+GetMipLevelCount(const int& _width_in, const int& _height_in)
+{
+    return static_cast<uint32_t>(std::bit_width(static_cast<uint32_t>(
+      std::max(_width_in, _height_in))));
+}
+
+static void
+ReportCookedTextureError(const char* const _cooked_texture_file_path_in,
+                         const char* const _note_in)
+{
+    std::stringstream ss;
+    ss << "Ignoring cooked texture file." << std::endl
+       << "   File: " << _cooked_texture_file_path_in << std::endl
+       << "   Note: " << _note_in;
+    Log_w(ss);
+}
+
+// Note: Finds the value of `_key_in` in the key/value data. Each entry is a 32-bit length, the
+//       null terminated key and the value, padded to four bytes.
+static bool
+FindKtx2Value(const unsigned char* const _kvd_in,
+              const size_t&              _kvd_size_bytes_in,
+              const char* const          _key_in,
+              const unsigned char*&      _value_out,
+              size_t&                    _value_size_bytes_out)
+{
+    const size_t key_size_bytes = std::strlen(_key_in) + 1;
+
+    size_t entry_offset = 0;
+    while ((entry_offset + sizeof(uint32_t)) <= _kvd_size_bytes_in)
+    {
+        uint32_t entry_size_bytes = 0;
+        std::memcpy(&entry_size_bytes, _kvd_in + entry_offset, sizeof(uint32_t));
+
+        const size_t entry_data_offset = entry_offset + sizeof(uint32_t);
+        if (entry_size_bytes > (_kvd_size_bytes_in - entry_data_offset))
+        {
+            return false;
+        }
+
+        if ((key_size_bytes <= entry_size_bytes) &&
+            (0 == std::memcmp(_kvd_in + entry_data_offset, _key_in, key_size_bytes)))
+        {
+            _value_out            = _kvd_in + entry_data_offset + key_size_bytes;
+            _value_size_bytes_out = entry_size_bytes - key_size_bytes;
+            return true;
+        }
+
+        entry_offset = AlignCookedTextureOffset(entry_data_offset + entry_size_bytes, 4);
+    }
+
+    return false;
+}
+
+static void
+AppendKtx2KeyValue(std::vector<unsigned char>& _kvd_in_out,
+                   const char* const           _key_in,
+                   const void* const           _value_in,
+                   const size_t&               _value_size_bytes_in)
+{
+    const size_t   key_size_bytes   = std::strlen(_key_in) + 1;
+    const uint32_t entry_size_bytes = static_cast<uint32_t>(key_size_bytes + _value_size_bytes_in);
+
+    const size_t entry_offset = _kvd_in_out.size();
+    _kvd_in_out.resize(
+      AlignCookedTextureOffset(entry_offset + sizeof(uint32_t) + entry_size_bytes, 4), 0);
+
+    unsigned char* const entry = _kvd_in_out.data() + entry_offset;
+    std::memcpy(entry, &entry_size_bytes, sizeof(uint32_t));
+    std::memcpy(entry + sizeof(uint32_t), _key_in, key_size_bytes);
+    std::memcpy(entry + sizeof(uint32_t) + key_size_bytes, _value_in, _value_size_bytes_in);
+}
+
+struct Ktx2DataFormatSample
+{
+    uint32_t channel_id;
+    uint32_t bit_offset;
+    uint32_t bit_length;
+};
+
+// Note: A Khronos basic data format descriptor block (see the Khronos Data Format Specification).
+//       Uncompressed formats have one 8-bit unsigned normalized sample per channel, in RGBA
+//       order. Block compressed formats have one sample per 64 or 128 bits of their block, in
+//       the color model of the format.
+static void
+BuildKtx2DataFormatDescriptor(const CookedTextureFormat& _format_in,
+                              std::vector<uint32_t>&     _dfd_out)
+{
+    constexpr uint32_t khr_df_version_1_3        = 2;
+    constexpr uint32_t khr_df_model_rgbsda       = 1;
+    constexpr uint32_t khr_df_model_bc1a         = 128;
+    constexpr uint32_t khr_df_model_bc3          = 130;
+    constexpr uint32_t khr_df_model_bc5          = 132;
+    constexpr uint32_t khr_df_model_bc7          = 134;
+    constexpr uint32_t khr_df_primaries_bt709    = 1;
+    constexpr uint32_t khr_df_transfer_linear    = 1;
+    constexpr uint32_t khr_df_transfer_srgb      = 2;
+    constexpr uint32_t khr_df_channel_ids[]      = { 0, 1, 2, 15 };
+    constexpr uint32_t khr_df_block_header_bytes = 24;
+    constexpr uint32_t khr_df_sample_bytes       = 16;
+
+    uint32_t                          color_model  = khr_df_model_rgbsda;
+    uint32_t                          sample_upper = 255;
+    std::vector<Ktx2DataFormatSample> samples;
+    if (false == _format_in.compressed)
+    {
+        for (uint32_t channel = 0; channel < _format_in.channel_count; channel++)
+        {
+            samples.push_back({ khr_df_channel_ids[channel], channel * 8, 8 });
+        }
+    }
+    else
+    {
+        sample_upper = std::numeric_limits<uint32_t>::max();
+        switch (_format_in.block_format)
+        {
+            case BlockFormat::BC1:
+            {
+                color_model = khr_df_model_bc1a;
+                samples     = { { 0, 0, 64 } };
+                break;
+            }
+            case BlockFormat::BC3:
+            {
+                color_model = khr_df_model_bc3;
+                samples     = { { 15, 0, 64 }, { 0, 64, 64 } };
+                break;
+            }
+            case BlockFormat::BC5:
+            {
+                color_model = khr_df_model_bc5;
+                samples     = { { 0, 0, 64 }, { 1, 64, 64 } };
+                break;
+            }
+            case BlockFormat::BC7:
+            {
+                color_model = khr_df_model_bc7;
+                samples     = { { 0, 0, 128 } };
+                break;
+            }
+        }
+    }
+
+    const uint32_t block_size_bytes = khr_df_block_header_bytes +
+                                      static_cast<uint32_t>(samples.size() * khr_df_sample_bytes);
+    const uint32_t block_dimension  = _format_in.block_dimension - 1;
+
+    _dfd_out.clear();
+    _dfd_out.push_back(sizeof(uint32_t) + block_size_bytes);
+    _dfd_out.push_back(0); // Note: Khronos vendor, basic descriptor type.
+    _dfd_out.push_back((block_size_bytes << 16) | khr_df_version_1_3);
+    const uint32_t transfer = (true == _format_in.srgb) ? khr_df_transfer_srgb
+                                                        : khr_df_transfer_linear;
+    _dfd_out.push_back(color_model | (khr_df_primaries_bt709 << 8) | (transfer << 16));
+    _dfd_out.push_back(block_dimension | (block_dimension << 8));
+    _dfd_out.push_back(_format_in.block_size_bytes);
+    _dfd_out.push_back(0);
+
+    for (const Ktx2DataFormatSample& sample : samples)
+    {
+        _dfd_out.push_back(sample.bit_offset | ((sample.bit_length - 1) << 16) |
+                           (sample.channel_id << 24));
+        _dfd_out.push_back(0);
+        _dfd_out.push_back(0);
+        _dfd_out.push_back(sample_upper);
+    }
+}
+
+void
+GetCookedTextureOptionsHash(uint64_t& _hash_out, const CookedTextureOptions& _options_in) noexcept
+{
+    uint32_t alpha_coverage_reference_bits = 0;
+    std::memcpy(&alpha_coverage_reference_bits,
+                &_options_in.mip_options.alpha_coverage_reference,
+                sizeof(uint32_t));
+
+    std::vector<uint64_t> option_values;
+    option_values.push_back(static_cast<uint64_t>(_options_in.mip_options.filter));
+    option_values.push_back((true == _options_in.mip_options.srgb) ? 1 : 0);
+    option_values.push_back(alpha_coverage_reference_bits);
+    option_values.push_back((true == _options_in.compress) ? 1 : 0);
+    if (true == _options_in.compress)
+    {
+        option_values.push_back(static_cast<uint64_t>(_options_in.block_format));
+        option_values.push_back(static_cast<uint64_t>(_options_in.compression_quality));
+    }
+
+    HashMemory(_hash_out, option_values.data(), option_values.size() * sizeof(uint64_t));
+}
+
+// Note: As MapCookedTexture(...), with the source entry compared by `_is_source_current_in`.
+static void
+MapCookedTextureIfCurrent(
+  bool&                                                  _success_out,
+  const char* const                                      _cooked_texture_file_path_in,
+  const std::function<bool(const CookedTextureSource&)>& _is_source_current_in,
+  CookedTexture&                                         _cooked_texture_out,
+  const CookedTextureOptions* const                      _options_in)
+{
+    _success_out = false;
+
+    _cooked_texture_out.header          = nullptr;
+    _cooked_texture_out.channel_count   = 0;
+    _cooked_texture_out.compressed      = false;
+    _cooked_texture_out.block_format    = BlockFormat::BC1;
+    _cooked_texture_out.srgb            = false;
+    _cooked_texture_out.internal_format = GL_NONE;
+    _cooked_texture_out.pixel_format    = GL_NONE;
+    _cooked_texture_out.pixel_type      = GL_NONE;
+    _cooked_texture_out.levels.clear();
+
+    bool file_exists = false;
+    bool file_empty  = true;
+    FileExistsOrEmpty(_cooked_texture_file_path_in, file_exists, file_empty);
+    if ((false == file_exists) || (true == file_empty))
+    {
+        return;
+    }
+
+    MapFileToMemory(_success_out, _cooked_texture_file_path_in, _cooked_texture_out.file);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    _success_out = false;
+
+    const unsigned char* const data = reinterpret_cast<const unsigned char*>(
+      _cooked_texture_out.file.data);
+    const size_t size_bytes = _cooked_texture_out.file.size_bytes;
+    if (sizeof(Ktx2Header) > size_bytes)
+    {
+        ReportCookedTextureError(_cooked_texture_file_path_in, "File is smaller than its header.");
+        return;
+    }
+
+    const Ktx2Header* const header = reinterpret_cast<const Ktx2Header*>(data);
+    if (0 != std::memcmp(header->identifier, ktx2_identifier, sizeof(ktx2_identifier)))
+    {
+        ReportCookedTextureError(_cooked_texture_file_path_in, "Not a KTX2 file.");
+        return;
+    }
+
+    // Note: The source key is checked before the layout, so that files written by other tools
+    //       are reported as such.
+    if (((header->kvd_offset_bytes + static_cast<uint64_t>(header->kvd_size_bytes)) > size_bytes))
+    {
+        ReportCookedTextureError(_cooked_texture_file_path_in, "Key/value data is out of bounds.");
+        return;
+    }
+
+    const unsigned char* source_value            = nullptr;
+    size_t               source_value_size_bytes = 0;
+    if ((false == FindKtx2Value(data + header->kvd_offset_bytes,
+                                header->kvd_size_bytes,
+                                cooked_texture_source_key,
+                                source_value,
+                                source_value_size_bytes)) ||
+        (sizeof(uint32_t) > source_value_size_bytes))
+    {
+        ReportCookedTextureError(_cooked_texture_file_path_in, "Missing the source key.");
+        return;
+    }
+
+    // Note: The version leads the value, whose size differs between versions.
+    uint32_t source_version = 0;
+    std::memcpy(&source_version, source_value, sizeof(uint32_t));
+    if ((cooked_texture_version != source_version) ||
+        (sizeof(CookedTextureSource) != source_value_size_bytes))
+    {
+        ReportCookedTextureError(_cooked_texture_file_path_in, "Unrecognized version.");
+        return;
+    }
+
+    CookedTextureSource source;
+    std::memcpy(&source, source_value, sizeof(CookedTextureSource));
+    if (false == _is_source_current_in(source))
+    {
+        // Note: The source changed since it was cooked. Not an error; the caller recooks.
+        return;
+    }
+
+    if (nullptr != _options_in)
+    {
+        uint64_t options_hash = 0;
+        GetCookedTextureOptionsHash(options_hash, *_options_in);
+        if (options_hash != source.options_hash)
+        {
+            // Note: Cooked with other options. Not an error; the caller recooks.
+            return;
+        }
+    }
+
+    const CookedTextureFormat* const format = FindCookedTextureFormat(header->vk_format);
+    if ((nullptr == format) || (0 != header->supercompression_scheme))
+    {
+        ReportCookedTextureError(_cooked_texture_file_path_in, "Unsupported format.");
+        return;
+    }
+
+    if ((0 == header->pixel_width) || (0 == header->pixel_height) || (0 != header->pixel_depth) ||
+        (0 != header->layer_count) || (1 != header->face_count) || (0 == header->level_count) ||
+        (header->pixel_width > static_cast<uint32_t>(std::numeric_limits<GLsizei>::max())) ||
+        (header->pixel_height > static_cast<uint32_t>(std::numeric_limits<GLsizei>::max())) ||
+        (GetMipLevelCount(header->pixel_width, header->pixel_height) < header->level_count))
+    {
+        ReportCookedTextureError(_cooked_texture_file_path_in, "Not a 2D texture.");
+        return;
+    }
+
+    const size_t level_index_end = sizeof(Ktx2Header) +
+                                   (header->level_count * sizeof(Ktx2LevelIndex));
+    if (level_index_end > size_bytes)
+    {
+        ReportCookedTextureError(_cooked_texture_file_path_in, "Level index is out of bounds.");
+        return;
+    }
+
+    const Ktx2LevelIndex* const level_index = reinterpret_cast<const Ktx2LevelIndex*>(
+      data + sizeof(Ktx2Header));
+    const size_t level_alignment = GetLevelAlignment(format->block_size_bytes);
+
+    _cooked_texture_out.levels.resize(header->level_count);
+    for (uint32_t level = 0; level < header->level_count; level++)
+    {
+        const GLsizei width  = std::max(static_cast<GLsizei>(header->pixel_width >> level), 1);
+        const GLsizei height = std::max(static_cast<GLsizei>(header->pixel_height >> level), 1);
+        const uint64_t level_size_bytes = GetLevelSizeBytes(*format, width, height);
+
+        const Ktx2LevelIndex& index = level_index[level];
+        if ((level_size_bytes != index.size_bytes) ||
+            (level_size_bytes != index.uncompressed_size_bytes) ||
+            (0 != (index.offset_bytes % level_alignment)) ||
+            (level_index_end > index.offset_bytes) || (index.offset_bytes > size_bytes) ||
+            (index.size_bytes > (size_bytes - index.offset_bytes)))
+        {
+            ReportCookedTextureError(_cooked_texture_file_path_in, "Mip level is out of bounds.");
+            _cooked_texture_out.levels.clear();
+            return;
+        }
+
+        CookedTextureLevel& cooked_texture_level = _cooked_texture_out.levels[level];
+        cooked_texture_level.data                = data + index.offset_bytes;
+        cooked_texture_level.size_bytes          = index.size_bytes;
+        cooked_texture_level.width               = width;
+        cooked_texture_level.height              = height;
+    }
+
+    _cooked_texture_out.header          = header;
+    _cooked_texture_out.channel_count   = static_cast<int>(format->channel_count);
+    _cooked_texture_out.compressed      = format->compressed;
+    _cooked_texture_out.block_format    = format->block_format;
+    _cooked_texture_out.srgb            = format->srgb;
+    _cooked_texture_out.internal_format = format->internal_format;
+    _cooked_texture_out.pixel_format    = format->pixel_format;
+    _cooked_texture_out.pixel_type      = format->pixel_type;
+
+    _success_out = true;
+}
+
+void
+MapCookedTexture(bool&                             _success_out,
+                 const char* const                 _cooked_texture_file_path_in,
+                 const uint64_t&                   _source_size_bytes_in,
+                 const uint64_t&                   _source_content_hash_in,
+                 CookedTexture&                    _cooked_texture_out,
+                 const CookedTextureOptions* const _options_in)
+{
+    MapCookedTextureIfCurrent(
+      _success_out,
+      _cooked_texture_file_path_in,
+      [&](const CookedTextureSource& _source_in)
+      {
+          return (_source_size_bytes_in == _source_in.source_size_bytes) &&
+                 (_source_content_hash_in == _source_in.source_content_hash);
+      },
+      _cooked_texture_out,
+      _options_in);
+}
+
+void
+MapCurrentCookedTexture(bool&                             _success_out,
+                        const char* const                 _image_file_path_in,
+                        CookedTexture&                    _cooked_texture_out,
+                        const CookedTextureOptions* const _options_in)
+{
+    _success_out = false;
+    if (nullptr == _image_file_path_in)
+    {
+        return;
+    }
+
+    const std::string cooked_texture_file_path = std::string(_image_file_path_in) +
+                                                 cooked_texture_file_extension;
+    bool              file_exists              = false;
+    bool              file_empty               = true;
+    FileExistsOrEmpty(cooked_texture_file_path.c_str(), file_exists, file_empty);
+    if ((false == file_exists) || (true == file_empty))
+    {
+        return;
+    }
+
+    std::error_code error_code;
+    const uint64_t  source_size_bytes = std::filesystem::file_size(_image_file_path_in,
+                                                                  error_code);
+    if (error_code)
+    {
+        return;
+    }
+
+    bool     has_source_write_time = false;
+    uint64_t source_write_time     = 0;
+    GetFileWriteTime(has_source_write_time, _image_file_path_in, source_write_time);
+
+    // Note: An image of the recorded size and modification time is taken as the one cooked. The
+    //       image is only hashed when its size matches but it was modified since, such that a
+    //       current cooked texture is found without reading the image.
+    MapCookedTextureIfCurrent(
+      _success_out,
+      cooked_texture_file_path.c_str(),
+      [&](const CookedTextureSource& _source_in)
+      {
+          if (source_size_bytes != _source_in.source_size_bytes)
+          {
+              return false;
+          }
+
+          if ((true == has_source_write_time) &&
+              (source_write_time == _source_in.source_write_time))
+          {
+              return true;
+          }
+
+          bool       image_file_mapped = false;
+          MappedFile image_file;
+          MapFileToMemory(image_file_mapped, _image_file_path_in, image_file);
+          if ((false == image_file_mapped) || (source_size_bytes != image_file.size_bytes))
+          {
+              return false;
+          }
+
+          uint64_t source_content_hash = 0;
+          HashMemory(source_content_hash, image_file.data, image_file.size_bytes);
+          return source_content_hash == _source_in.source_content_hash;
+      },
+      _cooked_texture_out,
+      _options_in);
+}
+
+void
+WriteCookedTexture(bool&                       _success_out,
+                   const char* const           _cooked_texture_file_path_in,
+                   const uint64_t&             _source_size_bytes_in,
+                   const uint64_t&             _source_content_hash_in,
+                   const uint64_t&             _source_write_time_in,
+                   const unsigned char* const  _image_data_in,
+                   const int&                  _image_width_in,
+                   const int&                  _image_height_in,
+                   const int&                  _image_channels_in,
+                   const CookedTextureOptions& _options_in)
+{
+    _success_out = false;
+
+    if ((nullptr == _image_data_in) || (0 >= _image_width_in) || (0 >= _image_height_in))
+    {
+        Log_e("Invalid image provided.");
+        return;
+    }
+
+    const bool                 srgb   = _options_in.mip_options.srgb;
+    const CookedTextureFormat* format = nullptr;
+    switch (_image_channels_in)
+    {
+        // [ cfarvin::TODO ] case: 1 is grayscale
+        case 3:
+        {
+            format = FindCookedTextureFormat((true == srgb) ? ktx2_vk_format_r8g8b8_srgb
+                                                            : ktx2_vk_format_r8g8b8_unorm);
+            break;
+        }
+        case 4:
+        {
+            format = FindCookedTextureFormat((true == srgb) ? ktx2_vk_format_r8g8b8a8_srgb
+                                                            : ktx2_vk_format_r8g8b8a8_unorm);
+            break;
+        }
+        default:
+        {
+            std::stringstream ss;
+            ss << "Invalid number of image channels provided: " << _image_channels_in;
+            Log_e(ss);
+            return;
+        }
+    }
+
+    if (true == _options_in.compress)
+    {
+        format = FindCookedTextureFormat(_options_in.block_format, srgb);
+    }
+
+    // Note: Levels are generated from four channel images; three channel formats drop alpha,
+    //       and compressed formats are encoded, once every level is generated.
+    const uint32_t level_count      = GetMipLevelCount(_image_width_in, _image_height_in);
+    const size_t   image_size_bytes = static_cast<size_t>(_image_width_in) * _image_height_in * 4;
+
+    std::vector<MipLevel> mip_levels;
+    GenerateMipChain(_success_out,
+                     _image_data_in,
+                     _image_width_in,
+                     _image_height_in,
+                     _options_in.mip_options,
+                     nullptr,
+                     mip_levels);
+    if (false == _success_out)
+    {
+        Log_e("Unable to generate the mip chain of the cooked texture.");
+        return;
+    }
+
+    _success_out = false;
+    assert((level_count - 1) == mip_levels.size());
+
+    std::vector<std::vector<unsigned char>> levels(level_count);
+    levels[0].assign(_image_data_in, _image_data_in + image_size_bytes);
+    for (uint32_t level = 1; level < level_count; level++)
+    {
+        levels[level] = std::move(mip_levels[level - 1].pixels);
+    }
+
+    if (true == format->compressed)
+    {
+        for (uint32_t level = 0; level < level_count; level++)
+        {
+            const int width  = std::max(_image_width_in >> level, 1);
+            const int height = std::max(_image_height_in >> level, 1);
+
+            std::vector<unsigned char> blocks;
+            CompressImageBlocks(_success_out,
+                                levels[level].data(),
+                                width,
+                                height,
+                                format->block_format,
+                                _options_in.compression_quality,
+                                nullptr,
+                                blocks);
+            if (false == _success_out)
+            {
+                Log_e("Unable to compress a mip level of the cooked texture.");
+                return;
+            }
+
+            levels[level] = std::move(blocks);
+        }
+
+        _success_out = false;
+    }
+    else if (3 == format->channel_count)
+    {
+        for (auto& level : levels)
+        {
+            const size_t pixel_count = level.size() / 4;
+            for (size_t pixel = 0; pixel < pixel_count; pixel++)
+            {
+                level[(pixel * 3) + 0] = level[(pixel * 4) + 0];
+                level[(pixel * 3) + 1] = level[(pixel * 4) + 1];
+                level[(pixel * 3) + 2] = level[(pixel * 4) + 2];
+            }
+
+            level.resize(pixel_count * 3);
+        }
+    }
+
+    std::vector<uint32_t> dfd;
+    BuildKtx2DataFormatDescriptor(*format, dfd);
+
+    // Note: Keys are sorted by their bytes, as KTX2 requires.
+    CookedTextureSource source;
+    source.source_size_bytes   = _source_size_bytes_in;
+    source.source_content_hash = _source_content_hash_in;
+    source.source_write_time   = _source_write_time_in;
+    GetCookedTextureOptionsHash(source.options_hash, _options_in);
+
+    std::vector<unsigned char> kvd;
+    AppendKtx2KeyValue(kvd,
+                       ktx2_orientation_key,
+                       ktx2_orientation_value,
+                       sizeof(ktx2_orientation_value));
+    AppendKtx2KeyValue(kvd, cooked_texture_source_key, &source, sizeof(CookedTextureSource));
+
+    Ktx2Header header;
+    std::memcpy(header.identifier, ktx2_identifier, sizeof(ktx2_identifier));
+    header.vk_format        = format->vk_format;
+    header.pixel_width      = static_cast<uint32_t>(_image_width_in);
+    header.pixel_height     = static_cast<uint32_t>(_image_height_in);
+    header.level_count      = level_count;
+    header.dfd_offset_bytes = static_cast<uint32_t>(sizeof(Ktx2Header) +
+                                                    (level_count * sizeof(Ktx2LevelIndex)));
+    header.dfd_size_bytes   = static_cast<uint32_t>(dfd.size() * sizeof(uint32_t));
+    header.kvd_offset_bytes = header.dfd_offset_bytes + header.dfd_size_bytes;
+    header.kvd_size_bytes   = static_cast<uint32_t>(kvd.size());
+
+    // Note: The smallest level is stored first, so that a reader streaming the file from the
+    //       front has a complete texture as soon as possible.
+    const size_t                level_alignment = GetLevelAlignment(format->block_size_bytes);
+    std::vector<Ktx2LevelIndex> level_index(level_count);
+    size_t                      file_size_bytes = header.kvd_offset_bytes + header.kvd_size_bytes;
+    for (uint32_t level = level_count; level-- > 0;)
+    {
+        file_size_bytes = AlignCookedTextureOffset(file_size_bytes, level_alignment);
+
+        level_index[level].offset_bytes            = file_size_bytes;
+        level_index[level].size_bytes              = levels[level].size();
+        level_index[level].uncompressed_size_bytes = levels[level].size();
+
+        file_size_bytes += levels[level].size();
+    }
+
+    // Note: Unique per thread, as the same texture may be cooked on several at once.
+    std::stringstream temporary_file_path_ss;
+    temporary_file_path_ss << _cooked_texture_file_path_in << "." << std::this_thread::get_id()
+                           << ".tmp";
+    const std::string temporary_file_path = temporary_file_path_ss.str();
+    {
+        std::ofstream file_stream(temporary_file_path, std::ios::binary | std::ios::trunc);
+        if (false == file_stream.is_open())
+        {
+            std::stringstream ss;
+            ss << "Unable to open cooked texture file for writing: " << temporary_file_path;
+            Log_w(ss);
+            return;
+        }
+
+        file_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file_stream.write(reinterpret_cast<const char*>(level_index.data()),
+                          level_index.size() * sizeof(Ktx2LevelIndex));
+        file_stream.write(reinterpret_cast<const char*>(dfd.data()),
+                          dfd.size() * sizeof(uint32_t));
+        file_stream.write(reinterpret_cast<const char*>(kvd.data()), kvd.size());
+
+        const char padding[16]        = { 0 };
+        size_t     written_size_bytes = header.kvd_offset_bytes + header.kvd_size_bytes;
+        for (uint32_t level = level_count; level-- > 0;)
+        {
+            file_stream.write(padding, level_index[level].offset_bytes - written_size_bytes);
+            file_stream.write(reinterpret_cast<const char*>(levels[level].data()),
+                              levels[level].size());
+            written_size_bytes = level_index[level].offset_bytes + levels[level].size();
+        }
+
+        _success_out = file_stream.good();
+    }
+
+    std::error_code error_code;
+    if (true == _success_out)
+    {
+        std::filesystem::rename(temporary_file_path, _cooked_texture_file_path_in, error_code);
+        _success_out = (false == static_cast<bool>(error_code));
+    }
+
+    if (false == _success_out)
+    {
+        std::filesystem::remove(temporary_file_path, error_code);
+
+        std::stringstream ss;
+        ss << "Unable to write cooked texture file: " << _cooked_texture_file_path_in;
+        Log_w(ss);
+    }
+}
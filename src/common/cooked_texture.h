@@ -0,0 +1,190 @@
+#ifndef cooked_texture_h
+#define cooked_texture_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "block_compression.h"
+#include "fileio.h"
+#include "mip_generator.h"
+
+//
+// Note: A cooked texture is the binary form of an image, laid out as a KTX2 file so that standard
+//       tools can inspect it. Every mip level is stored in the pixel format it is uploaded in,
+//       such that the file is memory mapped and each level handed straight to OpenGL, without
+//       decoding the image or generating mipmaps:
+//
+//       Ktx2Header
+//       Ktx2LevelIndex[level_count]
+//       Data format descriptor, dfd_size_bytes
+//       Key/value data, kvd_size_bytes
+//       (padding)
+//       Mip levels, smallest first; each aligned as the format requires
+//
+//       Rows are stored bottom to top, as images are loaded (see LoadImageToMemory(...) in
+//       image_tools.h); the KTXorientation key records this. Only 2D textures with a complete
+//       mip chain are written, uncompressed or block compressed (see block_compression.h).
+//
+//       Cooked textures record the size, content hash and modification time of the image they
+//       were cooked from in the cooked_texture_source_key entry of the key/value data, and are
+//       considered stale when the size or content hash no longer matches. The entry also
+//       records a hash of the options the texture was cooked with (see
+//       GetCookedTextureOptionsHash(...)); callers that cook pass their options to be compared
+//       as well, such that changing them recooks. Callers that only draw the texture accept
+//       whatever options it was cooked with.
+//
+constexpr unsigned char ktx2_identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32,
+                                                0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+// Note: VkFormat values, as KTX2 identifies formats by them. Textures cooked with sRGB mips
+//       (see MipGenerationOptions in mip_generator.h) are written with the _SRGB formats, and
+//       uploaded with the matching sRGB internal formats, such that they are sampled as linear
+//       colors. BC5 holds two channel data, such as normals, and has no sRGB format.
+constexpr uint32_t ktx2_vk_format_r8g8b8_unorm   = 23;
+constexpr uint32_t ktx2_vk_format_r8g8b8_srgb    = 29;
+constexpr uint32_t ktx2_vk_format_r8g8b8a8_unorm = 37;
+constexpr uint32_t ktx2_vk_format_r8g8b8a8_srgb  = 43;
+constexpr uint32_t ktx2_vk_format_bc1_rgb_unorm  = 131;
+constexpr uint32_t ktx2_vk_format_bc1_rgb_srgb   = 132;
+constexpr uint32_t ktx2_vk_format_bc3_unorm      = 137;
+constexpr uint32_t ktx2_vk_format_bc3_srgb       = 138;
+constexpr uint32_t ktx2_vk_format_bc5_unorm      = 141;
+constexpr uint32_t ktx2_vk_format_bc7_unorm      = 145;
+constexpr uint32_t ktx2_vk_format_bc7_srgb       = 146;
+
+constexpr uint32_t cooked_texture_version          = 4;
+constexpr char     cooked_texture_source_key[]     = "OGLengine.source";
+constexpr char     cooked_texture_file_extension[] = ".ktx2";
+
+struct Ktx2Header
+{
+    unsigned char identifier[12]          = { 0 };
+    uint32_t      vk_format               = 0;
+    uint32_t      type_size               = 1;
+    uint32_t      pixel_width             = 0;
+    uint32_t      pixel_height            = 0;
+    uint32_t      pixel_depth             = 0;
+    uint32_t      layer_count             = 0;
+    uint32_t      face_count              = 1;
+    uint32_t      level_count             = 0;
+    uint32_t      supercompression_scheme = 0;
+
+    uint32_t dfd_offset_bytes = 0;
+    uint32_t dfd_size_bytes   = 0;
+    uint32_t kvd_offset_bytes = 0;
+    uint32_t kvd_size_bytes   = 0;
+    uint64_t sgd_offset_bytes = 0;
+    uint64_t sgd_size_bytes   = 0;
+};
+
+struct Ktx2LevelIndex
+{
+    uint64_t offset_bytes            = 0;
+    uint64_t size_bytes              = 0;
+    uint64_t uncompressed_size_bytes = 0;
+};
+
+// Note: Value of the cooked_texture_source_key entry.
+struct CookedTextureSource
+{
+    uint32_t version             = cooked_texture_version;
+    uint32_t padding             = 0;
+    uint64_t source_size_bytes   = 0;
+    uint64_t source_content_hash = 0;
+    uint64_t options_hash        = 0;
+
+    // Note: See GetFileWriteTime(...) in fileio.h; zero when unknown.
+    uint64_t source_write_time = 0;
+};
+
+struct CookedTextureOptions
+{
+    MipGenerationOptions mip_options;
+
+    // Note: When set, every level is block compressed to `block_format`, which determines the
+    //       channels stored in place of the image's channel count.
+    bool                    compress            = false;
+    BlockFormat             block_format        = BlockFormat::BC7;
+    BlockCompressionQuality compression_quality = BlockCompressionQuality::FAST;
+};
+
+// Note: Of the mip and compression options; the block format and quality are ignored unless
+//       `compress` is set, as they do not change the texture written.
+void
+GetCookedTextureOptionsHash(uint64_t& _hash_out, const CookedTextureOptions& _options_in) noexcept;
+
+struct CookedTextureLevel
+{
+    const unsigned char* data       = nullptr;
+    size_t               size_bytes = 0;
+    GLsizei              width      = 0;
+    GLsizei              height     = 0;
+};
+
+// Read-only view of a cooked texture file. Pointers are valid for the lifetime of the object.
+struct CookedTexture
+{
+    MappedFile file;
+
+    const Ktx2Header* header        = nullptr;
+    int               channel_count = 0;
+
+    // Note: Levels of compressed textures are blocks of `block_format`, uploaded with
+    //       glCompressedTexImage2D; `pixel_format` and `pixel_type` are GL_NONE.
+    bool        compressed   = false;
+    BlockFormat block_format = BlockFormat::BC1;
+
+    // Note: Set for the _SRGB formats, whose internal format is sRGB.
+    bool srgb = false;
+
+    // Note: Level zero, the full resolution image, first.
+    std::vector<CookedTextureLevel> levels;
+
+    // Note: Arguments to glTexImage2D, or glCompressedTexImage2D.
+    GLenum internal_format = GL_NONE;
+    GLenum pixel_format    = GL_NONE;
+    GLenum pixel_type      = GL_NONE;
+};
+
+// Note: Fails without logging an error if the file does not exist, so that a missing cooked
+//       texture may be treated as a cache miss. Malformed or out of date files are logged.
+//       When `_options_in` is provided, a texture cooked with other options is stale.
+void
+MapCookedTexture(bool&                             _success_out,
+                 const char* const                 _cooked_texture_file_path_in,
+                 const uint64_t&                   _source_size_bytes_in,
+                 const uint64_t&                   _source_content_hash_in,
+                 CookedTexture&                    _cooked_texture_out,
+                 const CookedTextureOptions* const _options_in = nullptr);
+
+// Note: Maps `<image file>.ktx2` if it was cooked from the current contents of the image file,
+//       and with `_options_in` when provided. Fails without logging an error otherwise. The
+//       image is only read, and hashed, when its modification time differs from the one
+//       recorded but its size does not.
+void
+MapCurrentCookedTexture(bool&                             _success_out,
+                        const char* const                 _image_file_path_in,
+                        CookedTexture&                    _cooked_texture_out,
+                        const CookedTextureOptions* const _options_in = nullptr);
+
+// Note: `_image_data_in` holds four channels per pixel, as loaded by LoadImageToMemory(...);
+//       `_image_channels_in` selects the format stored, RGB for three and RGBA for four. The
+//       mip chain is generated, and compressed, on the calling thread as `_options_in`
+//       describes.
+//
+//       The file is written to a temporary path and renamed into place, such that a concurrent
+//       reader never observes a partially written cooked texture.
+void
+WriteCookedTexture(bool&                       _success_out,
+                   const char* const           _cooked_texture_file_path_in,
+                   const uint64_t&             _source_size_bytes_in,
+                   const uint64_t&             _source_content_hash_in,
+                   const uint64_t&             _source_write_time_in,
+                   const unsigned char* const  _image_data_in,
+                   const int&                  _image_width_in,
+                   const int&                  _image_height_in,
+                   const int&                  _image_channels_in,
+                   const CookedTextureOptions& _options_in);
+
+#endif // cooked_texture_h
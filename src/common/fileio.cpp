@@ -6,6 +6,12 @@
 
 #include "logging.h"
 
+#if defined(_ENGINE_PLATFORM_LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 void
 FileExistsOrEmpty(const char* const _file_path_in, bool& _file_exists_out, bool& _file_empty_out)
 {
@@ -50,4 +56,182 @@ LoadFileToStdString(bool&             _success_out,
     file_stream.read(_file_data_out.data(), _file_size_out);
 
     return;
-}
\ No newline at end of file
+}
+
+MappedFile::~MappedFile() { Unmap(); }
+
+void
+MappedFile::Unmap() noexcept
+{
+#if defined(_ENGINE_PLATFORM_WINDOWS_)
+    if (nullptr != data)
+    {
+        UnmapViewOfFile(data);
+    }
+
+    if (nullptr != mapping_handle)
+    {
+        CloseHandle(mapping_handle);
+        mapping_handle = nullptr;
+    }
+
+    if (INVALID_HANDLE_VALUE != file_handle)
+    {
+        CloseHandle(file_handle);
+        file_handle = INVALID_HANDLE_VALUE;
+    }
+#elif defined(_ENGINE_PLATFORM_LINUX)
+    if (nullptr != data)
+    {
+        munmap(const_cast<char*>(data), size_bytes);
+    }
+#endif
+
+    data       = nullptr;
+    size_bytes = 0;
+}
+
+void
+MapFileToMemory(bool& _success_out, const char* const _file_path_in, MappedFile& _mapped_file_out)
+{
+    _mapped_file_out.Unmap();
+
+    _success_out     = true;
+    bool file_exists = false;
+    bool file_empty  = true;
+    FileExistsOrEmpty(_file_path_in, file_exists, file_empty);
+    if ((false == file_exists) || (true == file_empty))
+    {
+        std::stringstream ss;
+        ss << "File does not exist or is empty: " << _file_path_in;
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    const size_t file_size_bytes = std::filesystem::file_size(_file_path_in);
+
+#if defined(_ENGINE_PLATFORM_WINDOWS_)
+    _mapped_file_out.file_handle = CreateFileA(_file_path_in,
+                                               GENERIC_READ,
+                                               FILE_SHARE_READ,
+                                               nullptr,
+                                               OPEN_EXISTING,
+                                               FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                               nullptr);
+    if (INVALID_HANDLE_VALUE == _mapped_file_out.file_handle)
+    {
+        _success_out = false;
+    }
+    else
+    {
+        _mapped_file_out.mapping_handle = CreateFileMappingA(_mapped_file_out.file_handle,
+                                                             nullptr,
+                                                             PAGE_READONLY,
+                                                             0,
+                                                             0,
+                                                             nullptr);
+        if (nullptr == _mapped_file_out.mapping_handle)
+        {
+            _success_out = false;
+        }
+        else
+        {
+            _mapped_file_out.data = static_cast<const char*>(
+              MapViewOfFile(_mapped_file_out.mapping_handle, FILE_MAP_READ, 0, 0, 0));
+            _success_out = (nullptr != _mapped_file_out.data);
+        }
+    }
+#elif defined(_ENGINE_PLATFORM_LINUX)
+    const int file_descriptor = open(_file_path_in, O_RDONLY);
+    if (-1 == file_descriptor)
+    {
+        _success_out = false;
+    }
+    else
+    {
+        void* mapping = mmap(nullptr, file_size_bytes, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+        // Note: The mapping holds its own reference to the file.
+        close(file_descriptor);
+
+        if (MAP_FAILED == mapping)
+        {
+            _success_out = false;
+        }
+        else
+        {
+            _mapped_file_out.data = static_cast<const char*>(mapping);
+        }
+    }
+#else
+    _success_out = false;
+#endif
+
+    if (false == _success_out)
+    {
+        _mapped_file_out.Unmap();
+
+        std::stringstream ss;
+        ss << "Unable to map file to memory: " << _file_path_in;
+        Log_e(ss);
+        return;
+    }
+
+    _mapped_file_out.size_bytes = file_size_bytes;
+}
+
+void
+GetFileWriteTime(bool& _success_out, const char* const _file_path_in, uint64_t& _write_time_out)
+{
+    _success_out    = false;
+    _write_time_out = 0;
+    if (nullptr == _file_path_in)
+    {
+        return;
+    }
+
+    std::error_code                       error_code;
+    const std::filesystem::file_time_type write_time = std::filesystem::last_write_time(
+      _file_path_in, error_code);
+    if (error_code)
+    {
+        return;
+    }
+
+    _write_time_out = static_cast<uint64_t>(write_time.time_since_epoch().count());
+    _success_out    = true;
+}
+
+void
+HashMemory(uint64_t& _hash_out, const void* const _data_in, const size_t& _size_bytes_in) noexcept
+{
+    // Note: FNV-1a constants, consumed a word at a time with a rotate so that high bits of each
+    //       word feed back into the low bits of the hash. Finalized with the MurmurHash3 mixer.
+    constexpr uint64_t offset_basis = 0xcbf29ce484222325ull;
+    constexpr uint64_t prime        = 0x00000100000001b3ull;
+
+    const unsigned char* const bytes = static_cast<const unsigned char*>(_data_in);
+    const size_t               words = _size_bytes_in / sizeof(uint64_t);
+
+    uint64_t hash = offset_basis ^ _size_bytes_in;
+    for (size_t word_index = 0; word_index < words; word_index++)
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + (word_index * sizeof(uint64_t)), sizeof(uint64_t));
+        hash = std::rotl((hash ^ word) * prime, 29);
+    }
+
+    for (size_t byte_index = words * sizeof(uint64_t); byte_index < _size_bytes_in; byte_index++)
+    {
+        hash = (hash ^ bytes[byte_index]) * prime;
+    }
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+
+    _hash_out = hash;
+}
@@ -14,4 +14,48 @@ LoadFileToStdString(bool&             _success_out,
                     size_t&           _file_size_out,
                     std::string&      _file_data_out);
 
+// Read-only view of a file mapped into the address space of the process. The view is
+// released when the object is destroyed, or when it is passed to MapFileToMemory(...) again.
+struct MappedFile
+{
+    MappedFile() = default;
+    ~MappedFile();
+
+    void
+    Unmap() noexcept;
+
+    const char* data       = nullptr;
+    size_t      size_bytes = 0;
+
+  private:
+    friend void
+    MapFileToMemory(bool&             _success_out,
+                    const char* const _file_path_in,
+                    MappedFile&       _mapped_file_out);
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile&
+    operator=(const MappedFile&) = delete;
+
+#if defined(_ENGINE_PLATFORM_WINDOWS_)
+    HANDLE file_handle    = INVALID_HANDLE_VALUE;
+    HANDLE mapping_handle = nullptr;
+#endif
+};
+
+// Note: Empty files are rejected in the same manner as LoadFileToStdString(...).
+void
+MapFileToMemory(bool& _success_out, const char* const _file_path_in, MappedFile& _mapped_file_out);
+
+// Note: The last modification time of a file, in ticks of the file system clock. Only
+//       comparable with times read on the same machine. Fails without logging an error.
+void
+GetFileWriteTime(bool& _success_out, const char* const _file_path_in, uint64_t& _write_time_out);
+
+// Note: Non-cryptographic 64-bit hash of a block of memory, used to detect when cached data
+//       derived from a file is stale. Results are only comparable on the same architecture.
+void
+HashMemory(uint64_t& _hash_out, const void* const _data_in, const size_t& _size_bytes_in) noexcept;
+
 #endif // fileio_h
\ No newline at end of file
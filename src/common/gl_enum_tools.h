@@ -64,6 +64,10 @@ enum class GLTextureTargetToArrayIndex
 constexpr unsigned char texture_target_array_length = static_cast<unsigned char>(
   GLTextureTargetToArrayIndex::COUNT);
 
+// Note: Marks a cached texture binding as unknown. No texture object has this name, so the next
+//       bind of the target is never skipped.
+constexpr GLuint unknown_texture_binding = 0xFFFFFFFF;
+
 inline GLBufferTargetToArrayIndex
 GetBufferTargetArrayIndex(const GLenum&& _target_type_in)
 {
@@ -334,4 +338,40 @@ GLBufferTargetToString(const GLenum& _depth_comparison_mode_in)
     }
 }
 
+// Note: Size in bytes of a single component of a vertex attribute or element of the given type.
+//       Returns 0 for types which are not valid vertex attribute or element types. Unlike the
+//       rest of this file, this is used on import paths and is kept cheap to call.
+inline size_t
+GLDataTypeSizeBytes(const GLenum& _data_type_in)
+{
+    switch (_data_type_in)
+    {
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE:
+        {
+            return sizeof(GLubyte);
+        }
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT:
+        {
+            return sizeof(GLushort);
+        }
+        case GL_INT:
+        case GL_UNSIGNED_INT:
+        case GL_FLOAT:
+        {
+            return sizeof(GLuint);
+        }
+        case GL_DOUBLE:
+        {
+            return sizeof(GLdouble);
+        }
+        default:
+        {
+            return 0;
+        }
+    }
+}
+
 #endif
\ No newline at end of file
@@ -61,6 +61,23 @@
 #define CompileShader(_shader_in) \
     Impl_CompileShader(std::move(_shader_in) _DEBUG_FILE_AND_LINE_ARGS_)
 
+#define CompressedTexImage2D(_target_in,                      \
+                             _level_in,                       \
+                             _internal_format_in,             \
+                             _width_in,                       \
+                             _height_in,                      \
+                             _border_in,                      \
+                             _image_size_in,                  \
+                             _data_in)                        \
+    Impl_CompressedTexImage2D(std::move(_target_in),          \
+                              std::move(_level_in),           \
+                              std::move(_internal_format_in), \
+                              std::move(_width_in),           \
+                              std::move(_height_in),          \
+                              std::move(_border_in),          \
+                              std::move(_image_size_in),      \
+                              std::move(_data_in) _DEBUG_FILE_AND_LINE_ARGS_)
+
 #define CreateProgram() Impl_CreateProgram(_DEBUG_FILE_AND_LINE_ARGS_NO_COMMA_)
 
 #define CreateShader(_shader_type_in) \
@@ -111,6 +128,9 @@
 #define GetFloatv(_paramter_name_in, _data_out) \
     Impl_GetFloatv(std::move(_paramter_name_in), std::move(_data_out) _DEBUG_FILE_AND_LINE_ARGS_)
 
+#define GetIntegerv(_paramter_name_in, _data_out) \
+    Impl_GetIntegerv(std::move(_paramter_name_in), std::move(_data_out) _DEBUG_FILE_AND_LINE_ARGS_)
+
 #define GetProgramInfoLog(_program_in, _max_length_in, _length_out, _info_log_out) \
     Impl_GetProgramInfoLog(std::move(_program_in),                                 \
                            std::move(_max_length_in),                              \
@@ -146,6 +166,17 @@
 
 #define LinkProgram(_program_in) Impl_LinkProgram(std::move(_program_in) _DEBUG_FILE_AND_LINE_ARGS_)
 
+#define MultiDrawElements(_drawing_mode_in,                  \
+                          _element_counts_in,                \
+                          _index_data_type_in,               \
+                          _data_byte_offsets_in,             \
+                          _draw_count_in)                    \
+    Impl_MultiDrawElements(std::move(_drawing_mode_in),      \
+                           std::move(_element_counts_in),    \
+                           std::move(_index_data_type_in),   \
+                           std::move(_data_byte_offsets_in), \
+                           std::move(_draw_count_in) _DEBUG_FILE_AND_LINE_ARGS_)
+
 #define PixelStorei(_parameter_name_in, _parameter_value_in) \
     Impl_PixelStorei(std::move(_parameter_name_in),          \
                      std::move(_parameter_value_in) _DEBUG_FILE_AND_LINE_ARGS_)
@@ -183,6 +214,11 @@
 #define Uniform1f(_location_in, _float_in) \
     Impl_Uniform1f(std::move(_location_in), std::move(_float_in) _DEBUG_FILE_AND_LINE_ARGS_)
 
+#define Uniform4fv(_location_in, _count_in, _value_in) \
+    Impl_Uniform4fv(std::move(_location_in),          \
+                    std::move(_count_in),             \
+                    std::move(_value_in) _DEBUG_FILE_AND_LINE_ARGS_)
+
 #define UniformMatrix4fv(_location_in, _count_in, _should_transpose_in, _value_in) \
     Impl_UniformMatrix4fv(std::move(_location_in),                                 \
                           std::move(_count_in),                                    \
@@ -318,6 +354,13 @@ namespace glfn
         local_glActiveTexture(_texture_in);
         s_QueryErrors(_DEBUG_QUERY_ERRORS_ARGS);
 
+        // Note: Textures are bound per unit but cached per target, so the cached bindings are
+        //       those of the previous unit; see Impl_BindTexture(...).
+        for (GLuint& texture_id : state_cache->opengl_state->bound_textures_by_target_type)
+        {
+            texture_id = unknown_texture_binding;
+        }
+
         *active_texture   = _texture_in;
         state_initialized = true;
     }
@@ -498,6 +541,46 @@ namespace glfn
         s_QueryErrors(_DEBUG_QUERY_ERRORS_ARGS);
     }
 
+    inline void
+    Impl_CompressedTexImage2D(const GLenum&&   _target_in,
+                              const GLint&&    _level_in,
+                              const GLenum&&   _internal_format_in,
+                              const GLsizei&&  _width_in,
+                              const GLsizei&&  _height_in,
+                              const GLint&&    _border_in,
+                              const GLsizei&&  _image_size_in,
+                              const void*&& _data_in _DEBUG_FILE_AND_LINE_PARAMS_)
+    {
+        static const void (*local_glCompressedTexImage2D)(
+          GLenum,
+          GLint,
+          GLenum,
+          GLsizei,
+          GLsizei,
+          GLint,
+          GLsizei,
+          const void*) = (const void (*)(GLenum,
+                                         GLint,
+                                         GLenum,
+                                         GLsizei,
+                                         GLsizei,
+                                         GLint,
+                                         GLsizei,
+                                         const void*))wglGetProcAddress("glCompressedTexImage2D");
+
+        assert(nullptr != local_glCompressedTexImage2D);
+
+        local_glCompressedTexImage2D(_target_in,
+                                     _level_in,
+                                     _internal_format_in,
+                                     _width_in,
+                                     _height_in,
+                                     _border_in,
+                                     _image_size_in,
+                                     _data_in);
+        s_QueryErrors(_DEBUG_QUERY_ERRORS_ARGS);
+    }
+
     inline GLuint
     Impl_CreateProgram(_DEBUG_FILE_AND_LINE_PARAMS_NO_COMMA_)
     {
@@ -770,6 +853,20 @@ namespace glfn
         s_QueryErrors(_DEBUG_QUERY_ERRORS_ARGS);
     }
 
+    inline void
+    Impl_GetIntegerv(const GLenum&&   _parameter_name_in,
+                     GLint* _data_out _DEBUG_FILE_AND_LINE_PARAMS_)
+    {
+        static const void (*local_glGetIntegerv)(
+          GLenum,
+          GLint*) = (const void (*)(GLenum, GLint*))GetProcAddress(ogl_dll, "glGetIntegerv");
+
+        assert(nullptr != local_glGetIntegerv);
+
+        local_glGetIntegerv(_parameter_name_in, _data_out);
+        s_QueryErrors(_DEBUG_QUERY_ERRORS_ARGS);
+    }
+
     inline void
     Impl_GetProgramInfoLog(const GLuint&&          _program_in,
                            const GLsizei&&         _max_length_in,
@@ -915,6 +1012,31 @@ namespace glfn
         s_QueryErrors(_DEBUG_QUERY_ERRORS_ARGS);
     }
 
+    inline void
+    Impl_MultiDrawElements(const GLenum&&             _drawing_mode_in,
+                           const GLsizei* const&&     _element_counts_in,
+                           const GLenum&&             _index_data_type_in,
+                           const void* const* const&& _data_byte_offsets_in,
+                           const GLsizei&& _draw_count_in _DEBUG_FILE_AND_LINE_PARAMS_)
+    {
+        static const void (*local_glMultiDrawElements)(GLenum,
+                                                       const GLsizei*,
+                                                       GLenum,
+                                                       const void* const*,
+                                                       GLsizei) =
+          (const void (*)(GLenum, const GLsizei*, GLenum, const void* const*, GLsizei))
+            wglGetProcAddress("glMultiDrawElements");
+
+        assert(nullptr != local_glMultiDrawElements);
+
+        local_glMultiDrawElements(_drawing_mode_in,
+                                  _element_counts_in,
+                                  _index_data_type_in,
+                                  _data_byte_offsets_in,
+                                  _draw_count_in);
+        s_QueryErrors(_DEBUG_QUERY_ERRORS_ARGS);
+    }
+
     inline void
     Impl_PixelStorei(const GLenum&&                   _paramter_name_in,
                      const GLint&& _paramter_value_in _DEBUG_FILE_AND_LINE_PARAMS_)
@@ -1034,6 +1156,20 @@ namespace glfn
         s_QueryErrors(_DEBUG_QUERY_ERRORS_ARGS);
     }
 
+    inline void
+    Impl_Uniform4fv(const GLint&&              _location_in,
+                    const GLsizei&&            _count_in,
+                    const GLfloat*&& _value_in _DEBUG_FILE_AND_LINE_PARAMS_)
+    {
+        static const void (*local_glUniform4fv)(GLint, GLsizei, const GLfloat*) =
+          (const void (*)(GLint, GLsizei, const GLfloat*))wglGetProcAddress("glUniform4fv");
+
+        assert(nullptr != local_glUniform4fv);
+
+        local_glUniform4fv(_location_in, _count_in, _value_in);
+        s_QueryErrors(_DEBUG_QUERY_ERRORS_ARGS);
+    }
+
     inline void
     Impl_UniformMatrix4fv(const GLint&&              _location_in,
                           const GLsizei&&            _count_in,
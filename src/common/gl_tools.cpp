@@ -4,6 +4,7 @@
 
 #include "gl_tools.h"
 
+#include "cooked_texture.h"
 #include "fileio.h"
 #include "gl_function_wrappers.h"
 #include "image_tools.h"
@@ -31,36 +32,13 @@ glt::GLDebugCallback(GLenum        _source_in,
     assert(false);
 }
 
-glt::VertexAttributeDescriptor::VertexAttributeDescriptor(
-  const GLuint&&         _vertex_array_object_id_in,
-  const GLuint&&         _vertex_attribute_index_in,
-  const GLint&&          _component_count_in,
-  const GLenum&&         _data_type_in,
-  const GLboolean&&      _should_be_normalized_by_gpu_in,
-  const GLsizei&&        _byte_stride_between_elements_in,
-  const GLvoid*&&        _first_component_byte_offset_in,
-  const VertexDataType&& _vertex_data_type_in)
-  : vertex_array_object_id(_vertex_array_object_id_in)
-  , vertex_attribute_index(_vertex_attribute_index_in)
-  , component_count(_component_count_in)
-  , data_type(_data_type_in)
-  , should_be_normalized_by_gpu(_should_be_normalized_by_gpu_in)
-  , byte_stride_between_elements(_byte_stride_between_elements_in)
-  , first_component_byte_offset(_first_component_byte_offset_in)
-  , vertex_data_type(_vertex_data_type_in)
-{
-    assert(0 != _component_count_in);
-    assert(GL_FLOAT == _data_type_in);
-    assert(false == _should_be_normalized_by_gpu_in);
-    assert(VertexDataType::COUNT != _vertex_data_type_in);
-}
-
 glt::GLArrayBuffer::GLArrayBuffer(
   const GLuint&&                                _buffer_id_in,
   const GLsizei&&                               _target_buffer_element_count_in,
   const GLenum&&                                _primitive_drawing_mode_in,
   const std::vector<VertexAttributeDescriptor>& _glt_vertex_attribute_pointers_in) noexcept
-  : buffer_info({ _buffer_id_in, _target_buffer_element_count_in, _primitive_drawing_mode_in })
+  : buffer_info(
+      { _buffer_id_in, _target_buffer_element_count_in, _primitive_drawing_mode_in, GL_NONE })
   , vertex_attribute_pointers(_glt_vertex_attribute_pointers_in)
 {
     assert(0 != _target_buffer_element_count_in);
@@ -69,7 +47,8 @@ glt::GLArrayBuffer::GLArrayBuffer(
 glt::GLArrayBuffer::GLArrayBuffer(const GLArrayBuffer& _) noexcept
   : buffer_info({ _.buffer_info.buffer_id,
                   _.buffer_info.target_buffer_element_count,
-                  _.buffer_info.primitive_drawing_mode })
+                  _.buffer_info.primitive_drawing_mode,
+                  _.buffer_info.element_data_type })
   , vertex_attribute_pointers(_.vertex_attribute_pointers)
 {
     assert(0 != _.buffer_info.target_buffer_element_count);
@@ -77,16 +56,24 @@ glt::GLArrayBuffer::GLArrayBuffer(const GLArrayBuffer& _) noexcept
 
 glt::GLElementBuffer::GLElementBuffer(const GLuint&&  _buffer_id_in,
                                       const GLsizei&& _target_buffer_element_count_in,
-                                      const GLenum&&  _primitive_drawing_mode_in) noexcept
-  : buffer_info({ _buffer_id_in, _target_buffer_element_count_in, _primitive_drawing_mode_in })
+                                      const GLenum&&  _primitive_drawing_mode_in,
+                                      const GLenum&&  _element_data_type_in) noexcept
+  : buffer_info({ _buffer_id_in,
+                  _target_buffer_element_count_in,
+                  _primitive_drawing_mode_in,
+                  _element_data_type_in })
 {
     assert(0 != _target_buffer_element_count_in);
+    assert((GL_UNSIGNED_BYTE == _element_data_type_in) ||
+           (GL_UNSIGNED_SHORT == _element_data_type_in) ||
+           (GL_UNSIGNED_INT == _element_data_type_in));
 }
 
 glt::GLElementBuffer::GLElementBuffer(const GLElementBuffer& _) noexcept
   : buffer_info({ _.buffer_info.buffer_id,
                   _.buffer_info.target_buffer_element_count,
-                  _.buffer_info.primitive_drawing_mode })
+                  _.buffer_info.primitive_drawing_mode,
+                  _.buffer_info.element_data_type })
 {
     assert(0 != _.buffer_info.target_buffer_element_count);
 }
@@ -146,6 +133,7 @@ glt::GLBufferStore::AddElementBuffer(bool&               _success_out,
                                      const GLvoid* const _data_in,
                                      const GLsizeiptr&&  _data_size_bytes_in,
                                      const GLsizei&&     _target_buffer_element_count_in,
+                                     const GLenum&&      _element_data_type_in,
                                      const GLenum&&      _target_buffer_usage_type_in,
                                      const GLenum&&      _primitive_drawing_mode_in) noexcept
 {
@@ -160,6 +148,27 @@ glt::GLBufferStore::AddElementBuffer(bool&               _success_out,
         return 0;
     }
 
+    if ((GL_UNSIGNED_BYTE != _element_data_type_in) &&
+        (GL_UNSIGNED_SHORT != _element_data_type_in) && (GL_UNSIGNED_INT != _element_data_type_in))
+    {
+        std::stringstream ss;
+        ss << "Unsupported element data type: 0x" << std::hex << _element_data_type_in;
+        Log_e(ss);
+        return 0;
+    }
+
+    const size_t element_size_bytes = GLDataTypeSizeBytes(_element_data_type_in);
+    if (static_cast<size_t>(_data_size_bytes_in) !=
+        (static_cast<size_t>(_target_buffer_element_count_in) * element_size_bytes))
+    {
+        std::stringstream ss;
+        ss << "Element buffer size (" << _data_size_bytes_in << " bytes) does not match "
+           << _target_buffer_element_count_in << " elements of " << element_size_bytes
+           << " bytes.";
+        Log_e(ss);
+        return 0;
+    }
+
     ScopedVaoBinding scoped_vao_binding = ScopedVaoBinding(std::move(_vao_in));
 
     GLuint element_buffer_id;
@@ -167,7 +176,8 @@ glt::GLBufferStore::AddElementBuffer(bool&               _success_out,
 
     element_buffer = new GLElementBuffer(std::move(element_buffer_id),
                                          std::move(_target_buffer_element_count_in),
-                                         std::move(_primitive_drawing_mode_in));
+                                         std::move(_primitive_drawing_mode_in),
+                                         std::move(_element_data_type_in));
 
     ScopedVboBinding scoped_vbo_binding = ScopedVboBinding(std::move(GL_ELEMENT_ARRAY_BUFFER),
                                                            std::move(element_buffer_id));
@@ -274,12 +284,84 @@ glt::CreateShaderProgram(bool&               _success_out,
     _program_id_out = program;
 }
 
+static inline bool
+IsMipmappedMinFilter(const GLenum& _min_filter_in)
+{
+    return (GL_NEAREST != _min_filter_in) && (GL_LINEAR != _min_filter_in);
+}
+
+// Note: Applies to the texture bound to GL_TEXTURE_2D.
+static void
+ApplyTextureSamplerSettings(const glt::TextureSamplerSettings& _sampler_settings_in)
+{
+    glfn::TexParameter(GL_TEXTURE_2D,
+                       GL_TEXTURE_WRAP_S,
+                       static_cast<GLint>(_sampler_settings_in.wrap_s));
+    glfn::TexParameter(GL_TEXTURE_2D,
+                       GL_TEXTURE_WRAP_T,
+                       static_cast<GLint>(_sampler_settings_in.wrap_t));
+    glfn::TexParameter(GL_TEXTURE_2D,
+                       GL_TEXTURE_MIN_FILTER,
+                       static_cast<GLint>(_sampler_settings_in.min_filter));
+    glfn::TexParameter(GL_TEXTURE_2D,
+                       GL_TEXTURE_MAG_FILTER,
+                       static_cast<GLint>(_sampler_settings_in.mag_filter));
+
+    if (true == _sampler_settings_in.attempt_ansiotropic_filtering)
+    {
+        // [ cfarvin::TODO ] Need to check that ansiotropic filtering is supported.
+        //                   String is: "GL_EXT_texture_filter_anisotropic"
+        GLfloat ansiotropic_sampling;
+        glfn::GetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &ansiotropic_sampling);
+        glfn::TexParameter(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, ansiotropic_sampling);
+    }
+}
+
+bool
+glt::TextureSamplerSettings::operator==(const TextureSamplerSettings& _other_in) const noexcept
+{
+    return (wrap_s == _other_in.wrap_s) && (wrap_t == _other_in.wrap_t) &&
+           (min_filter == _other_in.min_filter) && (mag_filter == _other_in.mag_filter) &&
+           (attempt_ansiotropic_filtering == _other_in.attempt_ansiotropic_filtering);
+}
+
 GLuint
 glt::GetTexture2DFromImage(bool&               _success_out,
                            const char* const&& _file_path,
                            const bool&&        _attempt_ansiotropic_filtering)
 {
-    _success_out = true;
+    TextureSamplerSettings sampler_settings;
+    sampler_settings.attempt_ansiotropic_filtering = _attempt_ansiotropic_filtering;
+
+    size_t texture_size_bytes;
+    return GetTexture2DFromImage(_success_out,
+                                 std::move(_file_path),
+                                 sampler_settings,
+                                 texture_size_bytes);
+}
+
+GLuint
+glt::GetTexture2DFromImage(bool&                         _success_out,
+                           const char* const&&           _file_path,
+                           const TextureSamplerSettings& _sampler_settings_in,
+                           size_t&                       _texture_size_bytes_out)
+{
+    _success_out            = true;
+    _texture_size_bytes_out = 0;
+
+    // Note: A cooked texture current with the image is uploaded in its place.
+    {
+        CookedTexture cooked_texture;
+        bool          cooked_texture_mapped = false;
+        MapCurrentCookedTexture(cooked_texture_mapped, _file_path, cooked_texture);
+        if (true == cooked_texture_mapped)
+        {
+            return GetTexture2DFromCookedTexture(_success_out,
+                                                 cooked_texture,
+                                                 _sampler_settings_in,
+                                                 _texture_size_bytes_out);
+        }
+    }
 
     unsigned char* image_data_in;
     int            image_width;
@@ -305,10 +387,7 @@ glt::GetTexture2DFromImage(bool&               _success_out,
     ScopedTextureBinding scoped_texture_binding = ScopedTextureBinding(std::move(GL_TEXTURE_2D),
                                                                        std::move(texture_id));
 
-    glfn::TexParameter(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glfn::TexParameter(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glfn::TexParameter(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glfn::TexParameter(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    ApplyTextureSamplerSettings(_sampler_settings_in);
 
     // Note: The image loader defaults to 4 bpp, which is why argument 7 to glTexImage2D below
     //       is hard-coded at { GL_RGBA }.
@@ -333,11 +412,12 @@ glt::GetTexture2DFromImage(bool&               _success_out,
             Log_e(ss);
             _success_out = false;
             glfn::DeleteTextures(1, &texture_id);
+            stbi_image_free(image_data_in);
             return 0;
         }
     }
 
-    glfn::PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    ScopedUnpackAlignment scoped_unpack_alignment = ScopedUnpackAlignment(1);
     glfn::TexImage2D(GL_TEXTURE_2D,             // Texture type.
                      0,                         // Level of mipmap detail.
                      internal_color_components, // Number of internal color components
@@ -348,20 +428,126 @@ glt::GetTexture2DFromImage(bool&               _success_out,
                      GL_UNSIGNED_BYTE,          // Pixel type.
                      image_data_in);            // Image data.
 
-    glfn::GenerateMipmap(GL_TEXTURE_2D);
-    if (true == _attempt_ansiotropic_filtering)
+    _texture_size_bytes_out = static_cast<size_t>(image_width) * image_height * image_channels;
+
+    if (true == IsMipmappedMinFilter(_sampler_settings_in.min_filter))
     {
-        // [ cfarvin::TODO ] Need to check that ansiotropic filtering is supported.
-        //                   String is: "GL_EXT_texture_filter_anisotropic"
-        GLfloat ansiotropic_sampling;
-        glfn::GetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &ansiotropic_sampling);
-        glfn::TexParameter(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, ansiotropic_sampling);
+        glfn::GenerateMipmap(GL_TEXTURE_2D);
+
+        size_t mip_width  = image_width;
+        size_t mip_height = image_height;
+        while ((1 < mip_width) || (1 < mip_height))
+        {
+            mip_width  = std::max(mip_width / 2, static_cast<size_t>(1));
+            mip_height = std::max(mip_height / 2, static_cast<size_t>(1));
+            _texture_size_bytes_out += mip_width * mip_height * image_channels;
+        }
     }
 
     stbi_image_free(image_data_in);
     return texture_id;
 }
 
+GLuint
+glt::GetTexture2DFromCookedTexture(bool&                         _success_out,
+                                   const CookedTexture&          _cooked_texture_in,
+                                   const TextureSamplerSettings& _sampler_settings_in,
+                                   size_t&                       _texture_size_bytes_out)
+{
+    return GetTexture2DFromCookedTextureLevels(_success_out,
+                                               _cooked_texture_in,
+                                               _sampler_settings_in,
+                                               0,
+                                               _texture_size_bytes_out);
+}
+
+GLuint
+glt::GetTexture2DFromCookedTextureLevels(bool&                         _success_out,
+                                         const CookedTexture&          _cooked_texture_in,
+                                         const TextureSamplerSettings& _sampler_settings_in,
+                                         const size_t&                 _first_level_in,
+                                         size_t&                       _texture_size_bytes_out)
+{
+    _success_out            = false;
+    _texture_size_bytes_out = 0;
+
+    if ((nullptr == _cooked_texture_in.header) ||
+        (_first_level_in >= _cooked_texture_in.levels.size()))
+    {
+        Log_e("Invalid cooked texture provided.");
+        return 0;
+    }
+
+    GLuint texture_id = 0;
+    glfn::GenTextures(1, &texture_id);
+    ScopedTextureBinding scoped_texture_binding = ScopedTextureBinding(std::move(GL_TEXTURE_2D),
+                                                                       std::move(texture_id));
+
+    ApplyTextureSamplerSettings(_sampler_settings_in);
+
+    // Note: Textures sampled without mipmaps need only their base level. Otherwise the level
+    //       count is capped at that of the file, should the mip chain be incomplete.
+    const size_t end_level = (true == IsMipmappedMinFilter(_sampler_settings_in.min_filter))
+                               ? _cooked_texture_in.levels.size()
+                               : (_first_level_in + 1);
+    glfn::TexParameter(GL_TEXTURE_2D,
+                       GL_TEXTURE_BASE_LEVEL,
+                       static_cast<GLint>(_first_level_in));
+    glfn::TexParameter(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(end_level - 1));
+
+    for (size_t level = _first_level_in; level < end_level; level++)
+    {
+        SpecifyCookedTextureLevel(_cooked_texture_in,
+                                  level,
+                                  _cooked_texture_in.levels[level].data);
+        _texture_size_bytes_out += _cooked_texture_in.levels[level].size_bytes;
+    }
+
+    _success_out = true;
+    return texture_id;
+}
+
+void
+glt::SpecifyCookedTextureLevel(const CookedTexture&       _cooked_texture_in,
+                               const size_t&              _level_in,
+                               const unsigned char* const _level_data_in) noexcept
+{
+    assert(_level_in < _cooked_texture_in.levels.size());
+
+    const CookedTextureLevel& cooked_texture_level = _cooked_texture_in.levels[_level_in];
+
+    const GLsizei width  = (nullptr == _level_data_in) ? 0 : cooked_texture_level.width;
+    const GLsizei height = (nullptr == _level_data_in) ? 0 : cooked_texture_level.height;
+
+    ScopedUnpackAlignment scoped_unpack_alignment = ScopedUnpackAlignment(1);
+    if (true == _cooked_texture_in.compressed)
+    {
+        const GLsizei size_bytes = (nullptr == _level_data_in)
+                                     ? 0
+                                     : static_cast<GLsizei>(cooked_texture_level.size_bytes);
+        glfn::CompressedTexImage2D(GL_TEXTURE_2D,
+                                   static_cast<GLint>(_level_in),
+                                   _cooked_texture_in.internal_format,
+                                   width,
+                                   height,
+                                   0,
+                                   size_bytes,
+                                   _level_data_in);
+    }
+    else
+    {
+        glfn::TexImage2D(GL_TEXTURE_2D,
+                         static_cast<GLint>(_level_in),
+                         _cooked_texture_in.internal_format,
+                         width,
+                         height,
+                         0,
+                         _cooked_texture_in.pixel_format,
+                         _cooked_texture_in.pixel_type,
+                         _level_data_in);
+    }
+}
+
 GLuint
 glt::GetTestTextureRGB(bool&               _success_out,
                        const char* const&& _output_file, // Provide nullptr to skip writing to disk.
@@ -408,7 +594,7 @@ glt::GetTestTextureRGB(bool&               _success_out,
         }
     }
 
-    glfn::PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    ScopedUnpackAlignment scoped_unpack_alignment = ScopedUnpackAlignment(1);
     glfn::TexImage2D(GL_TEXTURE_2D,    // Texture type.
                      0,                // Level of mipmap detail.
                      GL_RGB,           // Number of internal color components
@@ -469,3 +655,15 @@ glt::ScopedTextureBinding::ScopedTextureBinding(const GLenum&& _texture_target_i
 }
 
 glt::ScopedTextureBinding::~ScopedTextureBinding() { glfn::BindTexture(texture_target, 0); }
+
+glt::ScopedUnpackAlignment::ScopedUnpackAlignment(const GLint&& _unpack_alignment_in)
+  : previous_unpack_alignment(4)
+{
+    glfn::GetIntegerv(GL_UNPACK_ALIGNMENT, &previous_unpack_alignment);
+    glfn::PixelStorei(GL_UNPACK_ALIGNMENT, std::move(_unpack_alignment_in));
+}
+
+glt::ScopedUnpackAlignment::~ScopedUnpackAlignment()
+{
+    glfn::PixelStorei(GL_UNPACK_ALIGNMENT, std::move(previous_unpack_alignment));
+}
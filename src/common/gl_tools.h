@@ -5,7 +5,9 @@
 #include "pch.h"
 // clang-format on
 
+#include "cooked_texture.h"
 #include "gl_enum_tools.h"
+#include "vertex_layout.h"
 
 namespace glt
 {
@@ -59,42 +61,6 @@ namespace glt
         GLuint currently_enabled_vertex_attribute_array;
     };
 
-    // Note: `COUNT` enum int value determines size of `array_buffers` array in BufferStore.
-    //       See declaration of `glt::array_buffer_count` and `glt::BufferStore::array_buffers`
-    enum class VertexDataType
-    {
-        POSITION = 0,
-        TEXTURE,
-        NORMAL,
-        COUNT
-    };
-
-    constexpr size_t array_buffer_count = static_cast<size_t>(VertexDataType::COUNT);
-
-    struct VertexAttributeDescriptor
-    {
-        VertexAttributeDescriptor() = delete;
-        VertexAttributeDescriptor(const GLuint&&         _vertex_array_object_id_in,
-                                  const GLuint&&         _vertex_attribute_index_in,
-                                  const GLint&&          _component_count_in,
-                                  const GLenum&&         _data_type_in,
-                                  const GLboolean&&      _should_be_normalized_by_gpu_in,
-                                  const GLsizei&&        _byte_stride_between_elements_in,
-                                  const GLvoid*&&        _first_component_byte_offset_in,
-                                  const VertexDataType&& _vertex_data_type_in);
-
-        const GLuint vertex_array_object_id;
-
-        const GLuint    vertex_attribute_index;
-        const GLint     component_count;
-        const GLenum    data_type;
-        const GLboolean should_be_normalized_by_gpu;
-        const GLsizei   byte_stride_between_elements;
-        const GLvoid*   first_component_byte_offset;
-
-        const VertexDataType vertex_data_type;
-    };
-
     // Binds a VAO in the constructor and binds 0 in the destructor such
     // that a VAO is only bound during the life/scope of this ojbect.
     // Note: This is only appropriate for simple situations where it is certain
@@ -153,11 +119,32 @@ namespace glt
         operator=(const ScopedTextureBinding&);
     };
 
+    // Sets GL_UNPACK_ALIGNMENT in the constructor and restores the previous alignment in the
+    // destructor, such that tightly packed uploads do not change the alignment used by others.
+    struct ScopedUnpackAlignment
+    {
+        ScopedUnpackAlignment() = delete;
+        ScopedUnpackAlignment(const GLint&& _unpack_alignment_in);
+
+        ~ScopedUnpackAlignment();
+
+      private:
+        GLint previous_unpack_alignment;
+        ScopedUnpackAlignment(const ScopedUnpackAlignment& _);
+
+        ScopedUnpackAlignment
+        operator=(const ScopedUnpackAlignment&);
+    };
+
     struct GLBufferInfo
     {
         GLuint  buffer_id;
         GLsizei target_buffer_element_count;
         GLenum  primitive_drawing_mode;
+
+        // Note: GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT or GL_UNSIGNED_INT for element buffers, and
+        //       GL_NONE for array buffers.
+        GLenum element_data_type;
     };
 
     struct GLArrayBuffer
@@ -194,7 +181,8 @@ namespace glt
 
         GLElementBuffer(const GLuint&&  _buffer_id_in,
                         const GLsizei&& _target_buffer_element_count_in,
-                        const GLenum&&  _primitive_drawing_mode_in) noexcept;
+                        const GLenum&&  _primitive_drawing_mode_in,
+                        const GLenum&&  _element_data_type_in) noexcept;
 
         GLElementBuffer(const GLElementBuffer&) noexcept;
 
@@ -217,12 +205,16 @@ namespace glt
           const GLenum&&                                _primitive_drawing_mode_in,
           const std::vector<VertexAttributeDescriptor>& _glt_vertex_attribute_pointers_in) noexcept;
 
+        // Note: `_element_data_type_in` must be GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT or
+        //       GL_UNSIGNED_INT, and `_data_size_bytes_in` must be the element count multiplied by
+        //       its size. The type is stored in the buffer info for the draw call.
         const GLuint
         AddElementBuffer(bool&               _success_out,
                          const GLuint&&      _vao_in,
                          const GLvoid* const _data_in,
                          const GLsizeiptr&&  _data_size_bytes_in,
                          const GLsizei&&     _target_buffer_element_count_in,
+                         const GLenum&&      _element_data_type_in,
                          const GLenum&&      _target_buffer_usage_type_in,
                          const GLenum&&      _primitive_drawing_mode_in) noexcept;
 
@@ -241,11 +233,64 @@ namespace glt
                         const char* const&& _fragment_shader_file_path_in,
                         GLuint&             _program_id_out);
 
+    struct TextureSamplerSettings
+    {
+        GLenum wrap_s                        = GL_REPEAT;
+        GLenum wrap_t                        = GL_REPEAT;
+        GLenum min_filter                    = GL_LINEAR_MIPMAP_LINEAR;
+        GLenum mag_filter                    = GL_LINEAR;
+        bool   attempt_ansiotropic_filtering = true;
+
+        bool
+        operator==(const TextureSamplerSettings& _other_in) const noexcept;
+    };
+
     GLuint
     GetTexture2DFromImage(bool&               _success_out,
                           const char* const&& _file_path_in,
                           const bool&&        _attempt_ansiotropic_filtering_in);
 
+    // Note: When `<file>.ktx2` was cooked from the current contents of the image, the cooked
+    //       texture is uploaded instead of decoding the image; see cooked_texture.h.
+    //
+    //       Mipmaps are generated only when `_sampler_settings_in.min_filter` samples them.
+    //       `_texture_size_bytes_out` is the memory the texture and its mipmaps take on the GPU,
+    //       assuming one byte per internal color component.
+    GLuint
+    GetTexture2DFromImage(bool&                         _success_out,
+                          const char* const&&           _file_path_in,
+                          const TextureSamplerSettings& _sampler_settings_in,
+                          size_t&                       _texture_size_bytes_out);
+
+    // Note: Uploads every level of `_cooked_texture_in` (see cooked_texture.h) as stored; block
+    //       compressed levels are uploaded compressed, and no mipmaps are generated.
+    //       `_texture_size_bytes_out` is the size of the uploaded levels.
+    GLuint
+    GetTexture2DFromCookedTexture(bool&                         _success_out,
+                                  const CookedTexture&          _cooked_texture_in,
+                                  const TextureSamplerSettings& _sampler_settings_in,
+                                  size_t&                       _texture_size_bytes_out);
+
+    // Note: As GetTexture2DFromCookedTexture(...), uploading only the levels from
+    //       `_first_level_in` down. GL_TEXTURE_BASE_LEVEL is set to `_first_level_in`, such that
+    //       the texture is complete and sampled from the levels uploaded; finer levels may be
+    //       specified later with SpecifyCookedTextureLevel(...), lowering the base level.
+    GLuint
+    GetTexture2DFromCookedTextureLevels(bool&                         _success_out,
+                                        const CookedTexture&          _cooked_texture_in,
+                                        const TextureSamplerSettings& _sampler_settings_in,
+                                        const size_t&                 _first_level_in,
+                                        size_t&                       _texture_size_bytes_out);
+
+    // Note: Specifies `_level_in` of the texture bound to GL_TEXTURE_2D, in the format of
+    //       `_cooked_texture_in`, from `_level_data_in`: the level as stored in the cooked
+    //       texture, or a copy of it. A nullptr specifies an empty level, releasing the storage
+    //       of a level outside the base and max levels.
+    void
+    SpecifyCookedTextureLevel(const CookedTexture&       _cooked_texture_in,
+                              const size_t&              _level_in,
+                              const unsigned char* const _level_data_in) noexcept;
+
     GLuint
     GetTestTextureRGB(
       bool&                _success_out,
@@ -0,0 +1,1072 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "gltf.h"
+
+#include "logging.h"
+
+constexpr size_t glb_header_size_bytes       = 12;
+constexpr size_t glb_chunk_header_size_bytes = 8;
+
+// Note: Nesting limit of the JSON chunk, which is parsed recursively. glTF itself nests only a few
+//       levels deep; extensions and extras add a few more.
+constexpr size_t gltf_json_max_depth = 64;
+
+constexpr size_t gltf_json_no_value = std::numeric_limits<size_t>::max();
+
+enum class GltfJsonType
+{
+    NUL = 0,
+    BOOLEAN,
+    NUMBER,
+    STRING,
+    ARRAY,
+    OBJECT
+};
+
+// Note: Values of the JSON chunk are stored in one vector, in document order, with the children
+//       of arrays and objects linked through `first_child` and `next_sibling`. Strings and keys
+//       point into the mapped file and are not unescaped; glTF names compared here never contain
+//       escapes.
+struct GltfJsonValue
+{
+    GltfJsonType     type         = GltfJsonType::NUL;
+    std::string_view key          = {};
+    std::string_view string       = {};
+    double           number       = 0.0;
+    bool             boolean      = false;
+    size_t           first_child  = gltf_json_no_value;
+    size_t           next_sibling = gltf_json_no_value;
+};
+
+// Note: The JSON chunk, parsed, and the BIN chunk. Accessors and buffer views are indexed by the
+//       position of their JSON value.
+struct GlbDocument
+{
+    const char*                glb_file_path        = nullptr;
+    std::vector<GltfJsonValue> json_values;
+    std::vector<size_t>        accessors;
+    std::vector<size_t>        buffer_views;
+    const char*                bin_chunk            = nullptr;
+    size_t                     bin_chunk_size_bytes = 0;
+};
+
+static void
+ReportGlbError(const char* const _glb_file_path_in, const char* const _note_in)
+{
+    std::stringstream ss;
+    ss << "Failed to load glTF binary file." << std::endl
+       << "   File: " << _glb_file_path_in << std::endl
+       << "   Note: " << _note_in;
+    Log_e(ss);
+}
+
+static inline uint32_t
+ReadGlbUint32(const char* const _data_in) noexcept
+{
+    // Note: glTF is little endian, as is every platform the engine targets.
+    uint32_t value;
+    std::memcpy(&value, _data_in, sizeof(value));
+    return value;
+}
+
+static inline void
+SkipGltfJsonWhitespace(const char*& _cursor_in_out, const char* const _tail_in) noexcept
+{
+    while ((_cursor_in_out < _tail_in) &&
+           ((' ' == *_cursor_in_out) || ('\t' == *_cursor_in_out) || ('\n' == *_cursor_in_out) ||
+            ('\r' == *_cursor_in_out)))
+    {
+        _cursor_in_out++;
+    }
+}
+
+// Note: `_cursor_in_out` is at the opening quote, and is left after the closing quote.
+static void
+ScanGltfJsonString(bool&             _success_out,
+                   const char*&      _cursor_in_out,
+                   const char* const _tail_in,
+                   std::string_view& _string_out) noexcept
+{
+    _success_out = false;
+
+    const char* const string_head = ++_cursor_in_out;
+    while (_cursor_in_out < _tail_in)
+    {
+        if ('"' == *_cursor_in_out)
+        {
+            _string_out = std::string_view(string_head, _cursor_in_out - string_head);
+            _cursor_in_out++;
+            _success_out = true;
+            return;
+        }
+
+        if ('\\' == *_cursor_in_out)
+        {
+            _cursor_in_out++;
+        }
+
+        _cursor_in_out++;
+    }
+}
+
+static void
+ParseGltfJsonValue(bool&                       _success_out,
+                   const char*&                _cursor_in_out,
+                   const char* const           _tail_in,
+                   const size_t&&              _depth_in,
+                   std::vector<GltfJsonValue>& _json_values_in_out)
+{
+    _success_out = false;
+
+    SkipGltfJsonWhitespace(_cursor_in_out, _tail_in);
+    if ((_cursor_in_out >= _tail_in) || (gltf_json_max_depth < _depth_in))
+    {
+        return;
+    }
+
+    const size_t value_index = _json_values_in_out.size();
+    _json_values_in_out.emplace_back();
+
+    const char character = *_cursor_in_out;
+    if (('{' == character) || ('[' == character))
+    {
+        const bool is_object         = ('{' == character);
+        const char closing_character = (true == is_object) ? '}' : ']';
+        size_t     previous_child    = gltf_json_no_value;
+
+        _json_values_in_out[value_index].type = (true == is_object) ? GltfJsonType::OBJECT
+                                                                    : GltfJsonType::ARRAY;
+
+        _cursor_in_out++;
+        SkipGltfJsonWhitespace(_cursor_in_out, _tail_in);
+        if ((_cursor_in_out < _tail_in) && (closing_character == *_cursor_in_out))
+        {
+            _cursor_in_out++;
+            _success_out = true;
+            return;
+        }
+
+        while (_cursor_in_out < _tail_in)
+        {
+            std::string_view key = {};
+            if (true == is_object)
+            {
+                SkipGltfJsonWhitespace(_cursor_in_out, _tail_in);
+                if ((_cursor_in_out >= _tail_in) || ('"' != *_cursor_in_out))
+                {
+                    return;
+                }
+
+                ScanGltfJsonString(_success_out, _cursor_in_out, _tail_in, key);
+                if (false == _success_out)
+                {
+                    return;
+                }
+
+                SkipGltfJsonWhitespace(_cursor_in_out, _tail_in);
+                if ((_cursor_in_out >= _tail_in) || (':' != *_cursor_in_out))
+                {
+                    _success_out = false;
+                    return;
+                }
+
+                _cursor_in_out++;
+            }
+
+            const size_t child_index = _json_values_in_out.size();
+            ParseGltfJsonValue(_success_out,
+                               _cursor_in_out,
+                               _tail_in,
+                               _depth_in + 1,
+                               _json_values_in_out);
+            if (false == _success_out)
+            {
+                return;
+            }
+
+            // Note: Index rather than hold references; the vector grows while parsing children.
+            _json_values_in_out[child_index].key = key;
+            if (gltf_json_no_value == previous_child)
+            {
+                _json_values_in_out[value_index].first_child = child_index;
+            }
+            else
+            {
+                _json_values_in_out[previous_child].next_sibling = child_index;
+            }
+            previous_child = child_index;
+
+            _success_out = false;
+            SkipGltfJsonWhitespace(_cursor_in_out, _tail_in);
+            if (_cursor_in_out >= _tail_in)
+            {
+                return;
+            }
+
+            if (',' == *_cursor_in_out)
+            {
+                _cursor_in_out++;
+                continue;
+            }
+
+            if (closing_character == *_cursor_in_out)
+            {
+                _cursor_in_out++;
+                _success_out = true;
+            }
+
+            return;
+        }
+
+        return;
+    }
+
+    GltfJsonValue& value = _json_values_in_out[value_index];
+    if ('"' == character)
+    {
+        value.type = GltfJsonType::STRING;
+        ScanGltfJsonString(_success_out, _cursor_in_out, _tail_in, value.string);
+        return;
+    }
+
+    constexpr std::string_view true_literal  = "true";
+    constexpr std::string_view false_literal = "false";
+    constexpr std::string_view null_literal  = "null";
+    const std::string_view     remaining(_cursor_in_out, _tail_in - _cursor_in_out);
+    if (true == remaining.starts_with(true_literal))
+    {
+        value.type    = GltfJsonType::BOOLEAN;
+        value.boolean = true;
+        _cursor_in_out += true_literal.size();
+    }
+    else if (true == remaining.starts_with(false_literal))
+    {
+        value.type    = GltfJsonType::BOOLEAN;
+        value.boolean = false;
+        _cursor_in_out += false_literal.size();
+    }
+    else if (true == remaining.starts_with(null_literal))
+    {
+        value.type = GltfJsonType::NUL;
+        _cursor_in_out += null_literal.size();
+    }
+    else
+    {
+        const std::from_chars_result result = std::from_chars(_cursor_in_out,
+                                                              _tail_in,
+                                                              value.number);
+        if ((std::errc() != result.ec) || (_cursor_in_out == result.ptr))
+        {
+            return;
+        }
+
+        value.type     = GltfJsonType::NUMBER;
+        _cursor_in_out = result.ptr;
+    }
+
+    _success_out = true;
+}
+
+static size_t
+FindGltfJsonMember(const std::vector<GltfJsonValue>& _json_values_in,
+                   const size_t&                     _object_index_in,
+                   const std::string_view&&          _key_in) noexcept
+{
+    if ((gltf_json_no_value == _object_index_in) ||
+        (GltfJsonType::OBJECT != _json_values_in[_object_index_in].type))
+    {
+        return gltf_json_no_value;
+    }
+
+    for (size_t child_index = _json_values_in[_object_index_in].first_child;
+         gltf_json_no_value != child_index;
+         child_index = _json_values_in[child_index].next_sibling)
+    {
+        if (_key_in == _json_values_in[child_index].key)
+        {
+            return child_index;
+        }
+    }
+
+    return gltf_json_no_value;
+}
+
+// Note: Missing arrays are empty.
+static void
+GetGltfJsonArrayElements(bool&                             _success_out,
+                         const std::vector<GltfJsonValue>& _json_values_in,
+                         const size_t&                     _array_index_in,
+                         std::vector<size_t>&              _element_indices_out)
+{
+    _element_indices_out.clear();
+    _success_out = true;
+    if (gltf_json_no_value == _array_index_in)
+    {
+        return;
+    }
+
+    if (GltfJsonType::ARRAY != _json_values_in[_array_index_in].type)
+    {
+        _success_out = false;
+        return;
+    }
+
+    for (size_t child_index = _json_values_in[_array_index_in].first_child;
+         gltf_json_no_value != child_index;
+         child_index = _json_values_in[child_index].next_sibling)
+    {
+        _element_indices_out.push_back(child_index);
+    }
+}
+
+// Note: Leaves `_value_in_out` unchanged when the member is missing, so that it may hold the
+//       default. Fails when the member is not a non-negative integer.
+static void
+GetGltfJsonUnsigned(bool&                             _success_out,
+                    const std::vector<GltfJsonValue>& _json_values_in,
+                    const size_t&                     _object_index_in,
+                    const std::string_view&&          _key_in,
+                    size_t&                           _value_in_out) noexcept
+{
+    _success_out = true;
+
+    const size_t member_index = FindGltfJsonMember(_json_values_in,
+                                                   _object_index_in,
+                                                   std::move(_key_in));
+    if (gltf_json_no_value == member_index)
+    {
+        return;
+    }
+
+    // Note: Integers above 2^53 are not exact as doubles; no valid glTF count or offset is that
+    //       large.
+    constexpr double max_exact_integer = 9007199254740992.0;
+    const double     number            = _json_values_in[member_index].number;
+    if ((GltfJsonType::NUMBER != _json_values_in[member_index].type) || (0.0 > number) ||
+        (max_exact_integer < number) || (std::floor(number) != number))
+    {
+        _success_out = false;
+        return;
+    }
+
+    _value_in_out = static_cast<size_t>(number);
+}
+
+// Note: Resolves accessor `_accessor_index_in` to a range of the BIN chunk. Vertex attributes
+//       may be any component type; elements must be unsigned and tightly packed.
+static void
+ResolveGlbAccessor(bool&              _success_out,
+                   const GlbDocument& _glb_document_in,
+                   const size_t&      _accessor_index_in,
+                   const bool&&       _is_element_accessor_in,
+                   GlbAccessor&       _glb_accessor_out)
+{
+    _success_out = false;
+
+    const std::vector<GltfJsonValue>& json_values   = _glb_document_in.json_values;
+    const char* const                 glb_file_path = _glb_document_in.glb_file_path;
+    if (_glb_document_in.accessors.size() <= _accessor_index_in)
+    {
+        ReportGlbError(glb_file_path, "Accessor index is out of bounds.");
+        return;
+    }
+
+    const size_t accessor = _glb_document_in.accessors[_accessor_index_in];
+    if (gltf_json_no_value != FindGltfJsonMember(json_values, accessor, "sparse"))
+    {
+        ReportGlbError(glb_file_path, "Sparse accessors are not supported.");
+        return;
+    }
+
+    size_t buffer_view_index     = gltf_json_no_value;
+    size_t accessor_offset_bytes = 0;
+    size_t component_type        = 0;
+    size_t element_count         = 0;
+    bool   parsed_buffer_view    = false;
+    bool   parsed_offset         = false;
+    bool   parsed_component_type = false;
+    bool   parsed_count          = false;
+    GetGltfJsonUnsigned(parsed_buffer_view, json_values, accessor, "bufferView", buffer_view_index);
+    GetGltfJsonUnsigned(parsed_offset, json_values, accessor, "byteOffset", accessor_offset_bytes);
+    GetGltfJsonUnsigned(
+      parsed_component_type, json_values, accessor, "componentType", component_type);
+    GetGltfJsonUnsigned(parsed_count, json_values, accessor, "count", element_count);
+    if ((false == parsed_buffer_view) || (false == parsed_offset) ||
+        (false == parsed_component_type) || (false == parsed_count))
+    {
+        ReportGlbError(glb_file_path, "Accessor has a malformed property.");
+        return;
+    }
+
+    if (gltf_json_no_value == buffer_view_index)
+    {
+        // Note: Accessors without a buffer view are all zeros, and would need to be allocated.
+        ReportGlbError(glb_file_path, "Accessors without a buffer view are not supported.");
+        return;
+    }
+
+    if ((0 == element_count) ||
+        (static_cast<size_t>(std::numeric_limits<GLsizei>::max()) < element_count))
+    {
+        ReportGlbError(glb_file_path, "Accessor element count is out of range.");
+        return;
+    }
+
+    // Note: glTF component types are the OpenGL enumerants of the same name.
+    const GLenum data_type = static_cast<GLenum>(component_type);
+    switch (data_type)
+    {
+        case GL_BYTE:
+        case GL_SHORT:
+        case GL_FLOAT:
+        {
+            if (true == _is_element_accessor_in)
+            {
+                ReportGlbError(glb_file_path, "Element accessors must be unsigned integers.");
+                return;
+            }
+            break;
+        }
+        case GL_UNSIGNED_BYTE:
+        case GL_UNSIGNED_SHORT:
+        case GL_UNSIGNED_INT:
+        {
+            break;
+        }
+        default:
+        {
+            ReportGlbError(glb_file_path, "Unsupported accessor component type.");
+            return;
+        }
+    }
+
+    const size_t type_member = FindGltfJsonMember(json_values, accessor, "type");
+    if ((gltf_json_no_value == type_member) ||
+        (GltfJsonType::STRING != json_values[type_member].type))
+    {
+        ReportGlbError(glb_file_path, "Accessor has no type.");
+        return;
+    }
+
+    const std::string_view type            = json_values[type_member].string;
+    GLint                  component_count = 0;
+    if ("SCALAR" == type)
+    {
+        component_count = 1;
+    }
+    else if ("VEC2" == type)
+    {
+        component_count = 2;
+    }
+    else if ("VEC3" == type)
+    {
+        component_count = 3;
+    }
+    else if ("VEC4" == type)
+    {
+        component_count = 4;
+    }
+
+    if ((0 == component_count) || ((true == _is_element_accessor_in) && (1 != component_count)))
+    {
+        ReportGlbError(glb_file_path, "Unsupported accessor type.");
+        return;
+    }
+
+    bool         normalized        = false;
+    const size_t normalized_member = FindGltfJsonMember(json_values, accessor, "normalized");
+    if (gltf_json_no_value != normalized_member)
+    {
+        normalized = (GltfJsonType::BOOLEAN == json_values[normalized_member].type) &&
+                     (true == json_values[normalized_member].boolean);
+    }
+
+    if ((true == normalized) && ((GL_FLOAT == data_type) || (true == _is_element_accessor_in)))
+    {
+        ReportGlbError(glb_file_path, "Only integer vertex attributes may be normalized.");
+        return;
+    }
+
+    if (_glb_document_in.buffer_views.size() <= buffer_view_index)
+    {
+        ReportGlbError(glb_file_path, "Buffer view index is out of bounds.");
+        return;
+    }
+
+    const size_t buffer_view              = _glb_document_in.buffer_views[buffer_view_index];
+    size_t       buffer_index             = gltf_json_no_value;
+    size_t       buffer_view_offset_bytes = 0;
+    size_t       buffer_view_size_bytes   = gltf_json_no_value;
+    size_t       byte_stride              = 0;
+    bool         parsed_buffer            = false;
+    bool         parsed_view_offset       = false;
+    bool         parsed_view_size         = false;
+    bool         parsed_stride            = false;
+    GetGltfJsonUnsigned(parsed_buffer, json_values, buffer_view, "buffer", buffer_index);
+    GetGltfJsonUnsigned(
+      parsed_view_offset, json_values, buffer_view, "byteOffset", buffer_view_offset_bytes);
+    GetGltfJsonUnsigned(
+      parsed_view_size, json_values, buffer_view, "byteLength", buffer_view_size_bytes);
+    GetGltfJsonUnsigned(parsed_stride, json_values, buffer_view, "byteStride", byte_stride);
+    if ((false == parsed_buffer) || (false == parsed_view_offset) || (false == parsed_view_size) ||
+        (false == parsed_stride) || (gltf_json_no_value == buffer_view_size_bytes))
+    {
+        ReportGlbError(glb_file_path, "Buffer view has a malformed property.");
+        return;
+    }
+
+    if (0 != buffer_index)
+    {
+        // Note: Buffer zero is the BIN chunk; validated by the caller.
+        ReportGlbError(glb_file_path, "Only the BIN chunk buffer is supported.");
+        return;
+    }
+
+    const size_t component_size_bytes = GLDataTypeSizeBytes(data_type);
+    const size_t element_size_bytes   = component_count * component_size_bytes;
+    if (0 == byte_stride)
+    {
+        byte_stride = element_size_bytes;
+    }
+
+    if ((true == _is_element_accessor_in) && (element_size_bytes != byte_stride))
+    {
+        ReportGlbError(glb_file_path, "Element buffer views may not be strided.");
+        return;
+    }
+
+    // Note: OpenGL limits vertex attribute strides to 255 bytes in some implementations; glTF
+    //       limits them to 252 and requires components to be aligned.
+    if ((element_size_bytes > byte_stride) || (252 < byte_stride) ||
+        (0 != (byte_stride % component_size_bytes)) ||
+        (0 != ((buffer_view_offset_bytes + accessor_offset_bytes) % component_size_bytes)))
+    {
+        ReportGlbError(glb_file_path, "Accessor stride or alignment is invalid.");
+        return;
+    }
+
+    // Note: The end of every range is checked against the BIN chunk as well as its buffer
+    //       view, such that a malformed file can not reference memory beyond the mapping.
+    const size_t accessor_range_bytes = (byte_stride * (element_count - 1)) + element_size_bytes;
+    if ((buffer_view_offset_bytes > _glb_document_in.bin_chunk_size_bytes) ||
+        (buffer_view_size_bytes >
+         (_glb_document_in.bin_chunk_size_bytes - buffer_view_offset_bytes)) ||
+        (accessor_offset_bytes > buffer_view_size_bytes) ||
+        (accessor_range_bytes > (buffer_view_size_bytes - accessor_offset_bytes)))
+    {
+        ReportGlbError(glb_file_path, "Accessor range is out of the bounds of the BIN chunk.");
+        return;
+    }
+
+    _glb_accessor_out.data = _glb_document_in.bin_chunk + buffer_view_offset_bytes +
+                             accessor_offset_bytes;
+    _glb_accessor_out.element_count                = static_cast<GLsizei>(element_count);
+    _glb_accessor_out.component_count              = component_count;
+    _glb_accessor_out.data_type                    = data_type;
+    _glb_accessor_out.should_be_normalized_by_gpu  = (true == normalized) ? GL_TRUE : GL_FALSE;
+    _glb_accessor_out.byte_stride_between_elements = static_cast<GLsizei>(byte_stride);
+
+    _success_out = true;
+}
+
+// Note: Elements are drawn, bounded and clustered without further checks, so each must index a
+//       vertex of the primitive, as ValidateMeshElements(...) requires of other formats.
+static void
+ValidateGlbElements(bool&              _success_out,
+                    const char* const  _glb_file_path_in,
+                    const GlbAccessor& _elements_in,
+                    const size_t&      _vertex_count_in)
+{
+    _success_out = true;
+
+    const char* const element_data       = static_cast<const char*>(_elements_in.data);
+    const size_t      element_size_bytes = GLDataTypeSizeBytes(_elements_in.data_type);
+    for (size_t element_index = 0; element_index < static_cast<size_t>(_elements_in.element_count);
+         element_index++)
+    {
+        // Note: Elements are read by copy, so that no alignment is assumed of the BIN chunk.
+        const char* const element_head = element_data + (element_index * element_size_bytes);
+        size_t            element      = 0;
+        switch (_elements_in.data_type)
+        {
+            case GL_UNSIGNED_BYTE:
+            {
+                GLubyte value;
+                std::memcpy(&value, element_head, sizeof(value));
+                element = static_cast<size_t>(value);
+                break;
+            }
+            case GL_UNSIGNED_SHORT:
+            {
+                GLushort value;
+                std::memcpy(&value, element_head, sizeof(value));
+                element = static_cast<size_t>(value);
+                break;
+            }
+            default:
+            {
+                GLuint value;
+                std::memcpy(&value, element_head, sizeof(value));
+                element = static_cast<size_t>(value);
+                break;
+            }
+        }
+
+        if (element >= _vertex_count_in)
+        {
+            std::stringstream ss;
+            ss << "Primitive element " << element << " exceeds its vertex count ("
+               << _vertex_count_in << ").";
+            ReportGlbError(_glb_file_path_in, ss.str().c_str());
+            _success_out = false;
+            return;
+        }
+    }
+}
+
+static void
+LoadGlbPrimitive(bool&              _success_out,
+                 const GlbDocument& _glb_document_in,
+                 const size_t&      _primitive_in,
+                 size_t&            _ignored_attribute_count_in_out,
+                 GlbPrimitive&      _glb_primitive_out)
+{
+    _success_out = false;
+
+    const std::vector<GltfJsonValue>& json_values   = _glb_document_in.json_values;
+    const char* const                 glb_file_path = _glb_document_in.glb_file_path;
+
+    // Note: glTF primitive modes are the OpenGL enumerants GL_POINTS through GL_TRIANGLE_FAN.
+    size_t primitive_mode = GL_TRIANGLES;
+    GetGltfJsonUnsigned(_success_out, json_values, _primitive_in, "mode", primitive_mode);
+    if ((false == _success_out) || (GL_TRIANGLE_FAN < primitive_mode))
+    {
+        ReportGlbError(glb_file_path, "Unsupported primitive mode.");
+        _success_out = false;
+        return;
+    }
+
+    _glb_primitive_out.primitive_drawing_mode = static_cast<GLenum>(primitive_mode);
+
+    const size_t attributes = FindGltfJsonMember(json_values, _primitive_in, "attributes");
+    if ((gltf_json_no_value == attributes) ||
+        (GltfJsonType::OBJECT != json_values[attributes].type))
+    {
+        ReportGlbError(glb_file_path, "Primitive has no attributes.");
+        _success_out = false;
+        return;
+    }
+
+    const char* array_buffer_head = nullptr;
+    const char* array_buffer_tail = nullptr;
+    for (size_t attribute = json_values[attributes].first_child;
+         gltf_json_no_value != attribute;
+         attribute = json_values[attribute].next_sibling)
+    {
+        glt::VertexDataType vertex_data_type = glt::VertexDataType::COUNT;
+        if ("POSITION" == json_values[attribute].key)
+        {
+            vertex_data_type = glt::VertexDataType::POSITION;
+        }
+        else if ("NORMAL" == json_values[attribute].key)
+        {
+            vertex_data_type = glt::VertexDataType::NORMAL;
+        }
+        else if ("TEXCOORD_0" == json_values[attribute].key)
+        {
+            vertex_data_type = glt::VertexDataType::TEXTURE;
+        }
+        else if ("TANGENT" == json_values[attribute].key)
+        {
+            vertex_data_type = glt::VertexDataType::TANGENT;
+        }
+        else
+        {
+            _ignored_attribute_count_in_out++;
+            continue;
+        }
+
+        size_t accessor_index = gltf_json_no_value;
+        GetGltfJsonUnsigned(_success_out,
+                            json_values,
+                            attributes,
+                            std::string_view(json_values[attribute].key),
+                            accessor_index);
+        if (false == _success_out)
+        {
+            ReportGlbError(glb_file_path, "Primitive attribute is not an accessor index.");
+            return;
+        }
+
+        GlbVertexAttribute vertex_attribute;
+        vertex_attribute.vertex_data_type = vertex_data_type;
+        ResolveGlbAccessor(_success_out,
+                           _glb_document_in,
+                           accessor_index,
+                           false,
+                           vertex_attribute.accessor);
+        if (false == _success_out)
+        {
+            return;
+        }
+
+        const GlbAccessor& accessor       = vertex_attribute.accessor;
+        const char* const  accessor_head  = static_cast<const char*>(accessor.data);
+        const char* const  accessor_tail  = accessor_head +
+                                          (accessor.byte_stride_between_elements *
+                                           (static_cast<size_t>(accessor.element_count) - 1)) +
+                                          (accessor.component_count *
+                                           GLDataTypeSizeBytes(accessor.data_type));
+        if (nullptr == array_buffer_head)
+        {
+            array_buffer_head = accessor_head;
+            array_buffer_tail = accessor_tail;
+        }
+        else
+        {
+            array_buffer_head = std::min(array_buffer_head, accessor_head);
+            array_buffer_tail = std::max(array_buffer_tail, accessor_tail);
+        }
+
+        _glb_primitive_out.vertex_attributes.push_back(vertex_attribute);
+    }
+
+    const GlbVertexAttribute* position_attribute = nullptr;
+    for (auto& vertex_attribute : _glb_primitive_out.vertex_attributes)
+    {
+        if (glt::VertexDataType::POSITION == vertex_attribute.vertex_data_type)
+        {
+            position_attribute = &vertex_attribute;
+        }
+    }
+
+    if (nullptr == position_attribute)
+    {
+        ReportGlbError(glb_file_path, "Primitive has no POSITION attribute.");
+        _success_out = false;
+        return;
+    }
+
+    _glb_primitive_out.vertex_count = position_attribute->accessor.element_count;
+    for (auto& vertex_attribute : _glb_primitive_out.vertex_attributes)
+    {
+        if (_glb_primitive_out.vertex_count != vertex_attribute.accessor.element_count)
+        {
+            ReportGlbError(glb_file_path, "Primitive attributes differ in element count.");
+            _success_out = false;
+            return;
+        }
+    }
+
+    _glb_primitive_out.array_buffer_data            = array_buffer_head;
+    _glb_primitive_out.array_buffer_data_size_bytes = array_buffer_tail - array_buffer_head;
+
+    // Note: Accessors are aligned to their component size, so float positions may be read in
+    //       place as a float vertex stream of the accessor's stride.
+    const GlbAccessor& position_accessor = position_attribute->accessor;
+    if ((GL_FLOAT == position_accessor.data_type) && (3 == position_accessor.component_count))
+    {
+        ComputeBoundingVolume(
+          _success_out,
+          static_cast<const float*>(position_accessor.data),
+          static_cast<size_t>(position_accessor.byte_stride_between_elements) / sizeof(float),
+          0,
+          static_cast<size_t>(position_accessor.element_count),
+          _glb_primitive_out.bounding_volume);
+        if (false == _success_out)
+        {
+            return;
+        }
+    }
+    else
+    {
+        std::stringstream ss;
+        ss << "Primitive positions are not three floats; its bounding volume is left empty."
+           << std::endl
+           << "   File: " << glb_file_path;
+        Log_w(ss);
+    }
+
+    size_t element_accessor_index = gltf_json_no_value;
+    GetGltfJsonUnsigned(
+      _success_out, json_values, _primitive_in, "indices", element_accessor_index);
+    if (false == _success_out)
+    {
+        ReportGlbError(glb_file_path, "Primitive indices are not an accessor index.");
+        return;
+    }
+
+    if (gltf_json_no_value != element_accessor_index)
+    {
+        ResolveGlbAccessor(_success_out,
+                           _glb_document_in,
+                           element_accessor_index,
+                           true,
+                           _glb_primitive_out.elements);
+        if (false == _success_out)
+        {
+            return;
+        }
+
+        ValidateGlbElements(_success_out,
+                            glb_file_path,
+                            _glb_primitive_out.elements,
+                            static_cast<size_t>(_glb_primitive_out.vertex_count));
+    }
+}
+
+void
+LoadModelFromGlbFile(bool&             _success_out,
+                     const char* const _glb_file_path_in,
+                     GlbModel&         _glb_model_out)
+{
+    _glb_model_out.primitives.clear();
+
+    MapFileToMemory(_success_out, _glb_file_path_in, _glb_model_out.file);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    _success_out = false;
+
+    const char* const data       = _glb_model_out.file.data;
+    const size_t      size_bytes = _glb_model_out.file.size_bytes;
+    if ((glb_header_size_bytes + glb_chunk_header_size_bytes) > size_bytes)
+    {
+        ReportGlbError(_glb_file_path_in, "File is smaller than its header.");
+        return;
+    }
+
+    if ((glb_magic != ReadGlbUint32(data)) || (glb_version != ReadGlbUint32(data + 4)))
+    {
+        ReportGlbError(_glb_file_path_in, "Unrecognized magic or version.");
+        return;
+    }
+
+    // Note: Trailing bytes beyond the declared length are ignored.
+    const size_t glb_size_bytes = ReadGlbUint32(data + 8);
+    if (glb_size_bytes > size_bytes)
+    {
+        ReportGlbError(_glb_file_path_in, "File is shorter than its declared length.");
+        return;
+    }
+
+    const char* const json_chunk_header     = data + glb_header_size_bytes;
+    const size_t      json_chunk_size_bytes = ReadGlbUint32(json_chunk_header);
+    const char* const json_chunk = json_chunk_header + glb_chunk_header_size_bytes;
+    if ((glb_json_chunk_type != ReadGlbUint32(json_chunk_header + 4)) ||
+        (json_chunk_size_bytes >
+         (glb_size_bytes - glb_header_size_bytes - glb_chunk_header_size_bytes)))
+    {
+        ReportGlbError(_glb_file_path_in, "The first chunk is not a valid JSON chunk.");
+        return;
+    }
+
+    GlbDocument glb_document;
+    glb_document.glb_file_path = _glb_file_path_in;
+
+    // Note: The BIN chunk is optional, and must immediately follow the JSON chunk.
+    const char* const glb_tail       = data + glb_size_bytes;
+    const char* const bin_chunk_head = json_chunk + json_chunk_size_bytes;
+    if (static_cast<size_t>(glb_tail - bin_chunk_head) >= glb_chunk_header_size_bytes)
+    {
+        const size_t bin_chunk_size_bytes = ReadGlbUint32(bin_chunk_head);
+        if ((glb_bin_chunk_type != ReadGlbUint32(bin_chunk_head + 4)) ||
+            (bin_chunk_size_bytes >
+             static_cast<size_t>(glb_tail - bin_chunk_head - glb_chunk_header_size_bytes)))
+        {
+            ReportGlbError(_glb_file_path_in, "The second chunk is not a valid BIN chunk.");
+            return;
+        }
+
+        glb_document.bin_chunk            = bin_chunk_head + glb_chunk_header_size_bytes;
+        glb_document.bin_chunk_size_bytes = bin_chunk_size_bytes;
+    }
+
+    std::vector<GltfJsonValue>& json_values = glb_document.json_values;
+    const char*                 json_cursor = json_chunk;
+    const char* const           json_tail   = json_chunk + json_chunk_size_bytes;
+    ParseGltfJsonValue(_success_out, json_cursor, json_tail, 0, json_values);
+    if ((false == _success_out) || (GltfJsonType::OBJECT != json_values[0].type))
+    {
+        ReportGlbError(_glb_file_path_in, "JSON chunk is malformed.");
+        _success_out = false;
+        return;
+    }
+
+    constexpr size_t root = 0;
+
+    // Note: Buffer zero, when it has no uri, is the BIN chunk. It may be shorter than the chunk,
+    //       which is padded to four bytes.
+    std::vector<size_t> buffers;
+    GetGltfJsonArrayElements(_success_out,
+                             json_values,
+                             FindGltfJsonMember(json_values, root, "buffers"),
+                             buffers);
+    if (false == _success_out)
+    {
+        ReportGlbError(_glb_file_path_in, "The buffers property is not an array.");
+        return;
+    }
+
+    if (0 != buffers.size())
+    {
+        size_t buffer_size_bytes = gltf_json_no_value;
+        GetGltfJsonUnsigned(_success_out, json_values, buffers[0], "byteLength", buffer_size_bytes);
+        if ((false == _success_out) ||
+            (gltf_json_no_value != FindGltfJsonMember(json_values, buffers[0], "uri")) ||
+            (buffer_size_bytes > glb_document.bin_chunk_size_bytes))
+        {
+            ReportGlbError(_glb_file_path_in, "The first buffer does not describe the BIN chunk.");
+            _success_out = false;
+            return;
+        }
+
+        glb_document.bin_chunk_size_bytes = buffer_size_bytes;
+    }
+    else
+    {
+        glb_document.bin_chunk_size_bytes = 0;
+    }
+
+    std::vector<size_t> meshes;
+    bool                parsed_meshes       = false;
+    bool                parsed_accessors    = false;
+    bool                parsed_buffer_views = false;
+    GetGltfJsonArrayElements(parsed_meshes,
+                             json_values,
+                             FindGltfJsonMember(json_values, root, "meshes"),
+                             meshes);
+    GetGltfJsonArrayElements(parsed_accessors,
+                             json_values,
+                             FindGltfJsonMember(json_values, root, "accessors"),
+                             glb_document.accessors);
+    GetGltfJsonArrayElements(parsed_buffer_views,
+                             json_values,
+                             FindGltfJsonMember(json_values, root, "bufferViews"),
+                             glb_document.buffer_views);
+    if ((false == parsed_meshes) || (false == parsed_accessors) || (false == parsed_buffer_views))
+    {
+        ReportGlbError(_glb_file_path_in, "Meshes, accessors or buffer views are not arrays.");
+        _success_out = false;
+        return;
+    }
+
+    size_t              ignored_attribute_count = 0;
+    std::vector<size_t> primitives;
+    for (auto& mesh : meshes)
+    {
+        GetGltfJsonArrayElements(_success_out,
+                                 json_values,
+                                 FindGltfJsonMember(json_values, mesh, "primitives"),
+                                 primitives);
+        if (false == _success_out)
+        {
+            ReportGlbError(_glb_file_path_in, "Mesh primitives are not an array.");
+            return;
+        }
+
+        for (auto& primitive : primitives)
+        {
+            GlbPrimitive glb_primitive;
+            LoadGlbPrimitive(_success_out,
+                             glb_document,
+                             primitive,
+                             ignored_attribute_count,
+                             glb_primitive);
+            if (false == _success_out)
+            {
+                _glb_model_out.primitives.clear();
+                return;
+            }
+
+            _glb_model_out.primitives.push_back(std::move(glb_primitive));
+        }
+    }
+
+    if (0 == _glb_model_out.primitives.size())
+    {
+        ReportGlbError(_glb_file_path_in, "File contains no mesh primitives.");
+        _success_out = false;
+        return;
+    }
+
+    if (0 != ignored_attribute_count)
+    {
+        std::stringstream ss;
+        ss << "Ignored " << ignored_attribute_count
+           << " vertex attributes other than POSITION, NORMAL, TEXCOORD_0 and TANGENT." << std::endl
+           << "   File: " << _glb_file_path_in;
+        Log_w(ss);
+    }
+
+    _success_out = true;
+}
+
+void
+CreateGlbVertexAttributeDescriptors(
+  bool&                                        _success_out,
+  const GLuint&&                               _vertex_array_object_id_in,
+  const GlbPrimitive&                          _glb_primitive_in,
+  const GLuint&&                               _position_attribute_index_in,
+  const GLuint&&                               _normal_attribute_index_in,
+  const GLuint&&                               _texture_coordinates_attribute_index_in,
+  const GLuint&&                               _tangent_attribute_index_in,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out)
+{
+    _vertex_attribute_pointers_out.clear();
+
+    const char* const array_buffer_head = static_cast<const char*>(
+      _glb_primitive_in.array_buffer_data);
+    for (auto& vertex_attribute : _glb_primitive_in.vertex_attributes)
+    {
+        GLuint vertex_attribute_index = 0;
+        switch (vertex_attribute.vertex_data_type)
+        {
+            case glt::VertexDataType::POSITION:
+            {
+                vertex_attribute_index = _position_attribute_index_in;
+                break;
+            }
+            case glt::VertexDataType::NORMAL:
+            {
+                vertex_attribute_index = _normal_attribute_index_in;
+                break;
+            }
+            case glt::VertexDataType::TEXTURE:
+            {
+                vertex_attribute_index = _texture_coordinates_attribute_index_in;
+                break;
+            }
+            case glt::VertexDataType::TANGENT:
+            {
+                vertex_attribute_index = _tangent_attribute_index_in;
+                break;
+            }
+            default:
+            {
+                Log_e("Invalid vertex data type in glTF primitive.");
+                _vertex_attribute_pointers_out.clear();
+                _success_out = false;
+                return;
+            }
+        }
+
+        const GlbAccessor& accessor = vertex_attribute.accessor;
+        _vertex_attribute_pointers_out.push_back(glt::VertexAttributeDescriptor(
+          std::move(_vertex_array_object_id_in),
+          std::move(vertex_attribute_index),
+          std::move(accessor.component_count),
+          std::move(accessor.data_type),
+          std::move(accessor.should_be_normalized_by_gpu),
+          std::move(accessor.byte_stride_between_elements),
+          reinterpret_cast<const GLvoid*>(static_cast<const char*>(accessor.data) -
+                                          array_buffer_head),
+          std::move(vertex_attribute.vertex_data_type)));
+    }
+
+    _success_out = true;
+}
@@ -0,0 +1,122 @@
+#ifndef gltf_h
+#define gltf_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "bounds.h"
+#include "fileio.h"
+#include "gl_tools.h"
+
+//
+// Note: Binary glTF 2.0 (.glb) import. A .glb file is a 12 byte header followed by a JSON chunk,
+//       which describes the meshes, and a BIN chunk, which holds their vertex and element data
+//       in a form OpenGL reads as-is. The file is memory mapped and the JSON parsed once; the
+//       vertex and element data are never copied, and are uploaded straight from the mapping:
+//
+//       GlbModel glb_model;
+//       LoadModelFromGlbFile(success, "model.glb", glb_model);
+//
+//       const GlbPrimitive& primitive = glb_model.primitives[0];
+//       CreateGlbVertexAttributeDescriptors(success, vao, primitive, 0, 1, 2, 3, descriptors);
+//       model.AddArrayBuffer(success,
+//                            primitive.array_buffer_data,
+//                            std::move(primitive.array_buffer_data_size_bytes),
+//                            std::move(primitive.vertex_count),
+//                            GL_STATIC_DRAW,
+//                            std::move(primitive.primitive_drawing_mode),
+//                            descriptors);
+//       model.AddElementBuffer(success,
+//                              primitive.elements.data,
+//                              primitive.elements.element_count *
+//                                GLDataTypeSizeBytes(primitive.elements.data_type),
+//                              std::move(primitive.elements.element_count),
+//                              std::move(primitive.elements.data_type),
+//                              GL_STATIC_DRAW,
+//                              std::move(primitive.primitive_drawing_mode));
+//
+//       Only data held in the BIN chunk is supported; external and data URI buffers, sparse
+//       accessors and morph targets are rejected or ignored. Node transforms are not applied.
+//
+//       Texture coordinates are uploaded as they are in the file, with glTF's origin at the top
+//       left of the image, and must be flipped (v' = 1 - v) by the shader that samples with
+//       them. The importer overload of LoadModelFromGlbFile(...) in model_import.h, used by the
+//       model streamer and the cooker, flips them on import instead.
+//
+constexpr uint32_t glb_magic           = 0x46546C67; // "glTF"
+constexpr uint32_t glb_version         = 2;
+constexpr uint32_t glb_json_chunk_type = 0x4E4F534A; // "JSON"
+constexpr uint32_t glb_bin_chunk_type  = 0x004E4942; // "BIN\0"
+
+// Note: One accessor, described as OpenGL reads it. `data` points into the mapped file, at the
+//       first component of the first element. `byte_stride_between_elements` is never zero;
+//       tightly packed accessors report the size of one element.
+struct GlbAccessor
+{
+    const GLvoid* data                         = nullptr;
+    GLsizei       element_count                = 0;
+    GLint         component_count              = 0;
+    GLenum        data_type                    = GL_NONE;
+    GLboolean     should_be_normalized_by_gpu  = GL_FALSE;
+    GLsizei       byte_stride_between_elements = 0;
+};
+
+struct GlbVertexAttribute
+{
+    glt::VertexDataType vertex_data_type = glt::VertexDataType::COUNT;
+    GlbAccessor         accessor;
+};
+
+// Note: `array_buffer_data` is the smallest range of the BIN chunk holding every vertex
+//       attribute of the primitive, so that interleaved and separate attribute buffer views
+//       alike are uploaded as one array buffer. It may include unrelated bytes lying between
+//       attributes.
+//
+//       `elements.element_count` is zero for primitives drawn without elements. Otherwise,
+//       `elements.data_type` is GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT or GL_UNSIGNED_INT and the
+//       elements are tightly packed, as AddElementBuffer(...) expects.
+//
+//       `bounding_volume` bounds the POSITION attribute (see bounds.h).
+struct GlbPrimitive
+{
+    GLenum                          primitive_drawing_mode       = GL_TRIANGLES;
+    GLsizei                         vertex_count                 = 0;
+    std::vector<GlbVertexAttribute> vertex_attributes;
+    const GLvoid*                   array_buffer_data            = nullptr;
+    GLsizeiptr                      array_buffer_data_size_bytes = 0;
+    GlbAccessor                     elements;
+    BoundingVolume                  bounding_volume;
+};
+
+// Note: Pointers in `primitives` are valid for the lifetime of `file`, which must outlive the
+//       upload of the buffers.
+struct GlbModel
+{
+    MappedFile                file;
+    std::vector<GlbPrimitive> primitives;
+};
+
+// Note: Every primitive of every mesh in the file is loaded, in order. The POSITION, NORMAL,
+//       TEXCOORD_0 and TANGENT attributes are mapped onto glt::VertexDataType; other attributes
+//       are ignored with a warning. Every accessor range is validated against the BIN chunk.
+void
+LoadModelFromGlbFile(bool&             _success_out,
+                     const char* const _glb_file_path_in,
+                     GlbModel&         _glb_model_out);
+
+// Note: Describes the vertex attributes of `_glb_primitive_in` relative to its
+//       `array_buffer_data`, keeping the component types of the file. Integer attributes are
+//       read as floats by the shader, normalized when the accessor is.
+void
+CreateGlbVertexAttributeDescriptors(
+  bool&                                        _success_out,
+  const GLuint&&                               _vertex_array_object_id_in,
+  const GlbPrimitive&                          _glb_primitive_in,
+  const GLuint&&                               _position_attribute_index_in,
+  const GLuint&&                               _normal_attribute_index_in,
+  const GLuint&&                               _texture_coordinates_attribute_index_in,
+  const GLuint&&                               _tangent_attribute_index_in,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out);
+
+#endif // gltf_h
@@ -0,0 +1,318 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "image_decoding.h"
+
+#include "image_tools.h"
+#include "logging.h"
+
+// Note: Precedes every buffer, keeping the buffer as aligned as malloc's are.
+struct alignas(16) ImageBufferHeader
+{
+    size_t capacity_bytes = 0;
+    size_t size_class     = 0;
+};
+
+constexpr size_t image_buffer_unpooled_size_class = std::numeric_limits<size_t>::max();
+
+struct ImageBufferPool
+{
+    std::mutex mutex;
+
+    // Note: Guarded by `mutex`.
+    std::vector<std::vector<ImageBufferHeader*>> free_buffers_by_size_class;
+    size_t                                       limit_bytes = image_buffer_pool_default_limit;
+    ImageBufferPoolStatistics                    statistics;
+};
+
+// Note: The pool is never destroyed, as images may be freed (see STBI_FREE) during static
+//       destruction, after a function-local pool would be gone. Buffers it retains at exit are
+//       returned with the rest of the process.
+static ImageBufferPool&
+GetImageBufferPool() noexcept
+{
+    static ImageBufferPool* const image_buffer_pool = new ImageBufferPool;
+    return *image_buffer_pool;
+}
+
+// Note: Four size classes per power of two, starting at image_buffer_pool_minimum_size_bytes.
+static void
+GetImageBufferSizeClass(const size_t& _size_bytes_in,
+                        size_t&       _size_class_out,
+                        size_t&       _capacity_bytes_out) noexcept
+{
+    _size_class_out = 0;
+
+    size_t octave_size_bytes = image_buffer_pool_minimum_size_bytes;
+    while (true)
+    {
+        for (size_t step = 0; step < 4; step++, _size_class_out++)
+        {
+            _capacity_bytes_out = octave_size_bytes + ((octave_size_bytes / 4) * step);
+            if (_capacity_bytes_out >= _size_bytes_in)
+            {
+                return;
+            }
+        }
+
+        octave_size_bytes *= 2;
+    }
+}
+
+// Note: Releases retained buffers, largest first, until no more than `_limit_bytes_in` are
+//       retained. Called with the pool's mutex held; the buffers are freed by the caller.
+static void
+TakeImageBuffersOverLimit(ImageBufferPool&                 _image_buffer_pool_in_out,
+                          const size_t&                    _limit_bytes_in,
+                          std::vector<ImageBufferHeader*>& _released_headers_out) noexcept
+{
+    ImageBufferPoolStatistics& statistics = _image_buffer_pool_in_out.statistics;
+    for (size_t size_class = _image_buffer_pool_in_out.free_buffers_by_size_class.size();
+         (0 < size_class) && (statistics.retained_bytes > _limit_bytes_in);
+         size_class--)
+    {
+        auto& free_buffers = _image_buffer_pool_in_out.free_buffers_by_size_class[size_class - 1];
+        while ((false == free_buffers.empty()) && (statistics.retained_bytes > _limit_bytes_in))
+        {
+            statistics.retained_bytes -= free_buffers.back()->capacity_bytes;
+            statistics.retained_buffer_count--;
+            _released_headers_out.push_back(free_buffers.back());
+            free_buffers.pop_back();
+        }
+    }
+}
+
+void*
+AllocateImageBuffer(const size_t& _size_bytes_in) noexcept
+{
+    size_t size_class     = image_buffer_unpooled_size_class;
+    size_t capacity_bytes = _size_bytes_in;
+    if (_size_bytes_in >= image_buffer_pool_minimum_size_bytes)
+    {
+        GetImageBufferSizeClass(_size_bytes_in, size_class, capacity_bytes);
+
+        ImageBufferPool&            image_buffer_pool = GetImageBufferPool();
+        std::lock_guard<std::mutex> lock(image_buffer_pool.mutex);
+        if (size_class < image_buffer_pool.free_buffers_by_size_class.size())
+        {
+            auto& free_buffers = image_buffer_pool.free_buffers_by_size_class[size_class];
+            if (false == free_buffers.empty())
+            {
+                ImageBufferHeader* const header = free_buffers.back();
+                free_buffers.pop_back();
+
+                image_buffer_pool.statistics.reused_buffer_count++;
+                image_buffer_pool.statistics.retained_buffer_count--;
+                image_buffer_pool.statistics.retained_bytes -= capacity_bytes;
+                return header + 1;
+            }
+        }
+
+        image_buffer_pool.statistics.allocated_buffer_count++;
+    }
+
+    ImageBufferHeader* const header = static_cast<ImageBufferHeader*>(
+      std::malloc(sizeof(ImageBufferHeader) + capacity_bytes));
+    if (nullptr == header)
+    {
+        return nullptr;
+    }
+
+    header->capacity_bytes = capacity_bytes;
+    header->size_class     = size_class;
+    return header + 1;
+}
+
+void*
+ReallocateImageBuffer(void* const   _buffer_in,
+                      const size_t& _old_size_bytes_in,
+                      const size_t& _new_size_bytes_in) noexcept
+{
+    if (nullptr == _buffer_in)
+    {
+        return AllocateImageBuffer(_new_size_bytes_in);
+    }
+
+    // Note: Buffers grown within their size class, as zlib output buffers are, stay in place.
+    const ImageBufferHeader* const header = static_cast<ImageBufferHeader*>(_buffer_in) - 1;
+    if (_new_size_bytes_in <= header->capacity_bytes)
+    {
+        return _buffer_in;
+    }
+
+    void* const buffer = AllocateImageBuffer(_new_size_bytes_in);
+    if (nullptr == buffer)
+    {
+        return nullptr;
+    }
+
+    std::memcpy(buffer, _buffer_in, std::min(_old_size_bytes_in, _new_size_bytes_in));
+    FreeImageBuffer(_buffer_in);
+    return buffer;
+}
+
+void
+FreeImageBuffer(void* const _buffer_in) noexcept
+{
+    if (nullptr == _buffer_in)
+    {
+        return;
+    }
+
+    ImageBufferHeader* const header = static_cast<ImageBufferHeader*>(_buffer_in) - 1;
+    if (image_buffer_unpooled_size_class != header->size_class)
+    {
+        ImageBufferPool&            image_buffer_pool = GetImageBufferPool();
+        std::lock_guard<std::mutex> lock(image_buffer_pool.mutex);
+        ImageBufferPoolStatistics&  statistics = image_buffer_pool.statistics;
+        if ((statistics.retained_bytes + header->capacity_bytes) <= image_buffer_pool.limit_bytes)
+        {
+            if (header->size_class >= image_buffer_pool.free_buffers_by_size_class.size())
+            {
+                image_buffer_pool.free_buffers_by_size_class.resize(header->size_class + 1);
+            }
+
+            image_buffer_pool.free_buffers_by_size_class[header->size_class].push_back(header);
+            statistics.retained_buffer_count++;
+            statistics.retained_bytes += header->capacity_bytes;
+            return;
+        }
+    }
+
+    std::free(header);
+}
+
+void
+SetImageBufferPoolLimit(const size_t&& _limit_bytes_in) noexcept
+{
+    std::vector<ImageBufferHeader*> released_headers;
+    {
+        ImageBufferPool&            image_buffer_pool = GetImageBufferPool();
+        std::lock_guard<std::mutex> lock(image_buffer_pool.mutex);
+        image_buffer_pool.limit_bytes = _limit_bytes_in;
+        TakeImageBuffersOverLimit(image_buffer_pool, _limit_bytes_in, released_headers);
+    }
+
+    for (ImageBufferHeader* const header : released_headers)
+    {
+        std::free(header);
+    }
+}
+
+void
+TrimImageBufferPool() noexcept
+{
+    std::vector<ImageBufferHeader*> released_headers;
+    {
+        ImageBufferPool&            image_buffer_pool = GetImageBufferPool();
+        std::lock_guard<std::mutex> lock(image_buffer_pool.mutex);
+        TakeImageBuffersOverLimit(image_buffer_pool, 0, released_headers);
+    }
+
+    for (ImageBufferHeader* const header : released_headers)
+    {
+        std::free(header);
+    }
+}
+
+void
+GetImageBufferPoolStatistics(ImageBufferPoolStatistics& _statistics_out) noexcept
+{
+    ImageBufferPool&            image_buffer_pool = GetImageBufferPool();
+    std::lock_guard<std::mutex> lock(image_buffer_pool.mutex);
+    _statistics_out = image_buffer_pool.statistics;
+}
+
+void
+ReleaseDecodedImage(DecodedImage& _decoded_image_in_out) noexcept
+{
+    if (nullptr != _decoded_image_in_out.image_data)
+    {
+        stbi_image_free(_decoded_image_in_out.image_data);
+    }
+
+    _decoded_image_in_out = {};
+}
+
+ImageDecoder::~ImageDecoder()
+{
+    Stop();
+}
+
+void
+ImageDecoder::Start(bool& _success_out, const size_t&& _thread_count_in)
+{
+    job_system.Start(_success_out, std::move(_thread_count_in));
+    if (false == _success_out)
+    {
+        Log_e("Unable to start the image decoding job system.");
+        return;
+    }
+}
+
+void
+ImageDecoder::Stop() noexcept
+{
+    job_system.Stop();
+}
+
+void
+ImageDecoder::DecodeImages(bool&                                  _success_out,
+                           const std::vector<ImageDecodeRequest>& _requests_in,
+                           std::vector<DecodedImage>&             _decoded_images_out)
+{
+    _success_out = false;
+    if (0 == job_system.GetThreadCount())
+    {
+        Log_e("The image decoder has not been started.");
+        return;
+    }
+
+    _decoded_images_out.assign(_requests_in.size(), DecodedImage());
+
+    std::atomic<size_t> failed_image_count = 0;
+    JobBatch            batch;
+    for (size_t index = 0; index < _requests_in.size(); index++)
+    {
+        job_system.Submit(
+          [&_requests_in, &_decoded_images_out, &failed_image_count, index]()
+          {
+              const ImageDecodeRequest& request       = _requests_in[index];
+              DecodedImage&             decoded_image = _decoded_images_out[index];
+              DecodeImageToMemory(decoded_image.success,
+                                  request.file_path.c_str(),
+                                  request.flip_vertically,
+                                  &decoded_image.image_data,
+                                  decoded_image.image_width,
+                                  decoded_image.image_height,
+                                  decoded_image.image_channels);
+              if (false == decoded_image.success)
+              {
+                  std::stringstream ss;
+                  ss << "Unable to decode image: " << request.file_path;
+                  Log_e(ss);
+                  failed_image_count.fetch_add(1);
+              }
+          },
+          &batch);
+    }
+
+    job_system.Wait(batch);
+
+    if (0 != failed_image_count)
+    {
+        std::stringstream ss;
+        ss << failed_image_count << " of " << _requests_in.size() << " images failed to decode.";
+        Log_e(ss);
+        return;
+    }
+
+    _success_out = true;
+}
+
+size_t
+ImageDecoder::GetThreadCount() const noexcept
+{
+    return job_system.GetThreadCount();
+}
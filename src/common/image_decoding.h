@@ -0,0 +1,123 @@
+#ifndef image_decoding_h
+#define image_decoding_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "job_system.h"
+
+//
+// Note: Decodes many images at once on a JobSystem, one image per job, as loading a scene's
+//       textures one after another leaves every core but one idle:
+//
+//       ImageDecoder                    image_decoder;
+//       std::vector<ImageDecodeRequest> requests = { { "brick.png" }, { "stone.png" } };
+//       std::vector<DecodedImage>       decoded_images;
+//       image_decoder.Start(success, 0);
+//       image_decoder.DecodeImages(success, requests, decoded_images);
+//       ...
+//       ReleaseDecodedImage(decoded_images[0]);
+//
+//       Images are decoded by DecodeImageToMemory(...) in image_tools.h, which sets whether rows
+//       are flipped for the decoding thread only.
+//
+//       Every allocation stb_image makes, pixel data included, is served by the image buffer pool
+//       below, such that decoding a batch of images reuses the buffers of the last rather than
+//       asking the heap for fresh ones.
+//
+
+// Note: Buffers of at least image_buffer_pool_minimum_size_bytes are kept for reuse when freed,
+//       up to SetImageBufferPoolLimit(...) bytes in all; smaller buffers come from the heap.
+//       Buffer sizes are rounded up to a quarter of a power of two. Thread safe.
+constexpr size_t image_buffer_pool_minimum_size_bytes = 64 << 10;
+constexpr size_t image_buffer_pool_default_limit      = 256 << 20;
+
+struct ImageBufferPoolStatistics
+{
+    // Note: Counted over the life of the pool, of buffers large enough to be retained.
+    size_t reused_buffer_count    = 0;
+    size_t allocated_buffer_count = 0;
+
+    size_t retained_buffer_count = 0;
+    size_t retained_bytes        = 0;
+};
+
+// Note: Used by stb_image, as STBI_MALLOC, STBI_REALLOC_SIZED and STBI_FREE.
+void*
+AllocateImageBuffer(const size_t& _size_bytes_in) noexcept;
+
+void*
+ReallocateImageBuffer(void* const   _buffer_in,
+                      const size_t& _old_size_bytes_in,
+                      const size_t& _new_size_bytes_in) noexcept;
+
+void
+FreeImageBuffer(void* const _buffer_in) noexcept;
+
+// Note: Retained buffers over a lowered limit are released.
+void
+SetImageBufferPoolLimit(const size_t&& _limit_bytes_in) noexcept;
+
+// Note: Releases every retained buffer, e.g. once a scene's textures are uploaded.
+void
+TrimImageBufferPool() noexcept;
+
+void
+GetImageBufferPoolStatistics(ImageBufferPoolStatistics& _statistics_out) noexcept;
+
+struct ImageDecodeRequest
+{
+    std::string file_path;
+    bool        flip_vertically = true;
+};
+
+// Note: Four channels per pixel, as LoadImageToMemory(...) decodes; `image_channels` is the
+//       channel count of the file.
+struct DecodedImage
+{
+    bool           success        = false;
+    unsigned char* image_data     = nullptr;
+    int            image_width    = 0;
+    int            image_height   = 0;
+    int            image_channels = 0;
+};
+
+// Note: Returns the image data to the image buffer pool.
+void
+ReleaseDecodedImage(DecodedImage& _decoded_image_in_out) noexcept;
+
+struct ImageDecoder
+{
+    ImageDecoder() = default;
+    ~ImageDecoder();
+
+    // Note: Zero selects std::thread::hardware_concurrency() workers.
+    void
+    Start(bool& _success_out, const size_t&& _thread_count_in);
+
+    void
+    Stop() noexcept;
+
+    // Note: Decodes every request, in parallel, and returns once all are decoded;
+    //       `_decoded_images_out` is in the order of `_requests_in`. Fails if any image fails to
+    //       decode, with the images that did decoded all the same. Only these images are
+    //       waited on, such that several threads may decode at once.
+    void
+    DecodeImages(bool&                                  _success_out,
+                 const std::vector<ImageDecodeRequest>& _requests_in,
+                 std::vector<DecodedImage>&             _decoded_images_out);
+
+    size_t
+    GetThreadCount() const noexcept;
+
+  private:
+    ImageDecoder(const ImageDecoder&) = delete;
+
+    ImageDecoder
+    operator=(const ImageDecoder&) = delete;
+
+    JobSystem job_system;
+};
+
+#endif // image_decoding_h
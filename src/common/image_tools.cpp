@@ -14,6 +14,24 @@ LoadImageToMemory(bool&             _success_out,
                   int&              _image_width,
                   int&              _image_height,
                   int&              _image_channels)
+{
+    DecodeImageToMemory(_success_out,
+                        _file_path,
+                        true,
+                        _image_data,
+                        _image_width,
+                        _image_height,
+                        _image_channels);
+}
+
+void
+DecodeImageToMemory(bool&             _success_out,
+                    const char* const _file_path,
+                    const bool&       _flip_vertically_in,
+                    unsigned char**   _image_data,
+                    int&              _image_width,
+                    int&              _image_height,
+                    int&              _image_channels)
 {
     _success_out = true;
 
@@ -44,7 +62,7 @@ LoadImageToMemory(bool&             _success_out,
 
     _image_width = _image_height = _image_channels = 0;
     int width, height, channels = 0;
-    stbi_set_flip_vertically_on_load(true);
+    stbi_set_flip_vertically_on_load_thread(true == _flip_vertically_in);
     *_image_data = stbi_load(_file_path, &width, &height, &channels, STBI_rgb_alpha);
 
     if (0 >= width || 0 >= height || 0 >= channels)
@@ -53,7 +71,8 @@ LoadImageToMemory(bool&             _success_out,
 
         if (nullptr != *_image_data)
         {
-            delete *_image_data;
+            stbi_image_free(*_image_data);
+            *_image_data = nullptr;
         }
 
         _success_out = false;
@@ -1,6 +1,8 @@
 #ifndef image_tools_h
 #define image_tools_h
 
+// Note: Decodes four channels per pixel, rows bottom to top; `_image_channels` is the channel
+//       count of the file. Free the image data with stbi_image_free(...).
 void
 LoadImageToMemory(bool&             _success_out,
                   const char* const _file_path,
@@ -9,4 +11,16 @@ LoadImageToMemory(bool&             _success_out,
                   int&              _image_height,
                   int&              _image_channels);
 
+// Note: As LoadImageToMemory(...), with rows top to bottom unless `_flip_vertically_in` is set.
+//       The setting applies to the calling thread only, such that images may be decoded on many
+//       threads at once.
+void
+DecodeImageToMemory(bool&             _success_out,
+                    const char* const _file_path,
+                    const bool&       _flip_vertically_in,
+                    unsigned char**   _image_data,
+                    int&              _image_width,
+                    int&              _image_height,
+                    int&              _image_channels);
+
 #endif
\ No newline at end of file
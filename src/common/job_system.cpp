@@ -0,0 +1,246 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "job_system.h"
+
+#include "logging.h"
+
+// Note: Identifies the pool and queue of the current thread, so that jobs submitted from within a
+//       job go to the queue of the worker running it.
+static thread_local const JobSystem* current_job_system         = nullptr;
+static thread_local size_t           current_worker_queue_index = 0;
+
+JobSystem::~JobSystem()
+{
+    Stop();
+}
+
+void
+JobSystem::Start(bool& _success_out, const size_t&& _thread_count_in)
+{
+    _success_out = false;
+    if (0 != workers.size())
+    {
+        Log_e("The job system has already been started.");
+        return;
+    }
+
+    size_t thread_count = _thread_count_in;
+    if (0 == thread_count)
+    {
+        thread_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    stopping = false;
+    queues.clear();
+    for (size_t queue_index = 0; queue_index < thread_count; queue_index++)
+    {
+        queues.push_back(std::make_unique<JobQueue>());
+    }
+
+    workers.reserve(thread_count);
+    for (size_t worker_index = 0; worker_index < thread_count; worker_index++)
+    {
+        workers.emplace_back(&JobSystem::RunWorker, this, worker_index);
+    }
+
+    _success_out = true;
+}
+
+void
+JobSystem::Submit(std::function<void()>&& _job_in, JobBatch* const _batch_in_out) noexcept
+{
+    assert(0 != queues.size());
+
+    // Note: Waiters on the batch sleep on `done_condition`, as Wait() does.
+    if (nullptr != _batch_in_out)
+    {
+        _batch_in_out->pending_job_count.fetch_add(1);
+        _job_in = [this, _batch_in_out, job = std::move(_job_in)]()
+        {
+            job();
+            if (1 == _batch_in_out->pending_job_count.fetch_sub(1))
+            {
+                std::lock_guard<std::mutex> wake_lock(wake_mutex);
+                done_condition.notify_all();
+            }
+        };
+    }
+
+    const size_t queue_index = (this == current_job_system)
+                                 ? current_worker_queue_index
+                                 : (next_queue_index.fetch_add(1) % queues.size());
+
+    // Note: The count is raised under the wake mutex, so that a worker checking for jobs before
+    //       going to sleep can not miss the notification, and before the job is queued, so that
+    //       a worker taking the job can not lower it below zero. A worker woken in between finds
+    //       no job and checks again.
+    pending_job_count.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> wake_lock(wake_mutex);
+        queued_job_count.fetch_add(1);
+    }
+
+    {
+        std::lock_guard<std::mutex> queue_lock(queues[queue_index]->mutex);
+        queues[queue_index]->jobs.push_back(std::move(_job_in));
+    }
+    wake_condition.notify_one();
+}
+
+bool
+JobSystem::TryRunJob(const size_t& _home_queue_index_in) noexcept
+{
+    std::function<void()> job;
+    for (size_t queue_offset = 0; queue_offset < queues.size(); queue_offset++)
+    {
+        JobQueue& queue = *queues[(_home_queue_index_in + queue_offset) % queues.size()];
+
+        std::lock_guard<std::mutex> queue_lock(queue.mutex);
+        if (true == queue.jobs.empty())
+        {
+            continue;
+        }
+
+        if (0 == queue_offset)
+        {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+        }
+        else
+        {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+        }
+        break;
+    }
+
+    if (false == static_cast<bool>(job))
+    {
+        return false;
+    }
+
+    queued_job_count.fetch_sub(1);
+    job();
+
+    if (1 == pending_job_count.fetch_sub(1))
+    {
+        std::lock_guard<std::mutex> wake_lock(wake_mutex);
+        done_condition.notify_all();
+    }
+
+    return true;
+}
+
+void
+JobSystem::RunWorker(const size_t _worker_index_in) noexcept
+{
+    current_job_system         = this;
+    current_worker_queue_index = _worker_index_in;
+
+    while (true)
+    {
+        if (true == TryRunJob(_worker_index_in))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> wake_lock(wake_mutex);
+        wake_condition.wait(wake_lock,
+                            [this]() { return (true == stopping) || (0 != queued_job_count); });
+        if ((true == stopping) && (0 == queued_job_count))
+        {
+            return;
+        }
+    }
+}
+
+void
+JobSystem::Wait() noexcept
+{
+    assert(this != current_job_system);
+
+    // Note: The caller helps until the queues are empty, then sleeps until the jobs still
+    //       running on workers complete.
+    while (true == TryRunJob(next_queue_index.fetch_add(1) % std::max<size_t>(1, queues.size())))
+    {
+    }
+
+    std::unique_lock<std::mutex> wake_lock(wake_mutex);
+    done_condition.wait(wake_lock, [this]() { return 0 == pending_job_count; });
+}
+
+void
+JobSystem::Wait(JobBatch& _batch_in_out) noexcept
+{
+    const size_t home_queue_index = (this == current_job_system)
+                                      ? current_worker_queue_index
+                                      : (next_queue_index.fetch_add(1) %
+                                         std::max<size_t>(1, queues.size()));
+    while (0 != _batch_in_out.pending_job_count)
+    {
+        if (true == TryRunJob(home_queue_index))
+        {
+            continue;
+        }
+
+        // Note: The jobs of the batch left are running on other threads.
+        std::unique_lock<std::mutex> wake_lock(wake_mutex);
+        done_condition.wait(wake_lock,
+                            [&_batch_in_out]() { return 0 == _batch_in_out.pending_job_count; });
+    }
+}
+
+void
+JobSystem::Stop() noexcept
+{
+    if (0 == workers.size())
+    {
+        return;
+    }
+
+    Wait();
+    {
+        std::lock_guard<std::mutex> wake_lock(wake_mutex);
+        stopping = true;
+    }
+    wake_condition.notify_all();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    workers.clear();
+    queues.clear();
+}
+
+size_t
+JobSystem::GetThreadCount() const noexcept
+{
+    return workers.size();
+}
+
+void
+RunJobPerIndex(JobSystem* const                          _job_system_in,
+               const size_t&                             _count_in,
+               const std::function<void(const size_t&)>& _function_in)
+{
+    if ((nullptr == _job_system_in) || (1 >= _count_in))
+    {
+        for (size_t index = 0; index < _count_in; index++)
+        {
+            _function_in(index);
+        }
+        return;
+    }
+
+    JobBatch batch;
+    for (size_t index = 0; index < _count_in; index++)
+    {
+        _job_system_in->Submit([&_function_in, index]() { _function_in(index); }, &batch);
+    }
+
+    _job_system_in->Wait(batch);
+}
@@ -0,0 +1,101 @@
+#ifndef job_system_h
+#define job_system_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+//
+// Note: A fixed pool of worker threads, each with its own queue of jobs. A worker runs the most
+//       recently submitted job of its own queue first, which keeps the data of nested jobs warm
+//       in its cache, and steals the oldest job of another queue when its own is empty. Jobs
+//       submitted from outside the pool are spread over the queues in turn.
+//
+//       Jobs must not throw. A job may submit further jobs, and may wait on a JobBatch of them,
+//       but must not call Wait().
+//
+//       Jobs submitted with a JobBatch may be waited on alone, such that a caller sharing the
+//       pool with unrelated work does not wait on that work as well:
+//
+//       JobBatch batch;
+//       job_system.Submit([]() { ... }, &batch);
+//       job_system.Wait(batch);
+//
+
+// Note: Counts the jobs submitted with it that have not completed. Must outlive them.
+struct JobBatch
+{
+    std::atomic<size_t> pending_job_count = 0;
+};
+
+struct JobSystem
+{
+    JobSystem() = default;
+    ~JobSystem();
+
+    // Note: Zero selects std::thread::hardware_concurrency().
+    void
+    Start(bool& _success_out, const size_t&& _thread_count_in);
+
+    void
+    Submit(std::function<void()>&& _job_in, JobBatch* const _batch_in_out = nullptr) noexcept;
+
+    // Note: Runs jobs on the calling thread until every submitted job has completed.
+    void
+    Wait() noexcept;
+
+    // Note: Runs jobs on the calling thread, which may be a worker, until every job of
+    //       `_batch_in_out` has completed. Jobs of other batches may be run while waiting.
+    void
+    Wait(JobBatch& _batch_in_out) noexcept;
+
+    // Note: Waits for submitted jobs, then joins the workers.
+    void
+    Stop() noexcept;
+
+    size_t
+    GetThreadCount() const noexcept;
+
+  private:
+    struct JobQueue
+    {
+        std::mutex                        mutex;
+        std::deque<std::function<void()>> jobs;
+    };
+
+    bool
+    TryRunJob(const size_t& _home_queue_index_in) noexcept;
+
+    void
+    RunWorker(const size_t _worker_index_in) noexcept;
+
+    JobSystem(const JobSystem&) = delete;
+
+    JobSystem
+    operator=(const JobSystem&) = delete;
+
+    std::vector<std::thread>               workers;
+    std::vector<std::unique_ptr<JobQueue>> queues;
+
+    // Note: `queued_job_count` counts jobs waiting in a queue; `pending_job_count` counts jobs
+    //       that are queued or running.
+    std::atomic<size_t> queued_job_count  = 0;
+    std::atomic<size_t> pending_job_count = 0;
+    std::atomic<size_t> next_queue_index  = 0;
+
+    std::mutex              wake_mutex;
+    std::condition_variable wake_condition;
+    std::condition_variable done_condition;
+    bool                    stopping = false;
+};
+
+// Note: Runs `_function_in(index)` for every index below `_count_in`, one job each on
+//       `_job_system_in`, and returns once all have run; other jobs of the pool are not waited
+//       on, and it may be called from a job of `_job_system_in`. When `_job_system_in` is null,
+//       or there is one index, the calling thread runs them in turn.
+void
+RunJobPerIndex(JobSystem* const                          _job_system_in,
+               const size_t&                             _count_in,
+               const std::function<void(const size_t&)>& _function_in);
+
+#endif // job_system_h
@@ -109,6 +109,10 @@ Log::_Log(const LogType&&      lt,
         file_line_tag << spacing << _file << ':' << _line;
         message << file_line_tag.str().c_str();
     }
+    // Note: std::ctime(...) returns a shared buffer, and messages from job system workers must
+    //       not interleave.
+    static std::mutex           log_mutex;
+    std::lock_guard<std::mutex> log_lock(log_mutex);
     message << spacing << std::ctime(&time_point) << std::endl;
     std::fprintf(output_dest, "%s", message.str().c_str());
     std::fflush(output_dest);
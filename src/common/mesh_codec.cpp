@@ -0,0 +1,892 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "mesh_codec.h"
+
+#include "logging.h"
+
+constexpr size_t vertex_codec_group_size = 16;
+constexpr size_t vertex_codec_max_group_count = vertex_codec_block_vertex_count /
+                                                vertex_codec_group_size;
+
+// Note: Bytes of packed data in a group of each width code: 0, 2, 4 and 8 bits per value.
+constexpr size_t vertex_codec_group_size_bytes[4] = { 0, 4, 8, 16 };
+
+// Note: Codes in the high nibble of a triangle are edges, most recent first, or no edge. Codes
+//       in a low nibble are vertices: the next unseen vertex, one of the most recent vertices,
+//       or an explicit difference.
+constexpr size_t        index_codec_fifo_size        = 16;
+constexpr unsigned char index_codec_no_edge          = 15;
+constexpr unsigned char index_codec_next_vertex      = 0;
+constexpr unsigned char index_codec_explicit_vertex  = 15;
+constexpr size_t        index_codec_max_varint_bytes = 5;
+
+static_assert(0 == (vertex_codec_block_vertex_count % vertex_codec_group_size),
+              "Vertex codec blocks must hold whole groups.");
+static_assert(0 == (index_codec_fifo_size & (index_codec_fifo_size - 1)),
+              "Index codec FIFOs are indexed with a mask.");
+
+static inline unsigned char
+ZigzagByte(const unsigned char _delta_in) noexcept
+{
+    return static_cast<unsigned char>((_delta_in << 1) ^
+                                      static_cast<unsigned char>(
+                                        static_cast<signed char>(_delta_in) >> 7));
+}
+
+static inline unsigned char
+UnzigzagByte(const unsigned char _value_in) noexcept
+{
+    return static_cast<unsigned char>((_value_in >> 1) ^ (0 - (_value_in & 1)));
+}
+
+// Note: Unpacks a group of `_width_code_in` to 16 zigzag coded differences.
+static inline void
+UnpackVertexGroup(const unsigned char* const _input_in,
+                  const unsigned int&        _width_code_in,
+                  unsigned char* const       _values_out) noexcept
+{
+    switch (_width_code_in)
+    {
+        case 0:
+        {
+            std::memset(_values_out, 0, vertex_codec_group_size);
+            break;
+        }
+        case 1:
+        {
+            for (size_t byte_index = 0; byte_index < 4; byte_index++)
+            {
+                const unsigned char packed         = _input_in[byte_index];
+                _values_out[(byte_index * 4)]     = (packed >> 6) & 3;
+                _values_out[(byte_index * 4) + 1] = (packed >> 4) & 3;
+                _values_out[(byte_index * 4) + 2] = (packed >> 2) & 3;
+                _values_out[(byte_index * 4) + 3] = packed & 3;
+            }
+            break;
+        }
+        case 2:
+        {
+            for (size_t byte_index = 0; byte_index < 8; byte_index++)
+            {
+                const unsigned char packed         = _input_in[byte_index];
+                _values_out[(byte_index * 2)]     = packed >> 4;
+                _values_out[(byte_index * 2) + 1] = packed & 15;
+            }
+            break;
+        }
+        default:
+        {
+            std::memcpy(_values_out, _input_in, vertex_codec_group_size);
+            break;
+        }
+    }
+}
+
+#if defined(_ENGINE_SIMD_SSE_)
+// Note: As UnpackVertexGroup(...), followed by the prefix sum of the differences on top of
+//       `_carry_in` (the previous value, in every lane).
+static inline __m128i
+DecodeVertexGroupSse(const unsigned char* const _input_in,
+                     const unsigned int&        _width_code_in,
+                     const __m128i&             _carry_in) noexcept
+{
+    __m128i values;
+    switch (_width_code_in)
+    {
+        case 0:
+        {
+            return _carry_in;
+        }
+        case 1:
+        {
+            int32_t packed;
+            std::memcpy(&packed, _input_in, sizeof(packed));
+            const __m128i bytes   = _mm_cvtsi32_si128(packed);
+            const __m128i mask    = _mm_set1_epi8(3);
+            const __m128i first   = _mm_and_si128(_mm_srli_epi16(bytes, 6), mask);
+            const __m128i second  = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+            const __m128i third   = _mm_and_si128(_mm_srli_epi16(bytes, 2), mask);
+            const __m128i fourth  = _mm_and_si128(bytes, mask);
+            values                = _mm_unpacklo_epi16(_mm_unpacklo_epi8(first, second),
+                                        _mm_unpacklo_epi8(third, fourth));
+            break;
+        }
+        case 2:
+        {
+            const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_input_in));
+            const __m128i mask  = _mm_set1_epi8(15);
+            values              = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask),
+                                       _mm_and_si128(bytes, mask));
+            break;
+        }
+        default:
+        {
+            values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_input_in));
+            break;
+        }
+    }
+
+    // Note: Unzigzag; SSE has no byte shifts, so bits shifted in from the neighbouring byte are
+    //       masked off.
+    const __m128i one = _mm_set1_epi8(1);
+    values = _mm_xor_si128(_mm_and_si128(_mm_srli_epi16(values, 1), _mm_set1_epi8(0x7F)),
+                           _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(values, one)));
+
+    values = _mm_add_epi8(values, _mm_slli_si128(values, 1));
+    values = _mm_add_epi8(values, _mm_slli_si128(values, 2));
+    values = _mm_add_epi8(values, _mm_slli_si128(values, 4));
+    values = _mm_add_epi8(values, _mm_slli_si128(values, 8));
+    return _mm_add_epi8(values, _carry_in);
+}
+
+// Note: The last byte of `_values_in` in every lane.
+static inline __m128i
+BroadcastLastByte(const __m128i& _values_in) noexcept
+{
+    const __m128i high_words = _mm_shufflehi_epi16(_mm_unpackhi_epi8(_values_in, _values_in),
+                                                   0xFF);
+    return _mm_shuffle_epi32(high_words, 0xFF);
+}
+
+// Note: Transposes a 16x16 matrix of bytes, one row per register.
+static inline void
+TransposeBytes16x16(__m128i (&_rows_in_out)[16]) noexcept
+{
+    __m128i pairs[16];
+    for (size_t row = 0; row < 8; row++)
+    {
+        pairs[row]     = _mm_unpacklo_epi8(_rows_in_out[2 * row], _rows_in_out[(2 * row) + 1]);
+        pairs[row + 8] = _mm_unpackhi_epi8(_rows_in_out[2 * row], _rows_in_out[(2 * row) + 1]);
+    }
+
+    // Note: quads[(4 * column_block) + row_block] holds rows 4 * row_block onwards of columns
+    //       4 * column_block onwards.
+    __m128i quads[16];
+    for (size_t row_block = 0; row_block < 4; row_block++)
+    {
+        const __m128i& low_first   = pairs[2 * row_block];
+        const __m128i& low_second  = pairs[(2 * row_block) + 1];
+        const __m128i& high_first  = pairs[8 + (2 * row_block)];
+        const __m128i& high_second = pairs[8 + (2 * row_block) + 1];
+        quads[row_block]           = _mm_unpacklo_epi16(low_first, low_second);
+        quads[4 + row_block]       = _mm_unpackhi_epi16(low_first, low_second);
+        quads[8 + row_block]       = _mm_unpacklo_epi16(high_first, high_second);
+        quads[12 + row_block]      = _mm_unpackhi_epi16(high_first, high_second);
+    }
+
+    // Note: octets[(4 * column_block) + (2 * row_half) + column_half] holds rows 8 * row_half
+    //       onwards of columns (4 * column_block) + (2 * column_half) onwards.
+    __m128i octets[16];
+    for (size_t column_block = 0; column_block < 4; column_block++)
+    {
+        for (size_t row_half = 0; row_half < 2; row_half++)
+        {
+            const __m128i& first  = quads[(4 * column_block) + (2 * row_half)];
+            const __m128i& second = quads[(4 * column_block) + (2 * row_half) + 1];
+            octets[(4 * column_block) + (2 * row_half)]     = _mm_unpacklo_epi32(first, second);
+            octets[(4 * column_block) + (2 * row_half) + 1] = _mm_unpackhi_epi32(first, second);
+        }
+    }
+
+    for (size_t column_block = 0; column_block < 4; column_block++)
+    {
+        for (size_t column_half = 0; column_half < 2; column_half++)
+        {
+            const __m128i& first  = octets[(4 * column_block) + column_half];
+            const __m128i& second = octets[(4 * column_block) + 2 + column_half];
+            _rows_in_out[(4 * column_block) + (2 * column_half)]     = _mm_unpacklo_epi64(first,
+                                                                                      second);
+            _rows_in_out[(4 * column_block) + (2 * column_half) + 1] = _mm_unpackhi_epi64(first,
+                                                                                      second);
+        }
+    }
+}
+#endif // _ENGINE_SIMD_SSE_
+
+void
+EncodeVertexBuffer(bool&                       _success_out,
+                   const void* const           _vertex_data_in,
+                   const size_t&               _vertex_count_in,
+                   const size_t&               _vertex_size_bytes_in,
+                   std::vector<unsigned char>& _encoded_data_out)
+{
+    _success_out = false;
+    _encoded_data_out.clear();
+
+    if ((0 == _vertex_size_bytes_in) || (vertex_codec_max_vertex_size < _vertex_size_bytes_in))
+    {
+        std::stringstream ss;
+        ss << "Unable to encode vertices of " << _vertex_size_bytes_in << " bytes; at most "
+           << vertex_codec_max_vertex_size << " are supported.";
+        Log_e(ss);
+        return;
+    }
+
+    const unsigned char* const vertex_data = static_cast<const unsigned char*>(_vertex_data_in);
+    _encoded_data_out.reserve(_vertex_count_in * _vertex_size_bytes_in);
+
+    unsigned char previous_vertex[vertex_codec_max_vertex_size] = { 0 };
+    unsigned char values[vertex_codec_block_vertex_count];
+    for (size_t first_vertex = 0; first_vertex < _vertex_count_in;
+         first_vertex += vertex_codec_block_vertex_count)
+    {
+        const size_t block_vertex_count = std::min(vertex_codec_block_vertex_count,
+                                                   _vertex_count_in - first_vertex);
+        const size_t group_count        = (block_vertex_count + vertex_codec_group_size - 1) /
+                                   vertex_codec_group_size;
+
+        for (size_t byte_index = 0; byte_index < _vertex_size_bytes_in; byte_index++)
+        {
+            unsigned char previous = previous_vertex[byte_index];
+            for (size_t vertex_index = 0; vertex_index < block_vertex_count; vertex_index++)
+            {
+                const unsigned char current = vertex_data[((first_vertex + vertex_index) *
+                                                           _vertex_size_bytes_in) +
+                                                          byte_index];
+                values[vertex_index] = ZigzagByte(static_cast<unsigned char>(current - previous));
+                previous             = current;
+            }
+
+            std::memset(values + block_vertex_count,
+                        0,
+                        (group_count * vertex_codec_group_size) - block_vertex_count);
+            previous_vertex[byte_index] = previous;
+
+            const size_t header_offset = _encoded_data_out.size();
+            _encoded_data_out.resize(header_offset + ((group_count + 3) / 4), 0);
+            for (size_t group_index = 0; group_index < group_count; group_index++)
+            {
+                const unsigned char* const group = values + (group_index * vertex_codec_group_size);
+
+                unsigned char combined = 0;
+                for (size_t value_index = 0; value_index < vertex_codec_group_size; value_index++)
+                {
+                    combined |= group[value_index];
+                }
+
+                const unsigned int width_code = (0 == combined)    ? 0
+                                                : (4 > combined)  ? 1
+                                                : (16 > combined) ? 2
+                                                                  : 3;
+                _encoded_data_out[header_offset + (group_index / 4)] |= static_cast<unsigned char>(
+                  width_code << ((group_index % 4) * 2));
+
+                switch (width_code)
+                {
+                    case 1:
+                    {
+                        for (size_t byte = 0; byte < 4; byte++)
+                        {
+                            _encoded_data_out.push_back(
+                              static_cast<unsigned char>((group[byte * 4] << 6) |
+                                                         (group[(byte * 4) + 1] << 4) |
+                                                         (group[(byte * 4) + 2] << 2) |
+                                                         group[(byte * 4) + 3]));
+                        }
+                        break;
+                    }
+                    case 2:
+                    {
+                        for (size_t byte = 0; byte < 8; byte++)
+                        {
+                            _encoded_data_out.push_back(static_cast<unsigned char>(
+                              (group[byte * 2] << 4) | group[(byte * 2) + 1]));
+                        }
+                        break;
+                    }
+                    case 3:
+                    {
+                        _encoded_data_out.insert(_encoded_data_out.end(),
+                                                 group,
+                                                 group + vertex_codec_group_size);
+                        break;
+                    }
+                    default:
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    _success_out = true;
+}
+
+void
+DecodeVertexBuffer(bool&                      _success_out,
+                   const unsigned char* const _encoded_data_in,
+                   const size_t&              _encoded_size_bytes_in,
+                   const size_t&              _vertex_count_in,
+                   const size_t&              _vertex_size_bytes_in,
+                   void* const                _vertex_data_out)
+{
+    _success_out = false;
+
+    if ((0 == _vertex_size_bytes_in) || (vertex_codec_max_vertex_size < _vertex_size_bytes_in))
+    {
+        Log_e("Unable to decode vertices; unsupported vertex size.");
+        return;
+    }
+
+    unsigned char* const       vertex_data = static_cast<unsigned char*>(_vertex_data_out);
+    const unsigned char*       input       = _encoded_data_in;
+    const unsigned char* const input_end   = _encoded_data_in + _encoded_size_bytes_in;
+
+    // Note: Each plane of a block is decoded into a row of `planes`, then transposed into the
+    //       vertices.
+    std::vector<unsigned char> planes(_vertex_size_bytes_in * vertex_codec_block_vertex_count);
+    unsigned char              previous_vertex[vertex_codec_max_vertex_size] = { 0 };
+    for (size_t first_vertex = 0; first_vertex < _vertex_count_in;
+         first_vertex += vertex_codec_block_vertex_count)
+    {
+        const size_t block_vertex_count = std::min(vertex_codec_block_vertex_count,
+                                                   _vertex_count_in - first_vertex);
+        const size_t group_count        = (block_vertex_count + vertex_codec_group_size - 1) /
+                                   vertex_codec_group_size;
+        const size_t header_size_bytes  = (group_count + 3) / 4;
+
+        for (size_t byte_index = 0; byte_index < _vertex_size_bytes_in; byte_index++)
+        {
+            if (header_size_bytes > static_cast<size_t>(input_end - input))
+            {
+                Log_e("Encoded vertex data is truncated.");
+                return;
+            }
+
+            const unsigned char* const header = input;
+            input += header_size_bytes;
+
+            unsigned int width_codes[vertex_codec_max_group_count];
+            size_t       data_size_bytes = 0;
+            for (size_t group_index = 0; group_index < group_count; group_index++)
+            {
+                width_codes[group_index] = (header[group_index / 4] >> ((group_index % 4) * 2)) & 3;
+                data_size_bytes += vertex_codec_group_size_bytes[width_codes[group_index]];
+            }
+
+            if (data_size_bytes > static_cast<size_t>(input_end - input))
+            {
+                Log_e("Encoded vertex data is truncated.");
+                return;
+            }
+
+            unsigned char* const plane = planes.data() +
+                                         (byte_index * vertex_codec_block_vertex_count);
+#if defined(_ENGINE_SIMD_SSE_)
+            __m128i carry = _mm_set1_epi8(static_cast<char>(previous_vertex[byte_index]));
+            for (size_t group_index = 0; group_index < group_count; group_index++)
+            {
+                const __m128i values = DecodeVertexGroupSse(input,
+                                                            width_codes[group_index],
+                                                            carry);
+                _mm_storeu_si128(
+                  reinterpret_cast<__m128i*>(plane + (group_index * vertex_codec_group_size)),
+                  values);
+                carry = BroadcastLastByte(values);
+                input += vertex_codec_group_size_bytes[width_codes[group_index]];
+            }
+#else
+            unsigned char previous = previous_vertex[byte_index];
+            for (size_t group_index = 0; group_index < group_count; group_index++)
+            {
+                unsigned char* const group = plane + (group_index * vertex_codec_group_size);
+                UnpackVertexGroup(input, width_codes[group_index], group);
+                for (size_t value_index = 0; value_index < vertex_codec_group_size; value_index++)
+                {
+                    previous           = static_cast<unsigned char>(previous +
+                                                          UnzigzagByte(group[value_index]));
+                    group[value_index] = previous;
+                }
+                input += vertex_codec_group_size_bytes[width_codes[group_index]];
+            }
+#endif // _ENGINE_SIMD_SSE_
+
+            previous_vertex[byte_index] = plane[block_vertex_count - 1];
+        }
+
+        // Note: Whole groups of 16 vertices are transposed 16 bytes at a time. The last tile of
+        //       a vertex overlaps the one before it when the vertex size is not a multiple of 16.
+        size_t transposed_vertex_count = 0;
+#if defined(_ENGINE_SIMD_SSE_)
+        if (vertex_codec_group_size <= _vertex_size_bytes_in)
+        {
+            transposed_vertex_count = block_vertex_count & ~(vertex_codec_group_size - 1);
+            for (size_t group_first_vertex = 0; group_first_vertex < transposed_vertex_count;
+                 group_first_vertex += vertex_codec_group_size)
+            {
+                for (size_t tile_byte = 0; tile_byte < _vertex_size_bytes_in;
+                     tile_byte += vertex_codec_group_size)
+                {
+                    const size_t first_byte = std::min(tile_byte,
+                                                       _vertex_size_bytes_in -
+                                                         vertex_codec_group_size);
+
+                    __m128i rows[16];
+                    for (size_t row = 0; row < 16; row++)
+                    {
+                        rows[row] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                          planes.data() + ((first_byte + row) * vertex_codec_block_vertex_count) +
+                          group_first_vertex));
+                    }
+
+                    TransposeBytes16x16(rows);
+                    for (size_t row = 0; row < 16; row++)
+                    {
+                        _mm_storeu_si128(
+                          reinterpret_cast<__m128i*>(
+                            vertex_data +
+                            ((first_vertex + group_first_vertex + row) * _vertex_size_bytes_in) +
+                            first_byte),
+                          rows[row]);
+                    }
+                }
+            }
+        }
+#endif // _ENGINE_SIMD_SSE_
+
+        for (size_t vertex_index = transposed_vertex_count; vertex_index < block_vertex_count;
+             vertex_index++)
+        {
+            unsigned char* const vertex = vertex_data +
+                                          ((first_vertex + vertex_index) * _vertex_size_bytes_in);
+            for (size_t byte_index = 0; byte_index < _vertex_size_bytes_in; byte_index++)
+            {
+                vertex[byte_index] = planes[(byte_index * vertex_codec_block_vertex_count) +
+                                            vertex_index];
+            }
+        }
+    }
+
+    if (input != input_end)
+    {
+        Log_e("Encoded vertex data is longer than expected.");
+        return;
+    }
+
+    _success_out = true;
+}
+
+// Note: The state the index encoder and decoder keep in step.
+struct IndexCodecState
+{
+    GLuint edges[index_codec_fifo_size][2];
+    size_t edge_offset = 0;
+
+    GLuint vertices[index_codec_fifo_size];
+    size_t vertex_offset = 0;
+
+    GLuint next_vertex = 0;
+    GLuint last_vertex = 0;
+
+    // Note: Slots that were never written hold an index no mesh can use, and fail validation
+    //       when malformed data refers to them.
+    IndexCodecState() noexcept
+    {
+        std::fill(&edges[0][0], &edges[0][0] + (2 * index_codec_fifo_size), ~GLuint(0));
+        std::fill(vertices, vertices + index_codec_fifo_size, ~GLuint(0));
+    }
+};
+
+static inline void
+PushIndexCodecEdge(IndexCodecState& _state_in_out,
+                   const GLuint&    _first_in,
+                   const GLuint&    _second_in) noexcept
+{
+    GLuint* const edge = _state_in_out.edges[_state_in_out.edge_offset &
+                                             (index_codec_fifo_size - 1)];
+    edge[0]            = _first_in;
+    edge[1]            = _second_in;
+    _state_in_out.edge_offset++;
+}
+
+static inline void
+PushIndexCodecVertex(IndexCodecState& _state_in_out, const GLuint& _vertex_in) noexcept
+{
+    _state_in_out.vertices[_state_in_out.vertex_offset & (index_codec_fifo_size - 1)] = _vertex_in;
+    _state_in_out.vertex_offset++;
+}
+
+// Note: Edges are recorded as the neighbouring triangle with the same winding walks them.
+static inline void
+PushIndexCodecTriangle(IndexCodecState& _state_in_out,
+                       const GLuint&    _first_in,
+                       const GLuint&    _second_in,
+                       const GLuint&    _third_in,
+                       const bool&&     _first_edge_is_shared_in) noexcept
+{
+    if (false == _first_edge_is_shared_in)
+    {
+        PushIndexCodecEdge(_state_in_out, _second_in, _first_in);
+    }
+
+    PushIndexCodecEdge(_state_in_out, _third_in, _second_in);
+    PushIndexCodecEdge(_state_in_out, _first_in, _third_in);
+}
+
+// Note: Returns the code of `_vertex_in`, updating the state as the decoder will.
+static inline unsigned char
+EncodeIndexCodecVertex(IndexCodecState& _state_in_out, const GLuint& _vertex_in) noexcept
+{
+    if (_vertex_in == _state_in_out.next_vertex)
+    {
+        _state_in_out.next_vertex++;
+        PushIndexCodecVertex(_state_in_out, _vertex_in);
+        return index_codec_next_vertex;
+    }
+
+    for (size_t fifo_index = 0; fifo_index < (index_codec_explicit_vertex - 1); fifo_index++)
+    {
+        if (_vertex_in == _state_in_out.vertices[(_state_in_out.vertex_offset - 1 - fifo_index) &
+                                                 (index_codec_fifo_size - 1)])
+        {
+            return static_cast<unsigned char>(fifo_index + 1);
+        }
+    }
+
+    if (_vertex_in >= _state_in_out.next_vertex)
+    {
+        _state_in_out.next_vertex = _vertex_in + 1;
+    }
+
+    PushIndexCodecVertex(_state_in_out, _vertex_in);
+    return index_codec_explicit_vertex;
+}
+
+static inline void
+WriteIndexCodecVarint(std::vector<unsigned char>& _encoded_data_in_out,
+                      const GLuint&               _vertex_in,
+                      GLuint&                     _last_vertex_in_out)
+{
+    const int32_t delta  = static_cast<int32_t>(_vertex_in - _last_vertex_in_out);
+    uint32_t      zigzag = (static_cast<uint32_t>(delta) << 1) ^
+                           static_cast<uint32_t>(delta >> 31);
+    _last_vertex_in_out  = _vertex_in;
+    while (0x80 <= zigzag)
+    {
+        _encoded_data_in_out.push_back(static_cast<unsigned char>(zigzag | 0x80));
+        zigzag >>= 7;
+    }
+
+    _encoded_data_in_out.push_back(static_cast<unsigned char>(zigzag));
+}
+
+void
+EncodeIndexBuffer(bool&                       _success_out,
+                  const std::vector<GLuint>&  _elements_in,
+                  std::vector<unsigned char>& _encoded_data_out)
+{
+    _success_out = false;
+    _encoded_data_out.clear();
+
+    if (0 != (_elements_in.size() % 3))
+    {
+        Log_e("Unable to encode elements; meshes must be triangulated.");
+        return;
+    }
+
+    _encoded_data_out.reserve(_elements_in.size());
+
+    IndexCodecState state;
+    for (size_t first_element = 0; first_element < _elements_in.size(); first_element += 3)
+    {
+        const GLuint* const triangle = &_elements_in[first_element];
+
+        // Note: Finds the most recent edge shared with this triangle, in any of its rotations.
+        size_t edge_code = index_codec_no_edge;
+        size_t rotation  = 0;
+        for (size_t fifo_index = 0; (fifo_index < index_codec_no_edge) &&
+                                    (index_codec_no_edge == edge_code);
+             fifo_index++)
+        {
+            const GLuint* const edge = state.edges[(state.edge_offset - 1 - fifo_index) &
+                                                   (index_codec_fifo_size - 1)];
+            for (size_t corner = 0; corner < 3; corner++)
+            {
+                if ((edge[0] == triangle[corner]) && (edge[1] == triangle[(corner + 1) % 3]))
+                {
+                    edge_code = fifo_index;
+                    rotation  = corner;
+                    break;
+                }
+            }
+        }
+
+        const GLuint first  = triangle[rotation];
+        const GLuint second = triangle[(rotation + 1) % 3];
+        const GLuint third  = triangle[(rotation + 2) % 3];
+
+        if (index_codec_no_edge != edge_code)
+        {
+            const unsigned char third_code = EncodeIndexCodecVertex(state, third);
+            _encoded_data_out.push_back(static_cast<unsigned char>((edge_code << 4) | third_code));
+            if (index_codec_explicit_vertex == third_code)
+            {
+                WriteIndexCodecVarint(_encoded_data_out, third, state.last_vertex);
+            }
+
+            PushIndexCodecTriangle(state, first, second, third, true);
+            continue;
+        }
+
+        const unsigned char first_code  = EncodeIndexCodecVertex(state, first);
+        const unsigned char second_code = EncodeIndexCodecVertex(state, second);
+        const unsigned char third_code  = EncodeIndexCodecVertex(state, third);
+        _encoded_data_out.push_back(static_cast<unsigned char>((index_codec_no_edge << 4) |
+                                                               first_code));
+        _encoded_data_out.push_back(static_cast<unsigned char>((second_code << 4) | third_code));
+
+        const GLuint        vertices[3] = { first, second, third };
+        const unsigned char codes[3]    = { first_code, second_code, third_code };
+        for (size_t corner = 0; corner < 3; corner++)
+        {
+            if (index_codec_explicit_vertex == codes[corner])
+            {
+                WriteIndexCodecVarint(_encoded_data_out, vertices[corner], state.last_vertex);
+            }
+        }
+
+        PushIndexCodecTriangle(state, first, second, third, false);
+    }
+
+    _success_out = true;
+}
+
+// Note: Returns false when the input ends before the varint does, or it overflows 32 bits.
+static inline bool
+ReadIndexCodecVarint(const unsigned char*&      _input_in_out,
+                     const unsigned char* const _input_end_in,
+                     GLuint&                    _last_vertex_in_out,
+                     GLuint&                    _vertex_out) noexcept
+{
+    uint32_t zigzag = 0;
+    for (size_t byte_index = 0; byte_index < index_codec_max_varint_bytes; byte_index++)
+    {
+        if (_input_in_out == _input_end_in)
+        {
+            return false;
+        }
+
+        const unsigned char byte = *_input_in_out++;
+        zigzag |= static_cast<uint32_t>(byte & 0x7F) << (7 * byte_index);
+        if (0 == (byte & 0x80))
+        {
+            const uint32_t delta = (zigzag >> 1) ^ (0 - (zigzag & 1));
+            _vertex_out          = _last_vertex_in_out + delta;
+            _last_vertex_in_out  = _vertex_out;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Note: Returns the vertex of `_code_in`, updating the state as the encoder did.
+static inline bool
+DecodeIndexCodecVertex(IndexCodecState&           _state_in_out,
+                       const unsigned char&       _code_in,
+                       const unsigned char*&      _input_in_out,
+                       const unsigned char* const _input_end_in,
+                       GLuint&                    _vertex_out) noexcept
+{
+    // Note: Next and recent vertices are both common, in no predictable order; they are told
+    //       apart without a branch. A recent vertex is pushed to the slot the next push
+    //       overwrites, and the offset left unchanged.
+    if (index_codec_explicit_vertex != _code_in)
+    {
+        const bool   is_next_vertex = (index_codec_next_vertex == _code_in);
+        const GLuint recent_vertex  = _state_in_out.vertices[(_state_in_out.vertex_offset -
+                                                             _code_in) &
+                                                            (index_codec_fifo_size - 1)];
+        _vertex_out = (true == is_next_vertex) ? _state_in_out.next_vertex : recent_vertex;
+        _state_in_out.vertices[_state_in_out.vertex_offset & (index_codec_fifo_size - 1)] =
+          _vertex_out;
+        _state_in_out.next_vertex += static_cast<GLuint>(is_next_vertex);
+        _state_in_out.vertex_offset += static_cast<size_t>(is_next_vertex);
+        return true;
+    }
+
+    if (false == ReadIndexCodecVarint(_input_in_out,
+                                      _input_end_in,
+                                      _state_in_out.last_vertex,
+                                      _vertex_out))
+    {
+        return false;
+    }
+
+    if (_vertex_out >= _state_in_out.next_vertex)
+    {
+        _state_in_out.next_vertex = _vertex_out + 1;
+    }
+
+    PushIndexCodecVertex(_state_in_out, _vertex_out);
+    return true;
+}
+
+static inline void
+StoreTriangle(void* const    _element_data_out,
+              const GLenum&  _element_data_type_in,
+              const size_t&  _first_element_in,
+              const GLuint&  _first_in,
+              const GLuint&  _second_in,
+              const GLuint&  _third_in) noexcept
+{
+    switch (_element_data_type_in)
+    {
+        case GL_UNSIGNED_BYTE:
+        {
+            GLubyte* const elements = static_cast<GLubyte*>(_element_data_out) + _first_element_in;
+            elements[0]             = static_cast<GLubyte>(_first_in);
+            elements[1]             = static_cast<GLubyte>(_second_in);
+            elements[2]             = static_cast<GLubyte>(_third_in);
+            break;
+        }
+        case GL_UNSIGNED_SHORT:
+        {
+            GLushort* const elements = static_cast<GLushort*>(_element_data_out) +
+                                       _first_element_in;
+            elements[0]              = static_cast<GLushort>(_first_in);
+            elements[1]              = static_cast<GLushort>(_second_in);
+            elements[2]              = static_cast<GLushort>(_third_in);
+            break;
+        }
+        default:
+        {
+            GLuint* const elements = static_cast<GLuint*>(_element_data_out) + _first_element_in;
+            elements[0]            = _first_in;
+            elements[1]            = _second_in;
+            elements[2]            = _third_in;
+            break;
+        }
+    }
+}
+
+void
+DecodeIndexBuffer(bool&                      _success_out,
+                  const unsigned char* const _encoded_data_in,
+                  const size_t&              _encoded_size_bytes_in,
+                  const size_t&              _element_count_in,
+                  const size_t&              _vertex_count_in,
+                  const GLenum&&             _element_data_type_in,
+                  void* const                _element_data_out)
+{
+    _success_out = false;
+
+    size_t max_vertex_count = 0;
+    switch (_element_data_type_in)
+    {
+        case GL_UNSIGNED_BYTE:
+        {
+            max_vertex_count = static_cast<size_t>(std::numeric_limits<GLubyte>::max()) + 1;
+            break;
+        }
+        case GL_UNSIGNED_SHORT:
+        {
+            max_vertex_count = static_cast<size_t>(std::numeric_limits<GLushort>::max()) + 1;
+            break;
+        }
+        case GL_UNSIGNED_INT:
+        {
+            max_vertex_count = static_cast<size_t>(std::numeric_limits<GLuint>::max()) + 1;
+            break;
+        }
+        default:
+        {
+            Log_e("Unable to decode elements; unsupported element data type.");
+            return;
+        }
+    }
+
+    if ((0 != (_element_count_in % 3)) || (max_vertex_count < _vertex_count_in))
+    {
+        Log_e("Unable to decode elements; the element count or type does not fit the mesh.");
+        return;
+    }
+
+    const unsigned char*       input     = _encoded_data_in;
+    const unsigned char* const input_end = _encoded_data_in + _encoded_size_bytes_in;
+
+    IndexCodecState state;
+    for (size_t first_element = 0; first_element < _element_count_in; first_element += 3)
+    {
+        if (input == input_end)
+        {
+            Log_e("Encoded element data is truncated.");
+            return;
+        }
+
+        const unsigned char code      = *input++;
+        const unsigned char edge_code = code >> 4;
+
+        GLuint first;
+        GLuint second;
+        GLuint third;
+        bool   decoded = true;
+        if (index_codec_no_edge != edge_code)
+        {
+            const GLuint* const edge = state.edges[(state.edge_offset - 1 - edge_code) &
+                                                   (index_codec_fifo_size - 1)];
+            first                    = edge[0];
+            second                   = edge[1];
+            decoded                  = DecodeIndexCodecVertex(state,
+                                             static_cast<unsigned char>(code & 15),
+                                             input,
+                                             input_end,
+                                             third);
+        }
+        else
+        {
+            if (input == input_end)
+            {
+                Log_e("Encoded element data is truncated.");
+                return;
+            }
+
+            const unsigned char codes = *input++;
+            decoded = DecodeIndexCodecVertex(state,
+                                             static_cast<unsigned char>(code & 15),
+                                             input,
+                                             input_end,
+                                             first) &&
+                      DecodeIndexCodecVertex(state,
+                                             static_cast<unsigned char>(codes >> 4),
+                                             input,
+                                             input_end,
+                                             second) &&
+                      DecodeIndexCodecVertex(state,
+                                             static_cast<unsigned char>(codes & 15),
+                                             input,
+                                             input_end,
+                                             third);
+        }
+
+        if ((false == decoded) || (first >= _vertex_count_in) || (second >= _vertex_count_in) ||
+            (third >= _vertex_count_in))
+        {
+            Log_e("Encoded element data is malformed.");
+            return;
+        }
+
+        StoreTriangle(_element_data_out,
+                      _element_data_type_in,
+                      first_element,
+                      first,
+                      second,
+                      third);
+        PushIndexCodecTriangle(state,
+                               first,
+                               second,
+                               third,
+                               (index_codec_no_edge != edge_code));
+    }
+
+    if (input != input_end)
+    {
+        Log_e("Encoded element data is longer than expected.");
+        return;
+    }
+
+    _success_out = true;
+}
@@ -0,0 +1,65 @@
+#ifndef mesh_codec_h
+#define mesh_codec_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+//
+// Note: Lossless compression of vertex and element buffers, used by cooked meshes (see
+//       cooked_mesh.h) to cut the bytes read from slow asset stores. Both decoders write
+//       straight into caller memory, such as the buffers handed to glt::GLBufferStore, and make a
+//       single pass over their input.
+//
+//       Vertices are coded in blocks of vertex_codec_block_vertex_count. Each byte of the vertex
+//       is a plane; a plane stores the difference of each vertex from the one before it, zigzag
+//       coded, in groups of 16 packed to 0, 2, 4 or 8 bits. Quantized and fetch-ordered
+//       vertices change little from one to the next, so most groups pack to 4 bits or fewer;
+//       the low mantissa bytes of floats do not compress.
+//
+//       Elements are coded per triangle after Kapoulkine's meshoptimizer index codec: a triangle
+//       that shares an edge with one of the last few triangles codes that edge in a nibble, and
+//       each remaining vertex in another: the next unseen vertex (as is usual once vertices
+//       are in fetch order, see OptimizeVertexFetch(...) in mesh_tools.h), one of the last few
+//       vertices, or an explicit difference. Triangles keep their order and winding, but may
+//       start at a different corner; the mesh draws identically.
+//
+constexpr size_t vertex_codec_block_vertex_count = 256;
+constexpr size_t vertex_codec_max_vertex_size    = 256;
+
+void
+EncodeVertexBuffer(bool&                       _success_out,
+                   const void* const           _vertex_data_in,
+                   const size_t&               _vertex_count_in,
+                   const size_t&               _vertex_size_bytes_in,
+                   std::vector<unsigned char>& _encoded_data_out);
+
+// Note: Writes `_vertex_count_in` * `_vertex_size_bytes_in` bytes to `_vertex_data_out`. Fails
+//       if the encoded data is truncated or malformed.
+void
+DecodeVertexBuffer(bool&                      _success_out,
+                   const unsigned char* const _encoded_data_in,
+                   const size_t&              _encoded_size_bytes_in,
+                   const size_t&              _vertex_count_in,
+                   const size_t&              _vertex_size_bytes_in,
+                   void* const                _vertex_data_out);
+
+// Note: `_elements_in` must hold whole triangles.
+void
+EncodeIndexBuffer(bool&                       _success_out,
+                  const std::vector<GLuint>&  _elements_in,
+                  std::vector<unsigned char>& _encoded_data_out);
+
+// Note: Writes `_element_count_in` elements of `_element_data_type_in` (GL_UNSIGNED_BYTE,
+//       GL_UNSIGNED_SHORT or GL_UNSIGNED_INT) to `_element_data_out`. Fails if the encoded data
+//       is truncated or malformed, or indexes `_vertex_count_in` vertices or more.
+void
+DecodeIndexBuffer(bool&                      _success_out,
+                  const unsigned char* const _encoded_data_in,
+                  const size_t&              _encoded_size_bytes_in,
+                  const size_t&              _element_count_in,
+                  const size_t&              _vertex_count_in,
+                  const GLenum&&             _element_data_type_in,
+                  void* const                _element_data_out);
+
+#endif // mesh_codec_h
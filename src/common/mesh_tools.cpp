@@ -0,0 +1,2312 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "mesh_tools.h"
+
+#include "logging.h"
+
+constexpr GLuint invalid_vertex_index = std::numeric_limits<GLuint>::max();
+
+static void
+ValidateMeshElements(bool&                      _success_out,
+                     const std::vector<GLuint>& _elements_in,
+                     const size_t&              _vertex_count_in)
+{
+    _success_out = true;
+
+    if (0 != (_elements_in.size() % 3))
+    {
+        Log_e("Element count must be a multiple of three; meshes must be triangulated.");
+        _success_out = false;
+        return;
+    }
+
+    for (auto& element : _elements_in)
+    {
+        if (element >= _vertex_count_in)
+        {
+            std::stringstream ss;
+            ss << "Element " << element << " exceeds the vertex count (" << _vertex_count_in
+               << ").";
+            Log_e(ss);
+            _success_out = false;
+            return;
+        }
+    }
+}
+
+// Note: Maps a vertex component to the key it is hashed and compared by.
+static inline uint64_t
+WeldComponentKey(const float& _component_in, const float& _inverse_epsilon_in)
+{
+    if (0.0f == _inverse_epsilon_in)
+    {
+        // Note: Folds -0.0f onto 0.0f, which would otherwise differ in the sign bit.
+        const float component = (0.0f == _component_in) ? 0.0f : _component_in;
+        return std::bit_cast<uint32_t>(component);
+    }
+
+    return static_cast<uint64_t>(std::llround(_component_in * _inverse_epsilon_in));
+}
+
+static inline uint64_t
+HashWeldVertex(const float* const _vertex_in,
+               const size_t&      _floats_per_vertex_in,
+               const float&       _inverse_epsilon_in)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t component_index = 0; component_index < _floats_per_vertex_in; component_index++)
+    {
+        hash ^= WeldComponentKey(_vertex_in[component_index], _inverse_epsilon_in);
+        hash *= 0x00000100000001b3ull;
+        hash ^= hash >> 29;
+    }
+
+    return hash;
+}
+
+static inline bool
+WeldVerticesEqual(const float* const _vertex_a_in,
+                  const float* const _vertex_b_in,
+                  const size_t&      _floats_per_vertex_in,
+                  const float&       _inverse_epsilon_in)
+{
+    for (size_t component_index = 0; component_index < _floats_per_vertex_in; component_index++)
+    {
+        if (WeldComponentKey(_vertex_a_in[component_index], _inverse_epsilon_in) !=
+            WeldComponentKey(_vertex_b_in[component_index], _inverse_epsilon_in))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+WeldVertices(bool&                _success_out,
+             const size_t&        _floats_per_vertex_in,
+             const float&&        _epsilon_in,
+             size_t&              _vertex_count_in_out,
+             std::vector<float>&  _vertex_data_in_out,
+             std::vector<GLuint>& _elements_in_out,
+             VertexWeldReport&    _report_out)
+{
+    _success_out = true;
+    _report_out  = {};
+
+    if ((0 == _floats_per_vertex_in) ||
+        (_vertex_data_in_out.size() != (_vertex_count_in_out * _floats_per_vertex_in)))
+    {
+        Log_e("Vertex data size does not match the vertex count and vertex size.");
+        _success_out = false;
+        return;
+    }
+
+    if ((0.0f > _epsilon_in) || (false == std::isfinite(_epsilon_in)))
+    {
+        Log_e("Vertex weld epsilon must be zero or a positive, finite value.");
+        _success_out = false;
+        return;
+    }
+
+    ValidateMeshElements(_success_out, _elements_in_out, _vertex_count_in_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    const float inverse_epsilon = (0.0f == _epsilon_in) ? 0.0f : (1.0f / _epsilon_in);
+
+    //
+    // Note: Open addressed (linear probing) table of welded vertex indices. The table is sized to
+    //       a power of two at least twice the vertex count, so it is never more than half full.
+    //       Welded vertices are compacted to the front of the vertex buffer as they are found;
+    //       since a vertex never moves to a later position, the compacted prefix is never
+    //       overwritten and table entries may refer to it directly.
+    //
+    const size_t        table_size = std::bit_ceil(std::max<size_t>(2, _vertex_count_in_out * 2));
+    const size_t        table_mask = table_size - 1;
+    std::vector<GLuint> table(table_size, invalid_vertex_index);
+    std::vector<GLuint> remap(_vertex_count_in_out, invalid_vertex_index);
+
+    float* const vertex_data         = _vertex_data_in_out.data();
+    GLuint       welded_vertex_count = 0;
+    for (size_t vertex_index = 0; vertex_index < _vertex_count_in_out; vertex_index++)
+    {
+        const float* const vertex = vertex_data + (vertex_index * _floats_per_vertex_in);
+
+        size_t slot = HashWeldVertex(vertex, _floats_per_vertex_in, inverse_epsilon) & table_mask;
+        while (invalid_vertex_index != table[slot])
+        {
+            const float* const candidate = vertex_data + (table[slot] * _floats_per_vertex_in);
+            if (true ==
+                WeldVerticesEqual(vertex, candidate, _floats_per_vertex_in, inverse_epsilon))
+            {
+                break;
+            }
+
+            slot = (slot + 1) & table_mask;
+        }
+
+        if (invalid_vertex_index == table[slot])
+        {
+            if (welded_vertex_count != vertex_index)
+            {
+                std::memcpy(vertex_data + (welded_vertex_count * _floats_per_vertex_in),
+                            vertex,
+                            _floats_per_vertex_in * sizeof(float));
+            }
+
+            table[slot] = welded_vertex_count;
+            welded_vertex_count++;
+        }
+
+        remap[vertex_index] = table[slot];
+    }
+
+    for (auto& element : _elements_in_out)
+    {
+        element = remap[element];
+    }
+
+    _report_out.vertex_count_before = _vertex_count_in_out;
+    _report_out.vertex_count_after  = welded_vertex_count;
+    _report_out.bytes_saved         = (_vertex_count_in_out - welded_vertex_count) *
+                                      _floats_per_vertex_in * sizeof(float);
+
+    _vertex_count_in_out = welded_vertex_count;
+    _vertex_data_in_out.resize(welded_vertex_count * _floats_per_vertex_in);
+}
+
+// Note: Simulates a FIFO cache by timestamp; a vertex is cached when it was inserted fewer than
+//       `_cache_size_in` insertions ago. Adding `_cache_size_in + 1` to the timestamp empties
+//       the cache. Returns the number of misses for the triangle.
+static inline size_t
+UpdateFifoVertexCache(const GLuint* const  _triangle_in,
+                      const size_t&        _cache_size_in,
+                      std::vector<size_t>& _timestamps_in_out,
+                      size_t&              _timestamp_in_out)
+{
+    size_t miss_count = 0;
+    for (size_t corner = 0; corner < 3; corner++)
+    {
+        const GLuint vertex = _triangle_in[corner];
+        if ((_timestamp_in_out - _timestamps_in_out[vertex]) > _cache_size_in)
+        {
+            _timestamps_in_out[vertex] = _timestamp_in_out;
+            _timestamp_in_out++;
+            miss_count++;
+        }
+    }
+
+    return miss_count;
+}
+
+void
+AnalyzeVertexCache(bool&                      _success_out,
+                   const std::vector<GLuint>& _elements_in,
+                   const size_t&              _vertex_count_in,
+                   const size_t&&             _cache_size_in,
+                   const VertexCacheModel&&   _cache_model_in,
+                   VertexCacheStatistics&     _statistics_out)
+{
+    _statistics_out = {};
+
+    ValidateMeshElements(_success_out, _elements_in, _vertex_count_in);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    if (0 == _cache_size_in)
+    {
+        Log_e("Vertex cache size must be greater than zero.");
+        _success_out = false;
+        return;
+    }
+
+    size_t cache_miss_count = 0;
+    switch (_cache_model_in)
+    {
+        case VertexCacheModel::FIFO:
+        {
+            std::vector<size_t> timestamps(_vertex_count_in, 0);
+            size_t              timestamp = _cache_size_in + 1;
+            for (size_t element_index = 0; element_index < _elements_in.size(); element_index += 3)
+            {
+                cache_miss_count += UpdateFifoVertexCache(&_elements_in[element_index],
+                                                          _cache_size_in,
+                                                          timestamps,
+                                                          timestamp);
+            }
+            break;
+        }
+        case VertexCacheModel::LRU:
+        {
+            // Note: Most recently used first.
+            std::vector<GLuint> cache;
+            cache.reserve(_cache_size_in + 1);
+            for (auto& element : _elements_in)
+            {
+                auto cached_element = std::find(cache.begin(), cache.end(), element);
+                if (cache.end() == cached_element)
+                {
+                    cache_miss_count++;
+                    cache.insert(cache.begin(), element);
+                    if (_cache_size_in < cache.size())
+                    {
+                        cache.pop_back();
+                    }
+                }
+                else
+                {
+                    std::rotate(cache.begin(), cached_element, cached_element + 1);
+                }
+            }
+            break;
+        }
+        default:
+        {
+            Log_e("Unsupported vertex cache model.");
+            _success_out = false;
+            return;
+        }
+    }
+
+    std::vector<bool> referenced(_vertex_count_in, false);
+    size_t            referenced_vertex_count = 0;
+    for (auto& element : _elements_in)
+    {
+        if (false == referenced[element])
+        {
+            referenced[element] = true;
+            referenced_vertex_count++;
+        }
+    }
+
+    const size_t triangle_count      = _elements_in.size() / 3;
+    _statistics_out.cache_miss_count = cache_miss_count;
+    _statistics_out.acmr             = (0 == triangle_count)
+                                         ? 0.0f
+                                         : static_cast<float>(cache_miss_count) / triangle_count;
+    _statistics_out.atvr             = (0 == referenced_vertex_count)
+                                         ? 0.0f
+                                         : static_cast<float>(cache_miss_count) /
+                                             referenced_vertex_count;
+}
+
+// Note: Tuning values from Forsyth's reference implementation.
+constexpr size_t forsyth_cache_size          = 32;
+constexpr size_t forsyth_valence_table_size  = 32;
+constexpr float  forsyth_last_triangle_score = 0.75f;
+constexpr float  forsyth_cache_decay_power   = 1.5f;
+constexpr float  forsyth_valence_boost_scale = 2.0f;
+constexpr float  forsyth_valence_boost_power = 0.5f;
+
+void
+OptimizeVertexCache(bool&                _success_out,
+                    const size_t&        _vertex_count_in,
+                    std::vector<GLuint>& _elements_in_out)
+{
+    ValidateMeshElements(_success_out, _elements_in_out, _vertex_count_in);
+    if ((false == _success_out) || (0 == _elements_in_out.size()))
+    {
+        return;
+    }
+
+    const size_t triangle_count = _elements_in_out.size() / 3;
+
+    float cache_position_scores[forsyth_cache_size];
+    for (size_t cache_position = 0; cache_position < forsyth_cache_size; cache_position++)
+    {
+        // Note: The three vertices of the last triangle score equally, regardless of order.
+        cache_position_scores[cache_position] =
+          (3 > cache_position)
+            ? forsyth_last_triangle_score
+            : std::pow(1.0f - (static_cast<float>(cache_position - 3) / (forsyth_cache_size - 3)),
+                       forsyth_cache_decay_power);
+    }
+
+    float valence_scores[forsyth_valence_table_size] = { 0.0f };
+    for (size_t valence = 1; valence < forsyth_valence_table_size; valence++)
+    {
+        valence_scores[valence] = forsyth_valence_boost_scale *
+                                  std::pow(static_cast<float>(valence),
+                                           -forsyth_valence_boost_power);
+    }
+
+    //
+    // Note: Vertex to triangle adjacency. Each vertex owns a range of `adjacent_triangles`
+    //       beginning at `adjacency_offsets[vertex]`, the first `live_triangle_counts[vertex]`
+    //       entries of which are triangles that have not yet been emitted.
+    //
+    std::vector<GLuint> live_triangle_counts(_vertex_count_in, 0);
+    for (auto& element : _elements_in_out)
+    {
+        live_triangle_counts[element]++;
+    }
+
+    std::vector<size_t> adjacency_offsets(_vertex_count_in + 1, 0);
+    for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        adjacency_offsets[vertex + 1] = adjacency_offsets[vertex] + live_triangle_counts[vertex];
+    }
+
+    std::vector<GLuint> adjacent_triangles(_elements_in_out.size());
+    {
+        std::vector<size_t> adjacency_cursors(adjacency_offsets.begin(),
+                                              adjacency_offsets.end() - 1);
+        for (size_t element_index = 0; element_index < _elements_in_out.size(); element_index++)
+        {
+            const GLuint vertex = _elements_in_out[element_index];
+            adjacent_triangles[adjacency_cursors[vertex]++] = static_cast<GLuint>(element_index /
+                                                                                  3);
+        }
+    }
+
+    std::vector<int32_t> cache_positions(_vertex_count_in, -1);
+    std::vector<float>   vertex_scores(_vertex_count_in, 0.0f);
+    std::vector<float>   triangle_scores(triangle_count, 0.0f);
+    std::vector<uint8_t> triangle_emitted(triangle_count, 0);
+
+    auto score_vertex = [&](const GLuint& _vertex_in) -> float
+    {
+        const GLuint live_triangle_count = live_triangle_counts[_vertex_in];
+        if (0 == live_triangle_count)
+        {
+            return -1.0f;
+        }
+
+        float score = valence_scores[std::min<size_t>(live_triangle_count,
+                                                      forsyth_valence_table_size - 1)];
+        if (0 <= cache_positions[_vertex_in])
+        {
+            score += cache_position_scores[cache_positions[_vertex_in]];
+        }
+
+        return score;
+    };
+
+    // Note: Triangle scores are kept as the sum of their vertex scores by applying deltas.
+    auto rescore_vertex = [&](const GLuint& _vertex_in)
+    {
+        const float score = score_vertex(_vertex_in);
+        const float delta = score - vertex_scores[_vertex_in];
+        vertex_scores[_vertex_in] = score;
+
+        const size_t adjacency_begin = adjacency_offsets[_vertex_in];
+        const size_t adjacency_end   = adjacency_begin + live_triangle_counts[_vertex_in];
+        for (size_t adjacency = adjacency_begin; adjacency < adjacency_end; adjacency++)
+        {
+            triangle_scores[adjacent_triangles[adjacency]] += delta;
+        }
+    };
+
+    for (GLuint vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        vertex_scores[vertex] = score_vertex(vertex);
+    }
+
+    size_t best_triangle = 0;
+    for (size_t triangle = 0; triangle < triangle_count; triangle++)
+    {
+        triangle_scores[triangle] = vertex_scores[_elements_in_out[(triangle * 3) + 0]] +
+                                    vertex_scores[_elements_in_out[(triangle * 3) + 1]] +
+                                    vertex_scores[_elements_in_out[(triangle * 3) + 2]];
+        if (triangle_scores[triangle] > triangle_scores[best_triangle])
+        {
+            best_triangle = triangle;
+        }
+    }
+
+    constexpr size_t invalid_triangle = std::numeric_limits<size_t>::max();
+
+    std::vector<GLuint> optimized_elements;
+    optimized_elements.reserve(_elements_in_out.size());
+
+    GLuint cache[forsyth_cache_size + 3];
+    GLuint next_cache[forsyth_cache_size + 3];
+    size_t cache_count      = 0;
+    size_t unemitted_cursor = 0;
+    for (size_t emitted_count = 0; emitted_count < triangle_count; emitted_count++)
+    {
+        // Note: When no cached vertex has a live triangle, restart from the first triangle in
+        //       input order that has not been emitted, rather than searching every triangle.
+        if (invalid_triangle == best_triangle)
+        {
+            while (0 != triangle_emitted[unemitted_cursor])
+            {
+                unemitted_cursor++;
+            }
+
+            best_triangle = unemitted_cursor;
+        }
+
+        const GLuint* const triangle = &_elements_in_out[best_triangle * 3];
+        optimized_elements.insert(optimized_elements.end(), triangle, triangle + 3);
+        triangle_emitted[best_triangle] = 1;
+
+        for (size_t corner = 0; corner < 3; corner++)
+        {
+            const GLuint vertex          = triangle[corner];
+            const size_t adjacency_begin = adjacency_offsets[vertex];
+            const size_t adjacency_last  = adjacency_begin + live_triangle_counts[vertex] - 1;
+            for (size_t adjacency = adjacency_begin; adjacency <= adjacency_last; adjacency++)
+            {
+                if (best_triangle == adjacent_triangles[adjacency])
+                {
+                    std::swap(adjacent_triangles[adjacency], adjacent_triangles[adjacency_last]);
+                    live_triangle_counts[vertex]--;
+                    break;
+                }
+            }
+        }
+
+        // Note: The emitted triangle's vertices move to the front of the cache.
+        size_t next_cache_count = 0;
+        for (size_t corner = 0; corner < 3; corner++)
+        {
+            if (next_cache + next_cache_count ==
+                std::find(next_cache, next_cache + next_cache_count, triangle[corner]))
+            {
+                next_cache[next_cache_count++] = triangle[corner];
+            }
+        }
+
+        for (size_t cache_index = 0; cache_index < cache_count; cache_index++)
+        {
+            if ((triangle[0] != cache[cache_index]) && (triangle[1] != cache[cache_index]) &&
+                (triangle[2] != cache[cache_index]))
+            {
+                next_cache[next_cache_count++] = cache[cache_index];
+            }
+        }
+
+        for (size_t cache_index = forsyth_cache_size; cache_index < next_cache_count;
+             cache_index++)
+        {
+            cache_positions[next_cache[cache_index]] = -1;
+            rescore_vertex(next_cache[cache_index]);
+        }
+
+        cache_count = std::min(next_cache_count, forsyth_cache_size);
+        for (size_t cache_index = 0; cache_index < cache_count; cache_index++)
+        {
+            cache[cache_index]                  = next_cache[cache_index];
+            cache_positions[cache[cache_index]] = static_cast<int32_t>(cache_index);
+            rescore_vertex(cache[cache_index]);
+        }
+
+        best_triangle    = invalid_triangle;
+        float best_score = -1.0f;
+        for (size_t cache_index = 0; cache_index < cache_count; cache_index++)
+        {
+            const GLuint vertex          = cache[cache_index];
+            const size_t adjacency_begin = adjacency_offsets[vertex];
+            const size_t adjacency_end   = adjacency_begin + live_triangle_counts[vertex];
+            for (size_t adjacency = adjacency_begin; adjacency < adjacency_end; adjacency++)
+            {
+                const GLuint candidate = adjacent_triangles[adjacency];
+                if (triangle_scores[candidate] > best_score)
+                {
+                    best_score    = triangle_scores[candidate];
+                    best_triangle = candidate;
+                }
+            }
+        }
+    }
+
+    _elements_in_out.swap(optimized_elements);
+}
+
+// Note: Cache size used to find cluster boundaries for overdraw ordering.
+constexpr size_t overdraw_cluster_cache_size = 16;
+
+void
+OptimizeOverdraw(bool&                     _success_out,
+                 const std::vector<float>& _vertex_data_in,
+                 const size_t&             _floats_per_vertex_in,
+                 const size_t&             _position_offset_in,
+                 const size_t&             _vertex_count_in,
+                 const float&&             _acmr_threshold_in,
+                 std::vector<GLuint>&      _elements_in_out)
+{
+    ValidateMeshElements(_success_out, _elements_in_out, _vertex_count_in);
+    if ((false == _success_out) || (0 == _elements_in_out.size()))
+    {
+        return;
+    }
+
+    if (((_position_offset_in + 3) > _floats_per_vertex_in) ||
+        (_vertex_data_in.size() != (_vertex_count_in * _floats_per_vertex_in)))
+    {
+        Log_e("Vertex data does not hold three position components for every vertex.");
+        _success_out = false;
+        return;
+    }
+
+    const size_t triangle_count = _elements_in_out.size() / 3;
+
+    std::vector<size_t> timestamps(_vertex_count_in, 0);
+    size_t              timestamp = overdraw_cluster_cache_size + 1;
+
+    //
+    // Note: A triangle that misses on all three vertices almost always starts a new patch of the
+    //       mesh; these are the hard cluster boundaries. The first triangle always starts one.
+    //
+    std::vector<size_t> hard_cluster_starts;
+    for (size_t triangle = 0; triangle < triangle_count; triangle++)
+    {
+        const size_t miss_count = UpdateFifoVertexCache(&_elements_in_out[triangle * 3],
+                                                        overdraw_cluster_cache_size,
+                                                        timestamps,
+                                                        timestamp);
+        if ((0 == triangle) || (3 == miss_count))
+        {
+            hard_cluster_starts.push_back(triangle);
+        }
+    }
+
+    //
+    // Note: Each hard cluster is split further, wherever the running ACMR from the last split
+    //       drops within the threshold of the hard cluster's own ACMR. Smaller clusters sort
+    //       better, at the cost of the cache misses incurred at each split.
+    //
+    std::vector<size_t> cluster_starts;
+    for (size_t hard_cluster = 0; hard_cluster < hard_cluster_starts.size(); hard_cluster++)
+    {
+        const size_t start = hard_cluster_starts[hard_cluster];
+        const size_t end   = ((hard_cluster + 1) < hard_cluster_starts.size())
+                               ? hard_cluster_starts[hard_cluster + 1]
+                               : triangle_count;
+
+        timestamp += overdraw_cluster_cache_size + 1;
+        size_t cluster_miss_count = 0;
+        for (size_t triangle = start; triangle < end; triangle++)
+        {
+            cluster_miss_count += UpdateFifoVertexCache(&_elements_in_out[triangle * 3],
+                                                        overdraw_cluster_cache_size,
+                                                        timestamps,
+                                                        timestamp);
+        }
+
+        const float cluster_acmr_threshold = _acmr_threshold_in *
+                                             (static_cast<float>(cluster_miss_count) /
+                                              (end - start));
+
+        cluster_starts.push_back(start);
+
+        timestamp += overdraw_cluster_cache_size + 1;
+        size_t running_miss_count     = 0;
+        size_t running_triangle_count = 0;
+        for (size_t triangle = start; triangle < end; triangle++)
+        {
+            running_miss_count += UpdateFifoVertexCache(&_elements_in_out[triangle * 3],
+                                                        overdraw_cluster_cache_size,
+                                                        timestamps,
+                                                        timestamp);
+            running_triangle_count++;
+
+            if ((static_cast<float>(running_miss_count) / running_triangle_count) <=
+                cluster_acmr_threshold)
+            {
+                cluster_starts.push_back(triangle + 1);
+                timestamp += overdraw_cluster_cache_size + 1;
+                running_miss_count     = 0;
+                running_triangle_count = 0;
+            }
+        }
+
+        // Note: The trailing split rarely reaches the threshold, and a handful of triangles on
+        //       their own have a poor ACMR. Merge it into the split before it. This also removes
+        //       a split placed at `end`, which would otherwise leave an empty cluster.
+        if (start != cluster_starts.back())
+        {
+            cluster_starts.pop_back();
+        }
+    }
+
+    auto vertex_position = [&](const GLuint& _vertex_in) -> glm::vec3
+    {
+        const float* const position = &_vertex_data_in[(_vertex_in * _floats_per_vertex_in) +
+                                                       _position_offset_in];
+        return glm::vec3(position[0], position[1], position[2]);
+    };
+
+    glm::vec3 mesh_centroid(0.0f);
+    for (GLuint vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        mesh_centroid += vertex_position(vertex);
+    }
+    mesh_centroid /= static_cast<float>(_vertex_count_in);
+
+    //
+    // Note: Clusters whose area weighted centroid lies further along their average normal,
+    //       relative to the mesh centroid, face outward and are likely to occlude the rest of the
+    //       mesh. These are drawn first.
+    //
+    const size_t       cluster_count = cluster_starts.size();
+    std::vector<float> cluster_sort_keys(cluster_count, 0.0f);
+    for (size_t cluster = 0; cluster < cluster_count; cluster++)
+    {
+        const size_t start = cluster_starts[cluster];
+        const size_t end   = ((cluster + 1) < cluster_count) ? cluster_starts[cluster + 1]
+                                                             : triangle_count;
+
+        glm::vec3 centroid(0.0f);
+        glm::vec3 normal(0.0f);
+        float     area = 0.0f;
+        for (size_t triangle = start; triangle < end; triangle++)
+        {
+            const glm::vec3 p0 = vertex_position(_elements_in_out[(triangle * 3) + 0]);
+            const glm::vec3 p1 = vertex_position(_elements_in_out[(triangle * 3) + 1]);
+            const glm::vec3 p2 = vertex_position(_elements_in_out[(triangle * 3) + 2]);
+
+            const glm::vec3 triangle_normal = glm::cross(p1 - p0, p2 - p0);
+            const float     triangle_area   = glm::length(triangle_normal);
+
+            centroid += ((p0 + p1 + p2) / 3.0f) * triangle_area;
+            normal += triangle_normal;
+            area += triangle_area;
+        }
+
+        if ((0.0f == area) || (0.0f == glm::length(normal)))
+        {
+            continue;
+        }
+
+        cluster_sort_keys[cluster] = glm::dot((centroid / area) - mesh_centroid,
+                                              glm::normalize(normal));
+    }
+
+    std::vector<size_t> cluster_order(cluster_count);
+    for (size_t cluster = 0; cluster < cluster_count; cluster++)
+    {
+        cluster_order[cluster] = cluster;
+    }
+
+    std::stable_sort(cluster_order.begin(),
+                     cluster_order.end(),
+                     [&cluster_sort_keys](const size_t& _a_in, const size_t& _b_in)
+                     { return cluster_sort_keys[_a_in] > cluster_sort_keys[_b_in]; });
+
+    std::vector<GLuint> optimized_elements;
+    optimized_elements.reserve(_elements_in_out.size());
+    for (auto& cluster : cluster_order)
+    {
+        const size_t start = cluster_starts[cluster];
+        const size_t end   = ((cluster + 1) < cluster_count) ? cluster_starts[cluster + 1]
+                                                             : triangle_count;
+        optimized_elements.insert(optimized_elements.end(),
+                                  _elements_in_out.begin() + (start * 3),
+                                  _elements_in_out.begin() + (end * 3));
+    }
+
+    _elements_in_out.swap(optimized_elements);
+}
+
+void
+OptimizeVertexFetch(bool&                _success_out,
+                    const size_t&        _floats_per_vertex_in,
+                    size_t&              _vertex_count_in_out,
+                    std::vector<float>&  _vertex_data_in_out,
+                    std::vector<GLuint>& _elements_in_out)
+{
+    ValidateMeshElements(_success_out, _elements_in_out, _vertex_count_in_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    if (_vertex_data_in_out.size() != (_vertex_count_in_out * _floats_per_vertex_in))
+    {
+        Log_e("Vertex data size does not match the vertex count and vertex size.");
+        _success_out = false;
+        return;
+    }
+
+    std::vector<GLuint> remap(_vertex_count_in_out, invalid_vertex_index);
+    GLuint              fetched_vertex_count = 0;
+    for (auto& element : _elements_in_out)
+    {
+        if (invalid_vertex_index == remap[element])
+        {
+            remap[element] = fetched_vertex_count++;
+        }
+
+        element = remap[element];
+    }
+
+    std::vector<float> fetched_vertex_data(fetched_vertex_count * _floats_per_vertex_in);
+    for (size_t vertex = 0; vertex < _vertex_count_in_out; vertex++)
+    {
+        if (invalid_vertex_index != remap[vertex])
+        {
+            std::memcpy(&fetched_vertex_data[remap[vertex] * _floats_per_vertex_in],
+                        &_vertex_data_in_out[vertex * _floats_per_vertex_in],
+                        _floats_per_vertex_in * sizeof(float));
+        }
+    }
+
+    _vertex_data_in_out.swap(fetched_vertex_data);
+    _vertex_count_in_out = fetched_vertex_count;
+}
+
+// Note: Overdraw clusters may be split wherever this keeps ACMR within 5% of the vertex cache
+//       optimized order.
+constexpr float overdraw_acmr_threshold = 1.05f;
+
+void
+OptimizeMesh(bool&                   _success_out,
+             const size_t&           _floats_per_vertex_in,
+             const size_t&           _position_offset_in,
+             const size_t&&          _cache_size_in,
+             size_t&                 _vertex_count_in_out,
+             std::vector<float>&     _vertex_data_in_out,
+             std::vector<GLuint>&    _elements_in_out,
+             MeshOptimizationReport& _report_out)
+{
+    _report_out            = {};
+    _report_out.cache_size = _cache_size_in;
+
+    AnalyzeVertexCache(_success_out,
+                       _elements_in_out,
+                       _vertex_count_in_out,
+                       std::move(_cache_size_in),
+                       VertexCacheModel::FIFO,
+                       _report_out.fifo_before);
+    if (false == _success_out) return;
+
+    AnalyzeVertexCache(_success_out,
+                       _elements_in_out,
+                       _vertex_count_in_out,
+                       std::move(_cache_size_in),
+                       VertexCacheModel::LRU,
+                       _report_out.lru_before);
+    if (false == _success_out) return;
+
+    OptimizeVertexCache(_success_out, _vertex_count_in_out, _elements_in_out);
+    if (false == _success_out) return;
+
+    OptimizeOverdraw(_success_out,
+                     _vertex_data_in_out,
+                     _floats_per_vertex_in,
+                     _position_offset_in,
+                     _vertex_count_in_out,
+                     std::move(overdraw_acmr_threshold),
+                     _elements_in_out);
+    if (false == _success_out) return;
+
+    OptimizeVertexFetch(_success_out,
+                        _floats_per_vertex_in,
+                        _vertex_count_in_out,
+                        _vertex_data_in_out,
+                        _elements_in_out);
+    if (false == _success_out) return;
+
+    AnalyzeVertexCache(_success_out,
+                       _elements_in_out,
+                       _vertex_count_in_out,
+                       std::move(_cache_size_in),
+                       VertexCacheModel::FIFO,
+                       _report_out.fifo_after);
+    if (false == _success_out) return;
+
+    AnalyzeVertexCache(_success_out,
+                       _elements_in_out,
+                       _vertex_count_in_out,
+                       std::move(_cache_size_in),
+                       VertexCacheModel::LRU,
+                       _report_out.lru_after);
+}
+
+//
+// Note: Simplification collapses edges in order of quadric error, after Garland and Heckbert,
+//       "Surface Simplification Using Quadric Error Metrics". Edges only collapse onto existing
+//       vertices, so that every level of detail indexes the same vertex buffer. Border and seam
+//       handling follows the simplifier in Arseny Kapoulkine's meshoptimizer.
+//
+//       Vertices are classified once, by how the edges around them are shared:
+//
+//       MANIFOLD: Every edge is shared by two triangles. May collapse onto any neighbour.
+//       BORDER:   On a single open edge loop. May only collapse along that loop.
+//       SEAM:     Two vertices sharing a position on an attribute seam, such as a texture
+//                 coordinate discontinuity. Both collapse along the seam together.
+//       LOCKED:   Anything else, including corners where seams meet. Never moves.
+//
+enum class SimplifyVertexKind
+{
+    MANIFOLD = 0,
+    BORDER,
+    SEAM,
+    LOCKED,
+    COUNT
+};
+
+constexpr size_t simplify_vertex_kind_count = static_cast<size_t>(SimplifyVertexKind::COUNT);
+
+// Note: Whether a vertex of the row kind may collapse onto a vertex of the column kind.
+constexpr bool simplify_can_collapse[simplify_vertex_kind_count][simplify_vertex_kind_count] = {
+    { true, true, true, true },    // MANIFOLD
+    { false, true, false, false }, // BORDER
+    { false, false, true, false }, // SEAM
+    { false, false, false, false } // LOCKED
+};
+
+// Note: Whether an edge between the two kinds is also found in the opposite direction, in which
+//       case only one direction is considered.
+constexpr bool simplify_has_opposite[simplify_vertex_kind_count][simplify_vertex_kind_count] = {
+    { true, true, true, true },    // MANIFOLD
+    { true, false, true, false },  // BORDER
+    { true, true, true, true },    // SEAM
+    { true, false, true, false }   // LOCKED
+};
+
+// Note: Open edges are weighted more heavily than seams so that silhouettes are preserved.
+constexpr float simplify_border_edge_weight = 10.0f;
+constexpr float simplify_seam_edge_weight   = 1.0f;
+
+// Note: Collapses are made in passes. Each pass collapses edges up to this multiple of the error
+//       of the edge which would meet half of the remaining goal, such that the cheapest edges
+//       are collapsed first without a pass per edge.
+constexpr float simplify_pass_error_scale = 1.5f;
+
+// Note: Symmetric 4x4 quadric, a00..a22 and b0..b2 forming the upper 3x4 block, divided by the
+//       accumulated weight when evaluated.
+struct SimplifyQuadric
+{
+    float a00 = 0.0f;
+    float a11 = 0.0f;
+    float a22 = 0.0f;
+    float a10 = 0.0f;
+    float a20 = 0.0f;
+    float a21 = 0.0f;
+    float b0  = 0.0f;
+    float b1  = 0.0f;
+    float b2  = 0.0f;
+    float c   = 0.0f;
+    float w   = 0.0f;
+};
+
+struct SimplifyEdge
+{
+    GLuint next;
+    GLuint prev;
+};
+
+// Note: The edges leaving each vertex, one per triangle corner, in a single allocation.
+struct SimplifyAdjacency
+{
+    std::vector<size_t>       offsets;
+    std::vector<SimplifyEdge> edges;
+};
+
+struct SimplifyCollapse
+{
+    GLuint from;
+    GLuint to;
+    float  error;
+};
+
+static void
+AddSimplifyQuadric(SimplifyQuadric& _quadric_in_out, const SimplifyQuadric& _quadric_in)
+{
+    _quadric_in_out.a00 += _quadric_in.a00;
+    _quadric_in_out.a11 += _quadric_in.a11;
+    _quadric_in_out.a22 += _quadric_in.a22;
+    _quadric_in_out.a10 += _quadric_in.a10;
+    _quadric_in_out.a20 += _quadric_in.a20;
+    _quadric_in_out.a21 += _quadric_in.a21;
+    _quadric_in_out.b0 += _quadric_in.b0;
+    _quadric_in_out.b1 += _quadric_in.b1;
+    _quadric_in_out.b2 += _quadric_in.b2;
+    _quadric_in_out.c += _quadric_in.c;
+    _quadric_in_out.w += _quadric_in.w;
+}
+
+// Note: Quadric of the squared distance to the plane dot(normal, p) + distance = 0.
+static SimplifyQuadric
+SimplifyQuadricFromPlane(const glm::vec3& _normal_in,
+                         const float&     _distance_in,
+                         const float&     _weight_in)
+{
+    SimplifyQuadric quadric;
+    quadric.a00 = _normal_in.x * _normal_in.x * _weight_in;
+    quadric.a11 = _normal_in.y * _normal_in.y * _weight_in;
+    quadric.a22 = _normal_in.z * _normal_in.z * _weight_in;
+    quadric.a10 = _normal_in.y * _normal_in.x * _weight_in;
+    quadric.a20 = _normal_in.z * _normal_in.x * _weight_in;
+    quadric.a21 = _normal_in.z * _normal_in.y * _weight_in;
+    quadric.b0  = _normal_in.x * _distance_in * _weight_in;
+    quadric.b1  = _normal_in.y * _distance_in * _weight_in;
+    quadric.b2  = _normal_in.z * _distance_in * _weight_in;
+    quadric.c   = _distance_in * _distance_in * _weight_in;
+    quadric.w   = _weight_in;
+    return quadric;
+}
+
+static float
+SimplifyQuadricError(const SimplifyQuadric& _quadric_in, const glm::vec3& _position_in)
+{
+    const SimplifyQuadric& q = _quadric_in;
+    const glm::vec3&       p = _position_in;
+
+    const float rx = (q.a00 * p.x) + (q.a10 * p.y) + (q.a20 * p.z);
+    const float ry = (q.a10 * p.x) + (q.a11 * p.y) + (q.a21 * p.z);
+    const float rz = (q.a20 * p.x) + (q.a21 * p.y) + (q.a22 * p.z);
+
+    float error = (rx * p.x) + (ry * p.y) + (rz * p.z);
+    error += 2.0f * ((q.b0 * p.x) + (q.b1 * p.y) + (q.b2 * p.z));
+    error += q.c;
+
+    return (0.0f == q.w) ? 0.0f : (std::abs(error) / q.w);
+}
+
+// Note: Squared distance from `_point_in` to the closest point of the triangle, after Ericson,
+//       "Real-Time Collision Detection", 5.1.5.
+static float
+SimplifyTriangleDistanceSquared(const glm::vec3& _point_in,
+                                const glm::vec3& _a_in,
+                                const glm::vec3& _b_in,
+                                const glm::vec3& _c_in)
+{
+    const glm::vec3 ab = _b_in - _a_in;
+    const glm::vec3 ac = _c_in - _a_in;
+    const glm::vec3 ap = _point_in - _a_in;
+    const float     d1 = glm::dot(ab, ap);
+    const float     d2 = glm::dot(ac, ap);
+    if ((0.0f >= d1) && (0.0f >= d2))
+    {
+        return glm::dot(ap, ap);
+    }
+
+    const glm::vec3 bp = _point_in - _b_in;
+    const float     d3 = glm::dot(ab, bp);
+    const float     d4 = glm::dot(ac, bp);
+    if ((0.0f <= d3) && (d4 <= d3))
+    {
+        return glm::dot(bp, bp);
+    }
+
+    const glm::vec3 cp = _point_in - _c_in;
+    const float     d5 = glm::dot(ab, cp);
+    const float     d6 = glm::dot(ac, cp);
+    if ((0.0f <= d6) && (d5 <= d6))
+    {
+        return glm::dot(cp, cp);
+    }
+
+    glm::vec3   closest = _a_in;
+    const float vc      = (d1 * d4) - (d3 * d2);
+    const float vb      = (d5 * d2) - (d1 * d6);
+    const float va      = (d3 * d6) - (d5 * d4);
+    if ((0.0f >= vc) && (0.0f <= d1) && (0.0f >= d3))
+    {
+        closest = _a_in + (ab * (d1 / (d1 - d3)));
+    }
+    else if ((0.0f >= vb) && (0.0f <= d2) && (0.0f >= d6))
+    {
+        closest = _a_in + (ac * (d2 / (d2 - d6)));
+    }
+    else if ((0.0f >= va) && (0.0f <= (d4 - d3)) && (0.0f <= (d5 - d6)))
+    {
+        closest = _b_in + ((_c_in - _b_in) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))));
+    }
+    else
+    {
+        const float denominator = va + vb + vc;
+        closest = (0.0f == denominator)
+                    ? _a_in
+                    : (_a_in + (ab * (vb / denominator)) + (ac * (vc / denominator)));
+    }
+
+    const glm::vec3 offset = _point_in - closest;
+    return glm::dot(offset, offset);
+}
+
+static void
+BuildSimplifyAdjacency(const std::vector<GLuint>& _elements_in,
+                       const size_t&              _vertex_count_in,
+                       SimplifyAdjacency&         _adjacency_out)
+{
+    _adjacency_out.offsets.assign(_vertex_count_in + 1, 0);
+    for (auto& element : _elements_in)
+    {
+        _adjacency_out.offsets[element + 1]++;
+    }
+
+    for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        _adjacency_out.offsets[vertex + 1] += _adjacency_out.offsets[vertex];
+    }
+
+    std::vector<size_t> cursors(_adjacency_out.offsets.begin(), _adjacency_out.offsets.end() - 1);
+    _adjacency_out.edges.resize(_elements_in.size());
+    for (size_t element_index = 0; element_index < _elements_in.size(); element_index += 3)
+    {
+        const GLuint a = _elements_in[element_index + 0];
+        const GLuint b = _elements_in[element_index + 1];
+        const GLuint c = _elements_in[element_index + 2];
+
+        _adjacency_out.edges[cursors[a]++] = { b, c };
+        _adjacency_out.edges[cursors[b]++] = { c, a };
+        _adjacency_out.edges[cursors[c]++] = { a, b };
+    }
+}
+
+static bool
+HasSimplifyEdge(const SimplifyAdjacency& _adjacency_in,
+                const GLuint&            _from_in,
+                const GLuint&            _to_in)
+{
+    for (size_t edge = _adjacency_in.offsets[_from_in]; edge < _adjacency_in.offsets[_from_in + 1];
+         edge++)
+    {
+        if (_to_in == _adjacency_in.edges[edge].next)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Note: Whether moving `_from_in` onto `_to_in` would turn any remaining triangle around
+//       `_from_in` over.
+static bool
+HasSimplifyTriangleFlips(const SimplifyAdjacency&      _adjacency_in,
+                         const std::vector<glm::vec3>& _positions_in,
+                         const std::vector<GLuint>&    _position_remap_in,
+                         const std::vector<GLuint>&    _collapse_remap_in,
+                         const GLuint&                 _from_in,
+                         const GLuint&                 _to_in)
+{
+    const glm::vec3& from_position = _positions_in[_from_in];
+    const glm::vec3& to_position   = _positions_in[_to_in];
+    const GLuint     to_remap      = _position_remap_in[_to_in];
+    for (size_t edge = _adjacency_in.offsets[_from_in]; edge < _adjacency_in.offsets[_from_in + 1];
+         edge++)
+    {
+        const GLuint a = _collapse_remap_in[_adjacency_in.edges[edge].next];
+        const GLuint b = _collapse_remap_in[_adjacency_in.edges[edge].prev];
+
+        // Note: Triangles on the collapsing edge, or already collapsed, are removed.
+        if ((to_remap == _position_remap_in[a]) || (to_remap == _position_remap_in[b]) ||
+            (_position_remap_in[a] == _position_remap_in[b]))
+        {
+            continue;
+        }
+
+        const glm::vec3 edge_ab = _positions_in[b] - _positions_in[a];
+        const glm::vec3 normal_before = glm::cross(edge_ab, from_position - _positions_in[a]);
+        const glm::vec3 normal_after  = glm::cross(edge_ab, to_position - _positions_in[a]);
+        if (0.0f >= glm::dot(normal_before, normal_after))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Note: Follows a vertex's open edge loop through the collapses of a pass.
+static void
+RemapSimplifyEdgeLoop(std::vector<GLuint>&       _loop_in_out,
+                      const std::vector<GLuint>& _collapse_remap_in)
+{
+    for (size_t vertex = 0; vertex < _loop_in_out.size(); vertex++)
+    {
+        const GLuint loop_vertex = _loop_in_out[vertex];
+        if (invalid_vertex_index != loop_vertex)
+        {
+            const GLuint collapsed_loop_vertex = _collapse_remap_in[loop_vertex];
+
+            // Note: The loop edge collapsed onto this vertex; continue to the next edge instead.
+            _loop_in_out[vertex] = (vertex == collapsed_loop_vertex) ? _loop_in_out[loop_vertex]
+                                                                     : collapsed_loop_vertex;
+        }
+    }
+}
+
+void
+SimplifyMesh(bool&                      _success_out,
+             const std::vector<float>&  _vertex_data_in,
+             const size_t&              _floats_per_vertex_in,
+             const size_t&              _position_offset_in,
+             const size_t&              _vertex_count_in,
+             const std::vector<GLuint>& _elements_in,
+             const size_t&&             _target_element_count_in,
+             const float&&              _target_error_in,
+             std::vector<GLuint>&       _elements_out,
+             float&                     _error_out)
+{
+    _success_out = true;
+    _error_out   = 0.0f;
+
+    ValidateMeshElements(_success_out, _elements_in, _vertex_count_in);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    if (((_position_offset_in + 3) > _floats_per_vertex_in) ||
+        (_vertex_data_in.size() < (_vertex_count_in * _floats_per_vertex_in)))
+    {
+        Log_e("Vertex data does not contain a position for every vertex.");
+        _success_out = false;
+        return;
+    }
+
+    _elements_out = _elements_in;
+    if ((_target_element_count_in >= _elements_in.size()) || (0 == _vertex_count_in))
+    {
+        return;
+    }
+
+    //
+    // Note: Positions are rescaled to the unit cube such that error thresholds do not depend on
+    //       the size of the model.
+    //
+    std::vector<glm::vec3> positions(_vertex_count_in);
+    glm::vec3              minimum_position(std::numeric_limits<float>::max());
+    glm::vec3              maximum_position(std::numeric_limits<float>::lowest());
+    for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        const float* const position = &_vertex_data_in[(vertex * _floats_per_vertex_in) +
+                                                       _position_offset_in];
+        positions[vertex]           = glm::vec3(position[0], position[1], position[2]);
+        minimum_position            = glm::min(minimum_position, positions[vertex]);
+        maximum_position            = glm::max(maximum_position, positions[vertex]);
+    }
+
+    const glm::vec3 extent = maximum_position - minimum_position;
+    float           scale  = std::max({ extent.x, extent.y, extent.z });
+    scale                  = (0.0f == scale) ? 1.0f : scale;
+    for (auto& position : positions)
+    {
+        position = (position - minimum_position) / scale;
+    }
+
+    const float normalized_target_error = _target_error_in / scale;
+    const float error_limit = (std::numeric_limits<float>::max() == _target_error_in)
+                                ? std::numeric_limits<float>::max()
+                                : (normalized_target_error * normalized_target_error);
+
+    //
+    // Note: Vertices that share a position are linked in a ring through `wedges`, and map to the
+    //       first of them through `position_remap`.
+    //
+    std::vector<GLuint> position_remap(_vertex_count_in);
+    std::vector<GLuint> wedges(_vertex_count_in);
+    {
+        std::vector<GLuint> sorted_vertices(_vertex_count_in);
+        for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+        {
+            sorted_vertices[vertex] = static_cast<GLuint>(vertex);
+        }
+
+        std::sort(sorted_vertices.begin(),
+                  sorted_vertices.end(),
+                  [&positions](const GLuint& _a_in, const GLuint& _b_in) {
+                      const glm::vec3& a = positions[_a_in];
+                      const glm::vec3& b = positions[_b_in];
+                      return (a.x != b.x) ? (a.x < b.x)
+                                          : ((a.y != b.y) ? (a.y < b.y)
+                                                          : ((a.z != b.z) ? (a.z < b.z)
+                                                                          : (_a_in < _b_in)));
+                  });
+
+        size_t group_begin = 0;
+        while (group_begin < _vertex_count_in)
+        {
+            const glm::vec3& group_position = positions[sorted_vertices[group_begin]];
+
+            size_t group_end = group_begin + 1;
+            while ((group_end < _vertex_count_in) &&
+                   (group_position == positions[sorted_vertices[group_end]]))
+            {
+                group_end++;
+            }
+
+            for (size_t group_index = group_begin; group_index < group_end; group_index++)
+            {
+                const size_t next_group_index = (group_index + 1 == group_end) ? group_begin
+                                                                                 : group_index + 1;
+                position_remap[sorted_vertices[group_index]] = sorted_vertices[group_begin];
+                wedges[sorted_vertices[group_index]]         = sorted_vertices[next_group_index];
+            }
+
+            group_begin = group_end;
+        }
+    }
+
+    SimplifyAdjacency adjacency;
+    BuildSimplifyAdjacency(_elements_out, _vertex_count_in, adjacency);
+
+    //
+    // Note: An edge is open when no triangle uses it in the opposite direction. Each vertex
+    //       records its single open outgoing and incoming edge, or itself when it has several.
+    //
+    std::vector<GLuint> open_outgoing(_vertex_count_in, invalid_vertex_index);
+    std::vector<GLuint> open_incoming(_vertex_count_in, invalid_vertex_index);
+    for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        for (size_t edge = adjacency.offsets[vertex]; edge < adjacency.offsets[vertex + 1]; edge++)
+        {
+            const GLuint target = adjacency.edges[edge].next;
+            if (false == HasSimplifyEdge(adjacency, target, static_cast<GLuint>(vertex)))
+            {
+                open_incoming[target]  = (invalid_vertex_index == open_incoming[target])
+                                           ? static_cast<GLuint>(vertex)
+                                           : target;
+                open_outgoing[vertex] = (invalid_vertex_index == open_outgoing[vertex])
+                                          ? target
+                                          : static_cast<GLuint>(vertex);
+            }
+        }
+    }
+
+    std::vector<SimplifyVertexKind> vertex_kinds(_vertex_count_in, SimplifyVertexKind::LOCKED);
+    for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        if (vertex != position_remap[vertex])
+        {
+            continue;
+        }
+
+        const GLuint outgoing = open_outgoing[vertex];
+        const GLuint incoming = open_incoming[vertex];
+        const GLuint wedge    = wedges[vertex];
+        if (vertex == wedge)
+        {
+            if ((invalid_vertex_index == outgoing) && (invalid_vertex_index == incoming))
+            {
+                vertex_kinds[vertex] = SimplifyVertexKind::MANIFOLD;
+            }
+            else if ((invalid_vertex_index != outgoing) && (vertex != outgoing) &&
+                     (invalid_vertex_index != incoming) && (vertex != incoming))
+            {
+                vertex_kinds[vertex] = SimplifyVertexKind::BORDER;
+            }
+        }
+        else if (vertex == wedges[wedge])
+        {
+            // Note: Each side of a seam has one open edge in and one out, and the two sides must
+            //       run between the same positions in opposite directions.
+            const GLuint wedge_outgoing = open_outgoing[wedge];
+            const GLuint wedge_incoming = open_incoming[wedge];
+            if ((invalid_vertex_index != outgoing) && (vertex != outgoing) &&
+                (invalid_vertex_index != incoming) && (vertex != incoming) &&
+                (invalid_vertex_index != wedge_outgoing) && (wedge != wedge_outgoing) &&
+                (invalid_vertex_index != wedge_incoming) && (wedge != wedge_incoming) &&
+                (position_remap[incoming] == position_remap[wedge_outgoing]) &&
+                (position_remap[outgoing] == position_remap[wedge_incoming]))
+            {
+                vertex_kinds[vertex] = SimplifyVertexKind::SEAM;
+            }
+        }
+    }
+
+    for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        vertex_kinds[vertex] = vertex_kinds[position_remap[vertex]];
+    }
+
+    //
+    // Note: Each position accumulates the planes of its triangles, plus planes perpendicular to
+    //       its open and seam edges, which keep those edges from sliding.
+    //
+    std::vector<SimplifyQuadric> quadrics(_vertex_count_in);
+    for (size_t element_index = 0; element_index < _elements_out.size(); element_index += 3)
+    {
+        const GLuint* const triangle = &_elements_out[element_index];
+        const glm::vec3&    p0       = positions[triangle[0]];
+
+        glm::vec3   normal = glm::cross(positions[triangle[1]] - p0, positions[triangle[2]] - p0);
+        const float area   = glm::length(normal);
+        normal             = (0.0f == area) ? normal : (normal / area);
+
+        const SimplifyQuadric quadric = SimplifyQuadricFromPlane(normal,
+                                                                 -glm::dot(normal, p0),
+                                                                 area);
+        for (size_t corner = 0; corner < 3; corner++)
+        {
+            AddSimplifyQuadric(quadrics[position_remap[triangle[corner]]], quadric);
+        }
+
+        for (size_t corner = 0; corner < 3; corner++)
+        {
+            const GLuint             i0 = triangle[corner];
+            const GLuint             i1 = triangle[(corner + 1) % 3];
+            const GLuint             i2 = triangle[(corner + 2) % 3];
+            const SimplifyVertexKind k0 = vertex_kinds[i0];
+            const SimplifyVertexKind k1 = vertex_kinds[i1];
+
+            const bool i0_on_loop = (SimplifyVertexKind::BORDER == k0) ||
+                                    (SimplifyVertexKind::SEAM == k0);
+            const bool i1_on_loop = (SimplifyVertexKind::BORDER == k1) ||
+                                    (SimplifyVertexKind::SEAM == k1);
+            if (((false == i0_on_loop) && (false == i1_on_loop)) ||
+                ((true == i0_on_loop) && (i1 != open_outgoing[i0])) ||
+                ((true == i1_on_loop) && (i0 != open_incoming[i1])))
+            {
+                continue;
+            }
+
+            // Note: Seam edges are found from both sides.
+            if ((true == simplify_has_opposite[static_cast<size_t>(k0)][static_cast<size_t>(k1)]) &&
+                (position_remap[i1] > position_remap[i0]))
+            {
+                continue;
+            }
+
+            glm::vec3   edge_direction = positions[i1] - positions[i0];
+            const float edge_length    = glm::length(edge_direction);
+            if (0.0f == edge_length)
+            {
+                continue;
+            }
+
+            edge_direction /= edge_length;
+
+            // Note: The plane through the edge, perpendicular to its triangle.
+            const glm::vec3 to_opposite = positions[i2] - positions[i0];
+            glm::vec3       edge_normal = to_opposite -
+                                    (edge_direction * glm::dot(to_opposite, edge_direction));
+            const float     edge_normal_length = glm::length(edge_normal);
+            if (0.0f == edge_normal_length)
+            {
+                continue;
+            }
+
+            edge_normal /= edge_normal_length;
+
+            const float edge_weight = ((SimplifyVertexKind::BORDER == k0) ||
+                                       (SimplifyVertexKind::BORDER == k1))
+                                        ? simplify_border_edge_weight
+                                        : simplify_seam_edge_weight;
+            const SimplifyQuadric edge_quadric = SimplifyQuadricFromPlane(
+              edge_normal,
+              -glm::dot(edge_normal, positions[i0]),
+              edge_length * edge_weight);
+            AddSimplifyQuadric(quadrics[position_remap[i0]], edge_quadric);
+            AddSimplifyQuadric(quadrics[position_remap[i1]], edge_quadric);
+        }
+    }
+
+    std::vector<SimplifyCollapse> collapses;
+    std::vector<size_t>           collapse_order;
+    std::vector<GLuint>           collapse_remap(_vertex_count_in);
+    std::vector<bool>             collapse_locked(_vertex_count_in);
+    float                         result_error = 0.0f;
+
+    // Note: The vertex each vertex has been collapsed onto, through every pass.
+    std::vector<GLuint> vertex_targets(_vertex_count_in);
+    for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        vertex_targets[vertex] = static_cast<GLuint>(vertex);
+    }
+
+    while (_elements_out.size() > _target_element_count_in)
+    {
+        //
+        // Note: Pick the cheaper direction of every collapsible edge.
+        //
+        collapses.clear();
+        for (size_t element_index = 0; element_index < _elements_out.size(); element_index += 3)
+        {
+            const GLuint* const triangle = &_elements_out[element_index];
+            for (size_t corner = 0; corner < 3; corner++)
+            {
+                const GLuint i0 = triangle[corner];
+                const GLuint i1 = triangle[(corner + 1) % 3];
+                const size_t k0 = static_cast<size_t>(vertex_kinds[i0]);
+                const size_t k1 = static_cast<size_t>(vertex_kinds[i1]);
+                if ((false == simplify_can_collapse[k0][k1]) &&
+                    (false == simplify_can_collapse[k1][k0]))
+                {
+                    continue;
+                }
+
+                if ((true == simplify_has_opposite[k0][k1]) &&
+                    (position_remap[i1] > position_remap[i0]))
+                {
+                    continue;
+                }
+
+                // Note: Border and seam vertices on different loops must not be joined.
+                if ((k0 == k1) &&
+                    ((static_cast<size_t>(SimplifyVertexKind::BORDER) == k0) ||
+                     (static_cast<size_t>(SimplifyVertexKind::SEAM) == k0)) &&
+                    (i1 != open_outgoing[i0]))
+                {
+                    continue;
+                }
+
+                const float error_i0_to_i1 = (true == simplify_can_collapse[k0][k1])
+                                               ? SimplifyQuadricError(quadrics[position_remap[i0]],
+                                                                      positions[i1])
+                                               : std::numeric_limits<float>::max();
+                const float error_i1_to_i0 = (true == simplify_can_collapse[k1][k0])
+                                               ? SimplifyQuadricError(quadrics[position_remap[i1]],
+                                                                      positions[i0])
+                                               : std::numeric_limits<float>::max();
+                collapses.push_back((error_i0_to_i1 <= error_i1_to_i0)
+                                      ? SimplifyCollapse{ i0, i1, error_i0_to_i1 }
+                                      : SimplifyCollapse{ i1, i0, error_i1_to_i0 });
+            }
+        }
+
+        if (0 == collapses.size())
+        {
+            break;
+        }
+
+        collapse_order.resize(collapses.size());
+        for (size_t collapse_index = 0; collapse_index < collapses.size(); collapse_index++)
+        {
+            collapse_order[collapse_index] = collapse_index;
+        }
+
+        std::sort(collapse_order.begin(),
+                  collapse_order.end(),
+                  [&collapses](const size_t& _a_in, const size_t& _b_in) {
+                      return collapses[_a_in].error < collapses[_b_in].error;
+                  });
+
+        const size_t triangle_collapse_goal = std::max(
+          (_elements_out.size() - _target_element_count_in) / 3,
+          static_cast<size_t>(1));
+        const size_t edge_collapse_goal = triangle_collapse_goal / 2;
+        const float  pass_error_goal    = (edge_collapse_goal < collapses.size())
+                                            ? (simplify_pass_error_scale *
+                                               collapses[collapse_order[edge_collapse_goal]].error)
+                                            : std::numeric_limits<float>::max();
+        const float  pass_error_limit   = std::min(error_limit, pass_error_goal);
+
+        //
+        // Note: Perform collapses cheapest first. A position takes part in at most one collapse
+        //       per pass, so that every error was measured against the current mesh.
+        //
+        for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+        {
+            collapse_remap[vertex] = static_cast<GLuint>(vertex);
+        }
+
+        std::fill(collapse_locked.begin(), collapse_locked.end(), false);
+
+        size_t triangle_collapse_count = 0;
+        size_t edge_collapse_count     = 0;
+        for (auto& collapse_index : collapse_order)
+        {
+            const SimplifyCollapse& collapse = collapses[collapse_index];
+            if ((collapse.error > pass_error_limit) ||
+                (triangle_collapse_count >= triangle_collapse_goal))
+            {
+                break;
+            }
+
+            const GLuint i0 = collapse.from;
+            const GLuint i1 = collapse.to;
+            const GLuint r0 = position_remap[i0];
+            const GLuint r1 = position_remap[i1];
+            if ((true == collapse_locked[r0]) || (true == collapse_locked[r1]) ||
+                (true == HasSimplifyTriangleFlips(
+                           adjacency, positions, position_remap, collapse_remap, i0, i1)))
+            {
+                continue;
+            }
+
+            const SimplifyVertexKind kind = vertex_kinds[i0];
+            if (SimplifyVertexKind::SEAM == kind)
+            {
+                // Note: The other side of the seam collapses onto the other side of `i1`.
+                const GLuint s0 = wedges[i0];
+                const GLuint s1 = (i1 == open_outgoing[i0]) ? open_incoming[s0] : open_outgoing[s0];
+                if ((invalid_vertex_index == s1) || (r1 != position_remap[s1]) ||
+                    (true == HasSimplifyTriangleFlips(
+                               adjacency, positions, position_remap, collapse_remap, s0, s1)))
+                {
+                    continue;
+                }
+
+                collapse_remap[s0] = s1;
+            }
+
+            collapse_remap[i0] = i1;
+            AddSimplifyQuadric(quadrics[r1], quadrics[r0]);
+
+            collapse_locked[r0] = true;
+            collapse_locked[r1] = true;
+
+            // Note: Collapsing an interior edge removes two triangles; a border edge removes one.
+            triangle_collapse_count += (SimplifyVertexKind::BORDER == kind) ? 1 : 2;
+            edge_collapse_count++;
+            result_error = std::max(result_error, collapse.error);
+        }
+
+        if (0 == edge_collapse_count)
+        {
+            break;
+        }
+
+        //
+        // Note: Remap the elements, dropping triangles which no longer span three positions.
+        //
+        size_t kept_element_count = 0;
+        for (size_t element_index = 0; element_index < _elements_out.size(); element_index += 3)
+        {
+            const GLuint a = collapse_remap[_elements_out[element_index + 0]];
+            const GLuint b = collapse_remap[_elements_out[element_index + 1]];
+            const GLuint c = collapse_remap[_elements_out[element_index + 2]];
+            if ((position_remap[a] != position_remap[b]) &&
+                (position_remap[a] != position_remap[c]) &&
+                (position_remap[b] != position_remap[c]))
+            {
+                _elements_out[kept_element_count++] = a;
+                _elements_out[kept_element_count++] = b;
+                _elements_out[kept_element_count++] = c;
+            }
+        }
+
+        _elements_out.resize(kept_element_count);
+        RemapSimplifyEdgeLoop(open_outgoing, collapse_remap);
+        RemapSimplifyEdgeLoop(open_incoming, collapse_remap);
+        BuildSimplifyAdjacency(_elements_out, _vertex_count_in, adjacency);
+
+        for (auto& vertex_target : vertex_targets)
+        {
+            vertex_target = collapse_remap[vertex_target];
+        }
+    }
+
+    //
+    // Note: The quadric error is an area weighted mean of squared distances to many planes, and
+    //       can be far smaller than the distance to any one of them. The error reported is
+    //       therefore also no less than the distance from each vertex which was moved to the
+    //       nearest remaining triangle around the position it was collapsed onto, which bounds
+    //       its distance to the simplified surface. A vertex whose target has no triangles left
+    //       is measured against every remaining triangle instead.
+    //
+    std::vector<GLuint> position_elements(_elements_out.size());
+    for (size_t element_index = 0; element_index < _elements_out.size(); element_index++)
+    {
+        position_elements[element_index] = position_remap[_elements_out[element_index]];
+    }
+
+    BuildSimplifyAdjacency(position_elements, _vertex_count_in, adjacency);
+
+    std::vector<bool> vertex_measured(_vertex_count_in, false);
+    for (auto& element : _elements_in)
+    {
+        const GLuint target = position_remap[vertex_targets[element]];
+        if ((true == vertex_measured[element]) || (position_remap[element] == target) ||
+            (0 == position_elements.size()))
+        {
+            continue;
+        }
+
+        vertex_measured[element] = true;
+
+        float distance_error = std::numeric_limits<float>::max();
+        if (adjacency.offsets[target] != adjacency.offsets[target + 1])
+        {
+            for (size_t edge = adjacency.offsets[target]; edge < adjacency.offsets[target + 1];
+                 edge++)
+            {
+                distance_error = std::min(
+                  distance_error,
+                  SimplifyTriangleDistanceSquared(positions[element],
+                                                  positions[target],
+                                                  positions[adjacency.edges[edge].next],
+                                                  positions[adjacency.edges[edge].prev]));
+            }
+        }
+        else
+        {
+            for (size_t element_index = 0; element_index < position_elements.size();
+                 element_index += 3)
+            {
+                distance_error = std::min(
+                  distance_error,
+                  SimplifyTriangleDistanceSquared(positions[element],
+                                                  positions[position_elements[element_index + 0]],
+                                                  positions[position_elements[element_index + 1]],
+                                                  positions[position_elements[element_index + 2]]));
+            }
+        }
+
+        result_error = std::max(result_error, distance_error);
+    }
+
+    _error_out = std::sqrt(result_error) * scale;
+}
+
+// Note: Levels that keep more than this fraction of the previous level's elements are dropped.
+constexpr float lod_minimum_reduction = 0.95f;
+
+void
+GenerateLodChain(bool&                     _success_out,
+                 const std::vector<float>& _vertex_data_in,
+                 const size_t&             _floats_per_vertex_in,
+                 const size_t&             _position_offset_in,
+                 const size_t&             _vertex_count_in,
+                 const size_t&&            _max_lod_count_in,
+                 const float&&             _reduction_ratio_in,
+                 const float&&             _max_error_in,
+                 std::vector<GLuint>&      _elements_in_out,
+                 std::vector<MeshLod>&     _lods_out)
+{
+    _success_out = true;
+    _lods_out.clear();
+
+    if ((0.0f >= _reduction_ratio_in) || (1.0f <= _reduction_ratio_in))
+    {
+        Log_e("Level of detail reduction ratio must be between zero and one.");
+        _success_out = false;
+        return;
+    }
+
+    ValidateMeshElements(_success_out, _elements_in_out, _vertex_count_in);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    MeshLod first_lod;
+    first_lod.first_element = 0;
+    first_lod.element_count = _elements_in_out.size();
+    _lods_out.push_back(first_lod);
+
+    // Note: Every level is simplified from the full resolution level, rather than from the level
+    //       before it, so that its error is measured against the full resolution surface
+    //       instead of accumulating with each level.
+    const std::vector<GLuint> full_elements = _elements_in_out;
+    std::vector<GLuint>       lod_elements;
+    while (_lods_out.size() < _max_lod_count_in)
+    {
+        const MeshLod& previous_lod = _lods_out.back();
+
+        const size_t target_triangle_count = static_cast<size_t>(
+          static_cast<float>(previous_lod.element_count / 3) * _reduction_ratio_in);
+
+        float lod_error = 0.0f;
+        SimplifyMesh(_success_out,
+                     _vertex_data_in,
+                     _floats_per_vertex_in,
+                     _position_offset_in,
+                     _vertex_count_in,
+                     full_elements,
+                     target_triangle_count * 3,
+                     std::move(_max_error_in),
+                     lod_elements,
+                     lod_error);
+        if (false == _success_out)
+        {
+            return;
+        }
+
+        // Note: Stop when the simplifier is out of collapses within the error limit, or when the
+        //       measured deviation of the level exceeds it; a level barely smaller than the last
+        //       is not worth its element memory.
+        if ((0 == lod_elements.size()) || (lod_error > _max_error_in) ||
+            (static_cast<float>(lod_elements.size()) >
+             (static_cast<float>(previous_lod.element_count) * lod_minimum_reduction)))
+        {
+            break;
+        }
+
+        OptimizeVertexCache(_success_out, _vertex_count_in, lod_elements);
+        if (false == _success_out)
+        {
+            return;
+        }
+
+        MeshLod lod;
+        lod.first_element   = _elements_in_out.size();
+        lod.element_count   = lod_elements.size();
+        lod.geometric_error = std::max(previous_lod.geometric_error, lod_error);
+        _lods_out.push_back(lod);
+
+        _elements_in_out.insert(_elements_in_out.end(), lod_elements.begin(), lod_elements.end());
+    }
+}
+
+GLenum
+SelectElementDataType(const size_t& _vertex_count_in) noexcept
+{
+    if ((static_cast<size_t>(std::numeric_limits<GLushort>::max()) + 1) >= _vertex_count_in)
+    {
+        return GL_UNSIGNED_SHORT;
+    }
+
+    return GL_UNSIGNED_INT;
+}
+
+void
+PackElements(bool&                       _success_out,
+             const std::vector<GLuint>&  _elements_in,
+             const GLenum&&              _element_data_type_in,
+             std::vector<unsigned char>& _element_data_out)
+{
+    _success_out = true;
+
+    const size_t element_size_bytes = GLDataTypeSizeBytes(_element_data_type_in);
+    if ((GL_UNSIGNED_BYTE != _element_data_type_in) &&
+        (GL_UNSIGNED_SHORT != _element_data_type_in) && (GL_UNSIGNED_INT != _element_data_type_in))
+    {
+        Log_e("Unsupported element data type.");
+        _success_out = false;
+        return;
+    }
+
+    GLuint maximum_element = 0;
+    for (auto& element : _elements_in)
+    {
+        maximum_element = std::max(maximum_element, element);
+    }
+
+    if ((sizeof(GLuint) > element_size_bytes) &&
+        ((static_cast<GLuint>(1) << (element_size_bytes * 8)) <= maximum_element))
+    {
+        std::stringstream ss;
+        ss << "Element " << maximum_element << " does not fit a " << element_size_bytes
+           << " byte element buffer.";
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    _element_data_out.resize(_elements_in.size() * element_size_bytes);
+    switch (_element_data_type_in)
+    {
+        case GL_UNSIGNED_BYTE:
+        {
+            GLubyte* const element_data = reinterpret_cast<GLubyte*>(_element_data_out.data());
+            for (size_t element_index = 0; element_index < _elements_in.size(); element_index++)
+            {
+                element_data[element_index] = static_cast<GLubyte>(_elements_in[element_index]);
+            }
+            break;
+        }
+        case GL_UNSIGNED_SHORT:
+        {
+            GLushort* const element_data = reinterpret_cast<GLushort*>(_element_data_out.data());
+            for (size_t element_index = 0; element_index < _elements_in.size(); element_index++)
+            {
+                element_data[element_index] = static_cast<GLushort>(_elements_in[element_index]);
+            }
+            break;
+        }
+        default:
+        {
+            std::memcpy(_element_data_out.data(), _elements_in.data(), _element_data_out.size());
+            break;
+        }
+    }
+}
+
+void
+UnpackElements(bool&                _success_out,
+               const GLvoid* const  _element_data_in,
+               const size_t&        _element_count_in,
+               const GLenum&&       _element_data_type_in,
+               std::vector<GLuint>& _elements_out)
+{
+    _success_out = true;
+
+    _elements_out.resize(_element_count_in);
+    switch (_element_data_type_in)
+    {
+        case GL_UNSIGNED_BYTE:
+        {
+            const GLubyte* const element_data = static_cast<const GLubyte*>(_element_data_in);
+            for (size_t element_index = 0; element_index < _element_count_in; element_index++)
+            {
+                _elements_out[element_index] = element_data[element_index];
+            }
+            break;
+        }
+        case GL_UNSIGNED_SHORT:
+        {
+            const GLushort* const element_data = static_cast<const GLushort*>(_element_data_in);
+            for (size_t element_index = 0; element_index < _element_count_in; element_index++)
+            {
+                _elements_out[element_index] = element_data[element_index];
+            }
+            break;
+        }
+        case GL_UNSIGNED_INT:
+        {
+            std::memcpy(_elements_out.data(), _element_data_in, _element_count_in * sizeof(GLuint));
+            break;
+        }
+        default:
+        {
+            Log_e("Unsupported element data type.");
+            _elements_out.clear();
+            _success_out = false;
+        }
+    }
+}
+
+// Note: Round to nearest even. Values too large for a half float become infinity.
+static inline uint16_t
+FloatToHalf(const float& _value_in)
+{
+    const uint32_t bits              = std::bit_cast<uint32_t>(_value_in);
+    const uint32_t sign              = (bits >> 16) & 0x8000;
+    const uint32_t exponent_mantissa = bits & 0x7FFFFFFF;
+
+    // Infinity and NaN.
+    if (0x7F800000 <= exponent_mantissa)
+    {
+        const uint32_t quiet_bit = (0x7F800000 < exponent_mantissa) ? 0x200 : 0;
+        return static_cast<uint16_t>(sign | 0x7C00 | quiet_bit);
+    }
+
+    // At or above 65520, which rounds beyond the largest half float.
+    if (0x477FF000 <= exponent_mantissa)
+    {
+        return static_cast<uint16_t>(sign | 0x7C00);
+    }
+
+    // Below 2^-14, the smallest normal half float.
+    if (0x38800000 > exponent_mantissa)
+    {
+        // Below 2^-25, which rounds to zero.
+        if (0x33000000 > exponent_mantissa)
+        {
+            return static_cast<uint16_t>(sign);
+        }
+
+        const uint32_t exponent  = exponent_mantissa >> 23;
+        const uint32_t mantissa  = (exponent_mantissa & 0x7FFFFF) | 0x800000;
+        const uint32_t shift     = 126 - exponent;
+        const uint32_t remainder = mantissa & ((1u << shift) - 1);
+        const uint32_t halfway   = 1u << (shift - 1);
+
+        uint32_t half = mantissa >> shift;
+        if ((remainder > halfway) || ((remainder == halfway) && (0 != (half & 1))))
+        {
+            half++;
+        }
+
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    // Rebias the exponent from 127 to 15, then round away the low 13 bits of the mantissa.
+    uint32_t rebiased = exponent_mantissa - (112u << 23);
+    rebiased += 0x0FFF + ((rebiased >> 13) & 1);
+    return static_cast<uint16_t>(sign | (rebiased >> 13));
+}
+
+static inline float
+HalfToFloat(const uint16_t& _value_in)
+{
+    const uint32_t sign     = static_cast<uint32_t>(_value_in & 0x8000) << 16;
+    const uint32_t exponent = (_value_in >> 10) & 0x1F;
+    const uint32_t mantissa = _value_in & 0x3FF;
+
+    if (0 == exponent)
+    {
+        const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return (0 == sign) ? magnitude : -magnitude;
+    }
+
+    if (0x1F == exponent)
+    {
+        return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13));
+    }
+
+    return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+static inline int16_t
+FloatToSnorm16(const float& _value_in)
+{
+    return static_cast<int16_t>(std::lround(std::clamp(_value_in, -1.0f, 1.0f) * 32767.0f));
+}
+
+static inline float
+Snorm16ToFloat(const int16_t& _value_in)
+{
+    return std::max(static_cast<float>(_value_in) / 32767.0f, -1.0f);
+}
+
+static inline uint16_t
+FloatToUnorm16(const float& _value_in)
+{
+    return static_cast<uint16_t>(std::lround(std::clamp(_value_in, 0.0f, 1.0f) * 65535.0f));
+}
+
+static inline float
+Unorm16ToFloat(const uint16_t& _value_in)
+{
+    return static_cast<float>(_value_in) / 65535.0f;
+}
+
+// Note: Octahedral mapping of a unit vector onto [-1, 1]^2; see Cigolle et al., "A Survey of
+//       Efficient Representations for Independent Unit Vectors".
+static inline glm::vec2
+OctahedralEncode(const glm::vec3& _normal_in)
+{
+    const float l1_norm = std::abs(_normal_in.x) + std::abs(_normal_in.y) +
+                          std::abs(_normal_in.z);
+    if (0.0f == l1_norm)
+    {
+        return glm::vec2(0.0f);
+    }
+
+    glm::vec2 encoded = glm::vec2(_normal_in.x, _normal_in.y) / l1_norm;
+    if (0.0f > _normal_in.z)
+    {
+        const glm::vec2 sign_not_zero = glm::vec2((0.0f <= encoded.x) ? 1.0f : -1.0f,
+                                                  (0.0f <= encoded.y) ? 1.0f : -1.0f);
+        encoded = (1.0f - glm::abs(glm::vec2(encoded.y, encoded.x))) * sign_not_zero;
+    }
+
+    return encoded;
+}
+
+static inline glm::vec3
+OctahedralDecode(const glm::vec2& _encoded_in)
+{
+    glm::vec3 normal(_encoded_in.x,
+                     _encoded_in.y,
+                     1.0f - std::abs(_encoded_in.x) - std::abs(_encoded_in.y));
+    if (0.0f > normal.z)
+    {
+        const glm::vec2 sign_not_zero = glm::vec2((0.0f <= normal.x) ? 1.0f : -1.0f,
+                                                  (0.0f <= normal.y) ? 1.0f : -1.0f);
+        const glm::vec2 folded = (1.0f - glm::abs(glm::vec2(normal.y, normal.x))) * sign_not_zero;
+        normal.x               = folded.x;
+        normal.y               = folded.y;
+    }
+
+    return glm::normalize(normal);
+}
+
+static inline size_t
+AlignVertexAttributeOffset(const size_t& _offset_in)
+{
+    return (_offset_in + 3) & ~static_cast<size_t>(3);
+}
+
+void
+QuantizeVertices(
+  bool&                                              _success_out,
+  const PositionQuantization&&                       _position_quantization_in,
+  const size_t&                                      _vertex_count_in,
+  const std::vector<float>&                          _vertex_data_in,
+  const std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_in,
+  std::vector<unsigned char>&                        _vertex_data_out,
+  std::vector<glt::VertexAttributeDescriptor>&       _vertex_attribute_pointers_out,
+  VertexQuantizationReport&                          _report_out)
+{
+    _success_out = true;
+    _report_out  = {};
+
+    if (0 == _vertex_attribute_pointers_in.size())
+    {
+        Log_e("No vertex attributes to quantize.");
+        _success_out = false;
+        return;
+    }
+
+    const size_t input_stride_bytes = _vertex_attribute_pointers_in[0]
+                                        .byte_stride_between_elements;
+    const size_t floats_per_vertex  = input_stride_bytes / sizeof(float);
+    if ((0 == floats_per_vertex) ||
+        (_vertex_data_in.size() != (_vertex_count_in * floats_per_vertex)))
+    {
+        Log_e("Vertex data size does not match the vertex count and vertex stride.");
+        _success_out = false;
+        return;
+    }
+
+    //
+    // Note: The first pass validates the input layout and assigns each attribute its output
+    //       type and offset.
+    //
+    struct QuantizedAttribute
+    {
+        glt::VertexDataType vertex_data_type       = glt::VertexDataType::COUNT;
+        size_t              input_offset_floats    = 0;
+        size_t              output_offset_bytes    = 0;
+        GLint               output_component_count = 0;
+        GLenum              output_data_type       = GL_FLOAT;
+        GLboolean           output_normalized      = false;
+    };
+
+    std::vector<QuantizedAttribute> attributes;
+    size_t                          output_stride_bytes = 0;
+    for (auto& descriptor : _vertex_attribute_pointers_in)
+    {
+        if ((GL_FLOAT != descriptor.data_type) ||
+            (true == descriptor.should_be_normalized_by_gpu) ||
+            (input_stride_bytes != static_cast<size_t>(descriptor.byte_stride_between_elements)))
+        {
+            Log_e("Only interleaved, unnormalized float vertex attributes may be quantized.");
+            _success_out = false;
+            return;
+        }
+
+        QuantizedAttribute attribute;
+        attribute.vertex_data_type    = descriptor.vertex_data_type;
+        attribute.input_offset_floats = reinterpret_cast<uintptr_t>(
+                                          descriptor.first_component_byte_offset) /
+                                        sizeof(float);
+        attribute.output_offset_bytes = output_stride_bytes;
+
+        GLint expected_component_count = 0;
+        switch (descriptor.vertex_data_type)
+        {
+            case glt::VertexDataType::POSITION:
+            {
+                expected_component_count         = 3;
+                attribute.output_component_count = 3;
+                attribute.output_data_type       = (PositionQuantization::SNORM16 ==
+                                                    _position_quantization_in)
+                                                     ? GL_SHORT
+                                                     : GL_HALF_FLOAT;
+                attribute.output_normalized      = (GL_SHORT == attribute.output_data_type);
+                break;
+            }
+            case glt::VertexDataType::NORMAL:
+            {
+                expected_component_count         = 3;
+                attribute.output_component_count = 2;
+                attribute.output_data_type       = GL_SHORT;
+                attribute.output_normalized      = true;
+                break;
+            }
+            case glt::VertexDataType::TEXTURE:
+            {
+                expected_component_count         = 2;
+                attribute.output_component_count = 2;
+                attribute.output_data_type       = GL_UNSIGNED_SHORT;
+                attribute.output_normalized      = true;
+                break;
+            }
+            case glt::VertexDataType::TANGENT:
+            {
+                expected_component_count         = 4;
+                attribute.output_component_count = 4;
+                attribute.output_data_type       = GL_SHORT;
+                attribute.output_normalized      = true;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        if ((0 == expected_component_count) ||
+            (expected_component_count != descriptor.component_count) ||
+            ((attribute.input_offset_floats + expected_component_count) > floats_per_vertex))
+        {
+            Log_e("Unsupported vertex attribute layout for quantization.");
+            _success_out = false;
+            return;
+        }
+
+        attributes.push_back(attribute);
+        output_stride_bytes = AlignVertexAttributeOffset(
+          output_stride_bytes +
+          (attribute.output_component_count * GLDataTypeSizeBytes(attribute.output_data_type)));
+    }
+
+    // Note: Per-mesh bounds for SNORM16 positions, and the texture coordinate range check.
+    glm::vec3 position_minimum(std::numeric_limits<float>::max());
+    glm::vec3 position_maximum(std::numeric_limits<float>::lowest());
+    for (auto& attribute : attributes)
+    {
+        for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+        {
+            const float* const input = &_vertex_data_in[(vertex * floats_per_vertex) +
+                                                        attribute.input_offset_floats];
+            if (glt::VertexDataType::POSITION == attribute.vertex_data_type)
+            {
+                position_minimum = glm::min(position_minimum,
+                                            glm::vec3(input[0], input[1], input[2]));
+                position_maximum = glm::max(position_maximum,
+                                            glm::vec3(input[0], input[1], input[2]));
+            }
+            else if ((glt::VertexDataType::TEXTURE == attribute.vertex_data_type) &&
+                     ((0.0f > input[0]) || (1.0f < input[0]) || (0.0f > input[1]) ||
+                      (1.0f < input[1])))
+            {
+                attribute.output_data_type                     = GL_HALF_FLOAT;
+                attribute.output_normalized                    = false;
+                _report_out.texture_coordinates_use_half_float = true;
+            }
+        }
+    }
+
+    if ((PositionQuantization::SNORM16 == _position_quantization_in) && (0 < _vertex_count_in))
+    {
+        const glm::vec3 half_extent = (position_maximum - position_minimum) * 0.5f;
+        _report_out.position_bias   = (position_maximum + position_minimum) * 0.5f;
+        _report_out.position_scale  = std::max({ half_extent.x, half_extent.y, half_extent.z });
+        if (0.0f == _report_out.position_scale)
+        {
+            _report_out.position_scale = 1.0f;
+        }
+    }
+
+    //
+    // Note: The second pass encodes every attribute, decoding each value again to measure the
+    //       error introduced.
+    //
+    _vertex_data_out.assign(_vertex_count_in * output_stride_bytes, 0);
+    const float inverse_position_scale = 1.0f / _report_out.position_scale;
+    for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        const float* const   input_vertex  = &_vertex_data_in[vertex * floats_per_vertex];
+        unsigned char* const output_vertex = &_vertex_data_out[vertex * output_stride_bytes];
+        for (auto& attribute : attributes)
+        {
+            const float* const   input  = input_vertex + attribute.input_offset_floats;
+            unsigned char* const output = output_vertex + attribute.output_offset_bytes;
+            switch (attribute.vertex_data_type)
+            {
+                case glt::VertexDataType::POSITION:
+                {
+                    for (size_t component = 0; component < 3; component++)
+                    {
+                        float decoded = 0.0f;
+                        if (GL_SHORT == attribute.output_data_type)
+                        {
+                            const int16_t encoded = FloatToSnorm16(
+                              (input[component] - _report_out.position_bias[component]) *
+                              inverse_position_scale);
+                            std::memcpy(output + (component * sizeof(int16_t)),
+                                        &encoded,
+                                        sizeof(int16_t));
+                            decoded = (Snorm16ToFloat(encoded) * _report_out.position_scale) +
+                                      _report_out.position_bias[component];
+                        }
+                        else
+                        {
+                            const uint16_t encoded = FloatToHalf(input[component]);
+                            std::memcpy(output + (component * sizeof(uint16_t)),
+                                        &encoded,
+                                        sizeof(uint16_t));
+                            decoded = HalfToFloat(encoded);
+                        }
+
+                        _report_out.max_position_error = std::max(_report_out.max_position_error,
+                                                                  std::abs(decoded -
+                                                                           input[component]));
+                    }
+                    break;
+                }
+                case glt::VertexDataType::NORMAL:
+                {
+                    const glm::vec3 normal(input[0], input[1], input[2]);
+                    const glm::vec2 octahedral = OctahedralEncode(normal);
+                    const int16_t   encoded[2] = { FloatToSnorm16(octahedral.x),
+                                                   FloatToSnorm16(octahedral.y) };
+                    std::memcpy(output, encoded, sizeof(encoded));
+
+                    if (0.0f < glm::length(normal))
+                    {
+                        const glm::vec3 decoded = OctahedralDecode(
+                          glm::vec2(Snorm16ToFloat(encoded[0]), Snorm16ToFloat(encoded[1])));
+                        const float cosine = std::clamp(glm::dot(decoded, glm::normalize(normal)),
+                                                        -1.0f,
+                                                        1.0f);
+                        _report_out.max_normal_error_degrees = std::max(
+                          _report_out.max_normal_error_degrees,
+                          glm::degrees(std::acos(cosine)));
+                    }
+                    break;
+                }
+                case glt::VertexDataType::TEXTURE:
+                {
+                    for (size_t component = 0; component < 2; component++)
+                    {
+                        float    decoded = 0.0f;
+                        uint16_t encoded = 0;
+                        if (GL_UNSIGNED_SHORT == attribute.output_data_type)
+                        {
+                            encoded = FloatToUnorm16(input[component]);
+                            decoded = Unorm16ToFloat(encoded);
+                        }
+                        else
+                        {
+                            encoded = FloatToHalf(input[component]);
+                            decoded = HalfToFloat(encoded);
+                        }
+
+                        std::memcpy(output + (component * sizeof(uint16_t)),
+                                    &encoded,
+                                    sizeof(uint16_t));
+                        _report_out.max_texture_coordinate_error = std::max(
+                          _report_out.max_texture_coordinate_error,
+                          std::abs(decoded - input[component]));
+                    }
+                    break;
+                }
+                case glt::VertexDataType::TANGENT:
+                {
+                    const glm::vec3 tangent(input[0], input[1], input[2]);
+                    const int16_t   encoded[4] = { FloatToSnorm16(input[0]),
+                                                   FloatToSnorm16(input[1]),
+                                                   FloatToSnorm16(input[2]),
+                                                   FloatToSnorm16((0.0f > input[3]) ? -1.0f
+                                                                                    : 1.0f) };
+                    std::memcpy(output, encoded, sizeof(encoded));
+
+                    if (0.0f < glm::length(tangent))
+                    {
+                        const glm::vec3 decoded = glm::normalize(
+                          glm::vec3(Snorm16ToFloat(encoded[0]),
+                                    Snorm16ToFloat(encoded[1]),
+                                    Snorm16ToFloat(encoded[2])));
+                        const float cosine = std::clamp(glm::dot(decoded, glm::normalize(tangent)),
+                                                        -1.0f,
+                                                        1.0f);
+                        _report_out.max_tangent_error_degrees = std::max(
+                          _report_out.max_tangent_error_degrees,
+                          glm::degrees(std::acos(cosine)));
+                    }
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    _vertex_attribute_pointers_out.clear();
+    for (size_t attribute_index = 0; attribute_index < attributes.size(); attribute_index++)
+    {
+        const glt::VertexAttributeDescriptor& descriptor = _vertex_attribute_pointers_in
+          [attribute_index];
+        const QuantizedAttribute& attribute = attributes[attribute_index];
+
+        const GLvoid* first_component_byte_offset = reinterpret_cast<const GLvoid*>(
+          attribute.output_offset_bytes);
+        _vertex_attribute_pointers_out.push_back(
+          glt::VertexAttributeDescriptor(std::move(descriptor.vertex_array_object_id),
+                                         std::move(descriptor.vertex_attribute_index),
+                                         std::move(attribute.output_component_count),
+                                         std::move(attribute.output_data_type),
+                                         std::move(attribute.output_normalized),
+                                         static_cast<GLsizei>(output_stride_bytes),
+                                         std::move(first_component_byte_offset),
+                                         std::move(attribute.vertex_data_type)));
+    }
+
+    _report_out.vertex_size_bytes_before = input_stride_bytes;
+    _report_out.vertex_size_bytes_after  = output_stride_bytes;
+    _report_out.bytes_saved              = (input_stride_bytes - output_stride_bytes) *
+                                           _vertex_count_in;
+}
@@ -0,0 +1,262 @@
+#ifndef mesh_tools_h
+#define mesh_tools_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "gl_tools.h"
+
+//
+// Note: Mesh tools operate on the interleaved float vertex buffers and GLuint element buffers
+//       produced by the model importers (see LoadModelFromPlyFile(...) in model.h). None of
+//       these functions make OpenGL calls; they are run at import time, before upload.
+//
+
+struct VertexWeldReport
+{
+    size_t vertex_count_before = 0;
+    size_t vertex_count_after  = 0;
+    size_t bytes_saved         = 0;
+};
+
+// Note: Merges vertices which are identical across all `_floats_per_vertex_in` components,
+//       compacting `_vertex_data_in_out` and remapping `_elements_in_out` to the survivors.
+//       The first occurrence of each vertex is kept, so the relative order of the remaining
+//       vertices is unchanged.
+//
+//       When `_epsilon_in` is zero, components must match exactly (0.0f and -0.0f are treated
+//       as equal). Otherwise, components are quantized to the nearest multiple of
+//       `_epsilon_in` before comparison. Note that two values closer than `_epsilon_in` may
+//       still round to neighbouring multiples and remain distinct.
+void
+WeldVertices(bool&                _success_out,
+             const size_t&        _floats_per_vertex_in,
+             const float&&        _epsilon_in,
+             size_t&              _vertex_count_in_out,
+             std::vector<float>&  _vertex_data_in_out,
+             std::vector<GLuint>& _elements_in_out,
+             VertexWeldReport&    _report_out);
+
+enum class VertexCacheModel
+{
+    FIFO = 0,
+    LRU
+};
+
+// Note: ACMR is the average number of cache misses per triangle, lower bounded by 0.5 for a
+//       large closed mesh. ATVR is the number of cache misses per referenced vertex, lower
+//       bounded by 1.0, which is reached when every vertex is transformed exactly once.
+struct VertexCacheStatistics
+{
+    size_t cache_miss_count = 0;
+    float  acmr             = 0.0f;
+    float  atvr             = 0.0f;
+};
+
+// Note: Simulates a post-transform vertex cache of `_cache_size_in` entries over the triangle
+//       list in `_elements_in`.
+void
+AnalyzeVertexCache(bool&                      _success_out,
+                   const std::vector<GLuint>& _elements_in,
+                   const size_t&              _vertex_count_in,
+                   const size_t&&             _cache_size_in,
+                   const VertexCacheModel&&   _cache_model_in,
+                   VertexCacheStatistics&     _statistics_out);
+
+// Note: Reorders triangles for post-transform vertex cache locality using Tom Forsyth's
+//       "Linear-Speed Vertex Cache Optimisation", with a 32 entry LRU cache model.
+void
+OptimizeVertexCache(bool&                _success_out,
+                    const size_t&        _vertex_count_in,
+                    std::vector<GLuint>& _elements_in_out);
+
+// Note: Reorders clusters of triangles such that outward facing clusters are drawn first, after
+//       Sander, Nehab and Barczak, "Fast Triangle Reordering for Vertex Locality and Reduced
+//       Overdraw". Clusters are split where the vertex cache order already starts a new patch,
+//       and further wherever a cluster's ACMR stays within `_acmr_threshold_in` (e.g. 1.05) of
+//       the ACMR of the patch containing it. Run after OptimizeVertexCache(...).
+//
+//       Positions are read as three floats at `_position_offset_in` floats into each vertex.
+void
+OptimizeOverdraw(bool&                     _success_out,
+                 const std::vector<float>& _vertex_data_in,
+                 const size_t&             _floats_per_vertex_in,
+                 const size_t&             _position_offset_in,
+                 const size_t&             _vertex_count_in,
+                 const float&&             _acmr_threshold_in,
+                 std::vector<GLuint>&      _elements_in_out);
+
+// Note: Renumbers vertices in the order they are first referenced by `_elements_in_out`, such
+//       that vertex fetch walks the vertex buffer front to back. Vertices that are not referenced
+//       are dropped, and `_vertex_count_in_out` is updated to match.
+void
+OptimizeVertexFetch(bool&                _success_out,
+                    const size_t&        _floats_per_vertex_in,
+                    size_t&              _vertex_count_in_out,
+                    std::vector<float>&  _vertex_data_in_out,
+                    std::vector<GLuint>& _elements_in_out);
+
+struct MeshOptimizationReport
+{
+    size_t                cache_size = 0;
+    VertexCacheStatistics fifo_before;
+    VertexCacheStatistics fifo_after;
+    VertexCacheStatistics lru_before;
+    VertexCacheStatistics lru_after;
+};
+
+// Note: Runs OptimizeVertexCache(...), OptimizeOverdraw(...) and OptimizeVertexFetch(...) in
+//       order, reporting FIFO and LRU cache statistics before and after, with a cache of
+//       `_cache_size_in` entries.
+void
+OptimizeMesh(bool&                   _success_out,
+             const size_t&           _floats_per_vertex_in,
+             const size_t&           _position_offset_in,
+             const size_t&&          _cache_size_in,
+             size_t&                 _vertex_count_in_out,
+             std::vector<float>&     _vertex_data_in_out,
+             std::vector<GLuint>&    _elements_in_out,
+             MeshOptimizationReport& _report_out);
+
+// Note: Reduces `_elements_in` to at most `_target_element_count_in` elements by collapsing
+//       edges in order of quadric error, stopping early if the quadric error of the next collapse
+//       exceeds `_target_error_in` model units (std::numeric_limits<float>::max() for no limit).
+//       Edges only collapse onto existing vertices; the vertex buffer is not modified, and
+//       `_elements_out` indexes it as `_elements_in` does.
+//
+//       Open borders and attribute seams (vertices which share a position but not normals or
+//       texture coordinates) only collapse along themselves, and vertices where they meet are
+//       never moved, so silhouettes and texture coordinate seams are kept.
+//
+//       `_error_out` is the largest deviation introduced, in model units: the larger of the
+//       quadric error of the collapses made, and the distance from each moved vertex of
+//       `_elements_in` to the simplified triangles around the vertex it was collapsed onto, or
+//       to the nearest simplified triangle if none remain around it. It is never less than the
+//       distance from any vertex of `_elements_in` to the simplified surface. Since
+//       `_target_error_in` only limits the quadric error, `_error_out` may exceed it; callers
+//       holding to an error budget must check `_error_out`.
+void
+SimplifyMesh(bool&                      _success_out,
+             const std::vector<float>&  _vertex_data_in,
+             const size_t&              _floats_per_vertex_in,
+             const size_t&              _position_offset_in,
+             const size_t&              _vertex_count_in,
+             const std::vector<GLuint>& _elements_in,
+             const size_t&&             _target_element_count_in,
+             const float&&              _target_error_in,
+             std::vector<GLuint>&       _elements_out,
+             float&                     _error_out);
+
+// Note: A range of an element buffer drawing one level of detail, and how far, in model units,
+//       its surface may be from the full resolution surface.
+struct MeshLod
+{
+    size_t first_element   = 0;
+    size_t element_count   = 0;
+    float  geometric_error = 0.0f;
+};
+
+// Note: Appends up to `_max_lod_count_in` - 1 simplified levels of detail to `_elements_in_out`,
+//       each with `_reduction_ratio_in` of the triangles of the level before it, stopping early
+//       once a level would exceed `_max_error_in`. Each level is simplified from the full
+//       resolution level, and its geometric error is no less than that of the level before it.
+//       `_lods_out` receives the full resolution level first, followed by each appended level,
+//       coarsest last. All levels index the same vertices, and each is ordered for the vertex
+//       cache.
+void
+GenerateLodChain(bool&                     _success_out,
+                 const std::vector<float>& _vertex_data_in,
+                 const size_t&             _floats_per_vertex_in,
+                 const size_t&             _position_offset_in,
+                 const size_t&             _vertex_count_in,
+                 const size_t&&            _max_lod_count_in,
+                 const float&&             _reduction_ratio_in,
+                 const float&&             _max_error_in,
+                 std::vector<GLuint>&      _elements_in_out,
+                 std::vector<MeshLod>&     _lods_out);
+
+// Note: Returns the smallest element data type that can index `_vertex_count_in` vertices:
+//       GL_UNSIGNED_SHORT for up to 65,536 vertices, otherwise GL_UNSIGNED_INT. Byte indices
+//       are accepted by PackElements(...) but never selected here, as many drivers widen them on
+//       the CPU at draw time, and meshes that small gain little from them.
+GLenum
+SelectElementDataType(const size_t& _vertex_count_in) noexcept;
+
+// Note: Narrows `_elements_in` into `_element_data_out` as GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT
+//       or GL_UNSIGNED_INT elements. Fails if any element does not fit the type.
+void
+PackElements(bool&                       _success_out,
+             const std::vector<GLuint>&  _elements_in,
+             const GLenum&&              _element_data_type_in,
+             std::vector<unsigned char>& _element_data_out);
+
+// Note: Widens `_element_count_in` elements of `_element_data_type_in` back to GLuint.
+void
+UnpackElements(bool&                _success_out,
+               const GLvoid* const  _element_data_in,
+               const size_t&        _element_count_in,
+               const GLenum&&       _element_data_type_in,
+               std::vector<GLuint>& _elements_out);
+
+enum class PositionQuantization
+{
+    HALF_FLOAT = 0,
+    SNORM16
+};
+
+// Note: SNORM16 positions are stored relative to the mesh bounds and decode as
+//       (stored * position_scale) + position_bias. The scale is uniform so that normals are
+//       unaffected; fold glm::translate(position_bias) * glm::scale(glm::vec3(position_scale))
+//       into the model matrix. HALF_FLOAT positions are stored as-is, with a scale of one and no
+//       bias.
+//
+//       Errors are the largest absolute difference between an input value and its decoded
+//       quantized value: in model units for positions, degrees for normals and tangents, and
+//       texture space units for texture coordinates.
+struct VertexQuantizationReport
+{
+    float     position_scale = 1.0f;
+    glm::vec3 position_bias  = glm::vec3(0.0f);
+
+    size_t vertex_size_bytes_before = 0;
+    size_t vertex_size_bytes_after  = 0;
+    size_t bytes_saved              = 0;
+
+    float max_position_error           = 0.0f;
+    float max_normal_error_degrees     = 0.0f;
+    float max_texture_coordinate_error = 0.0f;
+    float max_tangent_error_degrees    = 0.0f;
+
+    // Note: Texture coordinates outside of [0, 1] cannot be stored as UNORM16, and are stored as
+    //       half floats instead, at the same size.
+    bool texture_coordinates_use_half_float = false;
+};
+
+//
+// Note: Re-encodes an interleaved float vertex buffer, as produced by the model importers, into
+//       smaller attribute encodings:
+//
+//       POSITION: 3 x GL_HALF_FLOAT, or 3 x GL_SHORT (normalized), padded to 8 bytes.
+//       NORMAL:   2 x GL_SHORT (normalized), octahedral encoding. Decode with
+//                 OctahedralDecode(...) in utils.glsl.
+//       TEXTURE:  2 x GL_UNSIGNED_SHORT (normalized).
+//       TANGENT:  4 x GL_SHORT (normalized); w remains exactly -1 or 1.
+//
+//       Attributes keep their order, and every attribute begins on a four byte boundary. The
+//       output descriptors keep the vertex array object and attribute indices of the input
+//       descriptors, with strides and offsets computed from the quantized attribute sizes. The
+//       monkey's 32 byte vertex becomes 16 bytes.
+//
+void
+QuantizeVertices(
+  bool&                                              _success_out,
+  const PositionQuantization&&                       _position_quantization_in,
+  const size_t&                                      _vertex_count_in,
+  const std::vector<float>&                          _vertex_data_in,
+  const std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_in,
+  std::vector<unsigned char>&                        _vertex_data_out,
+  std::vector<glt::VertexAttributeDescriptor>&       _vertex_attribute_pointers_out,
+  VertexQuantizationReport&                          _report_out);
+
+#endif // mesh_tools_h
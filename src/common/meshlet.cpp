@@ -0,0 +1,522 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "meshlet.h"
+
+#include "logging.h"
+
+static_assert(std::is_trivially_copyable<Meshlet>::value,
+              "Meshlets are written to and mapped from cooked mesh files.");
+
+// Note: Computes the bounds and normal cone of the triangles in `_meshlet_in_out`, whose element
+//       range is already set. The cone follows Arseny Kapoulkine's meshoptimizer.
+static void
+ComputeMeshletBounds(const std::vector<glm::vec3>& _positions_in,
+                     const std::vector<GLuint>&    _elements_in,
+                     Meshlet&                      _meshlet_in_out)
+{
+    const GLuint* const elements = &_elements_in[_meshlet_in_out.first_element];
+
+    glm::vec3 minimum(std::numeric_limits<float>::max());
+    glm::vec3 maximum(std::numeric_limits<float>::lowest());
+    for (size_t element_index = 0; element_index < _meshlet_in_out.element_count; element_index++)
+    {
+        minimum = glm::min(minimum, _positions_in[elements[element_index]]);
+        maximum = glm::max(maximum, _positions_in[elements[element_index]]);
+    }
+
+    const glm::vec3 center = (minimum + maximum) * 0.5f;
+    float           radius = 0.0f;
+    for (size_t element_index = 0; element_index < _meshlet_in_out.element_count; element_index++)
+    {
+        radius = std::max(radius, glm::distance(center, _positions_in[elements[element_index]]));
+    }
+
+    _meshlet_in_out.aabb_minimum           = minimum;
+    _meshlet_in_out.aabb_maximum           = maximum;
+    _meshlet_in_out.bounding_sphere_center = center;
+    _meshlet_in_out.bounding_sphere_radius = radius;
+
+    // Note: The cone axis is the mean triangle normal, and its spread the widest angle between
+    //       the axis and any triangle normal.
+    std::vector<glm::vec3> normals;
+    glm::vec3              normal_sum(0.0f);
+    for (size_t element_index = 0; element_index < _meshlet_in_out.element_count;
+         element_index += 3)
+    {
+        const glm::vec3& p0     = _positions_in[elements[element_index + 0]];
+        const glm::vec3& p1     = _positions_in[elements[element_index + 1]];
+        const glm::vec3& p2     = _positions_in[elements[element_index + 2]];
+        const glm::vec3  normal = glm::cross(p1 - p0, p2 - p0);
+        const float      length = glm::length(normal);
+        if (0.0f == length)
+        {
+            normals.push_back(glm::vec3(0.0f));
+            continue;
+        }
+
+        normals.push_back(normal / length);
+        normal_sum += normals.back();
+    }
+
+    _meshlet_in_out.cone_cutoff = 2.0f;
+    _meshlet_in_out.cone_apex   = center;
+    _meshlet_in_out.cone_axis   = glm::vec3(0.0f);
+
+    const float normal_sum_length = glm::length(normal_sum);
+    if (0.0f == normal_sum_length)
+    {
+        return;
+    }
+
+    const glm::vec3 axis           = normal_sum / normal_sum_length;
+    float           minimum_cosine = 1.0f;
+    for (auto& normal : normals)
+    {
+        if (glm::vec3(0.0f) != normal)
+        {
+            minimum_cosine = std::min(minimum_cosine, glm::dot(axis, normal));
+        }
+    }
+
+    // Note: Normals spread over a hemisphere or more are always partly front facing.
+    if (0.0f >= minimum_cosine)
+    {
+        return;
+    }
+
+    // Note: The apex is moved back along the axis until it is behind every triangle's plane,
+    //       such that any view direction within the cone from the apex sees only back faces.
+    float apex_offset = 0.0f;
+    for (size_t triangle_index = 0; triangle_index < normals.size(); triangle_index++)
+    {
+        const glm::vec3& normal = normals[triangle_index];
+        if (glm::vec3(0.0f) == normal)
+        {
+            continue;
+        }
+
+        const glm::vec3& p0 = _positions_in[elements[triangle_index * 3]];
+        apex_offset = std::max(apex_offset, glm::dot(center - p0, normal) / glm::dot(axis, normal));
+    }
+
+    // Note: Widening the normal cone by 90 degrees on each side and inverting it gives the cone of
+    //       view directions from which every triangle faces away: cos(90 + angle) = -sin(angle).
+    _meshlet_in_out.cone_apex   = center - (axis * apex_offset);
+    _meshlet_in_out.cone_axis   = axis;
+    _meshlet_in_out.cone_cutoff = std::sqrt(1.0f - (minimum_cosine * minimum_cosine));
+}
+
+void
+BuildMeshlets(bool&                     _success_out,
+              const std::vector<float>& _vertex_data_in,
+              const size_t&             _floats_per_vertex_in,
+              const size_t&             _position_offset_in,
+              const size_t&             _vertex_count_in,
+              std::vector<GLuint>&      _elements_in_out,
+              std::vector<Meshlet>&     _meshlets_out)
+{
+    _success_out = true;
+    _meshlets_out.clear();
+
+    if (0 != (_elements_in_out.size() % 3))
+    {
+        Log_e("Element count must be a multiple of three; meshes must be triangulated.");
+        _success_out = false;
+        return;
+    }
+
+    if (std::numeric_limits<uint32_t>::max() < _elements_in_out.size())
+    {
+        Log_e("Meshlets address at most 2^32 - 1 elements.");
+        _success_out = false;
+        return;
+    }
+
+    if (((_position_offset_in + 3) > _floats_per_vertex_in) ||
+        (_vertex_data_in.size() < (_vertex_count_in * _floats_per_vertex_in)))
+    {
+        Log_e("Vertex data does not contain a position for every vertex.");
+        _success_out = false;
+        return;
+    }
+
+    for (auto& element : _elements_in_out)
+    {
+        if (element >= _vertex_count_in)
+        {
+            std::stringstream ss;
+            ss << "Element " << element << " exceeds the vertex count (" << _vertex_count_in
+               << ").";
+            Log_e(ss);
+            _success_out = false;
+            return;
+        }
+    }
+
+    std::vector<glm::vec3> positions(_vertex_count_in);
+    for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        const float* const position = &_vertex_data_in[(vertex * _floats_per_vertex_in) +
+                                                       _position_offset_in];
+        positions[vertex]           = glm::vec3(position[0], position[1], position[2]);
+    }
+
+    const size_t           triangle_count = _elements_in_out.size() / 3;
+    std::vector<glm::vec3> triangle_normals(triangle_count);
+    std::vector<glm::vec3> triangle_centroids(triangle_count);
+    float                  total_area = 0.0f;
+    for (size_t triangle = 0; triangle < triangle_count; triangle++)
+    {
+        const glm::vec3& p0     = positions[_elements_in_out[(triangle * 3) + 0]];
+        const glm::vec3& p1     = positions[_elements_in_out[(triangle * 3) + 1]];
+        const glm::vec3& p2     = positions[_elements_in_out[(triangle * 3) + 2]];
+        const glm::vec3  normal = glm::cross(p1 - p0, p2 - p0);
+        const float      length = glm::length(normal);
+
+        triangle_normals[triangle]   = (0.0f == length) ? glm::vec3(0.0f) : (normal / length);
+        triangle_centroids[triangle] = (p0 + p1 + p2) / 3.0f;
+        total_area += length * 0.5f;
+    }
+
+    // Note: The radius of a disc covering a full meshlet's worth of average triangles, which
+    //       scales the distance term of the candidate score below.
+    const float expected_radius = std::max(
+      std::sqrt(((total_area / static_cast<float>(std::max<size_t>(triangle_count, 1))) *
+                 static_cast<float>(meshlet_max_triangle_count)) /
+                glm::pi<float>()),
+      std::numeric_limits<float>::min());
+
+    // Note: Per vertex lists of the triangles using it. The first `live_triangle_counts[v]`
+    //       entries of each list are the triangles not yet placed in a meshlet.
+    std::vector<uint32_t> adjacency_offsets(_vertex_count_in + 1, 0);
+    std::vector<uint32_t> live_triangle_counts(_vertex_count_in, 0);
+    for (auto& element : _elements_in_out)
+    {
+        live_triangle_counts[element]++;
+    }
+
+    for (size_t vertex = 0; vertex < _vertex_count_in; vertex++)
+    {
+        adjacency_offsets[vertex + 1] = adjacency_offsets[vertex] + live_triangle_counts[vertex];
+        live_triangle_counts[vertex]  = 0;
+    }
+
+    std::vector<uint32_t> adjacent_triangles(_elements_in_out.size());
+    for (size_t element_index = 0; element_index < _elements_in_out.size(); element_index++)
+    {
+        const GLuint& vertex = _elements_in_out[element_index];
+        adjacent_triangles[adjacency_offsets[vertex] + live_triangle_counts[vertex]] =
+          static_cast<uint32_t>(element_index / 3);
+        live_triangle_counts[vertex]++;
+    }
+
+    // Note: `vertex_meshlet` holds, per vertex, one more than the index of the last meshlet to
+    //       use it, so that a meshlet's unique vertices are counted without clearing a set.
+    std::vector<size_t>   vertex_meshlet(_vertex_count_in, 0);
+    std::vector<bool>     triangle_placed(triangle_count, false);
+    std::vector<uint32_t> triangle_order;
+    triangle_order.reserve(triangle_count);
+
+    // Note: Vertices of the current meshlet. Those without unplaced triangles are dropped as they
+    //       are found, so that candidates are only searched for along the meshlet's boundary.
+    std::vector<GLuint> frontier_vertices;
+    frontier_vertices.reserve(meshlet_max_vertex_count);
+
+    Meshlet   meshlet;
+    glm::vec3 meshlet_normal_sum(0.0f);
+    glm::vec3 meshlet_centroid_sum(0.0f);
+    size_t    next_unplaced_triangle = 0;
+    for (size_t placed_count = 0; placed_count < triangle_count; placed_count++)
+    {
+        // Note: Grow the meshlet across its own vertices, preferring triangles that add the fewest
+        //       new vertices, then those closest to its centroid and to its mean normal, after
+        //       Arseny Kapoulkine's meshoptimizer. Triangles facing too far from the mean normal
+        //       are left for another meshlet, which keeps the normal cones narrow enough to cull.
+        const size_t meshlet_stamp          = _meshlets_out.size() + 1;
+        const size_t meshlet_triangle_count = meshlet.element_count / 3;
+        size_t       best_triangle          = triangle_count;
+        size_t       best_new_vertex_count  = 4;
+        float        best_score             = std::numeric_limits<float>::max();
+        if (meshlet_triangle_count < meshlet_max_triangle_count)
+        {
+            const float     normal_sum_length = glm::length(meshlet_normal_sum);
+            const glm::vec3 meshlet_axis      = (0.0f == normal_sum_length)
+                                                  ? glm::vec3(0.0f)
+                                                  : (meshlet_normal_sum / normal_sum_length);
+            const glm::vec3 meshlet_centroid  = meshlet_centroid_sum /
+                                               static_cast<float>(
+                                                 std::max<size_t>(meshlet_triangle_count, 1));
+            for (size_t frontier_index = 0; frontier_index < frontier_vertices.size();)
+            {
+                const GLuint frontier_vertex = frontier_vertices[frontier_index];
+                if (0 == live_triangle_counts[frontier_vertex])
+                {
+                    frontier_vertices[frontier_index] = frontier_vertices.back();
+                    frontier_vertices.pop_back();
+                    continue;
+                }
+
+                frontier_index++;
+                const uint32_t* const live_triangles = &adjacent_triangles
+                                                         [adjacency_offsets[frontier_vertex]];
+                for (uint32_t live_index = 0; live_index < live_triangle_counts[frontier_vertex];
+                     live_index++)
+                {
+                    const uint32_t      triangle = live_triangles[live_index];
+                    const GLuint* const corners  = &_elements_in_out[triangle * 3];
+
+                    size_t new_vertex_count = 0;
+                    new_vertex_count += (meshlet_stamp != vertex_meshlet[corners[0]]) ? 1 : 0;
+                    new_vertex_count += ((meshlet_stamp != vertex_meshlet[corners[1]]) &&
+                                         (corners[1] != corners[0]))
+                                          ? 1
+                                          : 0;
+                    new_vertex_count += ((meshlet_stamp != vertex_meshlet[corners[2]]) &&
+                                         (corners[2] != corners[0]) && (corners[2] != corners[1]))
+                                          ? 1
+                                          : 0;
+                    const float spread = glm::dot(triangle_normals[triangle], meshlet_axis);
+                    if (((meshlet.vertex_count + new_vertex_count) > meshlet_max_vertex_count) ||
+                        (meshlet_min_normal_cosine > spread))
+                    {
+                        continue;
+                    }
+
+                    constexpr float cone_weight = 0.5f;
+                    const float     distance    = glm::distance(triangle_centroids[triangle],
+                                                         meshlet_centroid);
+                    const float     score  = (1.0f + ((distance / expected_radius) *
+                                                 (1.0f - cone_weight))) *
+                                        std::max(1.0f - (spread * cone_weight), 0.001f);
+                    if ((new_vertex_count < best_new_vertex_count) ||
+                        ((new_vertex_count == best_new_vertex_count) && (score < best_score)))
+                    {
+                        best_triangle         = triangle;
+                        best_new_vertex_count = new_vertex_count;
+                        best_score            = score;
+                    }
+                }
+            }
+        }
+
+        // Note: A full meshlet, or one with no neighbouring triangle that fits, is finished. The
+        //       next meshlet starts beside it, at the unplaced triangle of the vertex with the
+        //       fewest unplaced triangles, such that the remaining surface is consumed from its
+        //       edges rather than left in small islands. Failing that, it starts from the earliest
+        //       unplaced triangle in the input order.
+        if (triangle_count == best_triangle)
+        {
+            uint32_t fewest_live_triangles = std::numeric_limits<uint32_t>::max();
+            for (auto& frontier_vertex : frontier_vertices)
+            {
+                const uint32_t& live_count = live_triangle_counts[frontier_vertex];
+                if ((0 != live_count) && (live_count < fewest_live_triangles))
+                {
+                    fewest_live_triangles = live_count;
+                    best_triangle = adjacent_triangles[adjacency_offsets[frontier_vertex]];
+                }
+            }
+
+            if (0 != meshlet.element_count)
+            {
+                _meshlets_out.push_back(meshlet);
+
+                meshlet               = Meshlet();
+                meshlet.first_element = static_cast<uint32_t>(triangle_order.size() * 3);
+                meshlet_normal_sum    = glm::vec3(0.0f);
+                meshlet_centroid_sum  = glm::vec3(0.0f);
+                frontier_vertices.clear();
+            }
+
+            if (triangle_count == best_triangle)
+            {
+                while (true == triangle_placed[next_unplaced_triangle])
+                {
+                    next_unplaced_triangle++;
+                }
+
+                best_triangle = next_unplaced_triangle;
+            }
+        }
+
+        const size_t stamp = _meshlets_out.size() + 1;
+        for (size_t corner = 0; corner < 3; corner++)
+        {
+            const GLuint& vertex = _elements_in_out[(best_triangle * 3) + corner];
+            if (stamp != vertex_meshlet[vertex])
+            {
+                vertex_meshlet[vertex] = stamp;
+                frontier_vertices.push_back(vertex);
+                meshlet.vertex_count++;
+            }
+
+            // Note: Swap the triangle out of the vertex's live list.
+            uint32_t* const live_triangles = &adjacent_triangles[adjacency_offsets[vertex]];
+            for (uint32_t live_index = 0; live_index < live_triangle_counts[vertex]; live_index++)
+            {
+                if (best_triangle == live_triangles[live_index])
+                {
+                    live_triangle_counts[vertex]--;
+                    std::swap(live_triangles[live_index],
+                              live_triangles[live_triangle_counts[vertex]]);
+                    break;
+                }
+            }
+        }
+
+        triangle_placed[best_triangle] = true;
+        triangle_order.push_back(static_cast<uint32_t>(best_triangle));
+        meshlet_normal_sum += triangle_normals[best_triangle];
+        meshlet_centroid_sum += triangle_centroids[best_triangle];
+        meshlet.element_count += 3;
+    }
+
+    if (0 != meshlet.element_count)
+    {
+        _meshlets_out.push_back(meshlet);
+    }
+
+    // Note: Within each meshlet, triangles keep their input order, which preserves most of the
+    //       vertex cache locality of the input.
+    for (auto& finished_meshlet : _meshlets_out)
+    {
+        std::sort(triangle_order.begin() + (finished_meshlet.first_element / 3),
+                  triangle_order.begin() +
+                    ((finished_meshlet.first_element + finished_meshlet.element_count) / 3));
+    }
+
+    std::vector<GLuint> reordered_elements(_elements_in_out.size());
+    for (size_t triangle = 0; triangle < triangle_count; triangle++)
+    {
+        const GLuint* const corners = &_elements_in_out[triangle_order[triangle] * 3];
+        std::copy(corners, corners + 3, &reordered_elements[triangle * 3]);
+    }
+
+    _elements_in_out.swap(reordered_elements);
+    for (auto& finished_meshlet : _meshlets_out)
+    {
+        ComputeMeshletBounds(positions, _elements_in_out, finished_meshlet);
+    }
+}
+
+void
+ExtractFrustumPlanes(const glm::mat4& _view_projection_in, glm::vec4 (&_planes_out)[6]) noexcept
+{
+    // Note: glm matrices are column major; row i is (m[0][i], m[1][i], m[2][i], m[3][i]).
+    const glm::mat4 transpose = glm::transpose(_view_projection_in);
+
+    _planes_out[0] = transpose[3] + transpose[0]; // Left
+    _planes_out[1] = transpose[3] - transpose[0]; // Right
+    _planes_out[2] = transpose[3] + transpose[1]; // Bottom
+    _planes_out[3] = transpose[3] - transpose[1]; // Top
+    _planes_out[4] = transpose[3] + transpose[2]; // Near
+    _planes_out[5] = transpose[3] - transpose[2]; // Far
+
+    for (auto& plane : _planes_out)
+    {
+        plane /= glm::length(glm::vec3(plane));
+    }
+}
+
+// Note: Counts the meshlet in `_statistics_in_out`, as culled or submitted.
+static inline bool
+IsMeshletVisible(const Meshlet&            _meshlet_in,
+                 const glm::vec4 (&_frustum_planes_in)[6],
+                 const glm::vec3&          _camera_position_in,
+                 MeshletCullingStatistics& _statistics_in_out) noexcept
+{
+    _statistics_in_out.triangle_count += _meshlet_in.element_count / 3;
+
+    for (auto& plane : _frustum_planes_in)
+    {
+        if ((glm::dot(glm::vec3(plane), _meshlet_in.bounding_sphere_center) + plane.w) <
+            -_meshlet_in.bounding_sphere_radius)
+        {
+            _statistics_in_out.frustum_culled_meshlet_count++;
+            return false;
+        }
+    }
+
+    const glm::vec3 apex_direction = _meshlet_in.cone_apex - _camera_position_in;
+    const float     apex_distance  = glm::length(apex_direction);
+    if ((0.0f < apex_distance) &&
+        (glm::dot(apex_direction, _meshlet_in.cone_axis) >=
+         (_meshlet_in.cone_cutoff * apex_distance)))
+    {
+        _statistics_in_out.backface_culled_meshlet_count++;
+        return false;
+    }
+
+    _statistics_in_out.submitted_triangle_count += _meshlet_in.element_count / 3;
+    return true;
+}
+
+void
+CullMeshlets(const std::vector<Meshlet>& _meshlets_in,
+             const std::vector<GLuint>&  _elements_in,
+             const glm::mat4&            _model_view_projection_in,
+             const glm::vec3&            _camera_position_in,
+             std::vector<GLuint>&        _visible_elements_out,
+             MeshletCullingStatistics&   _statistics_out) noexcept
+{
+    glm::vec4 frustum_planes[6];
+    ExtractFrustumPlanes(_model_view_projection_in, frustum_planes);
+
+    _statistics_out               = {};
+    _statistics_out.meshlet_count = _meshlets_in.size();
+    _visible_elements_out.clear();
+
+    for (auto& meshlet : _meshlets_in)
+    {
+        assert((static_cast<size_t>(meshlet.first_element) + meshlet.element_count) <=
+               _elements_in.size());
+        if (false ==
+            IsMeshletVisible(meshlet, frustum_planes, _camera_position_in, _statistics_out))
+        {
+            continue;
+        }
+
+        _visible_elements_out.insert(_visible_elements_out.end(),
+                                     _elements_in.begin() + meshlet.first_element,
+                                     _elements_in.begin() + meshlet.first_element +
+                                       meshlet.element_count);
+    }
+}
+
+void
+CullMeshletRanges(const std::vector<Meshlet>& _meshlets_in,
+                  const glm::mat4&            _model_view_projection_in,
+                  const glm::vec3&            _camera_position_in,
+                  std::vector<MeshletRange>&  _visible_ranges_out,
+                  MeshletCullingStatistics&   _statistics_out) noexcept
+{
+    glm::vec4 frustum_planes[6];
+    ExtractFrustumPlanes(_model_view_projection_in, frustum_planes);
+
+    _statistics_out               = {};
+    _statistics_out.meshlet_count = _meshlets_in.size();
+    _visible_ranges_out.clear();
+
+    for (auto& meshlet : _meshlets_in)
+    {
+        if (false ==
+            IsMeshletVisible(meshlet, frustum_planes, _camera_position_in, _statistics_out))
+        {
+            continue;
+        }
+
+        MeshletRange* const last_range = (true == _visible_ranges_out.empty())
+                                           ? nullptr
+                                           : &_visible_ranges_out.back();
+        if ((nullptr != last_range) &&
+            ((last_range->first_element + last_range->element_count) == meshlet.first_element))
+        {
+            last_range->element_count += meshlet.element_count;
+            continue;
+        }
+
+        _visible_ranges_out.push_back({ meshlet.first_element, meshlet.element_count });
+    }
+}
@@ -0,0 +1,110 @@
+#ifndef meshlet_h
+#define meshlet_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+//
+// Note: Meshlets partition the triangles of a mesh into small clusters of at most
+//       meshlet_max_vertex_count unique vertices and meshlet_max_triangle_count triangles, each
+//       with bounds that allow whole clusters to be culled on the CPU before drawing. Meshlets
+//       are contiguous ranges of the element buffer they were built from.
+//
+//       Everything here is in model space. Cull with a model view projection matrix and a camera
+//       position transformed into model space.
+//
+constexpr size_t meshlet_max_vertex_count   = 64;
+constexpr size_t meshlet_max_triangle_count = 124;
+
+// Note: A triangle joins a meshlet only if its normal is within acos(meshlet_min_normal_cosine)
+//       (60 degrees) of the meshlet's mean normal. Lower values make fewer, larger meshlets that
+//       are rarely back facing as a whole.
+constexpr float meshlet_min_normal_cosine = 0.5f;
+
+// Note: Trivially copyable, and stored as-is in cooked meshes (see cooked_mesh.h).
+struct Meshlet
+{
+    uint32_t first_element = 0;
+    uint32_t element_count = 0;
+    uint32_t vertex_count  = 0;
+
+    // Note: Every triangle in the meshlet faces away from a camera at position p when
+    //       dot(normalize(cone_apex - p), cone_axis) >= cone_cutoff. A cutoff above one disables
+    //       the test, for meshlets whose normals are spread over a hemisphere or more.
+    float     cone_cutoff = 2.0f;
+    glm::vec3 cone_apex   = glm::vec3(0.0f);
+    glm::vec3 cone_axis   = glm::vec3(0.0f);
+
+    glm::vec3 bounding_sphere_center = glm::vec3(0.0f);
+    float     bounding_sphere_radius = 0.0f;
+    glm::vec3 aabb_minimum           = glm::vec3(0.0f);
+    glm::vec3 aabb_maximum           = glm::vec3(0.0f);
+};
+
+// Note: Partitions the triangles of `_elements_in_out` into meshlets, each grown across
+//       neighbouring triangles with similar normals, and reorders the triangles such that each
+//       meshlet is a contiguous range. Triangles keep their relative order within a meshlet, so
+//       run after OptimizeVertexCache(...) in mesh_tools.h; run OptimizeVertexFetch(...) after.
+//
+//       Positions are read as three floats at `_position_offset_in` floats into each vertex.
+void
+BuildMeshlets(bool&                     _success_out,
+              const std::vector<float>& _vertex_data_in,
+              const size_t&             _floats_per_vertex_in,
+              const size_t&             _position_offset_in,
+              const size_t&             _vertex_count_in,
+              std::vector<GLuint>&      _elements_in_out,
+              std::vector<Meshlet>&     _meshlets_out);
+
+struct MeshletCullingStatistics
+{
+    size_t meshlet_count                 = 0;
+    size_t frustum_culled_meshlet_count  = 0;
+    size_t backface_culled_meshlet_count = 0;
+    size_t triangle_count                = 0;
+    size_t submitted_triangle_count      = 0;
+};
+
+// Note: Frustum planes of a (model) view projection matrix, after Gribb and Hartmann, "Fast
+//       Extraction of Viewing Frustum Planes from the World-View-Projection Matrix". Each plane
+//       is normalized, with dot(plane.xyz, p) + plane.w >= 0 for points p inside the frustum.
+//       Planes are in the space the matrix transforms from.
+void
+ExtractFrustumPlanes(const glm::mat4& _view_projection_in, glm::vec4 (&_planes_out)[6]) noexcept;
+
+// Note: Writes the elements of every meshlet that is inside the frustum and not entirely back
+//       facing to `_visible_elements_out`, replacing its contents, ready to be uploaded and
+//       drawn in place of `_elements_in`.
+//
+//       `_camera_position_in` is in model space, such as
+//       glm::vec3(glm::inverse(model_view_matrix)[3]).
+//
+//       Expected to be called every frame; inputs are asserted rather than reported.
+void
+CullMeshlets(const std::vector<Meshlet>& _meshlets_in,
+             const std::vector<GLuint>&  _elements_in,
+             const glm::mat4&            _model_view_projection_in,
+             const glm::vec3&            _camera_position_in,
+             std::vector<GLuint>&        _visible_elements_out,
+             MeshletCullingStatistics&   _statistics_out) noexcept;
+
+// Note: A contiguous range of the element buffer the meshlets were built from.
+struct MeshletRange
+{
+    uint32_t first_element = 0;
+    uint32_t element_count = 0;
+};
+
+// Note: As CullMeshlets(...), without copying elements: writes the ranges of the visible
+//       meshlets to `_visible_ranges_out`, replacing its contents, to be drawn in place from the
+//       element buffer (see glMultiDrawElements). Visible meshlets that are adjacent in the
+//       element buffer share one range.
+void
+CullMeshletRanges(const std::vector<Meshlet>& _meshlets_in,
+                  const glm::mat4&            _model_view_projection_in,
+                  const glm::vec3&            _camera_position_in,
+                  std::vector<MeshletRange>&  _visible_ranges_out,
+                  MeshletCullingStatistics&   _statistics_out) noexcept;
+
+#endif // meshlet_h
@@ -0,0 +1,708 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "mip_generator.h"
+
+#include "logging.h"
+
+// Note: Rows of a level are split into tiles of at least this many pixels, one job each.
+constexpr size_t mip_tile_minimum_pixel_count = 64 * 1024;
+
+// Note: Both windowed sincs are three lobes wide, measured in pixels of the smaller level.
+constexpr float mip_filter_radius = 3.0f;
+constexpr float kaiser_alpha      = 4.0f;
+
+// Note: Linear values are quantized to 16 bits to index the sRGB encoding table, fine enough
+//       that every 8-bit sRGB value is reachable.
+constexpr size_t srgb_encode_table_size = 1 << 16;
+
+constexpr size_t alpha_coverage_search_iteration_count = 16;
+constexpr float  alpha_coverage_maximum_scale          = 4.0f;
+
+// Note: Conversions between 8-bit channels and linear floats.
+struct ChannelTables
+{
+    ChannelTables() noexcept
+    {
+        for (int value = 0; value < 256; value++)
+        {
+            const float encoded = value / 255.0f;
+            unorm_decode[value] = encoded;
+            srgb_decode[value]  = (encoded <= 0.04045f)
+                                    ? (encoded / 12.92f)
+                                    : std::pow((encoded + 0.055f) / 1.055f, 2.4f);
+        }
+
+        for (size_t index = 0; index < srgb_encode_table_size; index++)
+        {
+            const float linear  = static_cast<float>(index) / (srgb_encode_table_size - 1);
+            const float encoded = (linear <= 0.0031308f)
+                                    ? (linear * 12.92f)
+                                    : ((1.055f * std::pow(linear, 1.0f / 2.4f)) - 0.055f);
+            srgb_encode[index]  = static_cast<unsigned char>((encoded * 255.0f) + 0.5f);
+        }
+    }
+
+    float         unorm_decode[256];
+    float         srgb_decode[256];
+    unsigned char srgb_encode[srgb_encode_table_size];
+};
+
+// Note: Output `index` of a resampling pass sums the taps [starts[index], starts[index + 1]).
+struct FilterTaps
+{
+    std::vector<size_t> starts;
+    std::vector<int>    indices;
+    std::vector<float>  weights;
+};
+
+static const ChannelTables&
+GetChannelTables() noexcept
+{
+    // Note: Built on first use; the initialization of function statics is thread safe.
+    static const ChannelTables channel_tables;
+    return channel_tables;
+}
+
+static inline unsigned char
+EncodeSrgb(const ChannelTables& _channel_tables_in, const float& _linear_in)
+{
+    const float  linear = std::clamp(_linear_in, 0.0f, 1.0f);
+    const size_t index  = static_cast<size_t>((linear * (srgb_encode_table_size - 1)) + 0.5f);
+    return _channel_tables_in.srgb_encode[index];
+}
+
+static inline unsigned char
+EncodeLinear(const float& _linear_in)
+{
+    return static_cast<unsigned char>((std::clamp(_linear_in, 0.0f, 1.0f) * 255.0f) + 0.5f);
+}
+
+static inline float
+Sinc(const float& _x_in)
+{
+    if (std::abs(_x_in) < 1e-6f)
+    {
+        return 1.0f;
+    }
+
+    const float pi_x = glm::pi<float>() * _x_in;
+    return std::sin(pi_x) / pi_x;
+}
+
+// Note: Zeroth order modified Bessel function of the first kind, by its power series.
+static float
+BesselI0(const float& _x_in)
+{
+    const float half_x_squared = (_x_in * _x_in) / 4.0f;
+
+    float sum  = 1.0f;
+    float term = 1.0f;
+    for (int k = 1; k < 32; k++)
+    {
+        term *= half_x_squared / static_cast<float>(k * k);
+        sum += term;
+        if (term < (sum * 1e-8f))
+        {
+            break;
+        }
+    }
+
+    return sum;
+}
+
+static float
+EvaluateMipFilter(const MipFilter& _filter_in, const float& _x_in)
+{
+    const float distance = std::abs(_x_in);
+    if (distance >= mip_filter_radius)
+    {
+        return 0.0f;
+    }
+
+    if (MipFilter::LANCZOS == _filter_in)
+    {
+        return Sinc(distance) * Sinc(distance / mip_filter_radius);
+    }
+
+    const float window_position = distance / mip_filter_radius;
+    return Sinc(distance) *
+           (BesselI0(kaiser_alpha * std::sqrt(1.0f - (window_position * window_position))) /
+            BesselI0(kaiser_alpha));
+}
+
+// Note: Pixel `index` covers [index, index + 1). Taps past either edge are clamped to it.
+static void
+BuildFilterTaps(const MipFilter& _filter_in,
+                const int&       _source_size_in,
+                const int&       _destination_size_in,
+                FilterTaps&      _filter_taps_out)
+{
+    const float scale  = static_cast<float>(_source_size_in) / _destination_size_in;
+    const float radius = mip_filter_radius * scale;
+
+    _filter_taps_out.starts.assign(1, 0);
+    _filter_taps_out.indices.clear();
+    _filter_taps_out.weights.clear();
+    for (int destination = 0; destination < _destination_size_in; destination++)
+    {
+        const float  center      = (destination + 0.5f) * scale;
+        const int    first       = static_cast<int>(std::floor(center - radius));
+        const int    last        = static_cast<int>(std::ceil(center + radius));
+        const size_t start       = _filter_taps_out.weights.size();
+        float        weight_sum  = 0.0f;
+        for (int source = first; source <= last; source++)
+        {
+            const float weight = EvaluateMipFilter(_filter_in, ((source + 0.5f) - center) / scale);
+            if (0.0f == weight)
+            {
+                continue;
+            }
+
+            _filter_taps_out.indices.push_back(std::clamp(source, 0, _source_size_in - 1));
+            _filter_taps_out.weights.push_back(weight);
+            weight_sum += weight;
+        }
+
+        for (size_t tap = start; tap < _filter_taps_out.weights.size(); tap++)
+        {
+            _filter_taps_out.weights[tap] /= weight_sum;
+        }
+
+        _filter_taps_out.starts.push_back(_filter_taps_out.weights.size());
+    }
+}
+
+#if defined(_ENGINE_SIMD_SSE_)
+// Note: Averages the 2x2 blocks under four destination pixels, rounding as the scalar path does.
+//       Even and odd pixels of each row are separated so that each pair sums in one add.
+static inline __m128i
+DownsampleBox4(const unsigned char* const _row_0_in, const unsigned char* const _row_1_in)
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(2);
+
+    const __m128i row_0_low  = _mm_shuffle_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(_row_0_in)), _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128i row_0_high = _mm_shuffle_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(_row_0_in + 16)), _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128i row_1_low  = _mm_shuffle_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(_row_1_in)), _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128i row_1_high = _mm_shuffle_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(_row_1_in + 16)), _MM_SHUFFLE(3, 1, 2, 0));
+
+    __m128i sum_low = _mm_add_epi16(_mm_unpacklo_epi8(row_0_low, zero),
+                                    _mm_unpackhi_epi8(row_0_low, zero));
+    sum_low         = _mm_add_epi16(sum_low, _mm_unpacklo_epi8(row_1_low, zero));
+    sum_low         = _mm_add_epi16(sum_low, _mm_unpackhi_epi8(row_1_low, zero));
+
+    __m128i sum_high = _mm_add_epi16(_mm_unpacklo_epi8(row_0_high, zero),
+                                     _mm_unpackhi_epi8(row_0_high, zero));
+    sum_high         = _mm_add_epi16(sum_high, _mm_unpacklo_epi8(row_1_high, zero));
+    sum_high         = _mm_add_epi16(sum_high, _mm_unpackhi_epi8(row_1_high, zero));
+
+    return _mm_packus_epi16(_mm_srli_epi16(_mm_add_epi16(sum_low, round), 2),
+                            _mm_srli_epi16(_mm_add_epi16(sum_high, round), 2));
+}
+#endif // _ENGINE_SIMD_SSE_
+
+#if defined(_ENGINE_SIMD_AVX2_)
+// Note: As DownsampleBox4(...), for eight destination pixels. Packing works within each 128-bit
+//       lane, so the pairs of destination pixels are put back in order last.
+static inline __m256i
+DownsampleBox8(const unsigned char* const _row_0_in, const unsigned char* const _row_1_in)
+{
+    const __m256i zero  = _mm256_setzero_si256();
+    const __m256i round = _mm256_set1_epi16(2);
+
+    const __m256i row_0_low  = _mm256_shuffle_epi32(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_row_0_in)), _MM_SHUFFLE(3, 1, 2, 0));
+    const __m256i row_0_high = _mm256_shuffle_epi32(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_row_0_in + 32)),
+      _MM_SHUFFLE(3, 1, 2, 0));
+    const __m256i row_1_low  = _mm256_shuffle_epi32(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_row_1_in)), _MM_SHUFFLE(3, 1, 2, 0));
+    const __m256i row_1_high = _mm256_shuffle_epi32(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_row_1_in + 32)),
+      _MM_SHUFFLE(3, 1, 2, 0));
+
+    __m256i sum_low = _mm256_add_epi16(_mm256_unpacklo_epi8(row_0_low, zero),
+                                       _mm256_unpackhi_epi8(row_0_low, zero));
+    sum_low         = _mm256_add_epi16(sum_low, _mm256_unpacklo_epi8(row_1_low, zero));
+    sum_low         = _mm256_add_epi16(sum_low, _mm256_unpackhi_epi8(row_1_low, zero));
+
+    __m256i sum_high = _mm256_add_epi16(_mm256_unpacklo_epi8(row_0_high, zero),
+                                        _mm256_unpackhi_epi8(row_0_high, zero));
+    sum_high         = _mm256_add_epi16(sum_high, _mm256_unpacklo_epi8(row_1_high, zero));
+    sum_high         = _mm256_add_epi16(sum_high, _mm256_unpackhi_epi8(row_1_high, zero));
+
+    const __m256i packed = _mm256_packus_epi16(
+      _mm256_srli_epi16(_mm256_add_epi16(sum_low, round), 2),
+      _mm256_srli_epi16(_mm256_add_epi16(sum_high, round), 2));
+    return _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+}
+#endif // _ENGINE_SIMD_AVX2_
+
+static void
+DownsampleBoxRow(const unsigned char* const _row_0_in,
+                 const unsigned char* const _row_1_in,
+                 const int&                 _source_width_in,
+                 const bool&                _srgb_in,
+                 const int&                 _width_in,
+                 unsigned char* const       _row_out)
+{
+    int column = 0;
+    if (false == _srgb_in)
+    {
+        // Note: A level at least two pixels wide has both source pixels of every destination
+        //       pixel in range.
+#if defined(_ENGINE_SIMD_AVX2_)
+        for (; (column + 8) <= _width_in; column += 8)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_row_out + (column * 4)),
+                                DownsampleBox8(_row_0_in + (column * 8), _row_1_in + (column * 8)));
+        }
+#endif // _ENGINE_SIMD_AVX2_
+
+#if defined(_ENGINE_SIMD_SSE_)
+        for (; (column + 4) <= _width_in; column += 4)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_row_out + (column * 4)),
+                             DownsampleBox4(_row_0_in + (column * 8), _row_1_in + (column * 8)));
+        }
+#endif // _ENGINE_SIMD_SSE_
+    }
+
+    const ChannelTables& channel_tables = GetChannelTables();
+    for (; column < _width_in; column++)
+    {
+        const int column_0 = std::min(column * 2, _source_width_in - 1) * 4;
+        const int column_1 = std::min((column * 2) + 1, _source_width_in - 1) * 4;
+        for (int channel = 0; channel < 4; channel++)
+        {
+            const unsigned char samples[] = { _row_0_in[column_0 + channel],
+                                              _row_0_in[column_1 + channel],
+                                              _row_1_in[column_0 + channel],
+                                              _row_1_in[column_1 + channel] };
+            if ((true == _srgb_in) && (3 != channel))
+            {
+                const float linear = channel_tables.srgb_decode[samples[0]] +
+                                     channel_tables.srgb_decode[samples[1]] +
+                                     channel_tables.srgb_decode[samples[2]] +
+                                     channel_tables.srgb_decode[samples[3]];
+                _row_out[(column * 4) + channel] = EncodeSrgb(channel_tables, linear * 0.25f);
+            }
+            else
+            {
+                const unsigned int sum = samples[0] + samples[1] + samples[2] + samples[3];
+                _row_out[(column * 4) + channel] = static_cast<unsigned char>((sum + 2) / 4);
+            }
+        }
+    }
+}
+
+static void
+DownsampleBoxTile(const unsigned char* const _source_pixels_in,
+                  const int&                 _source_width_in,
+                  const int&                 _source_height_in,
+                  const bool&                _srgb_in,
+                  const int&                 _first_row_in,
+                  const int&                 _end_row_in,
+                  MipLevel&                  _level_in_out)
+{
+    const size_t source_stride = static_cast<size_t>(_source_width_in) * 4;
+    const size_t stride        = static_cast<size_t>(_level_in_out.width) * 4;
+    for (int row = _first_row_in; row < _end_row_in; row++)
+    {
+        const size_t source_row_0 = std::min(row * 2, _source_height_in - 1);
+        const size_t source_row_1 = std::min((row * 2) + 1, _source_height_in - 1);
+        DownsampleBoxRow(_source_pixels_in + (source_row_0 * source_stride),
+                         _source_pixels_in + (source_row_1 * source_stride),
+                         _source_width_in,
+                         _srgb_in,
+                         _level_in_out.width,
+                         _level_in_out.pixels.data() + (row * stride));
+    }
+}
+
+// Note: Resamples rows first, into linear floats, then columns. Each tile filters the source
+//       rows its columns reach, so that tiles are independent.
+static void
+ResampleTile(const unsigned char* const _source_pixels_in,
+             const int&                 _source_width_in,
+             const int&                 _source_height_in,
+             const FilterTaps&          _horizontal_taps_in,
+             const FilterTaps&          _vertical_taps_in,
+             const bool&                _srgb_in,
+             const int&                 _first_row_in,
+             const int&                 _end_row_in,
+             MipLevel&                  _level_in_out)
+{
+    const ChannelTables& channel_tables = GetChannelTables();
+    const float* const   color_decode   = (true == _srgb_in) ? channel_tables.srgb_decode
+                                                             : channel_tables.unorm_decode;
+    const size_t         width          = _level_in_out.width;
+
+    int first_source_row = _source_height_in;
+    int last_source_row  = 0;
+    for (size_t tap = _vertical_taps_in.starts[_first_row_in];
+         tap < _vertical_taps_in.starts[_end_row_in];
+         tap++)
+    {
+        first_source_row = std::min(first_source_row, _vertical_taps_in.indices[tap]);
+        last_source_row  = std::max(last_source_row, _vertical_taps_in.indices[tap]);
+    }
+
+    std::vector<float> source_row(static_cast<size_t>(_source_width_in) * 4);
+    std::vector<float> filtered_rows(
+      static_cast<size_t>(last_source_row - first_source_row + 1) * width * 4);
+    for (int source_row_index = first_source_row; source_row_index <= last_source_row;
+         source_row_index++)
+    {
+        const unsigned char* const source = _source_pixels_in +
+                                            (static_cast<size_t>(source_row_index) *
+                                             _source_width_in * 4);
+        for (size_t component = 0; component < source_row.size(); component += 4)
+        {
+            source_row[component + 0] = color_decode[source[component + 0]];
+            source_row[component + 1] = color_decode[source[component + 1]];
+            source_row[component + 2] = color_decode[source[component + 2]];
+            source_row[component + 3] = channel_tables.unorm_decode[source[component + 3]];
+        }
+
+        float* const filtered = filtered_rows.data() +
+                                (static_cast<size_t>(source_row_index - first_source_row) *
+                                 width * 4);
+        for (size_t column = 0; column < width; column++)
+        {
+            const size_t first_tap = _horizontal_taps_in.starts[column];
+            const size_t end_tap   = _horizontal_taps_in.starts[column + 1];
+#if defined(_ENGINE_SIMD_SSE_)
+            // Note: Alternate taps go to two sums, halving the chain of dependent adds.
+            __m128 even_sum = _mm_setzero_ps();
+            __m128 odd_sum  = _mm_setzero_ps();
+            size_t tap      = first_tap;
+            for (; (tap + 1) < end_tap; tap += 2)
+            {
+                const float* const even_pixel = source_row.data() +
+                                                (_horizontal_taps_in.indices[tap] * 4);
+                const float* const odd_pixel  = source_row.data() +
+                                               (_horizontal_taps_in.indices[tap + 1] * 4);
+                even_sum = _mm_add_ps(even_sum,
+                                      _mm_mul_ps(_mm_loadu_ps(even_pixel),
+                                                 _mm_set1_ps(_horizontal_taps_in.weights[tap])));
+                odd_sum  = _mm_add_ps(
+                  odd_sum,
+                  _mm_mul_ps(_mm_loadu_ps(odd_pixel),
+                             _mm_set1_ps(_horizontal_taps_in.weights[tap + 1])));
+            }
+
+            if (tap < end_tap)
+            {
+                const float* const pixel = source_row.data() +
+                                           (_horizontal_taps_in.indices[tap] * 4);
+                even_sum = _mm_add_ps(even_sum,
+                                      _mm_mul_ps(_mm_loadu_ps(pixel),
+                                                 _mm_set1_ps(_horizontal_taps_in.weights[tap])));
+            }
+
+            _mm_storeu_ps(filtered + (column * 4), _mm_add_ps(even_sum, odd_sum));
+#else
+            float sum[4] = { 0.0f };
+            for (size_t tap = first_tap; tap < end_tap; tap++)
+            {
+                const float* const pixel = source_row.data() +
+                                           (_horizontal_taps_in.indices[tap] * 4);
+                for (size_t channel = 0; channel < 4; channel++)
+                {
+                    sum[channel] += pixel[channel] * _horizontal_taps_in.weights[tap];
+                }
+            }
+
+            std::memcpy(filtered + (column * 4), sum, sizeof(sum));
+#endif // _ENGINE_SIMD_SSE_
+        }
+    }
+
+    std::vector<const float*> tap_rows;
+    for (int row = _first_row_in; row < _end_row_in; row++)
+    {
+        const size_t first_tap = _vertical_taps_in.starts[row];
+        const size_t end_tap   = _vertical_taps_in.starts[row + 1];
+
+        tap_rows.clear();
+        for (size_t tap = first_tap; tap < end_tap; tap++)
+        {
+            tap_rows.push_back(filtered_rows.data() +
+                               (static_cast<size_t>(_vertical_taps_in.indices[tap] -
+                                                    first_source_row) *
+                                width * 4));
+        }
+
+        const float* const   weights     = _vertical_taps_in.weights.data() + first_tap;
+        unsigned char* const destination = _level_in_out.pixels.data() +
+                                           (static_cast<size_t>(row) * width * 4);
+        for (size_t component = 0; component < (width * 4); component += 4)
+        {
+            float linear[4] = { 0.0f };
+#if defined(_ENGINE_SIMD_SSE_)
+            __m128 sum = _mm_setzero_ps();
+            for (size_t tap = 0; tap < tap_rows.size(); tap++)
+            {
+                sum = _mm_add_ps(sum,
+                                 _mm_mul_ps(_mm_loadu_ps(tap_rows[tap] + component),
+                                            _mm_set1_ps(weights[tap])));
+            }
+
+            if (false == _srgb_in)
+            {
+                const __m128i encoded = _mm_cvtps_epi32(_mm_mul_ps(
+                  _mm_min_ps(_mm_max_ps(sum, _mm_setzero_ps()), _mm_set1_ps(1.0f)),
+                  _mm_set1_ps(255.0f)));
+                const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(encoded, encoded),
+                                                        _mm_setzero_si128());
+                const int     pixel  = _mm_cvtsi128_si32(packed);
+                std::memcpy(destination + component, &pixel, sizeof(pixel));
+                continue;
+            }
+
+            _mm_storeu_ps(linear, sum);
+#else
+            for (size_t tap = 0; tap < tap_rows.size(); tap++)
+            {
+                for (size_t channel = 0; channel < 4; channel++)
+                {
+                    linear[channel] += tap_rows[tap][component + channel] * weights[tap];
+                }
+            }
+#endif // _ENGINE_SIMD_SSE_
+
+            for (size_t channel = 0; channel < 3; channel++)
+            {
+                destination[component + channel] = (true == _srgb_in)
+                                                      ? EncodeSrgb(channel_tables, linear[channel])
+                                                      : EncodeLinear(linear[channel]);
+            }
+
+            destination[component + 3] = EncodeLinear(linear[3]);
+        }
+    }
+}
+
+// Note: Runs `_tile_in` over row ranges covering [0, `_row_count_in`).
+static void
+ForEachTile(JobSystem* const                                   _job_system_in,
+            const int&                                         _row_count_in,
+            const int&                                         _row_width_in,
+            const std::function<void(const int&, const int&)>& _tile_in)
+{
+    const int rows_per_tile = static_cast<int>(std::max<size_t>(
+      1, mip_tile_minimum_pixel_count / static_cast<size_t>(_row_width_in)));
+    if ((nullptr == _job_system_in) || (rows_per_tile >= _row_count_in))
+    {
+        _tile_in(0, _row_count_in);
+        return;
+    }
+
+    JobBatch batch;
+    for (int first_row = 0; first_row < _row_count_in; first_row += rows_per_tile)
+    {
+        const int end_row = std::min(first_row + rows_per_tile, _row_count_in);
+        _job_system_in->Submit([&_tile_in, first_row, end_row]() { _tile_in(first_row, end_row); },
+                               &batch);
+    }
+
+    _job_system_in->Wait(batch);
+}
+
+static void
+BuildAlphaHistogram(const unsigned char* const _pixels_in,
+                    const size_t&              _pixel_count_in,
+                    size_t (&_histogram_out)[256])
+{
+    std::fill(std::begin(_histogram_out), std::end(_histogram_out), 0);
+    for (size_t pixel = 0; pixel < _pixel_count_in; pixel++)
+    {
+        _histogram_out[_pixels_in[(pixel * 4) + 3]]++;
+    }
+}
+
+// Note: The fraction of pixels whose alpha, once scaled and stored, is above the reference.
+static double
+GetAlphaCoverage(const size_t (&_histogram_in)[256],
+                 const size_t& _pixel_count_in,
+                 const float&  _reference_in,
+                 const float&  _scale_in)
+{
+    size_t covered_pixel_count = 0;
+    for (int alpha = 0; alpha < 256; alpha++)
+    {
+        const float scaled_alpha = std::min(std::floor((alpha * _scale_in) + 0.5f), 255.0f);
+        if (scaled_alpha > (_reference_in * 255.0f))
+        {
+            covered_pixel_count += _histogram_in[alpha];
+        }
+    }
+
+    return static_cast<double>(covered_pixel_count) / _pixel_count_in;
+}
+
+// Note: Coverage only grows with the scale, so the scale is found by bisection.
+static void
+PreserveAlphaCoverage(const double& _target_coverage_in,
+                      const float&  _reference_in,
+                      MipLevel&     _level_in_out)
+{
+    const size_t pixel_count = static_cast<size_t>(_level_in_out.width) * _level_in_out.height;
+
+    size_t histogram[256];
+    BuildAlphaHistogram(_level_in_out.pixels.data(), pixel_count, histogram);
+
+    float minimum_scale = 0.0f;
+    float maximum_scale = alpha_coverage_maximum_scale;
+    for (size_t iteration = 0; iteration < alpha_coverage_search_iteration_count; iteration++)
+    {
+        const float scale = (minimum_scale + maximum_scale) * 0.5f;
+        if (GetAlphaCoverage(histogram, pixel_count, _reference_in, scale) < _target_coverage_in)
+        {
+            minimum_scale = scale;
+        }
+        else
+        {
+            maximum_scale = scale;
+        }
+    }
+
+    const double minimum_error = std::abs(
+      GetAlphaCoverage(histogram, pixel_count, _reference_in, minimum_scale) -
+      _target_coverage_in);
+    const double maximum_error = std::abs(
+      GetAlphaCoverage(histogram, pixel_count, _reference_in, maximum_scale) -
+      _target_coverage_in);
+    const float scale = (minimum_error < maximum_error) ? minimum_scale : maximum_scale;
+
+    unsigned char scaled_alpha[256];
+    for (int alpha = 0; alpha < 256; alpha++)
+    {
+        scaled_alpha[alpha] = static_cast<unsigned char>(
+          std::min(std::floor((alpha * scale) + 0.5f), 255.0f));
+    }
+
+    for (size_t pixel = 0; pixel < pixel_count; pixel++)
+    {
+        unsigned char& alpha = _level_in_out.pixels[(pixel * 4) + 3];
+        alpha                = scaled_alpha[alpha];
+    }
+}
+
+void
+GenerateMipChain(bool&                       _success_out,
+                 const unsigned char* const  _image_data_in,
+                 const int&                  _image_width_in,
+                 const int&                  _image_height_in,
+                 const MipGenerationOptions& _options_in,
+                 JobSystem* const            _job_system_in,
+                 std::vector<MipLevel>&      _levels_out)
+{
+    _success_out = false;
+    _levels_out.clear();
+
+    if ((nullptr == _image_data_in) || (0 >= _image_width_in) || (0 >= _image_height_in))
+    {
+        Log_e("Invalid image provided.");
+        return;
+    }
+
+    if ((0.0f > _options_in.alpha_coverage_reference) ||
+        (1.0f <= _options_in.alpha_coverage_reference))
+    {
+        std::stringstream ss;
+        ss << "Invalid alpha coverage reference: " << _options_in.alpha_coverage_reference;
+        Log_e(ss);
+        return;
+    }
+
+    const size_t level_count = std::bit_width(static_cast<uint32_t>(
+      std::max(_image_width_in, _image_height_in)));
+    if (1 == level_count)
+    {
+        _success_out = true;
+        return;
+    }
+
+    // Note: Level zero is wrapped without a copy, and never written.
+    MipLevel image;
+    image.width  = _image_width_in;
+    image.height = _image_height_in;
+
+    _levels_out.resize(level_count - 1);
+    for (size_t level_index = 0; level_index < _levels_out.size(); level_index++)
+    {
+        const MipLevel& source = (0 == level_index) ? image : _levels_out[level_index - 1];
+        MipLevel&       level  = _levels_out[level_index];
+        level.width            = std::max(source.width / 2, 1);
+        level.height           = std::max(source.height / 2, 1);
+        level.pixels.resize(static_cast<size_t>(level.width) * level.height * 4);
+
+        const unsigned char* const source_pixels = (0 == level_index) ? _image_data_in
+                                                                      : source.pixels.data();
+        if (MipFilter::BOX == _options_in.filter)
+        {
+            ForEachTile(_job_system_in,
+                        level.height,
+                        level.width,
+                        [&](const int& _first_row_in, const int& _end_row_in)
+                        {
+                            DownsampleBoxTile(source_pixels,
+                                              source.width,
+                                              source.height,
+                                              _options_in.srgb,
+                                              _first_row_in,
+                                              _end_row_in,
+                                              level);
+                        });
+        }
+        else
+        {
+            FilterTaps horizontal_taps;
+            FilterTaps vertical_taps;
+            BuildFilterTaps(_options_in.filter, source.width, level.width, horizontal_taps);
+            BuildFilterTaps(_options_in.filter, source.height, level.height, vertical_taps);
+            ForEachTile(_job_system_in,
+                        level.height,
+                        level.width,
+                        [&](const int& _first_row_in, const int& _end_row_in)
+                        {
+                            ResampleTile(source_pixels,
+                                         source.width,
+                                         source.height,
+                                         horizontal_taps,
+                                         vertical_taps,
+                                         _options_in.srgb,
+                                         _first_row_in,
+                                         _end_row_in,
+                                         level);
+                        });
+        }
+    }
+
+    // Note: Each level was filtered from the unscaled level above it; scaling is applied last.
+    if (0.0f != _options_in.alpha_coverage_reference)
+    {
+        const size_t pixel_count = static_cast<size_t>(_image_width_in) * _image_height_in;
+
+        size_t histogram[256];
+        BuildAlphaHistogram(_image_data_in, pixel_count, histogram);
+        const double target_coverage = GetAlphaCoverage(histogram,
+                                                        pixel_count,
+                                                        _options_in.alpha_coverage_reference,
+                                                        1.0f);
+        for (MipLevel& level : _levels_out)
+        {
+            PreserveAlphaCoverage(target_coverage, _options_in.alpha_coverage_reference, level);
+        }
+    }
+
+    _success_out = true;
+}
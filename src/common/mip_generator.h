@@ -0,0 +1,65 @@
+#ifndef mip_generator_h
+#define mip_generator_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "job_system.h"
+
+//
+// Note: Generates the mip chain of an RGBA image, eight bits per channel, as loaded by
+//       LoadImageToMemory(...) in image_tools.h. Used to cook textures (see cooked_texture.h), and
+//       wherever glGenerateMipmap is unavailable.
+//
+//       Each level is filtered from the one above it and is half its size, rounded down, as
+//       OpenGL sizes mipmaps:
+//
+//       BOX      Averages each 2x2 block; the last row or column of an odd sized level is
+//                dropped. The fastest, and what drivers generally use. Runs eight pixels at a
+//                time on AVX2 in the /arch:AVX2 (-mavx2) builds, four on SSE otherwise.
+//       KAISER   Kaiser windowed sinc, three lobes wide. Sharper, and handles odd sizes exactly.
+//       LANCZOS  Lanczos windowed sinc, three lobes wide. Sharper still, with more ringing.
+//
+//       sRGB encoded color is filtered in linear space, converted through lookup tables; alpha
+//       is always linear.
+//
+struct MipLevel
+{
+    int                        width  = 0;
+    int                        height = 0;
+    std::vector<unsigned char> pixels;
+};
+
+enum class MipFilter
+{
+    BOX = 0,
+    KAISER,
+    LANCZOS
+};
+
+struct MipGenerationOptions
+{
+    MipFilter filter = MipFilter::BOX;
+    bool      srgb   = false;
+
+    // Note: Alpha tested textures thin out as their alpha is averaged into lower levels. When
+    //       non-zero, the alpha of each level is scaled such that the fraction of pixels with
+    //       alpha above this reference, in (0, 1), matches that of the image.
+    float alpha_coverage_reference = 0.0f;
+};
+
+// Note: `_levels_out` receives every level below the image, largest first; level zero is the
+//       image itself. Rows of each level are tiled across `_job_system_in` when provided, and
+//       only those jobs are waited on; see JobSystem::Wait(JobBatch&). The calling thread does
+//       the work otherwise.
+void
+GenerateMipChain(bool&                       _success_out,
+                 const unsigned char* const  _image_data_in,
+                 const int&                  _image_width_in,
+                 const int&                  _image_height_in,
+                 const MipGenerationOptions& _options_in,
+                 JobSystem* const            _job_system_in,
+                 std::vector<MipLevel>&      _levels_out);
+
+#endif // mip_generator_h
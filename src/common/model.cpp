@@ -4,11 +4,23 @@
 
 #include "model.h"
 
-#include "fileio.h"
 #include "gl_function_wrappers.h"
 #include "gl_tools.h"
 #include "logging.h"
 #include "state_tools.h"
+#include "texture_cache.h"
+
+void
+Model::SetBoundingVolume(const BoundingVolume& _bounding_volume_in) noexcept
+{
+    bounding_volume = _bounding_volume_in;
+}
+
+const BoundingVolume&
+Model::GetBoundingVolume() const noexcept
+{
+    return bounding_volume;
+}
 
 BufferedModel::~BufferedModel()
 {
@@ -169,6 +181,7 @@ BufferedModel::AddElementBuffer(bool&               _success_out,
                                 const GLvoid* const _data_in,
                                 const GLsizeiptr&&  _data_size_bytes_in,
                                 const GLsizei&&     _target_buffer_element_count_in,
+                                const GLenum&&      _element_data_type_in,
                                 const GLenum&&      _target_buffer_usage_type_in,
                                 const GLenum&&      _primitive_drawing_mode_in)
 {
@@ -186,6 +199,7 @@ BufferedModel::AddElementBuffer(bool&               _success_out,
                                          _data_in,
                                          std::move(_data_size_bytes_in),
                                          std::move(_target_buffer_element_count_in),
+                                         std::move(_element_data_type_in),
                                          std::move(_target_buffer_usage_type_in),
                                          std::move(_primitive_drawing_mode_in));
 }
@@ -331,13 +345,193 @@ BufferedModel::Draw() const noexcept
 
     // Note: Avoiding scoped binding helper objects in draw loop.
     glfn::BindVertexArray(*vertex_array_object);
-    glfn::DrawElements(buffer_store.element_buffer->buffer_info.primitive_drawing_mode,
-                       buffer_store.element_buffer->buffer_info.target_buffer_element_count,
-                       GL_UNSIGNED_INT,
-                       (void*)0);
+    DrawSelectedElements();
     glfn::BindVertexArray(0);
 }
 
+void
+BufferedModel::SetLevelsOfDetail(bool&                       _success_out,
+                                 const std::vector<MeshLod>& _levels_of_detail_in)
+{
+    if (nullptr == buffer_store.element_buffer)
+    {
+        _success_out = false;
+        Log_e("No element buffer was added; cannot set levels of detail.");
+        return;
+    }
+
+    const size_t element_buffer_count = static_cast<size_t>(
+      buffer_store.element_buffer->buffer_info.target_buffer_element_count);
+    for (auto& level_of_detail : _levels_of_detail_in)
+    {
+        if ((0 == level_of_detail.element_count) ||
+            ((level_of_detail.first_element + level_of_detail.element_count) >
+             element_buffer_count))
+        {
+            std::stringstream ss;
+            ss << "Level of detail elements [" << level_of_detail.first_element << ", "
+               << (level_of_detail.first_element + level_of_detail.element_count)
+               << ") are outside of the element buffer (" << element_buffer_count
+               << " elements).";
+            Log_e(ss);
+            _success_out = false;
+            return;
+        }
+    }
+
+    levels_of_detail         = _levels_of_detail_in;
+    selected_level_of_detail = 0;
+
+    _success_out = true;
+}
+
+size_t
+BufferedModel::SelectLevelOfDetail(const float&& _distance_in,
+                                   const float&& _projection_scale_in,
+                                   const float&& _max_screen_space_error_pixels_in) noexcept
+{
+    // Note: Levels are ordered by increasing error; keep the last one that is fine enough. The
+    //       camera may be inside the bounds of the model, where only the finest level will do.
+    selected_level_of_detail = 0;
+    if (0.0f < _distance_in)
+    {
+        for (size_t level = 1; level < levels_of_detail.size(); level++)
+        {
+            const float screen_space_error_pixels = levels_of_detail[level].geometric_error *
+                                                    _projection_scale_in / _distance_in;
+            if (screen_space_error_pixels > _max_screen_space_error_pixels_in)
+            {
+                break;
+            }
+
+            selected_level_of_detail = level;
+        }
+    }
+
+    return selected_level_of_detail;
+}
+
+void
+BufferedModel::GetSelectedElementRange(GLsizei&       _element_count_out,
+                                       const GLvoid*& _element_byte_offset_out) const noexcept
+{
+    const glt::GLBufferInfo& buffer_info = buffer_store.element_buffer->buffer_info;
+    if (0 == levels_of_detail.size())
+    {
+        _element_count_out       = buffer_info.target_buffer_element_count;
+        _element_byte_offset_out = nullptr;
+        return;
+    }
+
+    const MeshLod& level_of_detail = levels_of_detail[selected_level_of_detail];
+    _element_count_out             = static_cast<GLsizei>(level_of_detail.element_count);
+    _element_byte_offset_out       = reinterpret_cast<const GLvoid*>(
+      level_of_detail.first_element * GLDataTypeSizeBytes(buffer_info.element_data_type));
+}
+
+void
+BufferedModel::DrawSelectedElements() const noexcept
+{
+    const glt::GLBufferInfo& buffer_info = buffer_store.element_buffer->buffer_info;
+    if ((true == meshlets_culled) && (0 == selected_level_of_detail))
+    {
+        // Note: Every meshlet may have been culled.
+        if (0 != visible_meshlet_element_counts.size())
+        {
+            glfn::MultiDrawElements(buffer_info.primitive_drawing_mode,
+                                    visible_meshlet_element_counts.data(),
+                                    buffer_info.element_data_type,
+                                    visible_meshlet_byte_offsets.data(),
+                                    static_cast<GLsizei>(visible_meshlet_element_counts.size()));
+        }
+
+        return;
+    }
+
+    GLsizei       element_count       = 0;
+    const GLvoid* element_byte_offset = nullptr;
+    GetSelectedElementRange(element_count, element_byte_offset);
+
+    glfn::DrawElements(buffer_info.primitive_drawing_mode,
+                       element_count,
+                       buffer_info.element_data_type,
+                       element_byte_offset);
+}
+
+void
+BufferedModel::SetMeshlets(bool& _success_out, const std::vector<Meshlet>& _meshlets_in)
+{
+    if (nullptr == buffer_store.element_buffer)
+    {
+        _success_out = false;
+        Log_e("No element buffer was added; cannot set meshlets.");
+        return;
+    }
+
+    // Note: Levels of detail are appended after the full resolution elements, which the
+    //       meshlets partition.
+    size_t element_count = static_cast<size_t>(
+      buffer_store.element_buffer->buffer_info.target_buffer_element_count);
+    if (0 != levels_of_detail.size())
+    {
+        element_count = levels_of_detail[0].element_count;
+    }
+
+    for (auto& meshlet : _meshlets_in)
+    {
+        if ((static_cast<size_t>(meshlet.first_element) + meshlet.element_count) > element_count)
+        {
+            std::stringstream ss;
+            ss << "Meshlet elements [" << meshlet.first_element << ", "
+               << (static_cast<size_t>(meshlet.first_element) + meshlet.element_count)
+               << ") are outside of the full resolution elements (" << element_count
+               << " elements).";
+            Log_e(ss);
+            _success_out = false;
+            return;
+        }
+    }
+
+    meshlets        = _meshlets_in;
+    meshlets_culled = false;
+
+    _success_out = true;
+}
+
+void
+BufferedModel::CullMeshlets(const glm::mat4&          _model_view_projection_in,
+                            const glm::vec3&          _camera_position_in,
+                            MeshletCullingStatistics& _statistics_out) noexcept
+{
+    assert(nullptr != buffer_store.element_buffer);
+
+    _statistics_out = {};
+    meshlets_culled = false;
+    if ((0 == meshlets.size()) || (0 != selected_level_of_detail))
+    {
+        return;
+    }
+
+    CullMeshletRanges(meshlets,
+                      _model_view_projection_in,
+                      _camera_position_in,
+                      visible_meshlet_ranges,
+                      _statistics_out);
+
+    const size_t element_size_bytes = GLDataTypeSizeBytes(
+      buffer_store.element_buffer->buffer_info.element_data_type);
+    visible_meshlet_element_counts.clear();
+    visible_meshlet_byte_offsets.clear();
+    for (auto& range : visible_meshlet_ranges)
+    {
+        visible_meshlet_element_counts.push_back(static_cast<GLsizei>(range.element_count));
+        visible_meshlet_byte_offsets.push_back(
+          reinterpret_cast<const GLvoid*>(range.first_element * element_size_bytes));
+    }
+
+    meshlets_culled = true;
+}
+
 TextureInfo::TextureInfo(const GLuint&& _texture_id_in,
                          const GLuint&& _texture_coordinates_vbo_id_in,
                          const GLuint&& _texture_coordinates_vertex_attribute_index_in,
@@ -352,23 +546,23 @@ TextureInfo::TextureInfo(const GLuint&& _texture_id_in,
 }
 
 void
-TexturedModel::AddTexture(bool&             _success_out,
-                          const char* const _file_path_in,
-                          const GLuint&&    _vbo_id_in,
-                          const GLuint&&    _texture_coordinates_vertex_attribute_index_in,
-                          const GLenum&&    _texture_unit_in,
-                          const GLenum&&    _texture_target_buffer_type_in,
-                          GLuint&           _texture_id_out) noexcept
+TexturedModel::AddTexture(
+  bool&                              _success_out,
+  const char* const                  _file_path_in,
+  const GLuint&&                     _vbo_id_in,
+  const GLuint&&                     _texture_coordinates_vertex_attribute_index_in,
+  const GLenum&&                     _texture_unit_in,
+  const GLenum&&                     _texture_target_buffer_type_in,
+  GLuint&                            _texture_id_out,
+  const glt::TextureSamplerSettings& _sampler_settings_in) noexcept
 {
     _success_out = false;
 
-    // Note: glt::GetTexture2DFromImage handles nullptr file path.
-    _texture_id_out = glt::GetTexture2DFromImage(_success_out, std::move(_file_path_in), true);
+    // Note: The texture cache handles nullptr file path.
+    TextureCache* const texture_cache = TextureCache::GetInstance();
+    texture_cache->Acquire(_success_out, _file_path_in, _sampler_settings_in, _texture_id_out);
     if (false == _success_out)
     {
-        std::stringstream ss;
-        ss << "Unable to load texture at: " << _file_path_in;
-        Log_e(ss);
         return;
     }
 
@@ -380,8 +574,13 @@ TexturedModel::AddTexture(bool&             _success_out,
 
     if (false == is_unique)
     {
-        Log_e("A non-unique texture ID was generated.");
-        glfn::DeleteTextures(1, &_texture_id_out);
+        std::stringstream ss;
+        ss << "The texture at " << _file_path_in << " was already added to this model.";
+        Log_e(ss);
+
+        bool release_success;
+        texture_cache->Release(release_success, std::move(_texture_id_out));
+        _success_out = false;
         return;
     }
 
@@ -393,6 +592,169 @@ TexturedModel::AddTexture(bool&             _success_out,
     _success_out = true;
 }
 
+void
+TexturedModel::AddStreamedTexture(
+  bool&                              _success_out,
+  TextureStreamer&                   _texture_streamer_in_out,
+  const char* const                  _file_path_in,
+  const GLuint&&                     _vbo_id_in,
+  const GLuint&&                     _texture_coordinates_vertex_attribute_index_in,
+  const GLenum&&                     _texture_unit_in,
+  const GLenum&&                     _texture_target_buffer_type_in,
+  GLuint&                            _texture_id_out,
+  const glt::TextureSamplerSettings& _sampler_settings_in) noexcept
+{
+    _success_out = false;
+
+    // Note: Streamed textures are not shared, so each has its own texture id; the same file
+    //       streamed twice by the same streamer is the duplicate. It is rejected before the
+    //       texture is streamed, so that a rejected call decodes and uploads nothing.
+    const std::string canonical_path = GetCanonicalTexturePath(_file_path_in);
+    for (size_t index = 0; index < added_textures.size(); index++)
+    {
+        if ((&_texture_streamer_in_out == added_textures[index].texture_streamer) &&
+            (canonical_path == added_textures[index].streamed_file_path))
+        {
+            std::stringstream ss;
+            ss << "The texture at " << _file_path_in << " was already added to this model.";
+            Log_e(ss);
+            return;
+        }
+    }
+
+    StreamedTextureHandle streamed_texture;
+    _texture_streamer_in_out.StreamTexture(_success_out,
+                                           _file_path_in,
+                                           _sampler_settings_in,
+                                           streamed_texture);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    _texture_id_out = streamed_texture.GetTextureId();
+    added_textures.push_back(TextureInfo(std::move(_texture_id_out),
+                                         std::move(_vbo_id_in),
+                                         std::move(_texture_coordinates_vertex_attribute_index_in),
+                                         std::move(_texture_target_buffer_type_in),
+                                         std::move(_texture_unit_in)));
+    added_textures.back().texture_streamer   = &_texture_streamer_in_out;
+    added_textures.back().streamed_texture   = streamed_texture;
+    added_textures.back().streamed_file_path = canonical_path;
+    _success_out                             = true;
+}
+
+void
+TexturedModel::AddAtlasTexture(
+  bool&                              _success_out,
+  const char* const                  _atlas_image_file_path_in,
+  const char* const                  _sub_image_name_in,
+  const GLuint&&                     _vbo_id_in,
+  const GLuint&&                     _texture_coordinates_vertex_attribute_index_in,
+  const GLenum&&                     _texture_unit_in,
+  const GLenum&&                     _texture_target_buffer_type_in,
+  GLuint&                            _texture_id_out,
+  const glt::TextureSamplerSettings& _sampler_settings_in) noexcept
+{
+    TextureAtlas texture_atlas;
+    ReadTextureAtlas(_success_out, _atlas_image_file_path_in, texture_atlas);
+    if (false == _success_out)
+    {
+        std::stringstream ss;
+        ss << "Unable to read the texture atlas description of " << _atlas_image_file_path_in
+           << "; was it cooked?";
+        Log_e(ss);
+        return;
+    }
+
+    const TextureAtlasSubImage* sub_image = nullptr;
+    FindTextureAtlasSubImage(_success_out, texture_atlas, _sub_image_name_in, sub_image);
+    if (false == _success_out)
+    {
+        std::stringstream ss;
+        ss << "The texture atlas " << _atlas_image_file_path_in << " has no sub-image named "
+           << _sub_image_name_in << ".";
+        Log_e(ss);
+        return;
+    }
+
+    // Note: Sub-images of one atlas share its texture id, so a duplicate is the same sub-image of
+    //       the same atlas rather than the same texture.
+    const std::string canonical_path = GetCanonicalTexturePath(_atlas_image_file_path_in);
+    for (size_t index = 0; index < added_textures.size(); index++)
+    {
+        if ((canonical_path == added_textures[index].atlas_file_path) &&
+            (sub_image->name == added_textures[index].atlas_sub_image_name))
+        {
+            std::stringstream ss;
+            ss << "The sub-image " << _sub_image_name_in << " of the texture atlas "
+               << _atlas_image_file_path_in << " was already added to this model.";
+            Log_e(ss);
+            _success_out = false;
+            return;
+        }
+    }
+
+    TextureCache::GetInstance()->Acquire(_success_out,
+                                         _atlas_image_file_path_in,
+                                         _sampler_settings_in,
+                                         _texture_id_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    added_textures.push_back(TextureInfo(std::move(_texture_id_out),
+                                         std::move(_vbo_id_in),
+                                         std::move(_texture_coordinates_vertex_attribute_index_in),
+                                         std::move(_texture_target_buffer_type_in),
+                                         std::move(_texture_unit_in)));
+    added_textures.back().atlas_file_path               = canonical_path;
+    added_textures.back().atlas_sub_image_name          = sub_image->name;
+    added_textures.back().texture_coordinates_transform = sub_image->texture_coordinates_transform;
+}
+
+void
+TexturedModel::SetTextureCoordinatesTransformUniform(bool&             _success_out,
+                                                     const GLuint&&    _rendering_program_id_in,
+                                                     const char* const _uniform_name_in)
+{
+    if (false == glfn::IsProgram(_rendering_program_id_in))
+    {
+        _success_out = false;
+        Log_e("Invalid rendering program; cannot set the texture coordinates transform uniform.");
+        return;
+    }
+
+    const GLint uniform_location = glfn::GetUniformLocation(_rendering_program_id_in,
+                                                            _uniform_name_in);
+    if (-1 == uniform_location)
+    {
+        _success_out = false;
+        std::stringstream ss;
+        ss << "A uniform with name " << _uniform_name_in
+           << " could not be found in the rendering program with id: " << _rendering_program_id_in
+           << ". Could not set the texture coordinates transform uniform.";
+        Log_e(ss);
+        return;
+    }
+
+    texture_coordinates_transform_location = uniform_location;
+    _success_out                           = true;
+}
+
+void
+TexturedModel::SetStreamedTexturePriority(const float&& _priority_in) noexcept
+{
+    for (TextureInfo& texture : added_textures)
+    {
+        if (nullptr != texture.texture_streamer)
+        {
+            texture.streamed_texture.SetPriority(_priority_in);
+        }
+    }
+}
+
 void
 TexturedModel::EnableTexture(bool& _success_out, const GLuint&& _texture_id_in)
 {
@@ -422,6 +784,50 @@ TexturedModel::EnableTexture(bool& _success_out, const GLuint&& _texture_id_in)
     _success_out              = true;
 }
 
+void
+TexturedModel::EnableAtlasTexture(bool&             _success_out,
+                                  const char* const _atlas_image_file_path_in,
+                                  const char* const _sub_image_name_in)
+{
+    const std::string canonical_path = GetCanonicalTexturePath(_atlas_image_file_path_in);
+    for (auto& texture : added_textures)
+    {
+        if ((canonical_path == texture.atlas_file_path) &&
+            (texture.atlas_sub_image_name == _sub_image_name_in))
+        {
+            currently_enabled_texture = &texture;
+            _success_out              = true;
+            return;
+        }
+    }
+
+    std::stringstream ss;
+    ss << "The sub-image " << _sub_image_name_in << " of the texture atlas "
+       << _atlas_image_file_path_in << " was not found.";
+    Log_e(ss);
+    _success_out = false;
+}
+
+void
+TexturedModel::ReleaseTextures() noexcept
+{
+    TextureCache* const texture_cache = TextureCache::GetInstance();
+    for (TextureInfo& texture : added_textures)
+    {
+        bool release_success;
+        if (nullptr != texture.texture_streamer)
+        {
+            texture.texture_streamer->ReleaseTexture(release_success, texture.streamed_texture);
+            continue;
+        }
+
+        texture_cache->Release(release_success, std::move(texture.texture_id));
+    }
+
+    added_textures.clear();
+    currently_enabled_texture = nullptr;
+}
+
 void
 TexturedModel::Draw() const noexcept
 {
@@ -462,1004 +868,35 @@ TexturedModel::Draw() const noexcept
 
     if (nullptr != currently_enabled_texture)
     {
-        glfn::ActiveTexture(currently_enabled_texture->texture_unit);
-
-        // Note: Texture does not get unbound in this loop.
-        glfn::BindTexture(currently_enabled_texture->texture_target,
-                          currently_enabled_texture->texture_id);
-    }
-
-    glfn::DrawElements(buffer_store.element_buffer->buffer_info.primitive_drawing_mode,
-                       buffer_store.element_buffer->buffer_info.target_buffer_element_count,
-                       GL_UNSIGNED_INT,
-                       (void*)0);
-
-    glfn::BindVertexArray(0);
-}
-
-// void
-// LoadModelFromObjFile(bool&             _success_out,
-//                      const char* const _obj_file_path_in,
-//                      ImportedModel&    _model_in)
-// {
-//     Log_w("LoadModelFromObjFile(...) Does not account for duplicate vertices, texture coordinates, "
-//           "or normal data in faces. If possible, try using another 3D mesh file format which"
-//           " accounts for this issue. The Stanford Triangle Format, \".ply\" is currently"
-//           " favored in this codebase.");
-
-//     _success_out = true;
-//     std::stringstream ss;
-//     std::stringstream sub_ss;
-
-//     size_t      file_data_size_bytes;
-//     std::string file_data;
-//     LoadFileToStdString(_success_out, _obj_file_path_in, file_data_size_bytes, file_data);
-//     if ((false == _success_out) || (0 == file_data_size_bytes))
-//     {
-//         Log_e("Could not load object file.");
-//         return;
-//     }
-
-//     // Object File Prefixes:
-//     // -------------------------------------
-//     // 'v':  Geometric vertex location.
-//     // 'vt': Texture Coordinates.
-//     // 'vn': Vertex normals.
-//     // 'f':  Face.
-
-//     const char* const      delimeter         = "\n";
-//     const char* const      sub_delimeters    = "/ ";
-//     char*                  token             = std::strtok(file_data.data(), delimeter);
-//     char*                  sub_token         = nullptr;
-//     size_t                 char_line_offset  = 0;
-//     size_t                 char_total_offset = 0;
-//     size_t                 line_number       = 1;
-//     std::vector<glm::vec2> texture_coordinates;
-//     std::vector<glm::vec3> vertices;
-//     std::vector<glm::vec3> normals;
-//     std::vector<glm::vec3> faces;
-
-//     auto report_parse_error = [&](const char* const _note = nullptr)
-//     {
-//         ss << "Failed to parse model object file." << std::endl
-//            << "   Object File: " << _obj_file_path_in << std::endl
-//            << "   Line Number: " << line_number << std::endl
-//            << "   Line Data:   " << token;
-
-//         if (nullptr != _note)
-//         {
-//             ss << std::endl << "   Note:        " << _note;
-//         }
-
-//         Log_e(ss);
-//         _success_out = false;
-//     };
-
-//     // Note: Incrememnts the `char_line_offset` variable by +1.
-//     auto ensure_next_space = [&]()
-//     {
-//         char previous_char = token[char_line_offset];
-//         if (' ' != token[char_line_offset++])
-//         {
-//             sub_ss << "Expected a space after `" << previous_char << "` at line offset "
-//                    << char_line_offset - 1;
-//             report_parse_error(sub_ss.str().c_str());
-//         }
-//     };
-
-//     // Note: Using float vector as general container, will cast to unsigned int
-//     //       for faces/element indexes. Verticies, normals, and texture coordinates
-//     //       remain floats. Container reserved 12 spaces as the largest data group per
-//     //       line in the .obj file are the "faces" lines, having 4 groups of 3.
-//     std::vector<float> elements;
-//     elements.reserve(12); // Largest data group is "faces", with 12 elements.
-//     elements.shrink_to_fit();
-
-//     float temp_float;
-//     char* strtof_ending = nullptr;
-
-//     auto deserialize_core_impl = [&]()
-//     {
-//         elements.clear();
-//         sub_token = std::strtok(&(token[char_line_offset]), sub_delimeters);
-//         while (nullptr != sub_token)
-//         {
-//             temp_float = std::strtof(sub_token, &strtof_ending);
-//             if (0 == strtof_ending)
-//             {
-//                 sub_ss << "Could not parse as float: " << sub_token;
-//                 report_parse_error(sub_ss.str().c_str());
-//             }
-
-//             elements.push_back(temp_float);
-//             sub_token = std::strtok(nullptr, sub_delimeters);
-//         }
-//     };
-
-//     auto deserialize_to_vec2 = [&](std::vector<glm::vec2>& _target_buffer_type_in)
-//     {
-//         deserialize_core_impl();
-//         if (2 != elements.size())
-//         {
-//             sub_ss << "Expected 2 elements, got " << elements.size();
-//             report_parse_error(sub_ss.str().c_str());
-//         }
-//         else
-//         {
-//             _target_buffer_type_in.push_back(glm::vec2(elements[0], elements[1]));
-//         }
-//     };
-
-//     auto deserialize_to_vec3 = [&](std::vector<glm::vec3>& _target_buffer_type_in)
-//     {
-//         deserialize_core_impl();
-//         if (&_target_buffer_type_in == &faces)
-//         {
-//             if (9 != elements.size())
-//             {
-//                 sub_ss << "Expected 9 elements, got " << elements.size()
-//                        << ". Was \"Triangulated Mesh\" selected on object export?";
-//                 report_parse_error(sub_ss.str().c_str());
-//             }
-//             else
-//             {
-//                 _target_buffer_type_in.push_back(glm::vec3(elements[0], elements[1], elements[2]));
-//                 _target_buffer_type_in.push_back(glm::vec3(elements[3], elements[4], elements[5]));
-//                 _target_buffer_type_in.push_back(glm::vec3(elements[6], elements[7], elements[8]));
-//             }
-//         }
-//         else
-//         {
-//             if (3 != elements.size())
-//             {
-//                 sub_ss << "Expected 3 elements, got " << elements.size();
-//                 report_parse_error(sub_ss.str().c_str());
-//             }
-//             else
-//             {
-//                 _target_buffer_type_in.push_back(glm::vec3(elements[0], elements[1], elements[2]));
-//             }
-//         }
-//     };
-
-//     while (nullptr != token)
-//     {
-//         if (false == _success_out) return;
-
-//         char_line_offset = 0;
-//         char_total_offset += strlen(token) + 1;
-
-//         switch (token[char_line_offset++])
-//         {
-//             case '#': // Skip comments.
-//             case 's': // Skip smoothing for now.
-//             case 'o': // Skip object name for now.
-//             {
-//                 break;
-//             }
-//             case 'v':
-//             {
-//                 switch (token[char_line_offset++])
-//                 {
-//                     case ' ': // Geometric vertex location. ("v ")
-//                     {
-//                         deserialize_to_vec3(vertices);
-//                         break;
-//                     }
-//                     case 't': // Texture coordinates. ("vt  ")
-//                     {
-//                         ensure_next_space();
-//                         deserialize_to_vec2(texture_coordinates);
-//                         break;
-//                     }
-//                     case 'n': // Normal coordinates. ("vn ")
-//                     {
-//                         ensure_next_space();
-//                         deserialize_to_vec3(normals);
-//                         break;
-//                     }
-//                     default:
-//                     {
-//                         report_parse_error();
-//                     }
-//                 }
-//                 break;
-//             }
-//             case 'f': // Face. ("f ")
-//             {
-//                 ensure_next_space();
-//                 deserialize_to_vec3(faces);
-//                 break;
-//             }
-//             default:
-//             {
-//                 sub_ss << "Unexpected start-of-line: \"" << token[char_line_offset - 1] << "\"";
-//                 report_parse_error(sub_ss.str().c_str());
-//             }
-//         }
-
-//         token = std::strtok((file_data.data() + char_total_offset), delimeter);
-//         line_number++;
-//     }
-
-//     _model_in.AddBuffers(_success_out, texture_coordinates, vertices, normals, faces);
-//     if (false == _success_out)
-//     {
-//         Log_e("Model load failed due to errors in buffer addition.");
-//         return;
-//     }
-// }
-
-void
-LoadModelFromAsciiPlyFile(
-  bool&                                        _success_out,
-  const GLuint&&                               _vertex_array_object_id_in,
-  const char* const                            _ascii_ply_file_path_in,
-  const GLuint&&                               _position_attribute_index_in,
-  const GLuint&&                               _normal_attribute_index_in,
-  const GLuint&&                               _texture_coordinates_attribute_index_in,
-  size_t&                                      _vertex_count_out,
-  std::vector<float>&                          _buffer_data_out,
-  std::vector<GLuint>&                         _buffer_elements_array_out,
-  std::vector<glt::VertexDataType>&            _vertex_data_types_out,
-  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out)
-{
-    _success_out = true;
-
-    size_t      file_data_size_bytes;
-    std::string file_data;
-    LoadFileToStdString(_success_out, _ascii_ply_file_path_in, file_data_size_bytes, file_data);
-    if ((false == _success_out) || (0 == file_data_size_bytes))
-    {
-        Log_e("Could not load .ply object file.");
-        return;
-    }
-
-    const std::string ply_tag = "ply";
-    const std::string test    = file_data.substr(0, 3);
-    if (test != ply_tag)
-    {
-        Log_e("Invalid .ply file.");
-        _success_out = false;
-        return;
-    }
-
-    const std::string format_tag                    = "format";
-    const std::string ascii_tag                     = "ascii";
-    const std::string version_tag                   = "1.0";
-    const std::string comment_tag                   = "comment";
-    const std::string element_tag                   = "element";
-    const std::string end_header_tag                = "end_header";
-    const std::string property_tag                  = "property";
-    const std::string vertex_tag                    = "vertex";
-    const std::string x_tag                         = "x";
-    const std::string y_tag                         = "y";
-    const std::string z_tag                         = "z";
-    const std::string nx_tag                        = "nx";
-    const std::string ny_tag                        = "ny";
-    const std::string nz_tag                        = "nz";
-    const std::string s_tag                         = "s";
-    const std::string t_tag                         = "t";
-    const std::string float_tag                     = "float";
-    const std::string face_tag                      = "face";
-    const std::string list_tag                      = "list";
-    const std::string uchar_uint_vertex_indices_tag = "uchar uint vertex_indices";
-    const char* const strtok_delim                  = " ";
-
-    // Note: If more types are added, ensure to cover additions in the
-    //       switch for that data type as well as the stringify lambda switch below.
-    enum class ElementTypes
-    {
-        NONE = 0,
-        VERTEX,
-        FACE
-    };
-
-    auto stringify_element_type = [](ElementTypes _type_in, std::string& _string_out)
-    {
-        switch (_type_in)
-        {
-            case ElementTypes::VERTEX:
-            {
-                _string_out = "ElementTypes::VERTEX";
-                break;
-            }
-            case ElementTypes::FACE:
-            {
-                _string_out = "ElementTypes::FACE";
-                break;
-            }
-            case ElementTypes::NONE:
-            {
-                _string_out = "ElementTypes::NONE";
-                break;
-            }
-        }
-    };
-
-    std::istringstream       file_data_stream(file_data);
-    std::string              file_data_line;
-    std::vector<std::string> file_data_line_string_elements;
-    std::vector<float>       file_data_line_float_elements;
-    std::stringstream        ss;
-    size_t                   file_line_number = 0;
-
-    auto split_line_to_strings = [](const std::string&        _line_in,
-                                    const char* const         _delimeter_in,
-                                    std::vector<std::string>& _target_buffer_type_in_out)
-    {
-        _target_buffer_type_in_out.clear();
-        std::string line_copy = _line_in;
-        const char* token     = std::strtok(line_copy.data(), _delimeter_in);
-
-        while (nullptr != token)
-        {
-            _target_buffer_type_in_out.push_back(std::string(token));
-            token = std::strtok(nullptr, _delimeter_in);
-        }
-    };
-
-    // Note: sets _success_out to false, exiting loops in implementations below.
-    auto report_parse_error = [&](const char* const _note = nullptr)
-    {
-        std::stringstream parse_error_ss;
-        parse_error_ss << "Failed to parse model PLY file." << std::endl
-                       << "   PLY File:    " << _ascii_ply_file_path_in << std::endl
-                       << "   Line Number: " << file_line_number << std::endl
-                       << "   Line Data:   " << file_data_line;
-
-        if (nullptr != _note)
-        {
-            parse_error_ss << std::endl << "   Note:        " << _note;
-        }
-
-        Log_e(parse_error_ss);
-        _success_out = false;
-    };
-
-    // Note: sets _success_out to false, exiting loops in implementations below.
-    auto report_invalid_string_sequence = [&]()
-    {
-        ss.clear();
-        ss << "Invalid string sequence: " + file_data_line_string_elements[0];
-        report_parse_error(ss.str().c_str());
-    };
-
-    auto convert_string_to_data_size_bytes_in_t =
-      [](const char* const _string_in, size_t& _data_size_bytes_in_t_out)
-    {
-        char*         strtoull_ending = nullptr;
-        constexpr int base            = 10;
-        _data_size_bytes_in_t_out     = std::strtoull(_string_in, &strtoull_ending, base);
-
-        if (0 == strtoull_ending)
-        {
-            _data_size_bytes_in_t_out = 0; // Indicates error state to caller.
-        }
-    };
-
-    auto convert_strings_to_floats =
-      [](const std::vector<std::string>& _strings_in, std::vector<float>& _floats_out)
-    {
-        _floats_out.clear();
-        char* strtof_ending = nullptr;
-        float temp_float;
-        for (auto& str : _strings_in)
-        {
-            temp_float = std::strtof(str.c_str(), &strtof_ending);
-
-            if (0 == strtof_ending)
-            {
-                _floats_out.clear(); // Indicates error state to caller.
-                return;
-            }
-
-            _floats_out.push_back(temp_float);
-        }
-    };
-
-    auto update_element_count_and_layout_order =
-      [](char&                             _element_count_in,
-         bool&                             _vertex_type_bool_in,
-         std::vector<glt::VertexDataType>& _vertex_data_type_target_buffer_in,
-         glt::VertexDataType&&             _vertex_data_type_in)
-    {
-        _element_count_in++;
-
-        if (false == _vertex_type_bool_in)
-        {
-            _vertex_data_type_target_buffer_in.push_back(_vertex_data_type_in);
-        }
-        _vertex_type_bool_in = true;
-    };
-
-    size_t vertex_count                       = 0;
-    char   vertex_component_count             = 0;
-    char   normal_component_count             = 0;
-    char   texture_coordinate_component_count = 0;
-    size_t face_count                         = 0;
-
-    std::vector<ElementTypes>        file_element_layout_order;
-    std::vector<glt::VertexDataType> vertex_data_type_layout_order;
-    std::vector<float>               model_data_in;
-    std::vector<GLuint>              model_elements;
-
-    // Parse Header
-    {
-        bool         vertices_header_processed                 = false;
-        bool         faces_header_processed                    = false;
-        bool         header_complete                           = false;
-        bool         face_properties_set                       = false;
-        bool         vertex_position_data_type_added           = false;
-        bool         normal_vertex_data_type_added             = false;
-        bool         texture_coordinate_vertex_data_type_added = false;
-        ElementTypes current_element_type                      = ElementTypes::NONE;
-        while ((false == header_complete) && (true == _success_out) &&
-               (std::getline(file_data_stream, file_data_line)))
-        {
-            file_line_number++;
-            split_line_to_strings(file_data_line, strtok_delim, file_data_line_string_elements);
-
-            switch (file_data_line_string_elements[0][0]) // Switch by 1st char of 1st string.
-            {
-                case 'c':
-                {
-                    if (comment_tag != file_data_line_string_elements[0]) // COMMENT TAG
-                    {
-                        report_invalid_string_sequence();
-                    }
-
-                    break;
-                }
-                case 'p':
-                {
-                    if (ply_tag == file_data_line_string_elements[0]) // PLY TAG
-                    {
-                        if (1 != file_data_line_string_elements.size() || 1 != file_line_number)
-                        {
-                            ss.clear();
-                            ss << "Invalid line containing: " + ply_tag;
-                            report_parse_error(ss.str().c_str());
-                        }
-                    }
-                    else if (property_tag == file_data_line_string_elements[0]) // PROPERTY TAG
-                    {
-                        switch (current_element_type)
-                        {
-                            case ElementTypes::VERTEX: // VERTEX PROPERTIES
-                            {
-                                if ((3 != file_data_line_string_elements.size()) ||
-                                    (float_tag != file_data_line_string_elements[1]))
-                                {
-                                    report_parse_error(
-                                      "Vertex property descriptions must be floats and defined on "
-                                      "lines containing exactly three words.");
-                                    break;
-                                }
-
-                                if ((x_tag == file_data_line_string_elements[2]) ||
-                                    (y_tag == file_data_line_string_elements[2]) ||
-                                    (z_tag == file_data_line_string_elements[2]))
-                                {
-                                    update_element_count_and_layout_order(
-                                      vertex_component_count,
-                                      vertex_position_data_type_added,
-                                      vertex_data_type_layout_order,
-                                      glt::VertexDataType::POSITION);
-                                }
-                                else if ((nx_tag == file_data_line_string_elements[2]) ||
-                                         (ny_tag == file_data_line_string_elements[2]) ||
-                                         (nz_tag == file_data_line_string_elements[2]))
-                                {
-                                    update_element_count_and_layout_order(
-                                      normal_component_count,
-                                      normal_vertex_data_type_added,
-                                      vertex_data_type_layout_order,
-                                      glt::VertexDataType::NORMAL);
-                                }
-                                else if ((s_tag == file_data_line_string_elements[2]) ||
-                                         (t_tag == file_data_line_string_elements[2]))
-                                {
-                                    update_element_count_and_layout_order(
-                                      texture_coordinate_component_count,
-                                      texture_coordinate_vertex_data_type_added,
-                                      vertex_data_type_layout_order,
-                                      glt::VertexDataType::TEXTURE);
-                                }
-                                else
-                                {
-                                    report_parse_error("Invalid vertex property description.");
-                                }
-
-                                break;
-                            }
-                            case ElementTypes::FACE: // FACE PROPERTIES
-                            {
-                                if (true == face_properties_set)
-                                {
-                                    report_parse_error(
-                                      "Face properties can be defined exactly once.");
-                                    break;
-                                }
-                                face_properties_set = true;
-
-                                const std::string comparison_test_a =
-                                  file_data_line_string_elements[1] + // No space is intentional.
-                                  file_data_line_string_elements[2] + " " +
-                                  file_data_line_string_elements[3] + " " +
-                                  file_data_line_string_elements[4];
-
-                                const std::string comparison_test_b = list_tag +
-                                                                      uchar_uint_vertex_indices_tag;
-
-                                if ((5 != file_data_line_string_elements.size()) ||
-                                    (comparison_test_a != comparison_test_b))
-                                {
-                                    report_parse_error("Invalid face property description.");
-                                }
-
-                                // Note: Above logic enforces a single element face property description with
-                                //       exactly the following text:
-                                //
-                                //       "property list uchar uint vertex_indices"
-
-                                break;
-                            }
-                            default:
-                            {
-                                report_parse_error("Property tags were found without first listing "
-                                                   "an element type.");
-                            }
-                        }
-                    }
-                    else
-                    {
-                        report_invalid_string_sequence();
-                    }
-
-                    break;
-                }
-                case 'f':
-                {
-                    if ((3 == file_data_line_string_elements.size()) &&
-                        (format_tag == file_data_line_string_elements[0])) // FORMAT TAG
-                    {
-                        if ((ascii_tag != file_data_line_string_elements[1]) &&
-                            (version_tag != file_data_line_string_elements[2]))
-                        {
-                            report_parse_error(
-                              "Unsupported file type or version. Must be ascii version 1.0");
-                        }
-                    }
-                    else
-                    {
-                        report_invalid_string_sequence();
-                    }
-
-                    break;
-                }
-                case 'e':
-                {
-                    if ((3 == file_data_line_string_elements.size()) &&
-                        (element_tag == file_data_line_string_elements[0])) // ELEMENT TAG
-                    {
-                        if (vertex_tag == file_data_line_string_elements[1]) // VERTEX TAG
-                        {
-                            if (true == vertices_header_processed)
-                            {
-                                report_parse_error(
-                                  "Vertex header information can be processed exactly once.");
-                                break;
-                            }
-
-                            convert_string_to_data_size_bytes_in_t(
-                              file_data_line_string_elements[2].c_str(),
-                              vertex_count);
-
-                            if (0 == vertex_count)
-                            {
-                                report_parse_error("Unable to determine vertex count.");
-                                break;
-                            }
-
-                            current_element_type = ElementTypes::VERTEX;
-                            file_element_layout_order.push_back(ElementTypes::VERTEX);
-                            vertices_header_processed = true;
-                        }
-                        else if (face_tag == file_data_line_string_elements[1]) // FACE TAG
-                        {
-                            if (true == faces_header_processed)
-                            {
-                                report_parse_error(
-                                  "Faces header information can be processed exactly once.");
-                                break;
-                            }
-
-                            convert_string_to_data_size_bytes_in_t(
-                              file_data_line_string_elements[2].c_str(),
-                              face_count);
-
-                            if (0 == face_count)
-                            {
-                                report_parse_error("Unable to determine face count.");
-                                break;
-                            }
-
-                            current_element_type = ElementTypes::FACE;
-                            file_element_layout_order.push_back(ElementTypes::FACE);
-                            faces_header_processed = true;
-                        }
-                    }
-                    else if (end_header_tag == file_data_line_string_elements[0]) // END HEADER TAG
-                    {
-                        if (3 != vertex_component_count)
-                        {
-                            report_parse_error(
-                              "Vertex coordinates require exactly three positional components.");
-                            break;
-                        }
-
-                        if (3 != normal_component_count)
-                        {
-                            report_parse_error("Normal vectors require exactly three components.");
-                            break;
-                        }
-
-                        if (2 != texture_coordinate_component_count)
-                        {
-                            report_parse_error(
-                              "Texture coordinates require exactly two positional components.");
-                            break;
-                        }
-
-                        if (0 == vertex_count)
-                        {
-                            report_parse_error("At least one vertex is required.");
-                            break;
-                        }
-
-                        if (0 == face_count)
-                        {
-                            report_parse_error("At least one face is required.");
-                            break;
-                        }
-
-                        model_data_in.resize(
-                          vertex_count * (vertex_component_count + normal_component_count +
-                                          texture_coordinate_component_count),
-                          0.0f);
-
-                        //
-                        // VISIBILITY: Reservation size for the element array is the face count multiplied
-                        //             by three since this importer requires that exported meshes are
-                        //             triangulated. There are checks in the data import section which will
-                        //             throw errors for non-triangulated meshes (containing quads or N-gons).
-                        //
-                        model_elements.resize(face_count * 3, 0);
-
-                        header_complete = true;
-                    }
-                    else
-                    {
-                        report_invalid_string_sequence();
-                    }
-
-                    break;
-                }
-            }
-        }
-    }
-
-    //
-    // [ cfarvin::TODO ] Move to a function, to be seen in the header later if needed.
-    // Debug: Neatly prints pivotal data from the .ply header.
-    //
-    {
-        // std::stringstream header_debug_ss;
-        // header_debug_ss << "Successfully loaded PLY header" << std::endl
-        //                 << "   File:              " << _ascii_ply_file_path_in << std::endl
-        //                 << "   Vertices:          " << vertex_count << std::endl
-        //                 << "   Position elements: " << static_cast<size_t>(vertex_component_count)
-        //                 << std::endl
-        //                 << "   Normal elements:   " << static_cast<size_t>(normal_component_count)
-        //                 << std::endl
-        //                 << "   Texture elements:  "
-        //                 << static_cast<size_t>(texture_coordinate_component_count) << std::endl
-        //                 << "   Face count:        " << face_count;
-
-        // Log_i(header_debug_ss);
-    }
-
-    // Note: Pops one line off of the input stream and increments the line number.
-    auto read_next_data_in_line =
-      [&](bool& _should_break_calling_loop, const std::string& _data_in_type)
-    {
-        _should_break_calling_loop = false;
-
-        //
-        // Visibility: GETLINE
-        //
-        std::getline(file_data_stream, file_data_line);
-        file_line_number++;
-
-        if (0 == file_data_line.size())
-        {
-            ss.clear();
-            ss << "Expected more " << _data_in_type << " information.";
-            report_parse_error(ss.str().c_str());
-            _should_break_calling_loop = true;
-            return;
-        }
-
-        split_line_to_strings(file_data_line, strtok_delim, file_data_line_string_elements);
-        convert_strings_to_floats(file_data_line_string_elements, file_data_line_float_elements);
-        if (0 == file_data_line_float_elements.size())
-        {
-            ss.clear();
-            ss << "Unable to read or convert " << _data_in_type << " information.";
-            report_parse_error(ss.str().c_str());
-            _should_break_calling_loop = true;
-        }
-    };
-
-    const size_t expected_vertex_attribute_components = vertex_component_count +
-                                                        normal_component_count +
-                                                        texture_coordinate_component_count;
-    // Parse Data
-    {
-        if (end_header_tag != file_data_line)
-        {
-            Log_e("Could not move on to parsing data; 'end_header' was not the last line read.");
-            _success_out = false;
-            return;
-        }
-
-        bool vertices_data_in_processed = false;
-        bool faces_data_in_processed    = false;
-        for (auto& element_type : file_element_layout_order)
-        {
-            if (false == _success_out) break;
+        // Note: Texture does not get unbound in this loop, so models sharing a texture, such as
+        //       those textured from one atlas, bind it once when drawn one after another.
+        const static state::StateCache* const state_cache = state::StateCache::GetInstance();
+        const glt::GLState* const opengl_state = state_cache->opengl_state;
 
-            switch (element_type)
-            {
-                case (ElementTypes::VERTEX):
-                {
-                    if (true == vertices_data_in_processed)
-                    {
-                        report_parse_error("Vertices can be processed exactly once.");
-                        break;
-                    }
-
-                    size_t vertex_insertion_index = 0;
-                    for (size_t vertex_index = 0; vertex_index < vertex_count; vertex_index++)
-                    {
-                        bool break_loop;
-                        read_next_data_in_line(break_loop, "vertex");
-                        if (true == break_loop)
-                        {
-                            _success_out = false;
-                            break;
-                        }
-
-                        if (expected_vertex_attribute_components !=
-                            file_data_line_float_elements.size())
-                        {
-                            ss.clear();
-                            ss
-                              << "Unexpected quantity of vertex attribute elements found. Expected "
-                              << expected_vertex_attribute_components << ", got "
-                              << file_data_line_float_elements.size();
-                            report_parse_error(ss.str().c_str());
-                            break;
-                        }
-
-                        for (auto& vertex_attribute_element : file_data_line_float_elements)
-                        {
-                            model_data_in[vertex_insertion_index++] = vertex_attribute_element;
-                        }
-                    }
-
-                    vertices_data_in_processed = true;
-                    break;
-                }
-                case (ElementTypes::FACE):
-                {
-                    if (true == faces_data_in_processed)
-                    {
-                        report_parse_error("Faces can be processed exactly once.");
-                        break;
-                    }
-
-                    size_t face_insertion_index = 0;
-                    while (face_insertion_index < model_elements.size())
-                    {
-                        bool break_loop;
-                        read_next_data_in_line(break_loop, "face");
-                        if (true == break_loop)
-                        {
-                            _success_out = false;
-                            break;
-                        }
-
-                        if ((4 != file_data_line_float_elements.size()) &&
-                            (3 != static_cast<size_t>(file_data_line_float_elements[0])))
-                        {
-                            report_parse_error(
-                              "Faces must have exactly 3 elements. Ensure that meshes are "
-                              "triangulated before export.");
-                            break;
-                        }
-
-                        // Note: Ignore first element, which specifies count of elements to follow.
-                        for (size_t face_element_index = 1;
-                             face_element_index < file_data_line_float_elements.size();
-                             face_element_index++)
-                        {
-                            model_elements[face_insertion_index++] = static_cast<GLuint>(
-                              file_data_line_float_elements[face_element_index]);
-                        }
-                    }
-
-                    faces_data_in_processed = true;
-                    break;
-                }
-                default:
-                {
-                    ss.clear();
-                    std::string stringified_element_type;
-                    stringify_element_type(element_type, stringified_element_type);
-                    ss << "Unidentified element type specified for current data line. Received: "
-                       << stringified_element_type;
-                    report_parse_error(ss.str().c_str());
-                }
-            }
-        }
+        const size_t texture_target_array_index = static_cast<size_t>(
+          GetTextureTargetArrayIndex(std::move(currently_enabled_texture->texture_target)));
+        assert(texture_target_array_length != texture_target_array_index);
 
-        if ((true != faces_data_in_processed) && (true != vertices_data_in_processed))
+        if ((currently_enabled_texture->texture_unit != opengl_state->active_texture) ||
+            (currently_enabled_texture->texture_id !=
+             opengl_state->bound_textures_by_target_type[texture_target_array_index]))
         {
-            report_parse_error("Both vertices and faces must be imported from model files.");
-            _success_out = false;
-            return;
+            glfn::ActiveTexture(currently_enabled_texture->texture_unit);
+            glfn::BindTexture(currently_enabled_texture->texture_target,
+                              currently_enabled_texture->texture_id);
         }
 
-        //
-        // [ cfarvin::TODO ] Move to a function, to be seen in the header later if needed.
-        // Debug: Prints the vertices and face data as would be
-        //        seen in the data section object file on disk.
-        //
+        if (-1 != texture_coordinates_transform_location)
         {
-            // size_t c               = 0;
-            // size_t newline_counter = 1;
-
-            // std::stringstream model_data_in_test;
-            // model_data_in_test << std::endl;
-
-            // size_t newline_on = 9;
-            // for (size_t i = 0; i < model_data_in.size(); i++)
-            // {
-            //     model_data_in_test << model_data_in[c++] << " ";
-            //     newline_counter++;
-            //     if (newline_counter == newline_on)
-            //     {
-            //         newline_counter = 1;
-            //         model_data_in_test << std::endl;
-            //     }
-            // }
-
-            // c               = 0;
-            // newline_on      = 4;
-            // newline_counter = 1;
-            // for (size_t i = 0; i < model_elements.size(); i++)
-            // {
-            //     if (newline_counter == 1)
-            //     {
-            //         model_data_in_test << "3 ";
-            //     }
-
-            //     model_data_in_test << model_elements[c++] << " ";
-            //     newline_counter++;
-
-            //     if (newline_counter == newline_on)
-            //     {
-            //         newline_counter = 1;
-            //         model_data_in_test << std::endl;
-            //     }
-            // }
-
-            // Log_i(model_data_in_test);
+            const glm::vec4& texture_coordinates_transform =
+              currently_enabled_texture->texture_coordinates_transform;
+            glfn::Uniform4fv(texture_coordinates_transform_location,
+                             1,
+                             glm::value_ptr(texture_coordinates_transform));
         }
     }
 
-    // Write data to output buffers.
-    {
-        // Create vertex attributes
-        {
-            //
-            // VISIBILITY: This calculation assumes that all the data is of type float.
-            //
-            //             This works exclusively for layouts like:
-            //             float | float | float | float | float | float | float | float
-            //             p.x,  | p.y,  | p.z,  | n.x,  | n.y,  | n.z,  | tc.s, | tc.t
-            //
-            //
-            //             This does ___NOT___ work for layouts like:
-            //             float | float | float | double | double | double | uchar | uchar
-            //             p.x,  | p.y,  | p.z,  | n.x,   | n.y,   | n.z,   | tc.s, | tc.t
-            //             Though the example above is unlikely, it illustrates the point.
-            //
-
-            // Default values.
-            const GLboolean default_should_be_normalized_by_gpu = false;
-            const GLenum    default_data_type                   = GL_FLOAT;
-
-            // Variable values derived from input model file to be filled in.
-            GLuint              tmp_vertex_attribute_index      = 0;
-            GLint               tmp_component_count             = 0;
-            GLvoid*             tmp_first_component_byte_offset = nullptr;
-            glt::VertexDataType tmp_vertex_data_type            = glt::VertexDataType::COUNT;
-
-            // Constant values derived from input model file.
-            const GLsizei byte_stride_between_elements = static_cast<GLsizei>(
-                                                           expected_vertex_attribute_components) *
-                                                         sizeof(GL_FLOAT);
-
-            size_t first_component_offset_accumulator = 0;
-            for (auto& vertex_type : vertex_data_type_layout_order)
-            {
-                if (false == _success_out) break;
-                tmp_vertex_data_type = vertex_type;
-
-                switch (vertex_type)
-                {
-                    case glt::VertexDataType::POSITION:
-                    {
-                        tmp_component_count        = vertex_component_count;
-                        tmp_vertex_attribute_index = _position_attribute_index_in;
-                        break;
-                    }
-                    case glt::VertexDataType::NORMAL:
-                    {
-                        tmp_component_count        = normal_component_count;
-                        tmp_vertex_attribute_index = _normal_attribute_index_in;
-                        break;
-                    }
-                    case glt::VertexDataType::TEXTURE:
-                    {
-                        tmp_component_count        = texture_coordinate_component_count;
-                        tmp_vertex_attribute_index = _texture_coordinates_attribute_index_in;
-                        break;
-                    }
-                    default:
-                    {
-                        Log_e("Unsupported buffer vertex_type.");
-                        _success_out = false;
-                        break;
-                    }
-                }
-
-                tmp_first_component_byte_offset = (GLvoid*)(first_component_offset_accumulator *
-                                                            sizeof(GL_FLOAT));
-                first_component_offset_accumulator += tmp_component_count;
-
-                _vertex_attribute_pointers_out.push_back(
-                  glt::VertexAttributeDescriptor(std::move(_vertex_array_object_id_in),
-                                                 std::move(tmp_vertex_attribute_index),
-                                                 std::move(tmp_component_count),
-                                                 std::move(default_data_type),
-                                                 std::move(default_should_be_normalized_by_gpu),
-                                                 std::move(byte_stride_between_elements),
-                                                 std::move(tmp_first_component_byte_offset),
-                                                 std::move(tmp_vertex_data_type)));
-            }
-        }
+    DrawSelectedElements();
 
-        _buffer_data_out.reserve(model_data_in.size());
-        _buffer_elements_array_out.reserve(model_elements.size());
-
-        _buffer_data_out           = model_data_in;
-        _buffer_elements_array_out = model_elements;
-        _vertex_data_types_out     = vertex_data_type_layout_order;
-
-        _vertex_count_out = vertex_count;
-    }
-}
\ No newline at end of file
+    glfn::BindVertexArray(0);
+}
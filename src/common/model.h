@@ -5,8 +5,14 @@
 #include "pch.h"
 // clang-format on
 
+#include "bounds.h"
 #include "gl_tools.h"
+#include "mesh_tools.h"
+#include "meshlet.h"
+#include "model_import.h"
 #include "object3.h"
+#include "texture_atlas.h"
+#include "texture_streaming.h"
 
 // [ cfarvin::REVISIT ] Should all of this go in a "model" namespace?
 
@@ -17,8 +23,17 @@ struct Model : protected Object3
     using Object3::SetOrientation;
     using Object3::SetPosition;
 
+    // Note: Model space bounds of the mesh, as produced by the importers (see bounds.h). Batch
+    //       them through TransformBoundingVolumes(...) with the model matrices to cull.
+    void
+    SetBoundingVolume(const BoundingVolume& _bounding_volume_in) noexcept;
+
+    const BoundingVolume&
+    GetBoundingVolume() const noexcept;
+
   protected:
-    glm::mat4 model_matrix;
+    glm::mat4      model_matrix;
+    BoundingVolume bounding_volume;
 };
 
 // [ cfarvin::REVISIT ] Does this belong in glt? More general than OpenGL?
@@ -84,6 +99,7 @@ struct BufferedModel : Model
                      const GLvoid* const _data_in,
                      const GLsizeiptr&&  _data_size_bytes_in,
                      const GLsizei&&     _target_buffer_element_count_in,
+                     const GLenum&&      _element_data_type_in,
                      const GLenum&&      _target_buffer_usage_type_in,
                      const GLenum&&      _primitive_drawing_mode_in);
 
@@ -100,6 +116,37 @@ struct BufferedModel : Model
                         const MatrixType&& _matrix_type_in,
                         const glm::mat4&   _matrix_modifier_in) const noexcept;
 
+    // Note: Describes the levels of detail held in the element buffer, finest first (see
+    //       GenerateLodChain(...) in mesh_tools.h). Without levels of detail, or until one is
+    //       selected, the whole element buffer is drawn.
+    void
+    SetLevelsOfDetail(bool& _success_out, const std::vector<MeshLod>& _levels_of_detail_in);
+
+    // Note: Selects the coarsest level of detail whose geometric error, projected to the screen
+    //       at `_distance_in` from the camera, is at most `_max_screen_space_error_pixels_in`.
+    //       `_projection_scale_in` converts model units at unit distance to pixels; for a
+    //       perspective projection, viewport_height / (2 * tan(vertical_field_of_view / 2)).
+    //       Returns the selected level.
+    size_t
+    SelectLevelOfDetail(const float&& _distance_in,
+                        const float&& _projection_scale_in,
+                        const float&& _max_screen_space_error_pixels_in) noexcept;
+
+    // Note: Describes the meshlets of the finest level of detail (see meshlet.h), as produced by
+    //       the importers. Until CullMeshlets(...) is called, the whole level is drawn.
+    void
+    SetMeshlets(bool& _success_out, const std::vector<Meshlet>& _meshlets_in);
+
+    // Note: Culls the meshlets against the camera, such that Draw() submits only the ranges of
+    //       the visible ones, in place from the element buffer. Arguments are as for
+    //       CullMeshletRanges(...) in meshlet.h, in model space. Call every frame, after
+    //       SelectLevelOfDetail(...): meshlets cover the finest level only, and coarser levels
+    //       are drawn whole.
+    void
+    CullMeshlets(const glm::mat4&          _model_view_projection_in,
+                 const glm::vec3&          _camera_position_in,
+                 MeshletCullingStatistics& _statistics_out) noexcept;
+
     void
     Draw() const noexcept;
 
@@ -115,6 +162,25 @@ struct BufferedModel : Model
 
     std::vector<RenderingProgramUniformMatrixInfo> rendering_program_uniform_matrix_infos;
 
+    std::vector<MeshLod> levels_of_detail;
+    size_t               selected_level_of_detail = 0;
+
+    // Note: The visible ranges are kept as the arrays glMultiDrawElements takes; see
+    //       CullMeshlets(...).
+    std::vector<Meshlet>       meshlets;
+    std::vector<MeshletRange>  visible_meshlet_ranges;
+    std::vector<GLsizei>       visible_meshlet_element_counts;
+    std::vector<const GLvoid*> visible_meshlet_byte_offsets;
+    bool                       meshlets_culled = false;
+
+    void
+    GetSelectedElementRange(GLsizei&       _element_count_out,
+                            const GLvoid*& _element_byte_offset_out) const noexcept;
+
+    // Note: Draws the selected level of detail, or its visible meshlets once culled.
+    void
+    DrawSelectedElements() const noexcept;
+
     ~BufferedModel();
 };
 
@@ -132,28 +198,113 @@ struct TextureInfo
     const GLuint texture_coordinates_vertex_attribute_index;
     const GLenum texture_target;
     const GLenum texture_unit;
+
+    // Note: Set for textures added with TexturedModel::AddStreamedTexture(...), which are
+    //       released to their streamer rather than to the TextureCache.
+    TextureStreamer*      texture_streamer = nullptr;
+    StreamedTextureHandle streamed_texture;
+    // Note: The canonical path of the streamed image; see GetCanonicalTexturePath(...).
+    std::string           streamed_file_path;
+
+    // Note: Set for textures added with TexturedModel::AddAtlasTexture(...). The path is
+    //       canonical; see GetCanonicalTexturePath(...).
+    std::string atlas_file_path;
+    std::string atlas_sub_image_name;
+
+    // Note: Maps the model's texture coordinates onto a sub-image of an atlas; see
+    //       TexturedModel::AddAtlasTexture(...). Identity otherwise.
+    glm::vec4 texture_coordinates_transform = glm::vec4(1.0f, 1.0f, 0.0f, 0.0f);
 };
 
 struct TexturedModel : BufferedModel
 {
+    // Note: Textures come from the TextureCache (see texture_cache.h); models adding the same image
+    //       with the same sampler settings share one texture. Adding a texture the model already
+    //       has fails.
+    void
+    AddTexture(bool&                              _success_out,
+               const char* const                  _file_path_in,
+               const GLuint&&                     _vbo_id_in,
+               const GLuint&&                     _texture_coordinates_vertex_attribute_index_in,
+               const GLenum&&                     _texture_unit_in,
+               const GLenum&&                     _texture_target_buffer_type_in,
+               GLuint&                            _texture_id_out,
+               const glt::TextureSamplerSettings& _sampler_settings_in = {}) noexcept;
+
+    // Note: As AddTexture(...), with the texture streamed by `_texture_streamer_in` (see
+    //       texture_streaming.h) instead; the image must have been cooked. Streamed textures are
+    //       not shared between models, and are drawn from their mip tail until finer levels are
+    //       streamed in. Streaming a file the model already streams from the same streamer
+    //       fails.
+    void
+    AddStreamedTexture(
+      bool&                              _success_out,
+      TextureStreamer&                   _texture_streamer_in_out,
+      const char* const                  _file_path_in,
+      const GLuint&&                     _vbo_id_in,
+      const GLuint&&                     _texture_coordinates_vertex_attribute_index_in,
+      const GLenum&&                     _texture_unit_in,
+      const GLenum&&                     _texture_target_buffer_type_in,
+      GLuint&                            _texture_id_out,
+      const glt::TextureSamplerSettings& _sampler_settings_in = {}) noexcept;
+
+    // Note: As AddTexture(...), with the model textured by one sub-image of a texture atlas (see
+    //       texture_atlas.h), as cooked from a `<name>.atlas` directory. Models textured from the
+    //       same atlas share one texture, such that drawing them one after another binds it once.
+    //       The sub-image is named by its path relative to the atlas directory. Its texture
+    //       coordinates transform is set by Draw() when the rendering program declares one; see
+    //       SetTextureCoordinatesTransformUniform(...). Several sub-images of one atlas may be
+    //       added to the same model, and share `_texture_id_out`; adding the same sub-image twice
+    //       fails. Select one with EnableAtlasTexture(...).
+    void
+    AddAtlasTexture(
+      bool&                              _success_out,
+      const char* const                  _atlas_image_file_path_in,
+      const char* const                  _sub_image_name_in,
+      const GLuint&&                     _vbo_id_in,
+      const GLuint&&                     _texture_coordinates_vertex_attribute_index_in,
+      const GLenum&&                     _texture_unit_in,
+      const GLenum&&                     _texture_target_buffer_type_in,
+      GLuint&                            _texture_id_out,
+      const glt::TextureSamplerSettings& _sampler_settings_in = {}) noexcept;
+
+    // Note: Names the vec4 uniform of the rendering program that Draw() sets to the texture
+    //       coordinates transform of the enabled texture. Fails if the program has no such
+    //       uniform. Uniforms keep their last value, so set this for every model drawn with a
+    //       program that declares one, atlas textured or not.
+    void
+    SetTextureCoordinatesTransformUniform(bool&             _success_out,
+                                          const GLuint&&    _rendering_program_id_in,
+                                          const char* const _uniform_name_in);
+
+    // Note: Sets the streaming priority of every streamed texture of the model; see
+    //       StreamedTextureHandle::SetPriority(...). Typically updated once per frame.
     void
-    AddTexture(bool&             _success_out,
-               const char* const _file_path_in,
-               const GLuint&&    _vbo_id_in,
-               const GLuint&&    _texture_coordinates_vertex_attribute_index_in,
-               const GLenum&&    _texture_unit_in,
-               const GLenum&&    _texture_target_buffer_type_in,
-               GLuint&           _texture_id_out) noexcept;
+    SetStreamedTexturePriority(const float&& _priority_in) noexcept;
 
+    // Note: Sub-images of an atlas share its texture id; this enables the first added. See
+    //       EnableAtlasTexture(...).
     void
     EnableTexture(bool& _success_out, const GLuint&& _texture_id_in);
 
+    void
+    EnableAtlasTexture(bool&             _success_out,
+                       const char* const _atlas_image_file_path_in,
+                       const char* const _sub_image_name_in);
+
+    // Note: Returns the model's textures to the TextureCache, or to the streamer they were
+    //       streamed by. Call from the render thread while the OpenGL context is current;
+    //       textures are not released on destruction.
+    void
+    ReleaseTextures() noexcept;
+
     void
     Draw() const noexcept;
 
   protected:
     std::vector<TextureInfo> added_textures;
-    TextureInfo*             currently_enabled_texture;
+    TextureInfo*             currently_enabled_texture              = nullptr;
+    GLint                    texture_coordinates_transform_location = -1;
 
   private:
     void
@@ -162,22 +313,4 @@ struct TexturedModel : BufferedModel
                                    TextureInfo*&  _texture_info_out) const;
 };
 
-// void
-// LoadModelFromObjFile(bool&             _success_out,
-//                      const char* const _obj_file_location);
-
-void
-LoadModelFromAsciiPlyFile(
-  bool&                                        _success_out,
-  const GLuint&&                               _vertex_array_object_id_in,
-  const char* const                            _ascii_ply_file_path_in,
-  const GLuint&&                               _position_attribute_index_in,
-  const GLuint&&                               _normal_attribute_index_in,
-  const GLuint&&                               _texture_coordinates_attribute_index_in,
-  size_t&                                      _vertex_count_out,
-  std::vector<float>&                          _buffer_data_out,
-  std::vector<GLuint>&                         _buffer_elements_array_out,
-  std::vector<glt::VertexDataType>&            _vertex_data_types_out,
-  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out);
-
 #endif
\ No newline at end of file
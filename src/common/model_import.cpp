@@ -0,0 +1,3357 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "model_import.h"
+
+#include "cooked_mesh.h"
+#include "fileio.h"
+#include "gl_enum_tools.h"
+#include "gltf.h"
+#include "job_system.h"
+#include "logging.h"
+#include "mesh_tools.h"
+#include "tangent_space.h"
+
+// Note: If more types are added, ensure to cover additions in the
+//       switch for that data type as well as StringifyPlyElementType(...) below.
+enum class PlyElementType
+{
+    NONE = 0,
+    VERTEX,
+    FACE
+};
+
+enum class PlyFormat
+{
+    NONE = 0,
+    ASCII,
+    BINARY_LITTLE_ENDIAN,
+    BINARY_BIG_ENDIAN
+};
+
+// Note: The scalar types of the PLY specification. Each is accepted under both its original
+//       name (`uchar`) and its sized name (`uint8`).
+enum class PlyPropertyType
+{
+    NONE = 0,
+    INT8,
+    UINT8,
+    INT16,
+    UINT16,
+    INT32,
+    UINT32,
+    FLOAT32,
+    FLOAT64
+};
+
+// Note: Destination offset of properties the output vertex has no attribute for, such as colors.
+//       They are read past but not stored.
+constexpr size_t ply_property_skipped = std::numeric_limits<size_t>::max();
+
+struct PlyProperty
+{
+    PlyPropertyType type = PlyPropertyType::NONE;
+
+    // Note: NONE for scalar properties. For list properties `type` is the type of the items.
+    PlyPropertyType list_count_type = PlyPropertyType::NONE;
+
+    // Note: Vertex properties only; lists are not accepted on vertices. The byte offset within
+    //       a binary vertex record, and the float offset within the interleaved output vertex.
+    size_t source_offset_bytes = 0;
+    size_t destination_offset  = ply_property_skipped;
+};
+
+// Note: A run of vertex properties of one type, adjacent in the binary vertex record and written
+//       to adjacent output floats, converted in one call to ConvertPlyPropertyRun(...).
+struct PlyConversionRun
+{
+    PlyPropertyType type                = PlyPropertyType::NONE;
+    size_t          source_offset_bytes = 0;
+    size_t          destination_offset  = 0;
+    size_t          component_count     = 0;
+};
+
+// Note: Populated by ParsePlyHeader(...); describes everything required to read the data section
+//       of a PLY file regardless of its format.
+struct PlyHeader
+{
+    PlyFormat format = PlyFormat::NONE;
+
+    size_t vertex_count                       = 0;
+    char   vertex_component_count             = 0;
+    char   normal_component_count             = 0;
+    char   texture_coordinate_component_count = 0;
+    size_t face_count                         = 0;
+
+    std::vector<PlyElementType>      element_layout_order;
+    std::vector<glt::VertexDataType> vertex_data_type_layout_order;
+
+    // Note: Vertex properties in file order. Every property that is stored lands on its own
+    //       float of the interleaved output vertex; when the properties are all floats, none is
+    //       skipped, and each lands on its own index, the data section is already laid out as the
+    //       GPU buffer is, and binary data may be copied as-is.
+    std::vector<PlyProperty>      vertex_properties;
+    std::vector<PlyConversionRun> vertex_conversion_runs;
+    size_t                        vertex_record_size_bytes     = 0;
+    size_t                        floats_per_vertex            = 0;
+    bool                          vertex_layout_matches_output = false;
+
+    // Note: Face properties in file order; the one at `face_indices_property_index` is the list
+    //       of vertex indices, and every other is read past.
+    std::vector<PlyProperty> face_properties;
+    size_t                   face_indices_property_index = 0;
+
+    size_t header_line_count = 0;
+    size_t data_offset_bytes = 0;
+};
+
+static size_t
+PlyPropertyTypeSizeBytes(const PlyPropertyType& _type_in)
+{
+    switch (_type_in)
+    {
+        case PlyPropertyType::INT8:
+        case PlyPropertyType::UINT8:
+        {
+            return 1;
+        }
+        case PlyPropertyType::INT16:
+        case PlyPropertyType::UINT16:
+        {
+            return 2;
+        }
+        case PlyPropertyType::INT32:
+        case PlyPropertyType::UINT32:
+        case PlyPropertyType::FLOAT32:
+        {
+            return 4;
+        }
+        case PlyPropertyType::FLOAT64:
+        {
+            return 8;
+        }
+        default:
+        {
+            return 0;
+        }
+    }
+}
+
+static inline bool
+IsPlyPropertyTypeInteger(const PlyPropertyType& _type_in)
+{
+    return (PlyPropertyType::NONE != _type_in) && (PlyPropertyType::FLOAT32 != _type_in) &&
+           (PlyPropertyType::FLOAT64 != _type_in);
+}
+
+// Note: Returns PlyPropertyType::NONE for names outside the PLY specification.
+static PlyPropertyType
+ParsePlyPropertyType(const std::string& _type_name_in)
+{
+    const std::pair<const char*, PlyPropertyType> type_names[] = {
+        { "char", PlyPropertyType::INT8 },      { "int8", PlyPropertyType::INT8 },
+        { "uchar", PlyPropertyType::UINT8 },    { "uint8", PlyPropertyType::UINT8 },
+        { "short", PlyPropertyType::INT16 },    { "int16", PlyPropertyType::INT16 },
+        { "ushort", PlyPropertyType::UINT16 },  { "uint16", PlyPropertyType::UINT16 },
+        { "int", PlyPropertyType::INT32 },      { "int32", PlyPropertyType::INT32 },
+        { "uint", PlyPropertyType::UINT32 },    { "uint32", PlyPropertyType::UINT32 },
+        { "float", PlyPropertyType::FLOAT32 },  { "float32", PlyPropertyType::FLOAT32 },
+        { "double", PlyPropertyType::FLOAT64 }, { "float64", PlyPropertyType::FLOAT64 },
+    };
+
+    for (auto& type_name : type_names)
+    {
+        if (_type_name_in == type_name.first)
+        {
+            return type_name.second;
+        }
+    }
+
+    return PlyPropertyType::NONE;
+}
+
+static void
+StringifyPlyElementType(const PlyElementType& _type_in, std::string& _string_out)
+{
+    switch (_type_in)
+    {
+        case PlyElementType::VERTEX:
+        {
+            _string_out = "PlyElementType::VERTEX";
+            break;
+        }
+        case PlyElementType::FACE:
+        {
+            _string_out = "PlyElementType::FACE";
+            break;
+        }
+        case PlyElementType::NONE:
+        {
+            _string_out = "PlyElementType::NONE";
+            break;
+        }
+    }
+}
+
+// Note: Reverses the bytes of each of `_value_count_in` values of `_value_size_bytes_in` bytes.
+static inline void
+ByteSwapPlyValues(unsigned char* const _values_in_out,
+                  const size_t&        _value_count_in,
+                  const size_t&        _value_size_bytes_in)
+{
+    for (size_t value_index = 0; value_index < _value_count_in; value_index++)
+    {
+        unsigned char* const value = _values_in_out + (value_index * _value_size_bytes_in);
+        std::reverse(value, value + _value_size_bytes_in);
+    }
+}
+
+// Note: Headers are a few hundred bytes in practice; this leaves room for long comment blocks.
+constexpr size_t ply_header_max_size_bytes = 64 * 1024;
+
+static void
+ParsePlyHeader(bool&             _success_out,
+               const char* const _ply_file_path_in,
+               const char* const _file_data_in,
+               const size_t&     _file_data_size_bytes_in,
+               PlyHeader&        _header_out)
+{
+    _success_out = true;
+
+    const std::string ply_tag = "ply";
+    if ((ply_tag.size() > _file_data_size_bytes_in) ||
+        (0 != std::memcmp(_file_data_in, ply_tag.data(), ply_tag.size())))
+    {
+        Log_e("Invalid .ply file.");
+        _success_out = false;
+        return;
+    }
+
+    const std::string format_tag                    = "format";
+    const std::string ascii_tag                     = "ascii";
+    const std::string binary_little_endian_tag      = "binary_little_endian";
+    const std::string binary_big_endian_tag         = "binary_big_endian";
+    const std::string version_tag                   = "1.0";
+    const std::string comment_tag                   = "comment";
+    const std::string element_tag                   = "element";
+    const std::string end_header_tag                = "end_header";
+    const std::string property_tag                  = "property";
+    const std::string vertex_tag                    = "vertex";
+    const std::string x_tag                         = "x";
+    const std::string y_tag                         = "y";
+    const std::string z_tag                         = "z";
+    const std::string nx_tag                        = "nx";
+    const std::string ny_tag                        = "ny";
+    const std::string nz_tag                        = "nz";
+    const std::string s_tag                         = "s";
+    const std::string t_tag                         = "t";
+    const std::string u_tag                         = "u";
+    const std::string v_tag                         = "v";
+    const std::string texture_s_tag                 = "texture_s";
+    const std::string texture_t_tag                 = "texture_t";
+    const std::string texture_u_tag                 = "texture_u";
+    const std::string texture_v_tag                 = "texture_v";
+    const std::string face_tag                      = "face";
+    const std::string list_tag                      = "list";
+    const std::string vertex_indices_tag            = "vertex_indices";
+    const std::string vertex_index_tag              = "vertex_index";
+    const char* const strtok_delim                  = " \r";
+
+    // Note: The header is plain text regardless of the format of the data section. Only the
+    //       header is copied out of the file; the data section is read in place by the caller.
+    std::string header_data;
+    {
+        // Note: Only the first `ply_header_max_size_bytes` are searched so that a file without a
+        //       header terminator is rejected without scanning its whole data section.
+        const std::string_view file_data_view(
+          _file_data_in, std::min(_file_data_size_bytes_in, ply_header_max_size_bytes));
+        const size_t end_header_offset = file_data_view.find(end_header_tag);
+        const size_t end_of_line_offset = (std::string_view::npos == end_header_offset)
+                                            ? std::string_view::npos
+                                            : file_data_view.find('\n', end_header_offset);
+
+        if (std::string_view::npos == end_of_line_offset)
+        {
+            std::stringstream ss;
+            ss << "Unable to find the end of the PLY header in: " << _ply_file_path_in;
+            Log_e(ss);
+            _success_out = false;
+            return;
+        }
+
+        header_data                   = std::string(_file_data_in, end_of_line_offset);
+        _header_out.data_offset_bytes = end_of_line_offset + 1;
+    }
+
+    std::istringstream       file_data_stream(header_data);
+    std::string              file_data_line;
+    std::vector<std::string> file_data_line_string_elements;
+    std::stringstream        ss;
+    size_t                   file_line_number = 0;
+
+    auto split_line_to_strings = [](const std::string&        _line_in,
+                                    const char* const         _delimeter_in,
+                                    std::vector<std::string>& _target_buffer_type_in_out)
+    {
+        _target_buffer_type_in_out.clear();
+        std::string line_copy = _line_in;
+        const char* token     = std::strtok(line_copy.data(), _delimeter_in);
+
+        while (nullptr != token)
+        {
+            _target_buffer_type_in_out.push_back(std::string(token));
+            token = std::strtok(nullptr, _delimeter_in);
+        }
+    };
+
+    // Note: sets _success_out to false, exiting loops in implementations below.
+    auto report_parse_error = [&](const char* const _note = nullptr)
+    {
+        std::stringstream parse_error_ss;
+        parse_error_ss << "Failed to parse model PLY file." << std::endl
+                       << "   PLY File:    " << _ply_file_path_in << std::endl
+                       << "   Line Number: " << file_line_number << std::endl
+                       << "   Line Data:   " << file_data_line;
+
+        if (nullptr != _note)
+        {
+            parse_error_ss << std::endl << "   Note:        " << _note;
+        }
+
+        Log_e(parse_error_ss);
+        _success_out = false;
+    };
+
+    // Note: sets _success_out to false, exiting loops in implementations below.
+    auto report_invalid_string_sequence = [&]()
+    {
+        ss.clear();
+        ss << "Invalid string sequence: " + file_data_line_string_elements[0];
+        report_parse_error(ss.str().c_str());
+    };
+
+    auto convert_string_to_data_size_bytes_in_t =
+      [](const char* const _string_in, size_t& _data_size_bytes_in_t_out)
+    {
+        char*         strtoull_ending = nullptr;
+        constexpr int base            = 10;
+        _data_size_bytes_in_t_out     = std::strtoull(_string_in, &strtoull_ending, base);
+
+        if (0 == strtoull_ending)
+        {
+            _data_size_bytes_in_t_out = 0; // Indicates error state to caller.
+        }
+    };
+
+    auto update_element_count_and_layout_order =
+      [](char&                             _element_count_in,
+         bool&                             _vertex_type_bool_in,
+         std::vector<glt::VertexDataType>& _vertex_data_type_target_buffer_in,
+         glt::VertexDataType&&             _vertex_data_type_in)
+    {
+        _element_count_in++;
+
+        if (false == _vertex_type_bool_in)
+        {
+            _vertex_data_type_target_buffer_in.push_back(_vertex_data_type_in);
+        }
+        _vertex_type_bool_in = true;
+    };
+
+    // Note: Each vertex property, in file order, as the attribute it belongs to and its component
+    //       index within that attribute; VertexDataType::COUNT for properties that are skipped.
+    //       Resolved to output offsets once the header is complete.
+    std::vector<std::pair<glt::VertexDataType, size_t>> vertex_property_attributes;
+
+    bool           vertices_header_processed                 = false;
+    bool           faces_header_processed                    = false;
+    bool           header_complete                           = false;
+    bool           face_properties_set                       = false;
+    bool           vertex_position_data_type_added           = false;
+    bool           normal_vertex_data_type_added             = false;
+    bool           texture_coordinate_vertex_data_type_added = false;
+    PlyElementType current_element_type                      = PlyElementType::NONE;
+    while ((false == header_complete) && (true == _success_out) &&
+           (std::getline(file_data_stream, file_data_line)))
+    {
+        file_line_number++;
+        split_line_to_strings(file_data_line, strtok_delim, file_data_line_string_elements);
+        if (0 == file_data_line_string_elements.size())
+        {
+            report_parse_error("Empty lines are not permitted in the PLY header.");
+            break;
+        }
+
+        switch (file_data_line_string_elements[0][0]) // Switch by 1st char of 1st string.
+        {
+            case 'c':
+            {
+                if (comment_tag != file_data_line_string_elements[0]) // COMMENT TAG
+                {
+                    report_invalid_string_sequence();
+                }
+
+                break;
+            }
+            case 'p':
+            {
+                if (ply_tag == file_data_line_string_elements[0]) // PLY TAG
+                {
+                    if (1 != file_data_line_string_elements.size() || 1 != file_line_number)
+                    {
+                        ss.clear();
+                        ss << "Invalid line containing: " + ply_tag;
+                        report_parse_error(ss.str().c_str());
+                    }
+                }
+                else if (property_tag == file_data_line_string_elements[0]) // PROPERTY TAG
+                {
+                    // Note: Either `property <type> <name>` or
+                    //       `property list <count type> <item type> <name>`.
+                    PlyProperty property;
+                    if ((5 == file_data_line_string_elements.size()) &&
+                        (list_tag == file_data_line_string_elements[1]))
+                    {
+                        property.list_count_type = ParsePlyPropertyType(
+                          file_data_line_string_elements[2]);
+                        property.type = ParsePlyPropertyType(file_data_line_string_elements[3]);
+                        if ((false == IsPlyPropertyTypeInteger(property.list_count_type)) ||
+                            (PlyPropertyType::NONE == property.type))
+                        {
+                            report_parse_error("Invalid list property description. The count "
+                                               "must be an integer type.");
+                            break;
+                        }
+                    }
+                    else if (3 == file_data_line_string_elements.size())
+                    {
+                        property.type = ParsePlyPropertyType(file_data_line_string_elements[1]);
+                        if (PlyPropertyType::NONE == property.type)
+                        {
+                            report_parse_error("Unsupported property type.");
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        report_parse_error("Invalid property description.");
+                        break;
+                    }
+
+                    const std::string& property_name = file_data_line_string_elements.back();
+                    switch (current_element_type)
+                    {
+                        case PlyElementType::VERTEX: // VERTEX PROPERTIES
+                        {
+                            if (PlyPropertyType::NONE != property.list_count_type)
+                            {
+                                report_parse_error(
+                                  "List properties are not supported for vertices.");
+                                break;
+                            }
+
+                            property.source_offset_bytes = _header_out.vertex_record_size_bytes;
+                            _header_out.vertex_record_size_bytes += PlyPropertyTypeSizeBytes(
+                              property.type);
+
+                            if ((x_tag == property_name) || (y_tag == property_name) ||
+                                (z_tag == property_name))
+                            {
+                                update_element_count_and_layout_order(
+                                  _header_out.vertex_component_count,
+                                  vertex_position_data_type_added,
+                                  _header_out.vertex_data_type_layout_order,
+                                  glt::VertexDataType::POSITION);
+
+                                const size_t component_index = (x_tag == property_name)   ? 0
+                                                               : (y_tag == property_name) ? 1
+                                                                                          : 2;
+                                vertex_property_attributes.push_back(
+                                  { glt::VertexDataType::POSITION, component_index });
+                            }
+                            else if ((nx_tag == property_name) || (ny_tag == property_name) ||
+                                     (nz_tag == property_name))
+                            {
+                                update_element_count_and_layout_order(
+                                  _header_out.normal_component_count,
+                                  normal_vertex_data_type_added,
+                                  _header_out.vertex_data_type_layout_order,
+                                  glt::VertexDataType::NORMAL);
+
+                                const size_t component_index = (nx_tag == property_name)   ? 0
+                                                               : (ny_tag == property_name) ? 1
+                                                                                           : 2;
+                                vertex_property_attributes.push_back(
+                                  { glt::VertexDataType::NORMAL, component_index });
+                            }
+                            else if ((s_tag == property_name) || (u_tag == property_name) ||
+                                     (texture_s_tag == property_name) ||
+                                     (texture_u_tag == property_name) ||
+                                     (t_tag == property_name) || (v_tag == property_name) ||
+                                     (texture_t_tag == property_name) ||
+                                     (texture_v_tag == property_name))
+                            {
+                                update_element_count_and_layout_order(
+                                  _header_out.texture_coordinate_component_count,
+                                  texture_coordinate_vertex_data_type_added,
+                                  _header_out.vertex_data_type_layout_order,
+                                  glt::VertexDataType::TEXTURE);
+
+                                const size_t component_index = ((s_tag == property_name) ||
+                                                                (u_tag == property_name) ||
+                                                                (texture_s_tag == property_name) ||
+                                                                (texture_u_tag == property_name))
+                                                                 ? 0
+                                                                 : 1;
+                                vertex_property_attributes.push_back(
+                                  { glt::VertexDataType::TEXTURE, component_index });
+                            }
+                            else
+                            {
+                                // Note: Colors, confidences and such have no attribute in the
+                                //       output vertex.
+                                vertex_property_attributes.push_back(
+                                  { glt::VertexDataType::COUNT, 0 });
+                            }
+
+                            _header_out.vertex_properties.push_back(property);
+                            break;
+                        }
+                        case PlyElementType::FACE: // FACE PROPERTIES
+                        {
+                            if ((vertex_indices_tag == property_name) ||
+                                (vertex_index_tag == property_name))
+                            {
+                                if (true == face_properties_set)
+                                {
+                                    report_parse_error(
+                                      "Face vertex indices can be defined exactly once.");
+                                    break;
+                                }
+                                face_properties_set = true;
+
+                                if ((PlyPropertyType::NONE == property.list_count_type) ||
+                                    (false == IsPlyPropertyTypeInteger(property.type)))
+                                {
+                                    report_parse_error(
+                                      "Face vertex indices must be a list of integers.");
+                                    break;
+                                }
+
+                                _header_out.face_indices_property_index = _header_out
+                                                                            .face_properties
+                                                                            .size();
+                            }
+
+                            _header_out.face_properties.push_back(property);
+                            break;
+                        }
+                        default:
+                        {
+                            report_parse_error("Property tags were found without first listing "
+                                               "an element type.");
+                        }
+                    }
+                }
+                else
+                {
+                    report_invalid_string_sequence();
+                }
+
+                break;
+            }
+            case 'f':
+            {
+                if ((3 == file_data_line_string_elements.size()) &&
+                    (format_tag == file_data_line_string_elements[0])) // FORMAT TAG
+                {
+                    if (ascii_tag == file_data_line_string_elements[1])
+                    {
+                        _header_out.format = PlyFormat::ASCII;
+                    }
+                    else if (binary_little_endian_tag == file_data_line_string_elements[1])
+                    {
+                        _header_out.format = PlyFormat::BINARY_LITTLE_ENDIAN;
+                    }
+                    else if (binary_big_endian_tag == file_data_line_string_elements[1])
+                    {
+                        _header_out.format = PlyFormat::BINARY_BIG_ENDIAN;
+                    }
+
+                    if ((PlyFormat::NONE == _header_out.format) ||
+                        (version_tag != file_data_line_string_elements[2]))
+                    {
+                        report_parse_error("Unsupported file type or version. Must be ascii, "
+                                           "binary_little_endian or binary_big_endian version 1.0");
+                    }
+                }
+                else
+                {
+                    report_invalid_string_sequence();
+                }
+
+                break;
+            }
+            case 'e':
+            {
+                if ((3 == file_data_line_string_elements.size()) &&
+                    (element_tag == file_data_line_string_elements[0])) // ELEMENT TAG
+                {
+                    if (vertex_tag == file_data_line_string_elements[1]) // VERTEX TAG
+                    {
+                        if (true == vertices_header_processed)
+                        {
+                            report_parse_error(
+                              "Vertex header information can be processed exactly once.");
+                            break;
+                        }
+
+                        convert_string_to_data_size_bytes_in_t(
+                          file_data_line_string_elements[2].c_str(),
+                          _header_out.vertex_count);
+
+                        if (0 == _header_out.vertex_count)
+                        {
+                            report_parse_error("Unable to determine vertex count.");
+                            break;
+                        }
+
+                        current_element_type = PlyElementType::VERTEX;
+                        _header_out.element_layout_order.push_back(PlyElementType::VERTEX);
+                        vertices_header_processed = true;
+                    }
+                    else if (face_tag == file_data_line_string_elements[1]) // FACE TAG
+                    {
+                        if (true == faces_header_processed)
+                        {
+                            report_parse_error(
+                              "Faces header information can be processed exactly once.");
+                            break;
+                        }
+
+                        convert_string_to_data_size_bytes_in_t(
+                          file_data_line_string_elements[2].c_str(),
+                          _header_out.face_count);
+
+                        if (0 == _header_out.face_count)
+                        {
+                            report_parse_error("Unable to determine face count.");
+                            break;
+                        }
+
+                        current_element_type = PlyElementType::FACE;
+                        _header_out.element_layout_order.push_back(PlyElementType::FACE);
+                        faces_header_processed = true;
+                    }
+                    else
+                    {
+                        report_parse_error("Only vertex and face elements are supported.");
+                    }
+                }
+                else if (end_header_tag == file_data_line_string_elements[0]) // END HEADER TAG
+                {
+                    if (PlyFormat::NONE == _header_out.format)
+                    {
+                        report_parse_error("The PLY format must be declared before 'end_header'.");
+                        break;
+                    }
+
+                    if (3 != _header_out.vertex_component_count)
+                    {
+                        report_parse_error(
+                          "Vertex coordinates require exactly three positional components.");
+                        break;
+                    }
+
+                    // Note: Normals and texture coordinates are optional, as in OBJ files.
+                    if ((0 != _header_out.normal_component_count) &&
+                        (3 != _header_out.normal_component_count))
+                    {
+                        report_parse_error("Normal vectors require exactly three components.");
+                        break;
+                    }
+
+                    if ((0 != _header_out.texture_coordinate_component_count) &&
+                        (2 != _header_out.texture_coordinate_component_count))
+                    {
+                        report_parse_error(
+                          "Texture coordinates require exactly two positional components.");
+                        break;
+                    }
+
+                    if (false == face_properties_set)
+                    {
+                        report_parse_error("Faces require a 'vertex_indices' list property.");
+                        break;
+                    }
+
+                    if (0 == _header_out.vertex_count)
+                    {
+                        report_parse_error("At least one vertex is required.");
+                        break;
+                    }
+
+                    if (0 == _header_out.face_count)
+                    {
+                        report_parse_error("At least one face is required.");
+                        break;
+                    }
+
+                    header_complete = true;
+                }
+                else
+                {
+                    report_invalid_string_sequence();
+                }
+
+                break;
+            }
+        }
+    }
+
+    if ((true == _success_out) && (false == header_complete))
+    {
+        report_parse_error("The PLY header ended without an 'end_header' line.");
+    }
+
+    if (false == _success_out) return;
+
+    _header_out.header_line_count = file_line_number;
+
+    // Resolve the output offset of each vertex property. Attributes are written in the order in
+    // which they first appear in the file; components are always written as x, y, z / s, t.
+    {
+        size_t attribute_base_offsets[glt::array_buffer_count] = { 0 };
+        size_t attribute_base_offset_accumulator               = 0;
+        for (auto& vertex_type : _header_out.vertex_data_type_layout_order)
+        {
+            attribute_base_offsets[static_cast<size_t>(vertex_type)] =
+              attribute_base_offset_accumulator;
+
+            switch (vertex_type)
+            {
+                case glt::VertexDataType::POSITION:
+                {
+                    attribute_base_offset_accumulator += _header_out.vertex_component_count;
+                    break;
+                }
+                case glt::VertexDataType::NORMAL:
+                {
+                    attribute_base_offset_accumulator += _header_out.normal_component_count;
+                    break;
+                }
+                case glt::VertexDataType::TEXTURE:
+                {
+                    attribute_base_offset_accumulator +=
+                      _header_out.texture_coordinate_component_count;
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+        }
+
+        _header_out.floats_per_vertex = attribute_base_offset_accumulator;
+
+        std::vector<bool> destination_offset_taken(_header_out.floats_per_vertex, false);
+        _header_out.vertex_layout_matches_output = true;
+        for (size_t property_index = 0; property_index < vertex_property_attributes.size();
+             property_index++)
+        {
+            PlyProperty& property = _header_out.vertex_properties[property_index];
+            const std::pair<glt::VertexDataType, size_t>& attribute = vertex_property_attributes
+              [property_index];
+            if (glt::VertexDataType::COUNT == attribute.first)
+            {
+                _header_out.vertex_layout_matches_output = false;
+                continue;
+            }
+
+            const size_t destination_offset =
+              attribute_base_offsets[static_cast<size_t>(attribute.first)] + attribute.second;
+
+            if (true == destination_offset_taken[destination_offset])
+            {
+                file_data_line = "";
+                report_parse_error("Each vertex property may be declared exactly once.");
+                return;
+            }
+            destination_offset_taken[destination_offset] = true;
+
+            property.destination_offset = destination_offset;
+            if ((PlyPropertyType::FLOAT32 != property.type) ||
+                (destination_offset != property_index))
+            {
+                _header_out.vertex_layout_matches_output = false;
+            }
+
+            // Note: Adjacent in both the file and the output vertex, and of the same type.
+            if (0 != _header_out.vertex_conversion_runs.size())
+            {
+                PlyConversionRun& run = _header_out.vertex_conversion_runs.back();
+                if ((run.type == property.type) &&
+                    ((run.source_offset_bytes +
+                      (run.component_count * PlyPropertyTypeSizeBytes(run.type))) ==
+                     property.source_offset_bytes) &&
+                    ((run.destination_offset + run.component_count) == destination_offset))
+                {
+                    run.component_count++;
+                    continue;
+                }
+            }
+
+            _header_out.vertex_conversion_runs.push_back(
+              { property.type, property.source_offset_bytes, destination_offset, 1 });
+        }
+    }
+
+    // Note: Output buffers are sized from the element counts, so the counts are checked against
+    //       the size of the data section first. Each record is at least its smallest encoding:
+    //       binary records are the sum of their property sizes with three face indices, and ascii
+    //       values are at least one digit and one separator, less the final separator, which may
+    //       be missing at the end of the file.
+    {
+        const bool   is_ascii               = (PlyFormat::ASCII == _header_out.format);
+        const size_t ascii_value_size_bytes = 2;
+
+        size_t vertex_record_min_bytes = _header_out.vertex_record_size_bytes;
+        if (true == is_ascii)
+        {
+            vertex_record_min_bytes = ascii_value_size_bytes * _header_out.vertex_properties.size();
+        }
+
+        size_t face_record_min_bytes = 0;
+        for (size_t property_index = 0; property_index < _header_out.face_properties.size();
+             property_index++)
+        {
+            const PlyProperty& property = _header_out.face_properties[property_index];
+            const bool is_list = (PlyPropertyType::NONE != property.list_count_type);
+
+            size_t item_count = (true == is_list) ? 0 : 1;
+            if (_header_out.face_indices_property_index == property_index)
+            {
+                item_count = 3;
+            }
+
+            if (true == is_ascii)
+            {
+                face_record_min_bytes += ascii_value_size_bytes *
+                                         (item_count + ((true == is_list) ? 1 : 0));
+            }
+            else
+            {
+                face_record_min_bytes += (item_count * PlyPropertyTypeSizeBytes(property.type)) +
+                                         PlyPropertyTypeSizeBytes(property.list_count_type);
+            }
+        }
+
+        size_t data_size_bytes = _file_data_size_bytes_in - _header_out.data_offset_bytes +
+                                 ((true == is_ascii) ? 1 : 0);
+        bool   counts_fit = (0 != vertex_record_min_bytes) &&
+                          (_header_out.vertex_count <= (data_size_bytes / vertex_record_min_bytes));
+        if (true == counts_fit)
+        {
+            data_size_bytes -= _header_out.vertex_count * vertex_record_min_bytes;
+            counts_fit = (0 != face_record_min_bytes) &&
+                         (_header_out.face_count <= (data_size_bytes / face_record_min_bytes));
+        }
+
+        if (false == counts_fit)
+        {
+            std::stringstream counts_ss;
+            counts_ss << "PLY element counts exceed the size of the data section." << std::endl
+                      << "   PLY File:        " << _ply_file_path_in << std::endl
+                      << "   Vertex count:    " << _header_out.vertex_count << std::endl
+                      << "   Face count:      " << _header_out.face_count << std::endl
+                      << "   Data size:       "
+                      << (_file_data_size_bytes_in - _header_out.data_offset_bytes) << " bytes";
+            Log_e(counts_ss);
+            _success_out = false;
+            return;
+        }
+    }
+}
+
+// Note: The scanners below walk the ascii data section in place. Numbers are parsed directly out
+//       of the mapped file with std::from_chars; nothing is allocated unless an error is reported.
+static inline void
+SkipPlyAsciiBlanks(const char*& _cursor_in_out, const char* const _tail_in)
+{
+    while ((_cursor_in_out < _tail_in) &&
+           ((' ' == *_cursor_in_out) || ('\t' == *_cursor_in_out) || ('\r' == *_cursor_in_out)))
+    {
+        _cursor_in_out++;
+    }
+}
+
+static inline bool
+ScanPlyAsciiFloat(const char*& _cursor_in_out, const char* const _tail_in, float& _value_out)
+{
+    SkipPlyAsciiBlanks(_cursor_in_out, _tail_in);
+
+    // Note: std::from_chars does not accept a leading '+', which exporters commonly write.
+    if ((_cursor_in_out < _tail_in) && ('+' == *_cursor_in_out))
+    {
+        _cursor_in_out++;
+    }
+
+    const std::from_chars_result result = std::from_chars(_cursor_in_out, _tail_in, _value_out);
+    if (std::errc() != result.ec)
+    {
+        return false;
+    }
+
+    _cursor_in_out = result.ptr;
+    return true;
+}
+
+static inline bool
+ScanPlyAsciiUnsigned(const char*& _cursor_in_out, const char* const _tail_in, uint32_t& _value_out)
+{
+    SkipPlyAsciiBlanks(_cursor_in_out, _tail_in);
+
+    if ((_cursor_in_out < _tail_in) && ('+' == *_cursor_in_out))
+    {
+        _cursor_in_out++;
+    }
+
+    const std::from_chars_result result = std::from_chars(_cursor_in_out, _tail_in, _value_out);
+    if (std::errc() != result.ec)
+    {
+        return false;
+    }
+
+    _cursor_in_out = result.ptr;
+    return true;
+}
+
+// Note: Consumes trailing blanks and the newline. Returns false if anything else remains on the
+//       line. The end of the data section is treated as the end of the line.
+static inline bool
+ScanPlyAsciiEndOfLine(const char*& _cursor_in_out, const char* const _tail_in)
+{
+    SkipPlyAsciiBlanks(_cursor_in_out, _tail_in);
+    if (_cursor_in_out == _tail_in)
+    {
+        return true;
+    }
+
+    if ('\n' != *_cursor_in_out)
+    {
+        return false;
+    }
+
+    _cursor_in_out++;
+    return true;
+}
+
+static inline bool
+IsPlyAsciiLineEmpty(const char* _cursor_in, const char* const _tail_in)
+{
+    SkipPlyAsciiBlanks(_cursor_in, _tail_in);
+    return (_cursor_in == _tail_in) || ('\n' == *_cursor_in);
+}
+
+struct PlyAsciiParseError
+{
+    size_t      line_number = 0;
+    const char* line_start  = nullptr;
+    std::string note;
+};
+
+static void
+ReportPlyAsciiParseError(const char* const         _ply_file_path_in,
+                         const PlyAsciiParseError& _error_in,
+                         const char* const         _tail_in)
+{
+    const char* line_end = _error_in.line_start;
+    while ((line_end < _tail_in) && ('\n' != *line_end) && ('\r' != *line_end))
+    {
+        line_end++;
+    }
+
+    const std::string_view line_data(_error_in.line_start, line_end - _error_in.line_start);
+
+    std::stringstream parse_error_ss;
+    parse_error_ss << "Failed to parse model PLY file." << std::endl
+                   << "   PLY File:    " << _ply_file_path_in << std::endl
+                   << "   Line Number: " << _error_in.line_number << std::endl
+                   << "   Line Data:   " << line_data << std::endl
+                   << "   Note:        " << _error_in.note;
+
+    Log_e(parse_error_ss);
+}
+
+// Note: Parses `_vertex_count_in` lines starting at `_cursor_in_out`, advancing the cursor and
+//       the line number past them. `_vertex_data_out` must hold every component of every vertex.
+static void
+ScanPlyAsciiVertices(bool&               _success_out,
+                     PlyAsciiParseError& _error_out,
+                     const PlyHeader&    _header_in,
+                     const char*&        _cursor_in_out,
+                     const char* const   _tail_in,
+                     const size_t&       _vertex_count_in,
+                     size_t&             _line_number_in_out,
+                     float*              _vertex_data_out)
+{
+    _success_out = true;
+
+    const std::vector<PlyProperty>& properties            = _header_in.vertex_properties;
+    const size_t                    properties_per_vertex = properties.size();
+
+    // Note: Every value is read as a float, whatever its declared type; ascii integers convert
+    //       exactly, and doubles round as they would in binary files.
+    float       skipped_value = 0.0f;
+    const char* cursor        = _cursor_in_out;
+    for (size_t vertex_index = 0; vertex_index < _vertex_count_in; vertex_index++)
+    {
+        const char* const line_start = cursor;
+        _line_number_in_out++;
+
+        if (true == IsPlyAsciiLineEmpty(cursor, _tail_in))
+        {
+            _error_out   = { _line_number_in_out, line_start, "Expected more vertex information." };
+            _success_out = false;
+            break;
+        }
+
+        for (size_t property_index = 0; property_index < properties_per_vertex; property_index++)
+        {
+            const size_t& destination_offset = properties[property_index].destination_offset;
+            float* const  value              = (ply_property_skipped == destination_offset)
+                                                 ? &skipped_value
+                                                 : &_vertex_data_out[destination_offset];
+            if (false == ScanPlyAsciiFloat(cursor, _tail_in, *value))
+            {
+                _success_out = false;
+                break;
+            }
+        }
+
+        if ((false == _success_out) || (false == ScanPlyAsciiEndOfLine(cursor, _tail_in)))
+        {
+            std::stringstream ss;
+            ss << "Unable to read or convert vertex information. Expected exactly "
+               << properties_per_vertex << " numeric vertex attribute elements.";
+            _error_out   = { _line_number_in_out, line_start, ss.str() };
+            _success_out = false;
+            break;
+        }
+
+        _vertex_data_out += _header_in.floats_per_vertex;
+    }
+
+    _cursor_in_out = cursor;
+}
+
+// Note: Parses `_face_count_in` lines starting at `_cursor_in_out`, advancing the cursor and
+//       the line number past them. `_elements_out` must hold three indices per face.
+static void
+ScanPlyAsciiFaces(bool&               _success_out,
+                  PlyAsciiParseError& _error_out,
+                  const PlyHeader&    _header_in,
+                  const char*&        _cursor_in_out,
+                  const char* const   _tail_in,
+                  const size_t&       _face_count_in,
+                  size_t&             _line_number_in_out,
+                  GLuint*             _elements_out)
+{
+    _success_out = true;
+
+    const size_t properties_per_face = _header_in.face_properties.size();
+
+    float       skipped_value = 0.0f;
+    const char* cursor        = _cursor_in_out;
+    for (size_t face_index = 0; face_index < _face_count_in; face_index++)
+    {
+        const char* const line_start = cursor;
+        _line_number_in_out++;
+
+        if (true == IsPlyAsciiLineEmpty(cursor, _tail_in))
+        {
+            _error_out   = { _line_number_in_out, line_start, "Expected more face information." };
+            _success_out = false;
+            break;
+        }
+
+        const char* error_note = nullptr;
+        for (size_t property_index = 0;
+             (nullptr == error_note) && (property_index < properties_per_face);
+             property_index++)
+        {
+            if (_header_in.face_indices_property_index == property_index)
+            {
+                uint32_t face_element_count = 0;
+                if ((false == ScanPlyAsciiUnsigned(cursor, _tail_in, face_element_count)) ||
+                    (3 != face_element_count))
+                {
+                    error_note = "Faces must have exactly 3 elements. Ensure that meshes are "
+                                 "triangulated before export.";
+                }
+                else if ((false == ScanPlyAsciiUnsigned(cursor, _tail_in, _elements_out[0])) ||
+                         (false == ScanPlyAsciiUnsigned(cursor, _tail_in, _elements_out[1])) ||
+                         (false == ScanPlyAsciiUnsigned(cursor, _tail_in, _elements_out[2])))
+                {
+                    error_note = "Unable to read or convert face information. Expected exactly "
+                                 "3 unsigned integer vertex indices.";
+                }
+
+                continue;
+            }
+
+            // Note: Other face properties are read past; a list is its count, then its items.
+            uint32_t item_count = 1;
+            if ((PlyPropertyType::NONE != _header_in.face_properties[property_index]
+                                            .list_count_type) &&
+                (false == ScanPlyAsciiUnsigned(cursor, _tail_in, item_count)))
+            {
+                error_note = "Unable to read the item count of a face list property.";
+            }
+
+            for (uint32_t item_index = 0; (nullptr == error_note) && (item_index < item_count);
+                 item_index++)
+            {
+                if (false == ScanPlyAsciiFloat(cursor, _tail_in, skipped_value))
+                {
+                    error_note = "Unable to read or convert a face property.";
+                }
+            }
+        }
+
+        if ((nullptr == error_note) && (false == ScanPlyAsciiEndOfLine(cursor, _tail_in)))
+        {
+            error_note = "Unexpected data after the last face property.";
+        }
+
+        if (nullptr != error_note)
+        {
+            _error_out   = { _line_number_in_out, line_start, error_note };
+            _success_out = false;
+            break;
+        }
+
+        _elements_out += 3;
+    }
+
+    _cursor_in_out = cursor;
+}
+
+// Note: Every ascii data line holds exactly one element, and elements appear in header order.
+//       This parses data lines [_first_line_in, _first_line_in + _line_count_in), where line 0
+//       is the first line after `end_header` and `_head_in` points to the start of
+//       `_first_line_in`. Elements land at their final position in the output buffers, so
+//       disjoint line ranges may be parsed concurrently.
+static void
+ScanPlyAsciiLines(bool&               _success_out,
+                  PlyAsciiParseError& _error_out,
+                  const PlyHeader&    _header_in,
+                  const char* const   _head_in,
+                  const char* const   _tail_in,
+                  const size_t&       _first_line_in,
+                  const size_t&       _line_count_in,
+                  float* const        _vertex_data_out,
+                  GLuint* const       _elements_out)
+{
+    _success_out = true;
+
+    const size_t last_line = _first_line_in + _line_count_in;
+
+    const char* cursor            = _head_in;
+    size_t      file_line_number  = _header_in.header_line_count + _first_line_in;
+    size_t      region_first_line = 0;
+    for (auto& element_type : _header_in.element_layout_order)
+    {
+        if ((false == _success_out) || (region_first_line >= last_line)) break;
+
+        size_t region_line_count = 0;
+        switch (element_type)
+        {
+            case (PlyElementType::VERTEX):
+            {
+                region_line_count = _header_in.vertex_count;
+                break;
+            }
+            case (PlyElementType::FACE):
+            {
+                region_line_count = _header_in.face_count;
+                break;
+            }
+            default:
+            {
+                std::string stringified_element_type;
+                StringifyPlyElementType(element_type, stringified_element_type);
+                _error_out   = { file_line_number + 1,
+                                 cursor,
+                                 "Unidentified element type specified for current data line. "
+                                 "Received: " +
+                                   stringified_element_type };
+                _success_out = false;
+                continue;
+            }
+        }
+
+        const size_t region_last_line = region_first_line + region_line_count;
+        const size_t overlap_first    = std::max(_first_line_in, region_first_line);
+        const size_t overlap_last     = std::min(last_line, region_last_line);
+        if (overlap_first < overlap_last)
+        {
+            const size_t region_offset = overlap_first - region_first_line;
+            const size_t overlap_count = overlap_last - overlap_first;
+            if (PlyElementType::VERTEX == element_type)
+            {
+                ScanPlyAsciiVertices(_success_out,
+                                     _error_out,
+                                     _header_in,
+                                     cursor,
+                                     _tail_in,
+                                     overlap_count,
+                                     file_line_number,
+                                     _vertex_data_out +
+                                       (region_offset * _header_in.floats_per_vertex));
+            }
+            else
+            {
+                ScanPlyAsciiFaces(_success_out,
+                                  _error_out,
+                                  _header_in,
+                                  cursor,
+                                  _tail_in,
+                                  overlap_count,
+                                  file_line_number,
+                                  _elements_out + (region_offset * 3));
+            }
+        }
+
+        region_first_line = region_last_line;
+    }
+}
+
+// Note: A contiguous, newline aligned slice of the ascii data section.
+struct PlyAsciiChunk
+{
+    const char* head       = nullptr;
+    const char* tail       = nullptr;
+    size_t      first_line = 0;
+    size_t      line_count = 0;
+
+    bool               success = true;
+    PlyAsciiParseError error;
+};
+
+// Note: Below this many bytes per chunk, scheduling a job costs more than it saves.
+constexpr size_t ply_ascii_min_parallel_chunk_bytes = 1 << 20;
+
+static void
+ParsePlyAsciiData(bool&                _success_out,
+                  const char* const    _ply_file_path_in,
+                  const PlyHeader&     _header_in,
+                  const char* const    _data_in,
+                  const size_t&        _data_size_bytes_in,
+                  JobSystem* const     _job_system_in,
+                  std::vector<float>&  _vertex_data_out,
+                  std::vector<GLuint>& _elements_out)
+{
+    _success_out = true;
+
+    const char* const tail           = _data_in + _data_size_bytes_in;
+    const size_t      required_lines = _header_in.vertex_count + _header_in.face_count;
+
+    size_t chunk_count = (nullptr == _job_system_in) ? 1 : _job_system_in->GetThreadCount();
+    chunk_count        = std::min(chunk_count,
+                           std::max<size_t>(1,
+                                            _data_size_bytes_in /
+                                              ply_ascii_min_parallel_chunk_bytes));
+
+    //
+    // Note: Parallel parsing runs in two passes over newline aligned chunks. The first counts the
+    //       lines starting in each chunk; a prefix sum of those counts gives each chunk its first
+    //       global line, and with it the element (and output slot) that line holds. The second
+    //       pass parses every chunk straight into its slice of the output buffers.
+    //
+    std::vector<PlyAsciiChunk> chunks(chunk_count);
+    if (1 < chunk_count)
+    {
+        const char* chunk_head = _data_in;
+        for (size_t chunk_index = 0; chunk_index < chunk_count; chunk_index++)
+        {
+            const char* chunk_tail = tail;
+            if ((chunk_count - 1) != chunk_index)
+            {
+                chunk_tail = std::max(chunk_head,
+                                      _data_in + (((chunk_index + 1) * _data_size_bytes_in) /
+                                                  chunk_count));
+                const char* const newline = static_cast<const char*>(
+                  std::memchr(chunk_tail, '\n', tail - chunk_tail));
+                chunk_tail = (nullptr == newline) ? tail : (newline + 1);
+            }
+
+            chunks[chunk_index].head = chunk_head;
+            chunks[chunk_index].tail = chunk_tail;
+            chunk_head               = chunk_tail;
+        }
+
+        RunJobPerIndex(_job_system_in,
+                       chunk_count,
+                       [&chunks](const size_t& _chunk_index_in)
+                       {
+                           PlyAsciiChunk& chunk  = chunks[_chunk_index_in];
+                           const char*    cursor = chunk.head;
+                           while (nullptr != (cursor = static_cast<const char*>(
+                                                std::memchr(cursor,
+                                                            '\n',
+                                                            chunk.tail - cursor))))
+                           {
+                               chunk.line_count++;
+                               cursor++;
+                           }
+                       });
+
+        size_t line_total = 0;
+        for (auto& chunk : chunks)
+        {
+            chunk.first_line = line_total;
+            line_total += chunk.line_count;
+        }
+
+        if ((0 < _data_size_bytes_in) && ('\n' != *(tail - 1)))
+        {
+            chunks.back().line_count++;
+            line_total++;
+        }
+
+        // Note: Short files fall through to the serial path, which reports the missing line.
+        if (line_total < required_lines)
+        {
+            chunk_count = 1;
+            chunks.resize(1);
+        }
+    }
+
+    if (1 == chunk_count)
+    {
+        chunks[0] = { _data_in, tail, 0, required_lines };
+    }
+
+    RunJobPerIndex(_job_system_in,
+                   chunk_count,
+                   [&](const size_t& _chunk_index_in)
+                   {
+                       PlyAsciiChunk& chunk = chunks[_chunk_index_in];
+                       ScanPlyAsciiLines(chunk.success,
+                                         chunk.error,
+                                         _header_in,
+                                         chunk.head,
+                                         chunk.tail,
+                                         chunk.first_line,
+                                         chunk.line_count,
+                                         _vertex_data_out.data(),
+                                         _elements_out.data());
+                   });
+
+    // Note: Chunks are in file order, so the first failure is the one the serial path would hit.
+    for (auto& chunk : chunks)
+    {
+        if (false == chunk.success)
+        {
+            ReportPlyAsciiParseError(_ply_file_path_in, chunk.error, tail);
+            _success_out = false;
+            return;
+        }
+    }
+
+#if defined(_ENGINE_DEBUG_)
+    // Note: Debug builds parse chunked files again on one thread, and fail the load unless both
+    //       parses agree, such that the importers and the cooker check the chunk boundaries on
+    //       every file they parse.
+    if (1 < chunk_count)
+    {
+        std::vector<float>  serial_vertex_data(_vertex_data_out.size());
+        std::vector<GLuint> serial_elements(_elements_out.size());
+        PlyAsciiChunk       serial_chunk = { _data_in, tail, 0, required_lines };
+        ScanPlyAsciiLines(serial_chunk.success,
+                          serial_chunk.error,
+                          _header_in,
+                          serial_chunk.head,
+                          serial_chunk.tail,
+                          serial_chunk.first_line,
+                          serial_chunk.line_count,
+                          serial_vertex_data.data(),
+                          serial_elements.data());
+        if ((false == serial_chunk.success) ||
+            (0 != std::memcmp(serial_vertex_data.data(),
+                              _vertex_data_out.data(),
+                              serial_vertex_data.size() * sizeof(float))) ||
+            (serial_elements != _elements_out))
+        {
+            std::stringstream ss;
+            ss << "The chunked parse of " << _ply_file_path_in << " on " << chunk_count
+               << " jobs differs from the serial parse.";
+            Log_e(ss);
+            _success_out = false;
+            return;
+        }
+    }
+#endif
+}
+
+// Note: Reads one scalar of `_type_in` as a float. `_value_in` is in host byte order.
+static inline float
+ReadPlyValueAsFloat(const unsigned char* const _value_in, const PlyPropertyType& _type_in)
+{
+    switch (_type_in)
+    {
+        case PlyPropertyType::INT8:
+        {
+            int8_t value;
+            std::memcpy(&value, _value_in, sizeof(value));
+            return static_cast<float>(value);
+        }
+        case PlyPropertyType::UINT8:
+        {
+            return static_cast<float>(*_value_in);
+        }
+        case PlyPropertyType::INT16:
+        {
+            int16_t value;
+            std::memcpy(&value, _value_in, sizeof(value));
+            return static_cast<float>(value);
+        }
+        case PlyPropertyType::UINT16:
+        {
+            uint16_t value;
+            std::memcpy(&value, _value_in, sizeof(value));
+            return static_cast<float>(value);
+        }
+        case PlyPropertyType::INT32:
+        {
+            int32_t value;
+            std::memcpy(&value, _value_in, sizeof(value));
+            return static_cast<float>(value);
+        }
+        case PlyPropertyType::UINT32:
+        {
+            uint32_t value;
+            std::memcpy(&value, _value_in, sizeof(value));
+            return static_cast<float>(value);
+        }
+        case PlyPropertyType::FLOAT32:
+        {
+            float value;
+            std::memcpy(&value, _value_in, sizeof(value));
+            return value;
+        }
+        case PlyPropertyType::FLOAT64:
+        {
+            double value;
+            std::memcpy(&value, _value_in, sizeof(value));
+            return static_cast<float>(value);
+        }
+        default:
+        {
+            return 0.0f;
+        }
+    }
+}
+
+// Note: Reads one integer of `_type_in` (see IsPlyPropertyTypeInteger(...)), swapping its bytes
+//       when `_requires_byte_swap_in` is set.
+static inline int64_t
+ReadPlyInteger(const char* const      _value_in,
+               const PlyPropertyType& _type_in,
+               const bool&            _requires_byte_swap_in)
+{
+    unsigned char value[sizeof(uint32_t)];
+    const size_t  value_size_bytes = PlyPropertyTypeSizeBytes(_type_in);
+    std::memcpy(value, _value_in, value_size_bytes);
+    if (true == _requires_byte_swap_in)
+    {
+        ByteSwapPlyValues(value, 1, value_size_bytes);
+    }
+
+    switch (_type_in)
+    {
+        case PlyPropertyType::INT8:
+        {
+            return static_cast<int8_t>(value[0]);
+        }
+        case PlyPropertyType::UINT8:
+        {
+            return value[0];
+        }
+        case PlyPropertyType::INT16:
+        {
+            int16_t integer;
+            std::memcpy(&integer, value, sizeof(integer));
+            return integer;
+        }
+        case PlyPropertyType::UINT16:
+        {
+            uint16_t integer;
+            std::memcpy(&integer, value, sizeof(integer));
+            return integer;
+        }
+        case PlyPropertyType::INT32:
+        {
+            int32_t integer;
+            std::memcpy(&integer, value, sizeof(integer));
+            return integer;
+        }
+        case PlyPropertyType::UINT32:
+        {
+            uint32_t integer;
+            std::memcpy(&integer, value, sizeof(integer));
+            return integer;
+        }
+        default:
+        {
+            return 0;
+        }
+    }
+}
+
+//
+// Note: Converts `_run_in.component_count` values of `_run_in.type`, in host byte order, to
+//       floats. Runs are short (a position, or a whole vertex of one type), so the kernels convert
+//       four values (two doubles) per step and finish the run one value at a time.
+//
+static inline void
+ConvertPlyPropertyRun(const unsigned char* const _values_in,
+                      const PlyConversionRun&    _run_in,
+                      float* const               _floats_out)
+{
+    const size_t& count = _run_in.component_count;
+    size_t        index = 0;
+    switch (_run_in.type)
+    {
+        case PlyPropertyType::FLOAT32:
+        {
+            std::memcpy(_floats_out, _values_in, count * sizeof(float));
+            return;
+        }
+#if defined(_ENGINE_SIMD_SSE_)
+        case PlyPropertyType::FLOAT64:
+        {
+            for (; (index + 2) <= count; index += 2)
+            {
+                const __m128d values = _mm_loadu_pd(
+                  reinterpret_cast<const double*>(_values_in + (index * sizeof(double))));
+                _mm_storel_pi(reinterpret_cast<__m64*>(_floats_out + index),
+                              _mm_cvtpd_ps(values));
+            }
+            break;
+        }
+        case PlyPropertyType::INT32:
+        {
+            for (; (index + 4) <= count; index += 4)
+            {
+                const __m128i values = _mm_loadu_si128(
+                  reinterpret_cast<const __m128i*>(_values_in + (index * sizeof(int32_t))));
+                _mm_storeu_ps(_floats_out + index, _mm_cvtepi32_ps(values));
+            }
+            break;
+        }
+        case PlyPropertyType::INT16:
+        case PlyPropertyType::UINT16:
+        {
+            const __m128i zero = _mm_setzero_si128();
+            for (; (index + 4) <= count; index += 4)
+            {
+                const __m128i values = _mm_loadl_epi64(
+                  reinterpret_cast<const __m128i*>(_values_in + (index * sizeof(int16_t))));
+
+                // Note: Signed values are widened into the high half, then shifted back down.
+                const __m128i widened = (PlyPropertyType::INT16 == _run_in.type)
+                                          ? _mm_srai_epi32(_mm_unpacklo_epi16(zero, values), 16)
+                                          : _mm_unpacklo_epi16(values, zero);
+                _mm_storeu_ps(_floats_out + index, _mm_cvtepi32_ps(widened));
+            }
+            break;
+        }
+        case PlyPropertyType::INT8:
+        case PlyPropertyType::UINT8:
+        {
+            const __m128i zero = _mm_setzero_si128();
+            for (; (index + 4) <= count; index += 4)
+            {
+                int32_t packed_values;
+                std::memcpy(&packed_values, _values_in + index, sizeof(packed_values));
+
+                const __m128i values  = _mm_cvtsi32_si128(packed_values);
+                const __m128i widened = (PlyPropertyType::INT8 == _run_in.type)
+                                          ? _mm_srai_epi32(
+                                              _mm_unpacklo_epi16(
+                                                zero, _mm_unpacklo_epi8(zero, values)),
+                                              24)
+                                          : _mm_unpacklo_epi16(_mm_unpacklo_epi8(values, zero),
+                                                               zero);
+                _mm_storeu_ps(_floats_out + index, _mm_cvtepi32_ps(widened));
+            }
+            break;
+        }
+#endif // _ENGINE_SIMD_SSE_
+        default:
+        {
+            break;
+        }
+    }
+
+    const size_t value_size_bytes = PlyPropertyTypeSizeBytes(_run_in.type);
+    for (; index < count; index++)
+    {
+        _floats_out[index] = ReadPlyValueAsFloat(_values_in + (index * value_size_bytes),
+                                                 _run_in.type);
+    }
+}
+
+static void
+ParsePlyBinaryData(bool&                _success_out,
+                   const char* const    _ply_file_path_in,
+                   const PlyHeader&     _header_in,
+                   const char* const    _data_in,
+                   const size_t&        _data_size_bytes_in,
+                   std::vector<float>&  _vertex_data_out,
+                   std::vector<GLuint>& _elements_out)
+{
+    _success_out = true;
+
+    const bool file_is_big_endian = (PlyFormat::BINARY_BIG_ENDIAN == _header_in.format);
+    const bool host_is_big_endian = (std::endian::big == std::endian::native);
+    const bool requires_byte_swap = (file_is_big_endian != host_is_big_endian);
+
+    const char*       cursor = _data_in;
+    const char* const tail   = _data_in + _data_size_bytes_in;
+
+    // Note: sets _success_out to false, exiting loops in implementations below.
+    auto report_parse_error = [&](const char* const _note)
+    {
+        std::stringstream parse_error_ss;
+        parse_error_ss << "Failed to parse model PLY file." << std::endl
+                       << "   PLY File:    " << _ply_file_path_in << std::endl
+                       << "   Data Offset: " << (cursor - _data_in) << " bytes" << std::endl
+                       << "   Note:        " << _note;
+
+        Log_e(parse_error_ss);
+        _success_out = false;
+    };
+
+    for (auto& element_type : _header_in.element_layout_order)
+    {
+        if (false == _success_out) break;
+
+        switch (element_type)
+        {
+            case (PlyElementType::VERTEX):
+            {
+                const size_t record_size_bytes       = _header_in.vertex_record_size_bytes;
+                const size_t vertex_block_size_bytes = _header_in.vertex_count * record_size_bytes;
+                if (static_cast<size_t>(tail - cursor) < vertex_block_size_bytes)
+                {
+                    report_parse_error("Unexpected end of file in vertex data.");
+                    break;
+                }
+
+                // Fast path: the file is laid out exactly as the output buffer; copy the block.
+                if ((false == requires_byte_swap) &&
+                    (true == _header_in.vertex_layout_matches_output))
+                {
+                    std::memcpy(_vertex_data_out.data(), cursor, vertex_block_size_bytes);
+                    cursor += vertex_block_size_bytes;
+                    break;
+                }
+
+                // Note: Records are byte swapped into `swapped_record` before conversion.
+                std::vector<unsigned char> swapped_record(record_size_bytes);
+                float*                     vertex_insertion_point = _vertex_data_out.data();
+                for (size_t vertex_index = 0; vertex_index < _header_in.vertex_count;
+                     vertex_index++)
+                {
+                    const unsigned char* record = reinterpret_cast<const unsigned char*>(cursor);
+                    if (true == requires_byte_swap)
+                    {
+                        std::memcpy(swapped_record.data(), record, record_size_bytes);
+                        for (auto& run : _header_in.vertex_conversion_runs)
+                        {
+                            ByteSwapPlyValues(swapped_record.data() + run.source_offset_bytes,
+                                              run.component_count,
+                                              PlyPropertyTypeSizeBytes(run.type));
+                        }
+                        record = swapped_record.data();
+                    }
+
+                    for (auto& run : _header_in.vertex_conversion_runs)
+                    {
+                        ConvertPlyPropertyRun(record + run.source_offset_bytes,
+                                              run,
+                                              vertex_insertion_point + run.destination_offset);
+                    }
+
+                    vertex_insertion_point += _header_in.floats_per_vertex;
+                    cursor += record_size_bytes;
+                }
+
+                break;
+            }
+            case (PlyElementType::FACE):
+            {
+                // Note: Face records hold every face property in header order; the vertex index
+                //       list is a count followed by that many indices, and other properties are
+                //       read past.
+                GLuint* element_insertion_point = _elements_out.data();
+                for (size_t face_index = 0;
+                     (true == _success_out) && (face_index < _header_in.face_count);
+                     face_index++)
+                {
+                    for (size_t property_index = 0;
+                         property_index < _header_in.face_properties.size();
+                         property_index++)
+                    {
+                        const PlyProperty& property   = _header_in.face_properties[property_index];
+                        const size_t       count_size = PlyPropertyTypeSizeBytes(
+                          property.list_count_type);
+                        const size_t item_size  = PlyPropertyTypeSizeBytes(property.type);
+                        int64_t      item_count = 1;
+                        if (PlyPropertyType::NONE != property.list_count_type)
+                        {
+                            if (static_cast<size_t>(tail - cursor) < count_size)
+                            {
+                                report_parse_error("Unexpected end of file in face data.");
+                                break;
+                            }
+
+                            item_count = ReadPlyInteger(cursor,
+                                                        property.list_count_type,
+                                                        requires_byte_swap);
+                            cursor += count_size;
+                        }
+
+                        if ((0 > item_count) ||
+                            (static_cast<size_t>(tail - cursor) <
+                             (static_cast<size_t>(item_count) * item_size)))
+                        {
+                            report_parse_error("Unexpected end of file in face data.");
+                            break;
+                        }
+
+                        if (_header_in.face_indices_property_index != property_index)
+                        {
+                            cursor += item_count * item_size;
+                            continue;
+                        }
+
+                        if (3 != item_count)
+                        {
+                            report_parse_error("Faces must have exactly 3 elements. Ensure that "
+                                               "meshes are triangulated before export.");
+                            break;
+                        }
+
+                        for (size_t corner = 0; corner < 3; corner++)
+                        {
+                            const int64_t index = ReadPlyInteger(cursor,
+                                                                 property.type,
+                                                                 requires_byte_swap);
+                            element_insertion_point[corner] = static_cast<GLuint>(index);
+                            cursor += item_size;
+
+                            // Note: Checked against the vertex count once every face is read.
+                            if (0 > index)
+                            {
+                                report_parse_error("Face vertex indices must not be negative.");
+                                break;
+                            }
+                        }
+
+                        if (false == _success_out)
+                        {
+                            break;
+                        }
+                    }
+
+                    element_insertion_point += 3;
+                }
+
+                break;
+            }
+            default:
+            {
+                std::string stringified_element_type;
+                StringifyPlyElementType(element_type, stringified_element_type);
+                const std::string note = "Unidentified element type: " + stringified_element_type;
+                report_parse_error(note.c_str());
+            }
+        }
+    }
+}
+
+// Note: Describes interleaved float vertices holding the attributes of
+//       `_vertex_data_type_layout_order_in`, in that order, with the given component counts.
+static void
+CreateFloatVertexAttributeDescriptors(
+  bool&                                        _success_out,
+  const GLuint&                                _vertex_array_object_id_in,
+  const std::vector<glt::VertexDataType>&      _vertex_data_type_layout_order_in,
+  const GLint&                                 _position_component_count_in,
+  const GLint&                                 _normal_component_count_in,
+  const GLint&                                 _texture_coordinate_component_count_in,
+  const GLuint&                                _position_attribute_index_in,
+  const GLuint&                                _normal_attribute_index_in,
+  const GLuint&                                _texture_coordinates_attribute_index_in,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out)
+{
+    _success_out = true;
+
+    //
+    // VISIBILITY: The model importers always produce interleaved floats, regardless of the types
+    //             declared in the file:
+    //             float | float | float | float | float | float | float | float
+    //             p.x,  | p.y,  | p.z,  | n.x,  | n.y,  | n.z,  | tc.s, | tc.t
+    //
+    //             Tangents are appended afterwards by GenerateTangents(...) in tangent_space.h,
+    //             and smaller encodings are produced by QuantizeVertices(...) in
+    //             mesh_tools.h, which computes strides and offsets from per-attribute sizes.
+    //
+
+    // Default values.
+    const GLboolean default_should_be_normalized_by_gpu = false;
+    const GLenum    default_data_type                   = GL_FLOAT;
+
+    // Variable values derived from input model file to be filled in.
+    GLuint              tmp_vertex_attribute_index      = 0;
+    GLint               tmp_component_count             = 0;
+    const GLvoid*       tmp_first_component_byte_offset = nullptr;
+    glt::VertexDataType tmp_vertex_data_type            = glt::VertexDataType::COUNT;
+
+    // Constant values derived from input model file.
+    GLint floats_per_vertex = 0;
+    for (auto& vertex_type : _vertex_data_type_layout_order_in)
+    {
+        floats_per_vertex += (glt::VertexDataType::POSITION == vertex_type)
+                               ? _position_component_count_in
+                             : (glt::VertexDataType::NORMAL == vertex_type)
+                               ? _normal_component_count_in
+                               : _texture_coordinate_component_count_in;
+    }
+
+    const size_t  component_size_bytes         = GLDataTypeSizeBytes(default_data_type);
+    const GLsizei byte_stride_between_elements = static_cast<GLsizei>(floats_per_vertex *
+                                                                      component_size_bytes);
+
+    size_t first_component_offset_accumulator = 0;
+    for (auto& vertex_type : _vertex_data_type_layout_order_in)
+    {
+        if (false == _success_out) break;
+        tmp_vertex_data_type = vertex_type;
+
+        switch (vertex_type)
+        {
+            case glt::VertexDataType::POSITION:
+            {
+                tmp_component_count        = _position_component_count_in;
+                tmp_vertex_attribute_index = _position_attribute_index_in;
+                break;
+            }
+            case glt::VertexDataType::NORMAL:
+            {
+                tmp_component_count        = _normal_component_count_in;
+                tmp_vertex_attribute_index = _normal_attribute_index_in;
+                break;
+            }
+            case glt::VertexDataType::TEXTURE:
+            {
+                tmp_component_count        = _texture_coordinate_component_count_in;
+                tmp_vertex_attribute_index = _texture_coordinates_attribute_index_in;
+                break;
+            }
+            default:
+            {
+                Log_e("Unsupported buffer vertex_type.");
+                _success_out = false;
+                break;
+            }
+        }
+
+        tmp_first_component_byte_offset = (const GLvoid*)(first_component_offset_accumulator *
+                                                          component_size_bytes);
+        first_component_offset_accumulator += tmp_component_count;
+
+        _vertex_attribute_pointers_out.push_back(
+          glt::VertexAttributeDescriptor(std::move(_vertex_array_object_id_in),
+                                         std::move(tmp_vertex_attribute_index),
+                                         std::move(tmp_component_count),
+                                         std::move(default_data_type),
+                                         std::move(default_should_be_normalized_by_gpu),
+                                         std::move(byte_stride_between_elements),
+                                         std::move(tmp_first_component_byte_offset),
+                                         std::move(tmp_vertex_data_type)));
+    }
+}
+
+// Note: Decodes a cooked mesh into the output buffers of LoadModelFromPlyFile(...). Attribute
+//       indices are supplied by the caller; every other descriptor value comes from the file.
+static void
+LoadModelFromCookedMesh(
+  bool&                                        _success_out,
+  const GLuint&                                _vertex_array_object_id_in,
+  const char* const                            _cooked_mesh_file_path_in,
+  const CookedMesh&                            _cooked_mesh_in,
+  const GLuint&                                _position_attribute_index_in,
+  const GLuint&                                _normal_attribute_index_in,
+  const GLuint&                                _texture_coordinates_attribute_index_in,
+  const GLuint&                                _tangent_attribute_index_in,
+  size_t&                                      _vertex_count_out,
+  std::vector<float>&                          _buffer_data_out,
+  std::vector<GLuint>&                         _buffer_elements_array_out,
+  GLenum&                                      _element_data_type_out,
+  std::vector<Meshlet>&                        _meshlets_out,
+  BoundingVolume&                              _bounding_volume_out,
+  std::vector<glt::VertexDataType>&            _vertex_data_types_out,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out)
+{
+    _success_out = true;
+
+    const CookedMeshHeader& header = *_cooked_mesh_in.header;
+    if (0 != (header.vertex_data_size_bytes % sizeof(float)))
+    {
+        std::stringstream ss;
+        ss << "Cooked mesh buffers do not match the model buffer types: "
+           << _cooked_mesh_file_path_in;
+        Log_w(ss);
+        _success_out = false;
+        return;
+    }
+
+    std::vector<glt::VertexDataType> vertex_data_types;
+    for (uint32_t attribute_index = 0; attribute_index < header.attribute_count; attribute_index++)
+    {
+        const uint32_t& vertex_data_type = _cooked_mesh_in.attributes[attribute_index]
+                                             .vertex_data_type;
+        if (glt::array_buffer_count <= vertex_data_type)
+        {
+            std::stringstream ss;
+            ss << "Cooked mesh contains an unsupported vertex data type: "
+               << _cooked_mesh_file_path_in;
+            Log_w(ss);
+            _success_out = false;
+            return;
+        }
+
+        vertex_data_types.push_back(static_cast<glt::VertexDataType>(vertex_data_type));
+    }
+
+    for (uint32_t attribute_index = 0; attribute_index < header.attribute_count; attribute_index++)
+    {
+        const CookedVertexAttribute& attribute = _cooked_mesh_in.attributes[attribute_index];
+
+        GLuint tmp_vertex_attribute_index = 0;
+        switch (vertex_data_types[attribute_index])
+        {
+            case glt::VertexDataType::POSITION:
+            {
+                tmp_vertex_attribute_index = _position_attribute_index_in;
+                break;
+            }
+            case glt::VertexDataType::NORMAL:
+            {
+                tmp_vertex_attribute_index = _normal_attribute_index_in;
+                break;
+            }
+            case glt::VertexDataType::TEXTURE:
+            {
+                tmp_vertex_attribute_index = _texture_coordinates_attribute_index_in;
+                break;
+            }
+            case glt::VertexDataType::TANGENT:
+            {
+                tmp_vertex_attribute_index = _tangent_attribute_index_in;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        const GLvoid* tmp_first_component_byte_offset = reinterpret_cast<const GLvoid*>(
+          static_cast<uintptr_t>(attribute.first_component_byte_offset));
+
+        _vertex_attribute_pointers_out.push_back(glt::VertexAttributeDescriptor(
+          std::move(_vertex_array_object_id_in),
+          std::move(tmp_vertex_attribute_index),
+          std::move(attribute.component_count),
+          std::move(attribute.data_type),
+          static_cast<GLboolean>(attribute.should_be_normalized_by_gpu),
+          std::move(attribute.byte_stride_between_elements),
+          std::move(tmp_first_component_byte_offset),
+          std::move(vertex_data_types[attribute_index])));
+    }
+
+    _buffer_data_out.resize(header.vertex_data_size_bytes / sizeof(float));
+    DecodeCookedVertexData(_success_out, _cooked_mesh_in, _buffer_data_out.data());
+    if (true == _success_out)
+    {
+        _buffer_elements_array_out.resize(header.element_count);
+        DecodeCookedElements(_success_out,
+                             _cooked_mesh_in,
+                             GL_UNSIGNED_INT,
+                             _buffer_elements_array_out.data());
+    }
+
+    if (false == _success_out)
+    {
+        std::stringstream ss;
+        ss << "Unable to decode cooked mesh: " << _cooked_mesh_file_path_in;
+        Log_w(ss);
+        return;
+    }
+
+    for (uint64_t meshlet_index = 0; meshlet_index < header.meshlet_count; meshlet_index++)
+    {
+        const Meshlet& meshlet = _cooked_mesh_in.meshlets[meshlet_index];
+        if ((0 != (meshlet.element_count % 3)) ||
+            ((static_cast<uint64_t>(meshlet.first_element) + meshlet.element_count) >
+             header.element_count))
+        {
+            std::stringstream ss;
+            ss << "Cooked mesh contains a meshlet outside of its elements: "
+               << _cooked_mesh_file_path_in;
+            Log_w(ss);
+            _success_out = false;
+            return;
+        }
+    }
+
+    _meshlets_out.assign(_cooked_mesh_in.meshlets,
+                         _cooked_mesh_in.meshlets + header.meshlet_count);
+    _bounding_volume_out   = header.bounding_volume;
+    _element_data_type_out = header.element_data_type;
+    _vertex_data_types_out = vertex_data_types;
+    _vertex_count_out      = header.vertex_count;
+}
+
+// Note: Loads the cooked mesh beside `_model_file_path_in` when it was cooked from the current
+//       contents of `_source_file_in` (see MapCookedMesh(...) in cooked_mesh.h). `_loaded_out`
+//       is false when there is no such cooked mesh, in which case the outputs are unspecified
+//       and the caller parses the source.
+static void
+LoadCurrentCookedMesh(
+  bool&                                        _loaded_out,
+  const GLuint&                                _vertex_array_object_id_in,
+  const char* const                            _model_file_path_in,
+  const MappedFile&                            _source_file_in,
+  const uint64_t&                              _source_write_time_in,
+  const GLuint&                                _position_attribute_index_in,
+  const GLuint&                                _normal_attribute_index_in,
+  const GLuint&                                _texture_coordinates_attribute_index_in,
+  const GLuint&                                _tangent_attribute_index_in,
+  size_t&                                      _vertex_count_out,
+  std::vector<float>&                          _buffer_data_out,
+  std::vector<GLuint>&                         _buffer_elements_array_out,
+  GLenum&                                      _element_data_type_out,
+  std::vector<Meshlet>&                        _meshlets_out,
+  BoundingVolume&                              _bounding_volume_out,
+  std::vector<glt::VertexDataType>&            _vertex_data_types_out,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out)
+{
+    const std::string cooked_mesh_file_path = std::string(_model_file_path_in) +
+                                              cooked_mesh_file_extension;
+
+    CookedMesh cooked_mesh;
+    MapCookedMesh(_loaded_out,
+                  cooked_mesh_file_path.c_str(),
+                  _source_file_in,
+                  _source_write_time_in,
+                  cooked_mesh);
+    if (false == _loaded_out)
+    {
+        return;
+    }
+
+    LoadModelFromCookedMesh(_loaded_out,
+                            _vertex_array_object_id_in,
+                            cooked_mesh_file_path.c_str(),
+                            cooked_mesh,
+                            _position_attribute_index_in,
+                            _normal_attribute_index_in,
+                            _texture_coordinates_attribute_index_in,
+                            _tangent_attribute_index_in,
+                            _vertex_count_out,
+                            _buffer_data_out,
+                            _buffer_elements_array_out,
+                            _element_data_type_out,
+                            _meshlets_out,
+                            _bounding_volume_out,
+                            _vertex_data_types_out,
+                            _vertex_attribute_pointers_out);
+    if (false == _loaded_out)
+    {
+        _vertex_attribute_pointers_out.clear();
+    }
+}
+
+// Note: Shared by the model importers once a source file is parsed into interleaved float
+//       vertices and triangle elements. Elements are validated, identical vertices are welded
+//       (see WeldVertices(...) in mesh_tools.h), tangents are generated for meshes with
+//       normals and texture coordinates (see GenerateTangents(...) in tangent_space.h), and the
+//       mesh is optimized and split into meshlets. When `_use_cooked_mesh_in` is set, the
+//       cooked mesh is (re)written beside the source.
+static void
+FinalizeImportedModel(
+  bool&                                        _success_out,
+  const char* const                            _model_file_path_in,
+  const size_t&                                _floats_per_vertex_in,
+  const size_t&                                _parsed_vertex_count_in,
+  const GLuint&                                _tangent_attribute_index_in,
+  const bool&                                  _use_cooked_mesh_in,
+  const uint64_t&                              _source_size_bytes_in,
+  const uint64_t&                              _source_content_hash_in,
+  const uint64_t&                              _source_write_time_in,
+  size_t&                                      _vertex_count_out,
+  std::vector<float>&                          _buffer_data_in_out,
+  std::vector<GLuint>&                         _buffer_elements_array_in_out,
+  GLenum&                                      _element_data_type_out,
+  std::vector<Meshlet>&                        _meshlets_out,
+  BoundingVolume&                              _bounding_volume_out,
+  std::vector<glt::VertexDataType>&            _vertex_data_types_in_out,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_in_out,
+  JobSystem* const                             _job_system_in)
+{
+    _success_out = true;
+
+    for (auto& element : _buffer_elements_array_in_out)
+    {
+        if (element >= _parsed_vertex_count_in)
+        {
+            std::stringstream ss;
+            ss << "Face index " << element << " exceeds the vertex count ("
+               << _parsed_vertex_count_in << ") in: " << _model_file_path_in;
+            Log_e(ss);
+            _success_out = false;
+            return;
+        }
+    }
+
+    // Note: Vertices identical in every attribute are redundant; welding them is lossless.
+    VertexWeldReport weld_report;
+    size_t           welded_vertex_count = _parsed_vertex_count_in;
+    WeldVertices(_success_out,
+                 _floats_per_vertex_in,
+                 0.0f,
+                 welded_vertex_count,
+                 _buffer_data_in_out,
+                 _buffer_elements_array_in_out,
+                 weld_report);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    if (0 != weld_report.bytes_saved)
+    {
+        std::stringstream ss;
+        ss << "Welded duplicate vertices." << std::endl
+           << "   File:        " << _model_file_path_in << std::endl
+           << "   Vertices:    " << weld_report.vertex_count_before << " -> "
+           << weld_report.vertex_count_after << std::endl
+           << "   Bytes Saved: " << weld_report.bytes_saved;
+        Log_i(ss);
+    }
+
+    // Note: Tangents split vertices, so they are generated once identical vertices are welded
+    //       and before the vertices are reordered.
+    size_t floats_per_vertex    = _floats_per_vertex_in;
+    size_t tangent_vertex_count = welded_vertex_count;
+    if ((_vertex_data_types_in_out.end() != std::find(_vertex_data_types_in_out.begin(),
+                                                      _vertex_data_types_in_out.end(),
+                                                      glt::VertexDataType::NORMAL)) &&
+        (_vertex_data_types_in_out.end() != std::find(_vertex_data_types_in_out.begin(),
+                                                      _vertex_data_types_in_out.end(),
+                                                      glt::VertexDataType::TEXTURE)))
+    {
+        TangentGenerationReport tangent_report;
+        GenerateTangents(_success_out,
+                         tangent_vertex_count,
+                         _buffer_elements_array_in_out,
+                         std::move(_tangent_attribute_index_in),
+                         _buffer_data_in_out,
+                         _vertex_data_types_in_out,
+                         _vertex_attribute_pointers_in_out,
+                         tangent_report,
+                         _job_system_in);
+        if (false == _success_out)
+        {
+            return;
+        }
+
+        floats_per_vertex = static_cast<size_t>(
+                              _vertex_attribute_pointers_in_out[0].byte_stride_between_elements) /
+                            sizeof(float);
+
+        std::stringstream ss;
+        ss << "Generated tangents." << std::endl
+           << "   File:       " << _model_file_path_in << std::endl
+           << "   Vertices:   " << welded_vertex_count << " -> " << tangent_vertex_count
+           << std::endl
+           << "   Mirrored:   " << tangent_report.mirrored_vertex_count << std::endl
+           << "   Degenerate: " << tangent_report.degenerate_triangle_count << " triangles";
+        Log_i(ss);
+    }
+
+    // Note: Triangles are reordered for the post-transform cache and for overdraw, then
+    //       vertices are renumbered in the order they are fetched. The cooked mesh stores the
+    //       result, so this cost is paid once per source file.
+    size_t position_offset = 0;
+    for (auto& descriptor : _vertex_attribute_pointers_in_out)
+    {
+        if (glt::VertexDataType::POSITION == descriptor.vertex_data_type)
+        {
+            position_offset = reinterpret_cast<uintptr_t>(descriptor.first_component_byte_offset) /
+                              sizeof(float);
+        }
+    }
+
+    MeshOptimizationReport optimization_report;
+    size_t                 optimized_vertex_count = tangent_vertex_count;
+    OptimizeMesh(_success_out,
+                 floats_per_vertex,
+                 position_offset,
+                 16,
+                 optimized_vertex_count,
+                 _buffer_data_in_out,
+                 _buffer_elements_array_in_out,
+                 optimization_report);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(3) << "Optimized mesh." << std::endl
+           << "   File:           " << _model_file_path_in << std::endl
+           << "   Cache Entries:  " << optimization_report.cache_size << std::endl
+           << "   FIFO ACMR/ATVR: " << optimization_report.fifo_before.acmr << "/"
+           << optimization_report.fifo_before.atvr << " -> " << optimization_report.fifo_after.acmr
+           << "/" << optimization_report.fifo_after.atvr << std::endl
+           << "   LRU ACMR/ATVR:  " << optimization_report.lru_before.acmr << "/"
+           << optimization_report.lru_before.atvr << " -> " << optimization_report.lru_after.acmr
+           << "/" << optimization_report.lru_after.atvr;
+        Log_i(ss);
+    }
+
+    // Note: Meshlets reorder triangles, so vertices are renumbered once more afterwards.
+    BuildMeshlets(_success_out,
+                  _buffer_data_in_out,
+                  floats_per_vertex,
+                  position_offset,
+                  optimized_vertex_count,
+                  _buffer_elements_array_in_out,
+                  _meshlets_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    OptimizeVertexFetch(_success_out,
+                        floats_per_vertex,
+                        optimized_vertex_count,
+                        _buffer_data_in_out,
+                        _buffer_elements_array_in_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    ComputeBoundingVolume(_success_out,
+                          _buffer_data_in_out.data(),
+                          floats_per_vertex,
+                          position_offset,
+                          optimized_vertex_count,
+                          _bounding_volume_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    _element_data_type_out = SelectElementDataType(optimized_vertex_count);
+    _vertex_count_out      = optimized_vertex_count;
+
+    if (true == _use_cooked_mesh_in)
+    {
+        // Note: Failing to write the cooked mesh only costs the next load a reparse.
+        const std::string cooked_mesh_file_path = std::string(_model_file_path_in) +
+                                                  cooked_mesh_file_extension;
+        bool              cooked_mesh_written   = false;
+        WriteCookedMesh(cooked_mesh_written,
+                        cooked_mesh_file_path.c_str(),
+                        _source_size_bytes_in,
+                        _source_content_hash_in,
+                        _source_write_time_in,
+                        _vertex_count_out,
+                        _buffer_data_in_out,
+                        _buffer_elements_array_in_out,
+                        std::move(_element_data_type_out),
+                        _meshlets_out,
+                        _bounding_volume_out,
+                        _vertex_attribute_pointers_in_out);
+    }
+}
+
+void
+LoadModelFromPlyFile(
+  bool&                                        _success_out,
+  const GLuint&&                               _vertex_array_object_id_in,
+  const char* const                            _ply_file_path_in,
+  const GLuint&&                               _position_attribute_index_in,
+  const GLuint&&                               _normal_attribute_index_in,
+  const GLuint&&                               _texture_coordinates_attribute_index_in,
+  const GLuint&&                               _tangent_attribute_index_in,
+  size_t&                                      _vertex_count_out,
+  std::vector<float>&                          _buffer_data_out,
+  std::vector<GLuint>&                         _buffer_elements_array_out,
+  GLenum&                                      _element_data_type_out,
+  std::vector<Meshlet>&                        _meshlets_out,
+  BoundingVolume&                              _bounding_volume_out,
+  std::vector<glt::VertexDataType>&            _vertex_data_types_out,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out,
+  const bool&&                                 _use_cooked_mesh_in,
+  JobSystem* const                             _job_system_in)
+{
+    _success_out = true;
+
+    // Note: The modification time is read before the file, such that a change made while it is
+    //       parsed leaves the cooked mesh stale.
+    bool     has_source_write_time = false;
+    uint64_t source_write_time     = 0;
+    GetFileWriteTime(has_source_write_time, _ply_file_path_in, source_write_time);
+
+    // Note: The file is mapped rather than read so that binary data sections can be copied from
+    //       the page cache straight into the output buffers.
+    MappedFile ply_file;
+    MapFileToMemory(_success_out, _ply_file_path_in, ply_file);
+    if (false == _success_out)
+    {
+        Log_e("Could not load .ply object file.");
+        return;
+    }
+
+    // Note: A cooked mesh is used in place of the source when it was cooked from identical
+    //       contents. Otherwise the source is hashed, parsed and the cooked mesh is rewritten.
+    uint64_t source_content_hash = 0;
+    if (true == _use_cooked_mesh_in)
+    {
+        bool cooked_mesh_loaded = false;
+        LoadCurrentCookedMesh(cooked_mesh_loaded,
+                              _vertex_array_object_id_in,
+                              _ply_file_path_in,
+                              ply_file,
+                              source_write_time,
+                              _position_attribute_index_in,
+                              _normal_attribute_index_in,
+                              _texture_coordinates_attribute_index_in,
+                              _tangent_attribute_index_in,
+                              _vertex_count_out,
+                              _buffer_data_out,
+                              _buffer_elements_array_out,
+                              _element_data_type_out,
+                              _meshlets_out,
+                              _bounding_volume_out,
+                              _vertex_data_types_out,
+                              _vertex_attribute_pointers_out);
+        if (true == cooked_mesh_loaded)
+        {
+            return;
+        }
+
+        HashMemory(source_content_hash, ply_file.data, ply_file.size_bytes);
+    }
+
+    PlyHeader ply_header;
+    ParsePlyHeader(_success_out, _ply_file_path_in, ply_file.data, ply_file.size_bytes, ply_header);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    //
+    // [ cfarvin::TODO ] Move to a function, to be seen in the header later if needed.
+    // Debug: Neatly prints pivotal data from the .ply header.
+    //
+    {
+        // std::stringstream header_debug_ss;
+        // header_debug_ss << "Successfully loaded PLY header" << std::endl
+        //                 << "   File:              " << _ply_file_path_in << std::endl
+        //                 << "   Vertices:          " << ply_header.vertex_count << std::endl
+        //                 << "   Position elements: "
+        //                 << static_cast<size_t>(ply_header.vertex_component_count) << std::endl
+        //                 << "   Normal elements:   "
+        //                 << static_cast<size_t>(ply_header.normal_component_count) << std::endl
+        //                 << "   Texture elements:  "
+        //                 << static_cast<size_t>(ply_header.texture_coordinate_component_count)
+        //                 << std::endl
+        //                 << "   Face count:        " << ply_header.face_count;
+
+        // Log_i(header_debug_ss);
+    }
+
+    // Note: Data sections are parsed directly into the output buffers.
+    _buffer_data_out.clear();
+    _buffer_data_out.resize(ply_header.vertex_count * ply_header.floats_per_vertex);
+
+    //
+    // VISIBILITY: Reservation size for the element array is the face count multiplied
+    //             by three since this importer requires that exported meshes are
+    //             triangulated. There are checks in the data import section which will
+    //             throw errors for non-triangulated meshes (containing quads or N-gons).
+    //
+    _buffer_elements_array_out.clear();
+    _buffer_elements_array_out.resize(ply_header.face_count * 3);
+
+    const char* const data_section            = ply_file.data + ply_header.data_offset_bytes;
+    const size_t      data_section_size_bytes = ply_file.size_bytes - ply_header.data_offset_bytes;
+    switch (ply_header.format)
+    {
+        case PlyFormat::ASCII:
+        {
+            ParsePlyAsciiData(_success_out,
+                              _ply_file_path_in,
+                              ply_header,
+                              data_section,
+                              data_section_size_bytes,
+                              _job_system_in,
+                              _buffer_data_out,
+                              _buffer_elements_array_out);
+            break;
+        }
+        case PlyFormat::BINARY_LITTLE_ENDIAN:
+        case PlyFormat::BINARY_BIG_ENDIAN:
+        {
+            ParsePlyBinaryData(_success_out,
+                               _ply_file_path_in,
+                               ply_header,
+                               data_section,
+                               data_section_size_bytes,
+                               _buffer_data_out,
+                               _buffer_elements_array_out);
+            break;
+        }
+        default:
+        {
+            Log_e("Unsupported PLY format.");
+            _success_out = false;
+        }
+    }
+
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    CreateFloatVertexAttributeDescriptors(_success_out,
+                                          _vertex_array_object_id_in,
+                                          ply_header.vertex_data_type_layout_order,
+                                          ply_header.vertex_component_count,
+                                          ply_header.normal_component_count,
+                                          ply_header.texture_coordinate_component_count,
+                                          _position_attribute_index_in,
+                                          _normal_attribute_index_in,
+                                          _texture_coordinates_attribute_index_in,
+                                          _vertex_attribute_pointers_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    _vertex_data_types_out = ply_header.vertex_data_type_layout_order;
+
+    FinalizeImportedModel(_success_out,
+                          _ply_file_path_in,
+                          ply_header.floats_per_vertex,
+                          ply_header.vertex_count,
+                          _tangent_attribute_index_in,
+                          _use_cooked_mesh_in,
+                          ply_file.size_bytes,
+                          source_content_hash,
+                          source_write_time,
+                          _vertex_count_out,
+                          _buffer_data_out,
+                          _buffer_elements_array_out,
+                          _element_data_type_out,
+                          _meshlets_out,
+                          _bounding_volume_out,
+                          _vertex_data_types_out,
+                          _vertex_attribute_pointers_out,
+                          _job_system_in);
+    if (false == _success_out)
+    {
+        return;
+    }
+}
+
+constexpr uint32_t obj_missing_index = std::numeric_limits<uint32_t>::max();
+
+// Note: One corner of an OBJ face, as zero based indices into the position, texture coordinate
+//       and normal lists. Attributes the face does not reference are obj_missing_index.
+struct ObjCorner
+{
+    uint32_t position           = obj_missing_index;
+    uint32_t texture_coordinate = obj_missing_index;
+    uint32_t normal             = obj_missing_index;
+};
+
+static inline bool
+ObjCornersEqual(const ObjCorner& _corner_a_in, const ObjCorner& _corner_b_in)
+{
+    return (_corner_a_in.position == _corner_b_in.position) &&
+           (_corner_a_in.texture_coordinate == _corner_b_in.texture_coordinate) &&
+           (_corner_a_in.normal == _corner_b_in.normal);
+}
+
+static inline uint64_t
+HashObjCorner(const ObjCorner& _corner_in)
+{
+    uint64_t hash = (static_cast<uint64_t>(_corner_in.position) << 32) ^
+                    (static_cast<uint64_t>(_corner_in.texture_coordinate) << 16) ^
+                    _corner_in.normal;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+// Note: OBJ statements are parsed in place with the ascii scanners of the PLY importer above.
+static inline void
+SkipObjLine(const char*& _cursor_in_out, const char* const _tail_in)
+{
+    while ((_cursor_in_out < _tail_in) && ('\n' != *_cursor_in_out))
+    {
+        _cursor_in_out++;
+    }
+
+    if (_cursor_in_out < _tail_in)
+    {
+        _cursor_in_out++;
+    }
+}
+
+// Note: Positive indices count from the first element of their kind, and are checked once the
+//       whole file is read. Negative indices count back from the last one defined so far.
+static inline bool
+ScanObjIndex(const char*&      _cursor_in_out,
+             const char* const _tail_in,
+             const size_t&     _defined_count_in,
+             uint32_t&         _index_out)
+{
+    int64_t                      index  = 0;
+    const std::from_chars_result result = std::from_chars(_cursor_in_out, _tail_in, index);
+    if (std::errc() != result.ec)
+    {
+        return false;
+    }
+
+    if ((0 < index) && (index <= static_cast<int64_t>(obj_missing_index)))
+    {
+        _index_out = static_cast<uint32_t>(index - 1);
+    }
+    else if ((0 > index) && (-index <= static_cast<int64_t>(_defined_count_in)))
+    {
+        _index_out = static_cast<uint32_t>(static_cast<int64_t>(_defined_count_in) + index);
+    }
+    else
+    {
+        return false;
+    }
+
+    _cursor_in_out = result.ptr;
+    return true;
+}
+
+// Note: Reads one `v`, `v/vt`, `v//vn` or `v/vt/vn` face corner.
+static inline bool
+ScanObjCorner(const char*&      _cursor_in_out,
+              const char* const _tail_in,
+              const size_t&     _position_count_in,
+              const size_t&     _texture_coordinate_count_in,
+              const size_t&     _normal_count_in,
+              ObjCorner&        _corner_out)
+{
+    _corner_out = ObjCorner();
+
+    SkipPlyAsciiBlanks(_cursor_in_out, _tail_in);
+    if (false == ScanObjIndex(_cursor_in_out, _tail_in, _position_count_in, _corner_out.position))
+    {
+        return false;
+    }
+
+    if ((_cursor_in_out < _tail_in) && ('/' == *_cursor_in_out))
+    {
+        _cursor_in_out++;
+        if ((_cursor_in_out < _tail_in) && ('/' != *_cursor_in_out) &&
+            (false == ScanObjIndex(_cursor_in_out,
+                                   _tail_in,
+                                   _texture_coordinate_count_in,
+                                   _corner_out.texture_coordinate)))
+        {
+            return false;
+        }
+
+        if ((_cursor_in_out < _tail_in) && ('/' == *_cursor_in_out))
+        {
+            _cursor_in_out++;
+            if (false ==
+                ScanObjIndex(_cursor_in_out, _tail_in, _normal_count_in, _corner_out.normal))
+            {
+                return false;
+            }
+        }
+    }
+
+    return (_cursor_in_out == _tail_in) || (' ' == *_cursor_in_out) ||
+           ('\t' == *_cursor_in_out) || ('\r' == *_cursor_in_out) || ('\n' == *_cursor_in_out);
+}
+
+static void
+ReportObjParseError(const char* const _obj_file_path_in,
+                    const size_t&     _line_number_in,
+                    const char* const _line_start_in,
+                    const char* const _tail_in,
+                    const char* const _note_in)
+{
+    const char* line_end = _line_start_in;
+    while ((line_end < _tail_in) && ('\n' != *line_end) && ('\r' != *line_end))
+    {
+        line_end++;
+    }
+
+    std::stringstream ss;
+    ss << "Failed to parse model object file." << std::endl
+       << "   Object File: " << _obj_file_path_in << std::endl
+       << "   Line Number: " << _line_number_in << std::endl
+       << "   Line Data:   " << std::string_view(_line_start_in, line_end - _line_start_in)
+       << std::endl
+       << "   Note:        " << _note_in;
+    Log_e(ss);
+}
+
+void
+LoadModelFromObjFile(
+  bool&                                        _success_out,
+  const GLuint&&                               _vertex_array_object_id_in,
+  const char* const                            _obj_file_path_in,
+  const GLuint&&                               _position_attribute_index_in,
+  const GLuint&&                               _normal_attribute_index_in,
+  const GLuint&&                               _texture_coordinates_attribute_index_in,
+  const GLuint&&                               _tangent_attribute_index_in,
+  size_t&                                      _vertex_count_out,
+  std::vector<float>&                          _buffer_data_out,
+  std::vector<GLuint>&                         _buffer_elements_array_out,
+  GLenum&                                      _element_data_type_out,
+  std::vector<Meshlet>&                        _meshlets_out,
+  BoundingVolume&                              _bounding_volume_out,
+  std::vector<glt::VertexDataType>&            _vertex_data_types_out,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out,
+  const bool&&                                 _use_cooked_mesh_in)
+{
+    _success_out = true;
+
+    bool     has_source_write_time = false;
+    uint64_t source_write_time     = 0;
+    GetFileWriteTime(has_source_write_time, _obj_file_path_in, source_write_time);
+
+    MappedFile obj_file;
+    MapFileToMemory(_success_out, _obj_file_path_in, obj_file);
+    if (false == _success_out)
+    {
+        Log_e("Could not load .obj object file.");
+        return;
+    }
+
+    uint64_t source_content_hash = 0;
+    if (true == _use_cooked_mesh_in)
+    {
+        bool cooked_mesh_loaded = false;
+        LoadCurrentCookedMesh(cooked_mesh_loaded,
+                              _vertex_array_object_id_in,
+                              _obj_file_path_in,
+                              obj_file,
+                              source_write_time,
+                              _position_attribute_index_in,
+                              _normal_attribute_index_in,
+                              _texture_coordinates_attribute_index_in,
+                              _tangent_attribute_index_in,
+                              _vertex_count_out,
+                              _buffer_data_out,
+                              _buffer_elements_array_out,
+                              _element_data_type_out,
+                              _meshlets_out,
+                              _bounding_volume_out,
+                              _vertex_data_types_out,
+                              _vertex_attribute_pointers_out);
+        if (true == cooked_mesh_loaded)
+        {
+            return;
+        }
+
+        HashMemory(source_content_hash, obj_file.data, obj_file.size_bytes);
+    }
+
+    //
+    // Note: A single pass over the file collects the attribute lists and the corners of every
+    //       triangle. Polygons are split into fans around their first corner as they are read,
+    //       so only the first and previous corners of a face are held.
+    //
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec2> texture_coordinates;
+    std::vector<glm::vec3> normals;
+    std::vector<ObjCorner> corners;
+
+    // Note: Rough reservations from the file size, to avoid most reallocation on large files.
+    positions.reserve(obj_file.size_bytes / 128);
+    corners.reserve(obj_file.size_bytes / 32);
+
+    const char* const tail                          = obj_file.data + obj_file.size_bytes;
+    const char*       cursor                        = obj_file.data;
+    size_t            line_number                   = 0;
+    size_t            unsupported_statement_count   = 0;
+    const char*       first_unsupported_line_start  = nullptr;
+    size_t            first_unsupported_line_number = 0;
+    while ((true == _success_out) && (cursor < tail))
+    {
+        const char* const line_start = cursor;
+        line_number++;
+
+        SkipPlyAsciiBlanks(cursor, tail);
+        const char* const keyword_start = cursor;
+        while ((cursor < tail) && (' ' != *cursor) && ('\t' != *cursor) && ('\r' != *cursor) &&
+               ('\n' != *cursor))
+        {
+            cursor++;
+        }
+
+        const std::string_view keyword(keyword_start, cursor - keyword_start);
+        if ("v" == keyword) // Geometric vertex location.
+        {
+            glm::vec3 position;
+            if ((false == ScanPlyAsciiFloat(cursor, tail, position.x)) ||
+                (false == ScanPlyAsciiFloat(cursor, tail, position.y)) ||
+                (false == ScanPlyAsciiFloat(cursor, tail, position.z)))
+            {
+                ReportObjParseError(
+                  _obj_file_path_in, line_number, line_start, tail, "Expected 3 floats.");
+                _success_out = false;
+                break;
+            }
+
+            positions.push_back(position);
+        }
+        else if ("vt" == keyword) // Texture coordinates; `v` defaults to zero.
+        {
+            glm::vec2 texture_coordinate(0.0f);
+            if (false == ScanPlyAsciiFloat(cursor, tail, texture_coordinate.s))
+            {
+                ReportObjParseError(
+                  _obj_file_path_in, line_number, line_start, tail, "Expected 1 to 3 floats.");
+                _success_out = false;
+                break;
+            }
+
+            if (false == IsPlyAsciiLineEmpty(cursor, tail))
+            {
+                ScanPlyAsciiFloat(cursor, tail, texture_coordinate.t);
+            }
+
+            texture_coordinates.push_back(texture_coordinate);
+        }
+        else if ("vn" == keyword) // Vertex normals.
+        {
+            glm::vec3 normal;
+            if ((false == ScanPlyAsciiFloat(cursor, tail, normal.x)) ||
+                (false == ScanPlyAsciiFloat(cursor, tail, normal.y)) ||
+                (false == ScanPlyAsciiFloat(cursor, tail, normal.z)))
+            {
+                ReportObjParseError(
+                  _obj_file_path_in, line_number, line_start, tail, "Expected 3 floats.");
+                _success_out = false;
+                break;
+            }
+
+            normals.push_back(normal);
+        }
+        else if ("f" == keyword) // Face.
+        {
+            ObjCorner first_corner;
+            ObjCorner previous_corner;
+            ObjCorner corner;
+            size_t    corner_count = 0;
+            while (false == IsPlyAsciiLineEmpty(cursor, tail))
+            {
+                if (false == ScanObjCorner(cursor,
+                                           tail,
+                                           positions.size(),
+                                           texture_coordinates.size(),
+                                           normals.size(),
+                                           corner))
+                {
+                    ReportObjParseError(_obj_file_path_in,
+                                        line_number,
+                                        line_start,
+                                        tail,
+                                        "Expected face corners of the form v, v/vt, v//vn or "
+                                        "v/vt/vn, with indices referring to defined elements.");
+                    _success_out = false;
+                    break;
+                }
+
+                if (0 == corner_count)
+                {
+                    first_corner = corner;
+                }
+                else if (2 <= corner_count)
+                {
+                    corners.push_back(first_corner);
+                    corners.push_back(previous_corner);
+                    corners.push_back(corner);
+                }
+
+                previous_corner = corner;
+                corner_count++;
+            }
+
+            if ((true == _success_out) && (3 > corner_count))
+            {
+                ReportObjParseError(_obj_file_path_in,
+                                    line_number,
+                                    line_start,
+                                    tail,
+                                    "Faces must have at least 3 corners.");
+                _success_out = false;
+            }
+        }
+        else if ((true == keyword.empty()) || ('#' == keyword[0]) || ("o" == keyword) ||
+                 ("g" == keyword) || ("s" == keyword) || ("usemtl" == keyword) ||
+                 ("mtllib" == keyword))
+        {
+            // Note: Blank lines, comments, grouping, smoothing and materials are ignored.
+        }
+        else
+        {
+            if (0 == unsupported_statement_count)
+            {
+                first_unsupported_line_start  = line_start;
+                first_unsupported_line_number = line_number;
+            }
+
+            unsupported_statement_count++;
+        }
+
+        // Note: Trailing values, such as `w` components or vertex colors, are ignored.
+        SkipObjLine(cursor, tail);
+    }
+
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    if (0 != unsupported_statement_count)
+    {
+        const char* line_end = first_unsupported_line_start;
+        while ((line_end < tail) && ('\n' != *line_end) && ('\r' != *line_end))
+        {
+            line_end++;
+        }
+
+        std::stringstream ss;
+        ss << "Ignored unsupported object file statements." << std::endl
+           << "   Object File: " << _obj_file_path_in << std::endl
+           << "   Statements:  " << unsupported_statement_count << std::endl
+           << "   First:       Line " << first_unsupported_line_number << ": "
+           << std::string_view(first_unsupported_line_start,
+                               line_end - first_unsupported_line_start);
+        Log_w(ss);
+    }
+
+    if (0 == corners.size())
+    {
+        std::stringstream ss;
+        ss << "Object file contains no faces: " << _obj_file_path_in;
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    bool has_texture_coordinates = false;
+    bool has_normals             = false;
+    for (auto& corner : corners)
+    {
+        if ((corner.position >= positions.size()) ||
+            ((obj_missing_index != corner.texture_coordinate) &&
+             (corner.texture_coordinate >= texture_coordinates.size())) ||
+            ((obj_missing_index != corner.normal) && (corner.normal >= normals.size())))
+        {
+            std::stringstream ss;
+            ss << "Face references an undefined vertex, texture coordinate or normal in: "
+               << _obj_file_path_in;
+            Log_e(ss);
+            _success_out = false;
+            return;
+        }
+
+        has_texture_coordinates |= (obj_missing_index != corner.texture_coordinate);
+        has_normals |= (obj_missing_index != corner.normal);
+    }
+
+    //
+    // VISIBILITY: Vertices are laid out as the PLY importer lays them out, with normals and
+    //             texture coordinates present when any face references them:
+    //             p.x, p.y, p.z [, n.x, n.y, n.z] [, tc.s, tc.t]
+    //
+    std::vector<glt::VertexDataType> vertex_data_types = { glt::VertexDataType::POSITION };
+    if (true == has_normals)
+    {
+        vertex_data_types.push_back(glt::VertexDataType::NORMAL);
+    }
+
+    if (true == has_texture_coordinates)
+    {
+        vertex_data_types.push_back(glt::VertexDataType::TEXTURE);
+    }
+
+    const size_t floats_per_vertex = 3 + ((true == has_normals) ? 3 : 0) +
+                                     ((true == has_texture_coordinates) ? 2 : 0);
+
+    //
+    // Note: Each distinct v/vt/vn triple becomes one vertex. Triples are deduplicated with an
+    //       open addressed (linear probing) table of vertex indices, sized to a power of two at
+    //       least twice the corner count so that it is never more than half full.
+    //
+    const size_t           table_size = std::bit_ceil(std::max<size_t>(2, corners.size() * 2));
+    const size_t           table_mask = table_size - 1;
+    std::vector<GLuint>    table(table_size, std::numeric_limits<GLuint>::max());
+    std::vector<ObjCorner> unique_corners;
+
+    _buffer_data_out.clear();
+    _buffer_elements_array_out.clear();
+    _buffer_elements_array_out.resize(corners.size());
+    for (size_t corner_index = 0; corner_index < corners.size(); corner_index++)
+    {
+        const ObjCorner& corner = corners[corner_index];
+
+        size_t slot = HashObjCorner(corner) & table_mask;
+        while ((std::numeric_limits<GLuint>::max() != table[slot]) &&
+               (false == ObjCornersEqual(corner, unique_corners[table[slot]])))
+        {
+            slot = (slot + 1) & table_mask;
+        }
+
+        if (std::numeric_limits<GLuint>::max() == table[slot])
+        {
+            table[slot] = static_cast<GLuint>(unique_corners.size());
+            unique_corners.push_back(corner);
+
+            const glm::vec3& position = positions[corner.position];
+            _buffer_data_out.insert(_buffer_data_out.end(), { position.x, position.y, position.z });
+
+            if (true == has_normals)
+            {
+                const glm::vec3 normal = (obj_missing_index == corner.normal)
+                                           ? glm::vec3(0.0f)
+                                           : normals[corner.normal];
+                _buffer_data_out.insert(_buffer_data_out.end(), { normal.x, normal.y, normal.z });
+            }
+
+            if (true == has_texture_coordinates)
+            {
+                const glm::vec2 texture_coordinate =
+                  (obj_missing_index == corner.texture_coordinate)
+                    ? glm::vec2(0.0f)
+                    : texture_coordinates[corner.texture_coordinate];
+                _buffer_data_out.insert(_buffer_data_out.end(),
+                                        { texture_coordinate.s, texture_coordinate.t });
+            }
+        }
+
+        _buffer_elements_array_out[corner_index] = table[slot];
+    }
+
+    CreateFloatVertexAttributeDescriptors(_success_out,
+                                          _vertex_array_object_id_in,
+                                          vertex_data_types,
+                                          3,
+                                          3,
+                                          2,
+                                          _position_attribute_index_in,
+                                          _normal_attribute_index_in,
+                                          _texture_coordinates_attribute_index_in,
+                                          _vertex_attribute_pointers_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    _vertex_data_types_out = vertex_data_types;
+
+    FinalizeImportedModel(_success_out,
+                          _obj_file_path_in,
+                          floats_per_vertex,
+                          unique_corners.size(),
+                          _tangent_attribute_index_in,
+                          _use_cooked_mesh_in,
+                          obj_file.size_bytes,
+                          source_content_hash,
+                          source_write_time,
+                          _vertex_count_out,
+                          _buffer_data_out,
+                          _buffer_elements_array_out,
+                          _element_data_type_out,
+                          _meshlets_out,
+                          _bounding_volume_out,
+                          _vertex_data_types_out,
+                          _vertex_attribute_pointers_out,
+                          nullptr);
+    if (false == _success_out)
+    {
+        return;
+    }
+}
+
+// Note: Reads component `_component_index_in` of element `_element_index_in` of a glb vertex
+//       accessor as a float, applying the glTF normalization of integer components.
+static float
+ReadGlbAccessorComponent(const GlbAccessor& _accessor_in,
+                         const size_t&      _element_index_in,
+                         const size_t&      _component_index_in)
+{
+    const size_t      component_size_bytes = GLDataTypeSizeBytes(_accessor_in.data_type);
+    const char* const component            = static_cast<const char*>(_accessor_in.data) +
+                                  (_element_index_in * _accessor_in.byte_stride_between_elements) +
+                                  (_component_index_in * component_size_bytes);
+    const bool normalized = (GL_TRUE == _accessor_in.should_be_normalized_by_gpu);
+    switch (_accessor_in.data_type)
+    {
+        case GL_BYTE:
+        {
+            int8_t value = 0;
+            std::memcpy(&value, component, sizeof(value));
+            return (true == normalized) ? std::max(value / 127.0f, -1.0f)
+                                        : static_cast<float>(value);
+        }
+        case GL_UNSIGNED_BYTE:
+        {
+            uint8_t value = 0;
+            std::memcpy(&value, component, sizeof(value));
+            return (true == normalized) ? (value / 255.0f) : static_cast<float>(value);
+        }
+        case GL_SHORT:
+        {
+            int16_t value = 0;
+            std::memcpy(&value, component, sizeof(value));
+            return (true == normalized) ? std::max(value / 32767.0f, -1.0f)
+                                        : static_cast<float>(value);
+        }
+        case GL_UNSIGNED_SHORT:
+        {
+            uint16_t value = 0;
+            std::memcpy(&value, component, sizeof(value));
+            return (true == normalized) ? (value / 65535.0f) : static_cast<float>(value);
+        }
+        case GL_UNSIGNED_INT:
+        {
+            uint32_t value = 0;
+            std::memcpy(&value, component, sizeof(value));
+            return static_cast<float>(value);
+        }
+        case GL_FLOAT:
+        {
+            float value = 0.0f;
+            std::memcpy(&value, component, sizeof(value));
+            return value;
+        }
+        default:
+        {
+            return 0.0f;
+        }
+    }
+}
+
+// Note: Reads element `_element_index_in` of a tightly packed glb element accessor.
+static GLuint
+ReadGlbElement(const GlbAccessor& _elements_in, const size_t& _element_index_in)
+{
+    const char* const element = static_cast<const char*>(_elements_in.data) +
+                                (_element_index_in * GLDataTypeSizeBytes(_elements_in.data_type));
+    switch (_elements_in.data_type)
+    {
+        case GL_UNSIGNED_BYTE:
+        {
+            uint8_t value = 0;
+            std::memcpy(&value, element, sizeof(value));
+            return value;
+        }
+        case GL_UNSIGNED_SHORT:
+        {
+            uint16_t value = 0;
+            std::memcpy(&value, element, sizeof(value));
+            return value;
+        }
+        default:
+        {
+            uint32_t value = 0;
+            std::memcpy(&value, element, sizeof(value));
+            return value;
+        }
+    }
+}
+
+void
+LoadModelFromGlbFile(
+  bool&                                        _success_out,
+  const GLuint&&                               _vertex_array_object_id_in,
+  const char* const                            _glb_file_path_in,
+  const GLuint&&                               _position_attribute_index_in,
+  const GLuint&&                               _normal_attribute_index_in,
+  const GLuint&&                               _texture_coordinates_attribute_index_in,
+  const GLuint&&                               _tangent_attribute_index_in,
+  size_t&                                      _vertex_count_out,
+  std::vector<float>&                          _buffer_data_out,
+  std::vector<GLuint>&                         _buffer_elements_array_out,
+  GLenum&                                      _element_data_type_out,
+  std::vector<Meshlet>&                        _meshlets_out,
+  BoundingVolume&                              _bounding_volume_out,
+  std::vector<glt::VertexDataType>&            _vertex_data_types_out,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out,
+  const bool&&                                 _use_cooked_mesh_in)
+{
+    _success_out = true;
+
+    bool     has_source_write_time = false;
+    uint64_t source_write_time     = 0;
+    GetFileWriteTime(has_source_write_time, _glb_file_path_in, source_write_time);
+
+    if (true == _use_cooked_mesh_in)
+    {
+        MappedFile glb_file;
+        MapFileToMemory(_success_out, _glb_file_path_in, glb_file);
+        if (false == _success_out)
+        {
+            Log_e("Could not load .glb object file.");
+            return;
+        }
+
+        bool cooked_mesh_loaded = false;
+        LoadCurrentCookedMesh(cooked_mesh_loaded,
+                              _vertex_array_object_id_in,
+                              _glb_file_path_in,
+                              glb_file,
+                              source_write_time,
+                              _position_attribute_index_in,
+                              _normal_attribute_index_in,
+                              _texture_coordinates_attribute_index_in,
+                              _tangent_attribute_index_in,
+                              _vertex_count_out,
+                              _buffer_data_out,
+                              _buffer_elements_array_out,
+                              _element_data_type_out,
+                              _meshlets_out,
+                              _bounding_volume_out,
+                              _vertex_data_types_out,
+                              _vertex_attribute_pointers_out);
+        if (true == cooked_mesh_loaded)
+        {
+            return;
+        }
+    }
+
+    GlbModel glb_model;
+    LoadModelFromGlbFile(_success_out, _glb_file_path_in, glb_model);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    uint64_t source_content_hash = 0;
+    if (true == _use_cooked_mesh_in)
+    {
+        HashMemory(source_content_hash, glb_model.file.data, glb_model.file.size_bytes);
+    }
+
+    // Note: Normals and texture coordinates are written when any primitive has them, and zero
+    //       filled for primitives without them, as in LoadModelFromObjFile(...).
+    bool   has_normals             = false;
+    bool   has_texture_coordinates = false;
+    size_t vertex_count            = 0;
+    size_t element_count           = 0;
+    for (auto& primitive : glb_model.primitives)
+    {
+        if (GL_TRIANGLES != primitive.primitive_drawing_mode)
+        {
+            std::stringstream ss;
+            ss << "Only triangle primitives can be imported from: " << _glb_file_path_in;
+            Log_e(ss);
+            _success_out = false;
+            return;
+        }
+
+        for (auto& vertex_attribute : primitive.vertex_attributes)
+        {
+            has_normals |= (glt::VertexDataType::NORMAL == vertex_attribute.vertex_data_type);
+            has_texture_coordinates |= (glt::VertexDataType::TEXTURE ==
+                                        vertex_attribute.vertex_data_type);
+        }
+
+        vertex_count += static_cast<size_t>(primitive.vertex_count);
+        element_count += (0 == primitive.elements.element_count)
+                           ? static_cast<size_t>(primitive.vertex_count)
+                           : static_cast<size_t>(primitive.elements.element_count);
+    }
+
+    if ((0 != (element_count % 3)) ||
+        (static_cast<size_t>(std::numeric_limits<GLuint>::max()) < vertex_count))
+    {
+        std::stringstream ss;
+        ss << "Triangle primitives are malformed or too large in: " << _glb_file_path_in;
+        Log_e(ss);
+        _success_out = false;
+        return;
+    }
+
+    std::vector<glt::VertexDataType> vertex_data_types = { glt::VertexDataType::POSITION };
+    if (true == has_normals)
+    {
+        vertex_data_types.push_back(glt::VertexDataType::NORMAL);
+    }
+
+    if (true == has_texture_coordinates)
+    {
+        vertex_data_types.push_back(glt::VertexDataType::TEXTURE);
+    }
+
+    const size_t normal_offset             = 3;
+    const size_t texture_coordinate_offset = normal_offset + ((true == has_normals) ? 3 : 0);
+    const size_t floats_per_vertex         = texture_coordinate_offset +
+                                     ((true == has_texture_coordinates) ? 2 : 0);
+
+    // Note: The primitives are merged into one mesh. glTF texture coordinates have their origin
+    //       at the top left of the image, and are flipped (v' = 1 - v) onto the bottom left
+    //       origin OpenGL and the other importers use.
+    _buffer_data_out.assign(vertex_count * floats_per_vertex, 0.0f);
+    _buffer_elements_array_out.clear();
+    _buffer_elements_array_out.reserve(element_count);
+    size_t base_vertex = 0;
+    for (auto& primitive : glb_model.primitives)
+    {
+        const size_t primitive_vertex_count = static_cast<size_t>(primitive.vertex_count);
+        for (auto& vertex_attribute : primitive.vertex_attributes)
+        {
+            const GlbAccessor& accessor           = vertex_attribute.accessor;
+            size_t             destination_offset = 0;
+            size_t             component_count    = 3;
+            switch (vertex_attribute.vertex_data_type)
+            {
+                case glt::VertexDataType::NORMAL:
+                {
+                    destination_offset = normal_offset;
+                    break;
+                }
+                case glt::VertexDataType::TEXTURE:
+                {
+                    destination_offset = texture_coordinate_offset;
+                    component_count    = 2;
+                    break;
+                }
+                case glt::VertexDataType::TANGENT:
+                {
+                    // Note: Tangents are regenerated, with vertex splits, once the mesh is
+                    //       welded in FinalizeImportedModel(...).
+                    continue;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+
+            component_count = std::min(component_count,
+                                       static_cast<size_t>(accessor.component_count));
+            for (size_t vertex_index = 0; vertex_index < primitive_vertex_count; vertex_index++)
+            {
+                float* const vertex = _buffer_data_out.data() +
+                                      ((base_vertex + vertex_index) * floats_per_vertex);
+                for (size_t component_index = 0; component_index < component_count;
+                     component_index++)
+                {
+                    vertex[destination_offset + component_index] = ReadGlbAccessorComponent(
+                      accessor, vertex_index, component_index);
+                }
+
+                if (glt::VertexDataType::TEXTURE == vertex_attribute.vertex_data_type)
+                {
+                    vertex[destination_offset + 1] = 1.0f - vertex[destination_offset + 1];
+                }
+            }
+        }
+
+        if (0 == primitive.elements.element_count)
+        {
+            for (size_t vertex_index = 0; vertex_index < primitive_vertex_count; vertex_index++)
+            {
+                _buffer_elements_array_out.push_back(
+                  static_cast<GLuint>(base_vertex + vertex_index));
+            }
+        }
+        else
+        {
+            for (size_t element_index = 0;
+                 element_index < static_cast<size_t>(primitive.elements.element_count);
+                 element_index++)
+            {
+                const GLuint element = ReadGlbElement(primitive.elements, element_index);
+                _buffer_elements_array_out.push_back(static_cast<GLuint>(base_vertex + element));
+            }
+        }
+
+        base_vertex += primitive_vertex_count;
+    }
+
+    CreateFloatVertexAttributeDescriptors(_success_out,
+                                          _vertex_array_object_id_in,
+                                          vertex_data_types,
+                                          3,
+                                          3,
+                                          2,
+                                          _position_attribute_index_in,
+                                          _normal_attribute_index_in,
+                                          _texture_coordinates_attribute_index_in,
+                                          _vertex_attribute_pointers_out);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    _vertex_data_types_out = vertex_data_types;
+
+    FinalizeImportedModel(_success_out,
+                          _glb_file_path_in,
+                          floats_per_vertex,
+                          vertex_count,
+                          _tangent_attribute_index_in,
+                          _use_cooked_mesh_in,
+                          glb_model.file.size_bytes,
+                          source_content_hash,
+                          source_write_time,
+                          _vertex_count_out,
+                          _buffer_data_out,
+                          _buffer_elements_array_out,
+                          _element_data_type_out,
+                          _meshlets_out,
+                          _bounding_volume_out,
+                          _vertex_data_types_out,
+                          _vertex_attribute_pointers_out,
+                          nullptr);
+    if (false == _success_out)
+    {
+        return;
+    }
+}
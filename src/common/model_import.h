@@ -0,0 +1,128 @@
+#ifndef model_import_h
+#define model_import_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "bounds.h"
+#include "job_system.h"
+#include "meshlet.h"
+#include "vertex_layout.h"
+
+//
+// Note: The model importers. They produce CPU-side buffers and vertex attribute descriptors and
+//       write cooked meshes, but never call OpenGL, so that they may run on worker threads and in
+//       offline tools such as the asset cooker. Upload the results with BufferedModel in model.h.
+//
+
+// Note: Accepts `format ascii 1.0`, `format binary_little_endian 1.0` and
+//       `format binary_big_endian 1.0` files with `vertex` and `face` elements. Vertex
+//       properties may be of any PLY scalar type and are converted to interleaved floats:
+//       x, y and z are required; nx, ny and nz, and s and t (or u and v) are optional. Other
+//       vertex properties, such as colors, are skipped. Faces must hold a `vertex_indices` list
+//       of any integer types; other face properties are skipped.
+//
+//       The file is memory mapped; binary vertex data whose layout matches the output buffer is
+//       copied without conversion. Vertices that are identical in every attribute are welded
+//       (see WeldVertices(...) in mesh_tools.h), so `_vertex_count_out` may be less than the
+//       vertex count in the file.
+//
+//       Large ascii files are parsed in chunks, one job each, on `_job_system_in` when provided;
+//       see RunJobPerIndex(...) in job_system.h. The calling thread parses the file otherwise.
+//
+//       `_element_data_type_out` is the smallest element type able to index the vertices; pack
+//       `_buffer_elements_array_out` to it with PackElements(...) in mesh_tools.h before upload.
+//       `_meshlets_out` partitions the elements for CullMeshlets(...) in meshlet.h, and
+//       `_bounding_volume_out` bounds the positions (see bounds.h).
+//
+//       Meshes with normals and texture coordinates are given a MikkTSpace TANGENT attribute at
+//       `_tangent_attribute_index_in`, four floats with the bitangent sign as w, after the
+//       other attributes. Vertices are split where their tangent spaces differ; see
+//       GenerateTangents(...) in tangent_space.h.
+//
+//       When `_use_cooked_mesh_in` is set, the model is loaded from `<file>.cmesh` if that file
+//       was cooked from the current contents of the PLY file. Otherwise the PLY file is parsed
+//       and the cooked mesh is (re)written beside it. See cooked_mesh.h.
+void
+LoadModelFromPlyFile(
+  bool&                                        _success_out,
+  const GLuint&&                               _vertex_array_object_id_in,
+  const char* const                            _ply_file_path_in,
+  const GLuint&&                               _position_attribute_index_in,
+  const GLuint&&                               _normal_attribute_index_in,
+  const GLuint&&                               _texture_coordinates_attribute_index_in,
+  const GLuint&&                               _tangent_attribute_index_in,
+  size_t&                                      _vertex_count_out,
+  std::vector<float>&                          _buffer_data_out,
+  std::vector<GLuint>&                         _buffer_elements_array_out,
+  GLenum&                                      _element_data_type_out,
+  std::vector<Meshlet>&                        _meshlets_out,
+  BoundingVolume&                              _bounding_volume_out,
+  std::vector<glt::VertexDataType>&            _vertex_data_types_out,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out,
+  const bool&&                                 _use_cooked_mesh_in = true,
+  JobSystem* const                             _job_system_in      = nullptr);
+
+// Note: Accepts `v`, `vt`, `vn` and `f` statements; objects, groups, smoothing groups and
+//       materials are ignored. Faces may list `v`, `v/vt`, `v//vn` or `v/vt/vn` corners, with
+//       negative (relative) indices. Faces with more than three corners are split into
+//       triangle fans, so polygons must be convex.
+//
+//       Each distinct v/vt/vn triple becomes one vertex. Vertices are laid out as in
+//       LoadModelFromPlyFile(...): position, then normal and texture coordinates when any face
+//       references them. Corners without them are zero filled.
+//
+//       Outputs and cooked mesh handling are as in LoadModelFromPlyFile(...), so the two
+//       loaders are interchangeable.
+void
+LoadModelFromObjFile(
+  bool&                                        _success_out,
+  const GLuint&&                               _vertex_array_object_id_in,
+  const char* const                            _obj_file_path_in,
+  const GLuint&&                               _position_attribute_index_in,
+  const GLuint&&                               _normal_attribute_index_in,
+  const GLuint&&                               _texture_coordinates_attribute_index_in,
+  const GLuint&&                               _tangent_attribute_index_in,
+  size_t&                                      _vertex_count_out,
+  std::vector<float>&                          _buffer_data_out,
+  std::vector<GLuint>&                         _buffer_elements_array_out,
+  GLenum&                                      _element_data_type_out,
+  std::vector<Meshlet>&                        _meshlets_out,
+  BoundingVolume&                              _bounding_volume_out,
+  std::vector<glt::VertexDataType>&            _vertex_data_types_out,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out,
+  const bool&&                                 _use_cooked_mesh_in = true);
+
+// Note: Imports every triangle primitive of a binary glTF 2.0 file (see gltf.h) as one mesh.
+//       The POSITION, NORMAL and TEXCOORD_0 attributes are converted to interleaved floats and
+//       laid out as in LoadModelFromObjFile(...); primitives without normals or texture
+//       coordinates are zero filled where others have them.
+//
+//       glTF places the texture coordinate origin at the top left of the image. Texture
+//       coordinates are flipped on import (v' = 1 - v) onto the bottom left origin of OpenGL
+//       and the other importers, so models may be drawn with any texture loaded by this engine.
+//
+//       Outputs and cooked mesh handling are as in LoadModelFromPlyFile(...). Unlike
+//       LoadModelFromGlbFile(...) in gltf.h, which uploads the file as-is, the vertex data is
+//       copied, welded and optimized.
+void
+LoadModelFromGlbFile(
+  bool&                                        _success_out,
+  const GLuint&&                               _vertex_array_object_id_in,
+  const char* const                            _glb_file_path_in,
+  const GLuint&&                               _position_attribute_index_in,
+  const GLuint&&                               _normal_attribute_index_in,
+  const GLuint&&                               _texture_coordinates_attribute_index_in,
+  const GLuint&&                               _tangent_attribute_index_in,
+  size_t&                                      _vertex_count_out,
+  std::vector<float>&                          _buffer_data_out,
+  std::vector<GLuint>&                         _buffer_elements_array_out,
+  GLenum&                                      _element_data_type_out,
+  std::vector<Meshlet>&                        _meshlets_out,
+  BoundingVolume&                              _bounding_volume_out,
+  std::vector<glt::VertexDataType>&            _vertex_data_types_out,
+  std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_out,
+  const bool&&                                 _use_cooked_mesh_in = true);
+
+#endif // model_import_h
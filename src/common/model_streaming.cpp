@@ -0,0 +1,456 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "model_streaming.h"
+
+#include "logging.h"
+#include "mesh_tools.h"
+#include "model_import.h"
+#include "timer.h"
+
+struct ModelLoad
+{
+    std::atomic<ModelLoadStatus> status = ModelLoadStatus::LOADING;
+
+    std::string           file_path;
+    GLuint                vertex_array_object_id = 0;
+    BufferedModel*        model                  = nullptr;
+    ModelLoadOptions      options;
+    ModelUploadedCallback on_uploaded;
+
+    // Note: Written by the loading job, read by the render thread once the load is queued for
+    //       upload, and released after the upload.
+    size_t                                      vertex_count = 0;
+    std::vector<unsigned char>                  vertex_data;
+    std::vector<glt::VertexAttributeDescriptor> vertex_attribute_pointers;
+    std::vector<unsigned char>                  element_data;
+    size_t                                      element_count     = 0;
+    GLenum                                      element_data_type = GL_UNSIGNED_INT;
+    std::vector<MeshLod>                        levels_of_detail;
+    std::vector<Meshlet>                        meshlets;
+    BoundingVolume                              bounding_volume;
+};
+
+ModelLoadStatus
+ModelLoadHandle::GetStatus() const noexcept
+{
+    assert(nullptr != load);
+    return load->status;
+}
+
+bool
+ModelLoadHandle::IsDone() const noexcept
+{
+    const ModelLoadStatus status = GetStatus();
+    return (ModelLoadStatus::UPLOADED == status) || (ModelLoadStatus::FAILED == status);
+}
+
+// Note: Runs on a worker of `_job_system_in`; does everything to the model that does not need
+//       the OpenGL context.
+static void
+PrepareModelForUpload(bool& _success_out, JobSystem* const _job_system_in, ModelLoad& _load_in_out)
+{
+    _success_out = false;
+
+    size_t                                      vertex_count = 0;
+    std::vector<float>                          buffer_data;
+    std::vector<GLuint>                         buffer_elements_array;
+    std::vector<glt::VertexDataType>            vertex_data_types;
+    std::vector<glt::VertexAttributeDescriptor> vertex_attribute_pointers;
+
+    // Note: Large ascii PLY files are parsed in chunks on the streamer's own pool, waiting only
+    //       on those chunks; see RunJobPerIndex(...) in job_system.h.
+    std::string extension = std::filesystem::path(_load_in_out.file_path).extension().string();
+    std::transform(extension.begin(),
+                   extension.end(),
+                   extension.begin(),
+                   [](const unsigned char _character_in)
+                   { return static_cast<char>(std::tolower(_character_in)); });
+    if (".ply" == extension)
+    {
+        LoadModelFromPlyFile(_success_out,
+                             std::move(_load_in_out.vertex_array_object_id),
+                             _load_in_out.file_path.c_str(),
+                             std::move(_load_in_out.options.position_attribute_index),
+                             std::move(_load_in_out.options.normal_attribute_index),
+                             std::move(_load_in_out.options.texture_coordinates_attribute_index),
+                             std::move(_load_in_out.options.tangent_attribute_index),
+                             vertex_count,
+                             buffer_data,
+                             buffer_elements_array,
+                             _load_in_out.element_data_type,
+                             _load_in_out.meshlets,
+                             _load_in_out.bounding_volume,
+                             vertex_data_types,
+                             vertex_attribute_pointers,
+                             true,
+                             _job_system_in);
+    }
+    else if (".obj" == extension)
+    {
+        LoadModelFromObjFile(_success_out,
+                             std::move(_load_in_out.vertex_array_object_id),
+                             _load_in_out.file_path.c_str(),
+                             std::move(_load_in_out.options.position_attribute_index),
+                             std::move(_load_in_out.options.normal_attribute_index),
+                             std::move(_load_in_out.options.texture_coordinates_attribute_index),
+                             std::move(_load_in_out.options.tangent_attribute_index),
+                             vertex_count,
+                             buffer_data,
+                             buffer_elements_array,
+                             _load_in_out.element_data_type,
+                             _load_in_out.meshlets,
+                             _load_in_out.bounding_volume,
+                             vertex_data_types,
+                             vertex_attribute_pointers);
+    }
+    else if (".glb" == extension)
+    {
+        LoadModelFromGlbFile(_success_out,
+                             std::move(_load_in_out.vertex_array_object_id),
+                             _load_in_out.file_path.c_str(),
+                             std::move(_load_in_out.options.position_attribute_index),
+                             std::move(_load_in_out.options.normal_attribute_index),
+                             std::move(_load_in_out.options.texture_coordinates_attribute_index),
+                             std::move(_load_in_out.options.tangent_attribute_index),
+                             vertex_count,
+                             buffer_data,
+                             buffer_elements_array,
+                             _load_in_out.element_data_type,
+                             _load_in_out.meshlets,
+                             _load_in_out.bounding_volume,
+                             vertex_data_types,
+                             vertex_attribute_pointers);
+    }
+    else
+    {
+        std::stringstream ss;
+        ss << "Unsupported model file extension: " << _load_in_out.file_path;
+        Log_e(ss);
+        return;
+    }
+
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    if (0 == vertex_count)
+    {
+        _success_out = false;
+        Log_e("The model has no vertices.");
+        return;
+    }
+
+    if (1 < _load_in_out.options.max_lod_count)
+    {
+        size_t position_offset = 0;
+        for (auto& descriptor : vertex_attribute_pointers)
+        {
+            if (glt::VertexDataType::POSITION == descriptor.vertex_data_type)
+            {
+                position_offset = reinterpret_cast<uintptr_t>(
+                                    descriptor.first_component_byte_offset) /
+                                  sizeof(float);
+            }
+        }
+
+        GenerateLodChain(_success_out,
+                         buffer_data,
+                         buffer_data.size() / vertex_count,
+                         position_offset,
+                         vertex_count,
+                         std::move(_load_in_out.options.max_lod_count),
+                         0.5f,
+                         std::numeric_limits<float>::max(),
+                         buffer_elements_array,
+                         _load_in_out.levels_of_detail);
+
+        if (false == _success_out)
+        {
+            Log_e("Unable to generate levels of detail.");
+            return;
+        }
+    }
+
+    if (true == _load_in_out.options.quantize_vertices)
+    {
+        VertexQuantizationReport quantization_report;
+        QuantizeVertices(_success_out,
+                         PositionQuantization::HALF_FLOAT,
+                         vertex_count,
+                         buffer_data,
+                         vertex_attribute_pointers,
+                         _load_in_out.vertex_data,
+                         _load_in_out.vertex_attribute_pointers,
+                         quantization_report);
+
+        if (false == _success_out)
+        {
+            Log_e("Unable to quantize model.");
+            return;
+        }
+    }
+    else
+    {
+        _load_in_out.vertex_data.resize(buffer_data.size() * sizeof(float));
+        std::memcpy(_load_in_out.vertex_data.data(),
+                    buffer_data.data(),
+                    _load_in_out.vertex_data.size());
+        _load_in_out.vertex_attribute_pointers.swap(vertex_attribute_pointers);
+    }
+
+    PackElements(_success_out,
+                 buffer_elements_array,
+                 std::move(_load_in_out.element_data_type),
+                 _load_in_out.element_data);
+
+    if (false == _success_out)
+    {
+        Log_e("Unable to pack element buffer.");
+        return;
+    }
+
+    _load_in_out.vertex_count  = vertex_count;
+    _load_in_out.element_count = buffer_elements_array.size();
+}
+
+// Note: Runs on the render thread.
+static void
+UploadModel(bool& _success_out, ModelLoad& _load_in_out)
+{
+    BufferedModel& model     = *_load_in_out.model;
+    const GLenum   draw_type = GL_TRIANGLES;
+
+    const GLuint vbo_id = model.AddArrayBuffer(
+      _success_out,
+      _load_in_out.vertex_data.data(),
+      _load_in_out.vertex_data.size(),
+      static_cast<GLsizei>(_load_in_out.vertex_count),
+      GL_STATIC_DRAW,
+      std::move(draw_type),
+      _load_in_out.vertex_attribute_pointers);
+
+    if (false == _success_out)
+    {
+        Log_e("Unable to create vertex buffer.");
+        return;
+    }
+
+    for (auto& descriptor : _load_in_out.vertex_attribute_pointers)
+    {
+        model.EnableVertexAttribute(_success_out, std::move(descriptor.vertex_attribute_index));
+        if (false == _success_out)
+        {
+            Log_e("Unable to enable vertex attribute.");
+            return;
+        }
+    }
+
+    model.AddElementBuffer(_success_out,
+                           _load_in_out.element_data.data(),
+                           _load_in_out.element_data.size(),
+                           static_cast<GLsizei>(_load_in_out.element_count),
+                           std::move(_load_in_out.element_data_type),
+                           GL_STATIC_DRAW,
+                           std::move(draw_type));
+
+    if (false == _success_out)
+    {
+        Log_e("Unable to add element buffer.");
+        return;
+    }
+
+    if (0 != _load_in_out.levels_of_detail.size())
+    {
+        model.SetLevelsOfDetail(_success_out, _load_in_out.levels_of_detail);
+        if (false == _success_out)
+        {
+            Log_e("Unable to set levels of detail.");
+            return;
+        }
+    }
+
+    // Note: Meshlets index the full resolution elements, which lead the element buffer.
+    model.SetMeshlets(_success_out, _load_in_out.meshlets);
+    if (false == _success_out)
+    {
+        Log_e("Unable to set meshlets.");
+        return;
+    }
+
+    model.SetBoundingVolume(_load_in_out.bounding_volume);
+
+    if (nullptr != _load_in_out.on_uploaded)
+    {
+        _load_in_out.on_uploaded(_success_out, vbo_id);
+        if (false == _success_out)
+        {
+            Log_e("Unable to finish setting up uploaded model.");
+            return;
+        }
+    }
+
+    _success_out = true;
+}
+
+ModelStreamer::~ModelStreamer()
+{
+    Stop();
+}
+
+void
+ModelStreamer::Start(bool& _success_out, const size_t&& _thread_count_in)
+{
+    job_system.Start(_success_out, std::move(_thread_count_in));
+    if (false == _success_out)
+    {
+        Log_e("Unable to start the model streaming job system.");
+        return;
+    }
+}
+
+void
+ModelStreamer::Stop() noexcept
+{
+    job_system.Stop();
+
+    std::lock_guard<std::mutex> lock(loaded_models_mutex);
+    loaded_models.clear();
+}
+
+void
+ModelStreamer::LoadModel(bool&                   _success_out,
+                         const char* const       _file_path_in,
+                         BufferedModel&          _model_in_out,
+                         const ModelLoadOptions& _options_in,
+                         ModelUploadedCallback&& _on_uploaded_in,
+                         ModelLoadHandle&        _handle_out)
+{
+    _success_out = false;
+    if (0 == job_system.GetThreadCount())
+    {
+        Log_e("The model streamer has not been started.");
+        return;
+    }
+
+    if (nullptr == _file_path_in)
+    {
+        Log_e("No model file path was provided.");
+        return;
+    }
+
+    std::shared_ptr<ModelLoad> load = std::make_shared<ModelLoad>();
+    _model_in_out.AddVertexArrayObject(_success_out, load->vertex_array_object_id);
+    if (false == _success_out)
+    {
+        Log_e("Unable to add a vertex array object.");
+        return;
+    }
+
+    load->file_path   = _file_path_in;
+    load->model       = &_model_in_out;
+    load->options     = _options_in;
+    load->on_uploaded = std::move(_on_uploaded_in);
+    _handle_out.load  = load;
+
+    loading_model_count.fetch_add(1);
+    job_system.Submit(
+      [this, load]()
+      {
+          bool success = false;
+          PrepareModelForUpload(success, &job_system, *load);
+          if (false == success)
+          {
+              std::stringstream ss;
+              ss << "Unable to load model: " << load->file_path;
+              Log_e(ss);
+              load->status = ModelLoadStatus::FAILED;
+          }
+          else
+          {
+              load->status = ModelLoadStatus::AWAITING_UPLOAD;
+
+              std::lock_guard<std::mutex> lock(loaded_models_mutex);
+              loaded_models.push_back(load);
+          }
+
+          loading_model_count.fetch_sub(1);
+      });
+
+    _success_out = true;
+}
+
+void
+ModelStreamer::UploadLoadedModels(const size_t&&     _max_upload_bytes_in,
+                                  const float&&      _max_upload_milliseconds_in,
+                                  ModelUploadReport& _report_out) noexcept
+{
+    _report_out = {};
+
+    Timer timer;
+    timer.StartTimer();
+    while (true)
+    {
+        std::shared_ptr<ModelLoad> load;
+        {
+            std::lock_guard<std::mutex> lock(loaded_models_mutex);
+            if (true == loaded_models.empty())
+            {
+                break;
+            }
+
+            const size_t upload_bytes = loaded_models.front()->vertex_data.size() +
+                                        loaded_models.front()->element_data.size();
+            if ((0 != _report_out.uploaded_model_count) &&
+                (((_report_out.uploaded_bytes + upload_bytes) > _max_upload_bytes_in) ||
+                 (_report_out.elapsed_milliseconds >= _max_upload_milliseconds_in)))
+            {
+                break;
+            }
+
+            load = loaded_models.front();
+            loaded_models.pop_front();
+        }
+
+        const size_t upload_bytes = load->vertex_data.size() + load->element_data.size();
+
+        bool success = false;
+        UploadModel(success, *load);
+        if (false == success)
+        {
+            std::stringstream ss;
+            ss << "Unable to upload model: " << load->file_path;
+            Log_e(ss);
+            load->status = ModelLoadStatus::FAILED;
+        }
+        else
+        {
+            load->status = ModelLoadStatus::UPLOADED;
+        }
+
+        // Note: The handle outlives the CPU copy of the mesh.
+        std::vector<unsigned char>().swap(load->vertex_data);
+        std::vector<unsigned char>().swap(load->element_data);
+        std::vector<glt::VertexAttributeDescriptor>().swap(load->vertex_attribute_pointers);
+        std::vector<MeshLod>().swap(load->levels_of_detail);
+        std::vector<Meshlet>().swap(load->meshlets);
+        load->on_uploaded = nullptr;
+
+        _report_out.uploaded_model_count++;
+        _report_out.uploaded_bytes += upload_bytes;
+
+        timer.StopTimer();
+        timer.TimerElapsedMs(_report_out.elapsed_milliseconds);
+    }
+
+    timer.StopTimer();
+    timer.TimerElapsedMs(_report_out.elapsed_milliseconds);
+
+    _report_out.loading_model_count = loading_model_count;
+    {
+        std::lock_guard<std::mutex> lock(loaded_models_mutex);
+        _report_out.awaiting_upload_model_count = loaded_models.size();
+    }
+}
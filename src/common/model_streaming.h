@@ -0,0 +1,142 @@
+#ifndef model_streaming_h
+#define model_streaming_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "job_system.h"
+#include "model.h"
+
+//
+// Note: Loads models without blocking the render thread. Files are parsed, quantized, reduced to
+//       levels of detail and packed on a JobSystem; the finished CPU-side meshes wait in a queue
+//       until the render thread uploads them, a few per frame:
+//
+//       ModelStreamer   model_streamer;
+//       ModelLoadHandle handle;
+//       model_streamer.Start(success, 0);
+//       model_streamer.LoadModel(success, "monkey.ply", model, {}, nullptr, handle);
+//
+//       // Once per frame, on the render thread:
+//       model_streamer.UploadLoadedModels(8 << 20, 2.0f, upload_report);
+//       if (ModelLoadStatus::UPLOADED == handle.GetStatus())
+//       {
+//           model.CullMeshlets(model_view_projection, camera_position, culling_statistics);
+//           model.Draw();
+//       }
+//
+
+enum class ModelLoadStatus
+{
+    LOADING = 0,
+    AWAITING_UPLOAD,
+    UPLOADED,
+    FAILED
+};
+
+struct ModelLoadOptions
+{
+    // Note: Attribute indices from the shader layout declarations.
+    GLuint position_attribute_index            = 0;
+    GLuint normal_attribute_index              = 1;
+    GLuint texture_coordinates_attribute_index = 2;
+    GLuint tangent_attribute_index             = 3;
+
+    // Note: Positions are stored as half floats and texture coordinates as normalized shorts;
+    //       see QuantizeVertices(...) in mesh_tools.h.
+    bool quantize_vertices = true;
+
+    // Note: Including the full resolution elements; one disables GenerateLodChain(...).
+    size_t max_lod_count = 5;
+};
+
+struct ModelUploadReport
+{
+    size_t uploaded_model_count = 0;
+    size_t uploaded_bytes       = 0;
+    float  elapsed_milliseconds = 0.0f;
+
+    // Note: Models still being loaded, and models loaded but left for a later frame.
+    size_t loading_model_count         = 0;
+    size_t awaiting_upload_model_count = 0;
+};
+
+// Note: Called with the id of the array buffer the model was uploaded to.
+typedef std::function<void(bool& _success_out, const GLuint& _vbo_id_in)> ModelUploadedCallback;
+
+// Note: Defined in model_streaming.cpp; shared by the handle, the job loading it and the upload
+//       queue.
+struct ModelLoad;
+
+// Note: Observes one model load. Copies observe the same load.
+struct ModelLoadHandle
+{
+    ModelLoadStatus
+    GetStatus() const noexcept;
+
+    // Note: True once the model was uploaded or failed to load.
+    bool
+    IsDone() const noexcept;
+
+  private:
+    friend struct ModelStreamer;
+
+    std::shared_ptr<ModelLoad> load;
+};
+
+struct ModelStreamer
+{
+    ModelStreamer() = default;
+    ~ModelStreamer();
+
+    // Note: Zero selects std::thread::hardware_concurrency() workers.
+    void
+    Start(bool& _success_out, const size_t&& _thread_count_in);
+
+    // Note: Waits for the loads in progress. Models not yet uploaded are discarded and keep the
+    //       AWAITING_UPLOAD status.
+    void
+    Stop() noexcept;
+
+    // Note: Call from the render thread: a vertex array object is added to `_model_in_out`
+    //       immediately, its buffers once uploaded. `_model_in_out` must outlive the load, or
+    //       the streamer must be stopped first.
+    //
+    //       PLY (.ply), OBJ (.obj) and binary glTF (.glb) files are accepted, with cooked meshes
+    //       used and written as by the importers in model_import.h. `_on_uploaded_in`, when set,
+    //       is called on the render thread after the upload with the id of the array buffer, to
+    //       add textures, uniforms and such; a model whose callback fails is marked FAILED.
+    void
+    LoadModel(bool&                   _success_out,
+              const char* const       _file_path_in,
+              BufferedModel&          _model_in_out,
+              const ModelLoadOptions& _options_in,
+              ModelUploadedCallback&& _on_uploaded_in,
+              ModelLoadHandle&        _handle_out);
+
+    // Note: Call once per frame from the render thread. Uploads loaded models in the order they
+    //       finished loading until either budget is spent; the first model is always uploaded,
+    //       so that models larger than `_max_upload_bytes_in` are not starved. Models are
+    //       uploaded whole; a budget smaller than the largest model only bounds the frame to one.
+    //
+    //       Failures are logged and reported through each model's handle.
+    void
+    UploadLoadedModels(const size_t&&     _max_upload_bytes_in,
+                       const float&&      _max_upload_milliseconds_in,
+                       ModelUploadReport& _report_out) noexcept;
+
+  private:
+    ModelStreamer(const ModelStreamer&) = delete;
+
+    ModelStreamer
+    operator=(const ModelStreamer&) = delete;
+
+    JobSystem job_system;
+
+    std::mutex                             loaded_models_mutex;
+    std::deque<std::shared_ptr<ModelLoad>> loaded_models;
+    std::atomic<size_t>                    loading_model_count = 0;
+};
+
+#endif // model_streaming_h
@@ -25,11 +25,26 @@
 #define _ENGINE_PLATFORM_ANDRIOD_ 1
 #endif
 
+// Note: SSE2 is part of x86-64. AVX is additionally enabled by /arch:AVX (or above) and -mavx,
+//       AVX2 by /arch:AVX2 and -mavx2. The build scripts pass /arch:AVX2 (-mavx2), so the
+//       minimum CPU is Intel Haswell / AMD Excavator.
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__)
+#define _ENGINE_SIMD_SSE_ 1
+#endif
+#if defined(_ENGINE_SIMD_SSE_) && defined(__AVX__)
+#define _ENGINE_SIMD_AVX_ 1
+#endif
+#if defined(_ENGINE_SIMD_AVX_) && defined(__AVX2__)
+#define _ENGINE_SIMD_AVX2_ 1
+#endif
+
 // clang-format off
+#if defined(_ENGINE_PLATFORM_WINDOWS_)
 #define WIN32_LEAN_AND_MEAN 1
 #define WIN32_EXTRA_LEAN 1
 #include "Windows.h"
 #include "wingdi.h"
+#endif
 
 // [ cfarvin::REMOVE ] Remove these include statements AND the entire include/GLFW folder And the 4
 //                     files with "glew" in their titles in the include/GL folder.
@@ -38,34 +53,55 @@
 
 #include "KHR/khrplatform.h"
 #include "GL/glcorearb.h"
+#if defined(_ENGINE_PLATFORM_WINDOWS_)
 #include "GL/wglext.h"
+#endif
 #include "GL/glext.h"
 
 #include "stb/stb_image.h"
 #include "stb/stb_image_write.h"
 
 #include "glm/glm.hpp"
+#if defined(_MSC_VER)
 #pragma warning(disable : 4201)
+#endif
 #include "glm/gtc/type_ptr.hpp" // glm::value_ptr and glm::translate
+#if defined(_MSC_VER)
 #pragma warning(default : 4201)
+#endif
 // clang-format on
 
 #include "assert.h"
 #include "stdint.h"
 #include "time.h"
 
+#if defined(_ENGINE_SIMD_SSE_)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <bitset>
+#include <charconv>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <sstream>
 #include <stack>
 #include <stdio.h>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -0,0 +1,545 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "tangent_space.h"
+
+#include "job_system.h"
+#include "logging.h"
+
+constexpr size_t tangent_component_count = 4;
+
+// Note: Below this many vertices per chunk, scheduling a job costs more than it saves.
+constexpr size_t tangent_min_parallel_chunk_vertices = 1 << 15;
+
+// Note: Offsets are in floats from the start of a vertex.
+struct TangentVertexLayout
+{
+    size_t floats_per_vertex         = 0;
+    size_t position_offset           = 0;
+    size_t normal_offset             = 0;
+    size_t texture_coordinate_offset = 0;
+    size_t tangent_offset            = 0;
+    bool   has_tangent               = false;
+};
+
+// Note: Corners of a vertex whose triangle tangents are further apart than this (90 degrees)
+//       are given separate vertices; see GenerateTangents(...).
+constexpr float tangent_split_min_cosine = 0.0f;
+
+// Note: A contiguous range of vertices, and the counts of its part of the report.
+struct TangentChunk
+{
+    size_t first_vertex = 0;
+    size_t end_vertex   = 0;
+
+    size_t degenerate_triangle_count = 0;
+    size_t fallback_vertex_count     = 0;
+    size_t mirrored_vertex_count     = 0;
+};
+
+// Note: The tangent frames of every vertex, one per group of its corners; see
+//       GroupChunkCorners(...). Vertex v owns the group slots from
+//       vertex_corner_offsets[v] + v, one more than it has corners, such that a vertex no
+//       triangle references still has one.
+struct TangentGroups
+{
+    std::vector<glm::vec4> tangents;
+    std::vector<GLuint>    group_counts;
+    std::vector<GLuint>    corner_groups;
+};
+
+static void
+GetTangentVertexLayout(
+  bool&                                              _success_out,
+  const std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_in,
+  TangentVertexLayout&                               _layout_out)
+{
+    _success_out = false;
+
+    if (0 == _vertex_attribute_pointers_in.size())
+    {
+        Log_e("No vertex attributes to generate tangents for.");
+        return;
+    }
+
+    const size_t stride_bytes     = _vertex_attribute_pointers_in[0].byte_stride_between_elements;
+    _layout_out.floats_per_vertex = stride_bytes / sizeof(float);
+
+    bool has_position           = false;
+    bool has_normal             = false;
+    bool has_texture_coordinate = false;
+    for (auto& descriptor : _vertex_attribute_pointers_in)
+    {
+        const size_t offset = reinterpret_cast<uintptr_t>(descriptor.first_component_byte_offset) /
+                              sizeof(float);
+        if ((GL_FLOAT != descriptor.data_type) ||
+            (GL_FALSE != descriptor.should_be_normalized_by_gpu) ||
+            (stride_bytes != static_cast<size_t>(descriptor.byte_stride_between_elements)) ||
+            ((offset + descriptor.component_count) > _layout_out.floats_per_vertex))
+        {
+            Log_e("Tangents require interleaved, unnormalized float vertex attributes.");
+            return;
+        }
+
+        GLint expected_component_count = descriptor.component_count;
+        switch (descriptor.vertex_data_type)
+        {
+            case glt::VertexDataType::POSITION:
+            {
+                expected_component_count    = 3;
+                _layout_out.position_offset = offset;
+                has_position                = true;
+                break;
+            }
+            case glt::VertexDataType::NORMAL:
+            {
+                expected_component_count  = 3;
+                _layout_out.normal_offset = offset;
+                has_normal                = true;
+                break;
+            }
+            case glt::VertexDataType::TEXTURE:
+            {
+                expected_component_count              = 2;
+                _layout_out.texture_coordinate_offset = offset;
+                has_texture_coordinate                = true;
+                break;
+            }
+            case glt::VertexDataType::TANGENT:
+            {
+                expected_component_count   = tangent_component_count;
+                _layout_out.tangent_offset = offset;
+                _layout_out.has_tangent    = true;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        if (expected_component_count != descriptor.component_count)
+        {
+            Log_e("Unsupported vertex attribute layout for tangent generation.");
+            return;
+        }
+    }
+
+    if ((false == has_position) || (false == has_normal) || (false == has_texture_coordinate))
+    {
+        Log_e("Tangents require POSITION, NORMAL and TEXTURE vertex attributes.");
+        return;
+    }
+
+    _success_out = true;
+}
+
+static inline glm::vec3
+ProjectOntoPlane(const glm::vec3& _vector_in, const glm::vec3& _plane_normal_in)
+{
+    return _vector_in - (_plane_normal_in * glm::dot(_plane_normal_in, _vector_in));
+}
+
+static inline glm::vec3
+NormalizeOrZero(const glm::vec3& _vector_in)
+{
+    const float length = glm::length(_vector_in);
+    return (0.0f < length) ? (_vector_in / length) : glm::vec3(0.0f);
+}
+
+// Note: Any unit vector perpendicular to `_normal_in`, after Duff et al., "Building an
+//       Orthonormal Basis, Revisited" (JCGT, 2017).
+static inline glm::vec3
+PerpendicularTangent(const glm::vec3& _normal_in)
+{
+    const float sign = std::copysign(1.0f, _normal_in.z);
+    const float a    = -1.0f / (sign + _normal_in.z);
+    const float b    = _normal_in.x * _normal_in.y * a;
+    return glm::vec3(1.0f + (sign * _normal_in.x * _normal_in.x * a),
+                     sign * b,
+                     -sign * _normal_in.x);
+}
+
+// Note: Groups the corners of each vertex of `_chunk_in_out`, listed for it in
+//       `_vertex_corners_in`, as MikkTSpace does: corners share a group when their triangles
+//       have the same texture space orientation and tangents within tangent_split_min_cosine
+//       of the group's. Corners are visited in order, so the groups do not depend on the
+//       chunks. Each group is given the tangent of its corners and their orientation as w.
+static void
+GroupChunkCorners(const TangentVertexLayout& _layout_in,
+                  const float* const         _vertex_data_in,
+                  const std::vector<GLuint>& _elements_in,
+                  const std::vector<size_t>& _vertex_corner_offsets_in,
+                  const std::vector<GLuint>& _vertex_corners_in,
+                  TangentGroups&             _groups_in_out,
+                  TangentChunk&              _chunk_in_out) noexcept
+{
+    const size_t floats_per_vertex = _layout_in.floats_per_vertex;
+    for (size_t vertex_index = _chunk_in_out.first_vertex; vertex_index < _chunk_in_out.end_vertex;
+         vertex_index++)
+    {
+        const float* const vertex = _vertex_data_in + (vertex_index * floats_per_vertex);
+        const glm::vec3    normal = NormalizeOrZero(
+          glm::make_vec3(vertex + _layout_in.normal_offset));
+
+        // Note: Sums are accumulated in the group slots, with the orientation as w.
+        glm::vec4* const group_tangents = &_groups_in_out.tangents[
+          _vertex_corner_offsets_in[vertex_index] + vertex_index];
+        GLuint           group_count    = 0;
+
+        bool has_degenerate_corner = false;
+        for (size_t corner_index = _vertex_corner_offsets_in[vertex_index];
+             corner_index < _vertex_corner_offsets_in[vertex_index + 1];
+             corner_index++)
+        {
+            const size_t  corner   = _vertex_corners_in[corner_index];
+            const size_t  triangle = corner / 3;
+            const GLuint* elements = &_elements_in[triangle * 3];
+
+            const float* const corner_vertex   = _vertex_data_in +
+                                               (elements[corner % 3] * floats_per_vertex);
+            const float* const next_vertex     = _vertex_data_in +
+                                             (elements[(corner + 1) % 3] * floats_per_vertex);
+            const float* const previous_vertex = _vertex_data_in +
+                                                 (elements[(corner + 2) % 3] * floats_per_vertex);
+
+            // Note: Directions of increasing u, scaled by the signed texture space area;
+            //       multiplying by its sign restores their direction on mirrored triangles.
+            const glm::vec3 position = glm::make_vec3(corner_vertex + _layout_in.position_offset);
+            const glm::vec3 edge_1   = glm::make_vec3(next_vertex + _layout_in.position_offset) -
+                                     position;
+            const glm::vec3 edge_2 = glm::make_vec3(previous_vertex + _layout_in.position_offset) -
+                                     position;
+
+            const glm::vec2 texture_coordinate = glm::make_vec2(
+              corner_vertex + _layout_in.texture_coordinate_offset);
+            const glm::vec2 texture_edge_1 = glm::make_vec2(
+                                               next_vertex + _layout_in.texture_coordinate_offset) -
+                                             texture_coordinate;
+            const glm::vec2 texture_edge_2 = glm::make_vec2(previous_vertex +
+                                                            _layout_in.texture_coordinate_offset) -
+                                             texture_coordinate;
+
+            const float signed_texture_area = (texture_edge_1.x * texture_edge_2.y) -
+                                              (texture_edge_1.y * texture_edge_2.x);
+            const float orientation = (0.0f < signed_texture_area) ? 1.0f : -1.0f;
+
+            // Note: Each triangle is counted once, by the vertex owning its first corner.
+            //       Degenerate corners join a group once the others are grouped.
+            const bool is_degenerate = (0.0f == signed_texture_area) ||
+                                       (glm::vec3(0.0f) == glm::cross(edge_1, edge_2));
+            if (true == is_degenerate)
+            {
+                if (0 == (corner % 3))
+                {
+                    _chunk_in_out.degenerate_triangle_count++;
+                }
+
+                has_degenerate_corner = true;
+                continue;
+            }
+
+            const glm::vec3 triangle_tangent = NormalizeOrZero(ProjectOntoPlane(
+              ((edge_1 * texture_edge_2.y) - (edge_2 * texture_edge_1.y)) * orientation,
+              normal));
+
+            const glm::vec3 projected_edge_1 = NormalizeOrZero(ProjectOntoPlane(edge_1, normal));
+            const glm::vec3 projected_edge_2 = NormalizeOrZero(ProjectOntoPlane(edge_2, normal));
+            const float     corner_angle     = std::acos(
+              std::clamp(glm::dot(projected_edge_1, projected_edge_2), -1.0f, 1.0f));
+
+            GLuint group = 0;
+            for (; group < group_count; group++)
+            {
+                const glm::vec3 group_tangent = NormalizeOrZero(
+                  glm::vec3(group_tangents[group]));
+                if ((orientation == group_tangents[group].w) &&
+                    ((glm::vec3(0.0f) == group_tangent) ||
+                     (glm::dot(group_tangent, triangle_tangent) >= tangent_split_min_cosine)))
+                {
+                    break;
+                }
+            }
+
+            if (group == group_count)
+            {
+                group_tangents[group] = glm::vec4(0.0f, 0.0f, 0.0f, orientation);
+                group_count++;
+            }
+
+            group_tangents[group] += glm::vec4(triangle_tangent * corner_angle, 0.0f);
+            _groups_in_out.corner_groups[corner] = group;
+        }
+
+        // Note: Vertices of degenerate triangles only, or of no triangle, keep one vertex.
+        if (0 == group_count)
+        {
+            group_tangents[0] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+            group_count       = 1;
+        }
+
+        if (true == has_degenerate_corner)
+        {
+            for (size_t corner_index = _vertex_corner_offsets_in[vertex_index];
+                 corner_index < _vertex_corner_offsets_in[vertex_index + 1];
+                 corner_index++)
+            {
+                const size_t corner = _vertex_corners_in[corner_index];
+                if (std::numeric_limits<GLuint>::max() == _groups_in_out.corner_groups[corner])
+                {
+                    _groups_in_out.corner_groups[corner] = 0;
+                }
+            }
+        }
+
+        for (GLuint group = 0; group < group_count; group++)
+        {
+            glm::vec3 tangent = NormalizeOrZero(
+              ProjectOntoPlane(glm::vec3(group_tangents[group]), normal));
+            if (glm::vec3(0.0f) == tangent)
+            {
+                tangent = (glm::vec3(0.0f) == normal) ? glm::vec3(1.0f, 0.0f, 0.0f)
+                                                      : PerpendicularTangent(normal);
+                _chunk_in_out.fallback_vertex_count++;
+            }
+
+            if (0.0f > group_tangents[group].w)
+            {
+                _chunk_in_out.mirrored_vertex_count++;
+            }
+
+            group_tangents[group] = glm::vec4(tangent, group_tangents[group].w);
+        }
+
+        _groups_in_out.group_counts[vertex_index] = group_count;
+    }
+}
+
+// Note: Writes one copy of each vertex of `_chunk_in` per group of its corners, with the
+//       tangent of that group, from `_first_output_vertices_in[vertex]` onwards.
+static void
+WriteChunkVertices(const TangentVertexLayout& _layout_in,
+                   const size_t&              _output_floats_per_vertex_in,
+                   const size_t&              _output_tangent_offset_in,
+                   const float* const         _vertex_data_in,
+                   const std::vector<size_t>& _vertex_corner_offsets_in,
+                   const TangentGroups&       _groups_in,
+                   const std::vector<size_t>& _first_output_vertices_in,
+                   const TangentChunk&        _chunk_in,
+                   float* const               _vertex_data_out) noexcept
+{
+    const size_t floats_per_vertex = _layout_in.floats_per_vertex;
+    for (size_t vertex_index = _chunk_in.first_vertex; vertex_index < _chunk_in.end_vertex;
+         vertex_index++)
+    {
+        const float* const     vertex = _vertex_data_in + (vertex_index * floats_per_vertex);
+        const glm::vec4* const group_tangents =
+          &_groups_in.tangents[_vertex_corner_offsets_in[vertex_index] + vertex_index];
+        for (GLuint group = 0; group < _groups_in.group_counts[vertex_index]; group++)
+        {
+            float* const output_vertex = _vertex_data_out +
+                                         ((_first_output_vertices_in[vertex_index] + group) *
+                                          _output_floats_per_vertex_in);
+            std::memcpy(output_vertex, vertex, floats_per_vertex * sizeof(float));
+
+            output_vertex[_output_tangent_offset_in]     = group_tangents[group].x;
+            output_vertex[_output_tangent_offset_in + 1] = group_tangents[group].y;
+            output_vertex[_output_tangent_offset_in + 2] = group_tangents[group].z;
+            output_vertex[_output_tangent_offset_in + 3] = group_tangents[group].w;
+        }
+    }
+}
+
+void
+GenerateTangents(bool&                                        _success_out,
+                 size_t&                                      _vertex_count_in_out,
+                 std::vector<GLuint>&                         _elements_in_out,
+                 const GLuint&&                               _tangent_attribute_index_in,
+                 std::vector<float>&                          _vertex_data_in_out,
+                 std::vector<glt::VertexDataType>&            _vertex_data_types_in_out,
+                 std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_in_out,
+                 TangentGenerationReport&                     _report_out,
+                 JobSystem* const                             _job_system_in)
+{
+    _report_out = {};
+
+    TangentVertexLayout layout;
+    GetTangentVertexLayout(_success_out, _vertex_attribute_pointers_in_out, layout);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    _success_out = false;
+    const size_t vertex_count = _vertex_count_in_out;
+    if (_vertex_data_in_out.size() != (vertex_count * layout.floats_per_vertex))
+    {
+        Log_e("Vertex data size does not match the vertex count and vertex stride.");
+        return;
+    }
+
+    if (0 != (_elements_in_out.size() % 3))
+    {
+        Log_e("Element count must be a multiple of three; meshes must be triangulated.");
+        return;
+    }
+
+    //
+    // Note: Lists the corners (3 * triangle + corner) of every vertex, in corner order, such
+    //       that each vertex may group its own corners without synchronization.
+    //
+    std::vector<size_t> vertex_corner_offsets(vertex_count + 1, 0);
+    for (auto& element : _elements_in_out)
+    {
+        if (element >= vertex_count)
+        {
+            std::stringstream ss;
+            ss << "Element " << element << " exceeds the vertex count (" << vertex_count << ").";
+            Log_e(ss);
+            return;
+        }
+
+        vertex_corner_offsets[element + 1]++;
+    }
+
+    for (size_t vertex_index = 0; vertex_index < vertex_count; vertex_index++)
+    {
+        vertex_corner_offsets[vertex_index + 1] += vertex_corner_offsets[vertex_index];
+    }
+
+    std::vector<GLuint> vertex_corners(_elements_in_out.size());
+    {
+        std::vector<size_t> vertex_corner_cursors(vertex_corner_offsets.begin(),
+                                                  vertex_corner_offsets.end() - 1);
+        for (size_t corner = 0; corner < _elements_in_out.size(); corner++)
+        {
+            vertex_corners[vertex_corner_cursors[_elements_in_out[corner]]++] = static_cast<GLuint>(
+              corner);
+        }
+    }
+
+    size_t chunk_count = (nullptr == _job_system_in) ? 1 : _job_system_in->GetThreadCount();
+    chunk_count        = std::min(chunk_count,
+                           std::max<size_t>(1,
+                                            vertex_count / tangent_min_parallel_chunk_vertices));
+
+    std::vector<TangentChunk> chunks(chunk_count);
+    for (size_t chunk_index = 0; chunk_index < chunk_count; chunk_index++)
+    {
+        chunks[chunk_index].first_vertex = (chunk_index * vertex_count) / chunk_count;
+        chunks[chunk_index].end_vertex   = ((chunk_index + 1) * vertex_count) / chunk_count;
+    }
+
+    TangentGroups groups;
+    groups.tangents.resize(_elements_in_out.size() + vertex_count);
+    groups.group_counts.resize(vertex_count, 0);
+    groups.corner_groups.resize(_elements_in_out.size(), std::numeric_limits<GLuint>::max());
+
+    const float* const input_vertex_data = _vertex_data_in_out.data();
+    RunJobPerIndex(_job_system_in,
+                   chunk_count,
+                   [&](const size_t& _chunk_index_in)
+                   {
+                       GroupChunkCorners(layout,
+                                         input_vertex_data,
+                                         _elements_in_out,
+                                         vertex_corner_offsets,
+                                         vertex_corners,
+                                         groups,
+                                         chunks[_chunk_index_in]);
+                   });
+
+    // Note: Each vertex is followed by its copies, one per additional group.
+    std::vector<size_t> first_output_vertices(vertex_count + 1, 0);
+    for (size_t vertex_index = 0; vertex_index < vertex_count; vertex_index++)
+    {
+        first_output_vertices[vertex_index + 1] = first_output_vertices[vertex_index] +
+                                                  groups.group_counts[vertex_index];
+    }
+
+    const size_t output_vertex_count = first_output_vertices[vertex_count];
+
+    // Note: Tangents are appended to each vertex unless the mesh already has them.
+    const size_t output_floats_per_vertex = (true == layout.has_tangent)
+                                              ? layout.floats_per_vertex
+                                              : (layout.floats_per_vertex +
+                                                 tangent_component_count);
+    const size_t output_tangent_offset    = (true == layout.has_tangent)
+                                              ? layout.tangent_offset
+                                              : layout.floats_per_vertex;
+
+    std::vector<float> output_vertex_data(output_vertex_count * output_floats_per_vertex);
+    RunJobPerIndex(_job_system_in,
+                   chunk_count,
+                   [&](const size_t& _chunk_index_in)
+                   {
+                       WriteChunkVertices(layout,
+                                          output_floats_per_vertex,
+                                          output_tangent_offset,
+                                          input_vertex_data,
+                                          vertex_corner_offsets,
+                                          groups,
+                                          first_output_vertices,
+                                          chunks[_chunk_index_in],
+                                          output_vertex_data.data());
+                   });
+
+    for (size_t corner = 0; corner < _elements_in_out.size(); corner++)
+    {
+        _elements_in_out[corner] = static_cast<GLuint>(
+          first_output_vertices[_elements_in_out[corner]] + groups.corner_groups[corner]);
+    }
+
+    _report_out.chunk_count        = chunk_count;
+    _report_out.split_vertex_count = output_vertex_count - vertex_count;
+    for (auto& chunk : chunks)
+    {
+        _report_out.degenerate_triangle_count += chunk.degenerate_triangle_count;
+        _report_out.fallback_vertex_count += chunk.fallback_vertex_count;
+        _report_out.mirrored_vertex_count += chunk.mirrored_vertex_count;
+    }
+
+    _vertex_data_in_out.swap(output_vertex_data);
+    _vertex_count_in_out = output_vertex_count;
+
+    if (true == layout.has_tangent)
+    {
+        _success_out = true;
+        return;
+    }
+
+    // Note: Descriptors are immutable; every one is rebuilt with the wider stride.
+    const GLsizei output_stride_bytes = static_cast<GLsizei>(output_floats_per_vertex *
+                                                             sizeof(float));
+    std::vector<glt::VertexAttributeDescriptor> vertex_attribute_pointers;
+    for (auto& descriptor : _vertex_attribute_pointers_in_out)
+    {
+        vertex_attribute_pointers.push_back(
+          glt::VertexAttributeDescriptor(std::move(descriptor.vertex_array_object_id),
+                                         std::move(descriptor.vertex_attribute_index),
+                                         std::move(descriptor.component_count),
+                                         std::move(descriptor.data_type),
+                                         std::move(descriptor.should_be_normalized_by_gpu),
+                                         std::move(output_stride_bytes),
+                                         std::move(descriptor.first_component_byte_offset),
+                                         std::move(descriptor.vertex_data_type)));
+    }
+
+    const GLvoid* tangent_byte_offset = reinterpret_cast<const GLvoid*>(output_tangent_offset *
+                                                                         sizeof(float));
+    vertex_attribute_pointers.push_back(
+      glt::VertexAttributeDescriptor(std::move(_vertex_attribute_pointers_in_out[0]
+                                                 .vertex_array_object_id),
+                                     std::move(_tangent_attribute_index_in),
+                                     static_cast<GLint>(tangent_component_count),
+                                     GL_FLOAT,
+                                     GL_FALSE,
+                                     std::move(output_stride_bytes),
+                                     std::move(tangent_byte_offset),
+                                     glt::VertexDataType::TANGENT));
+    _vertex_attribute_pointers_in_out.swap(vertex_attribute_pointers);
+    _vertex_data_types_in_out.push_back(glt::VertexDataType::TANGENT);
+
+    _success_out = true;
+}
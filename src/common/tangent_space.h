@@ -0,0 +1,71 @@
+#ifndef tangent_space_h
+#define tangent_space_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "job_system.h"
+#include "vertex_layout.h"
+
+//
+// Note: Per-vertex tangent spaces for normal mapping, following Morten Mikkelsen's MikkTSpace,
+//       the convention most bakers (Blender, Substance, xNormal) write normal maps in:
+//
+//       - Each triangle contributes the directions of increasing u and v over its surface.
+//       - At each vertex those directions are projected onto the plane of the vertex normal and
+//         weighted by the angle of the triangle at that vertex.
+//       - The tangent is the normalized sum, and its w component the sign of the bitangent:
+//
+//         bitangent = tangent.w * cross(normal, tangent.xyz)
+//
+//       The shader should neither renormalize nor orthogonalize the interpolated tangent space,
+//       as MikkTSpace bakers do not.
+//
+//       As in MikkTSpace, a vertex is split where its triangles disagree: triangles with
+//       mirrored texture coordinates, and triangles whose tangents are more than 90 degrees
+//       apart, are given separate copies of the vertex, each with its own tangent space. The
+//       elements are rewritten to match.
+//
+struct TangentGenerationReport
+{
+    // Note: Vertices are processed in this many chunks, one job each.
+    size_t chunk_count = 0;
+
+    // Note: Triangles with zero area in position or texture space contribute no direction.
+    size_t degenerate_triangle_count = 0;
+
+    // Note: Vertices left without a direction, whose tangent is derived from the normal alone.
+    size_t fallback_vertex_count = 0;
+
+    // Note: Vertices whose tangent.w is -1.
+    size_t mirrored_vertex_count = 0;
+
+    // Note: Vertices added by splitting; see above.
+    size_t split_vertex_count = 0;
+};
+
+// Note: Adds a TANGENT attribute of four floats to the end of each vertex of
+//       `_vertex_data_in_out`, an interleaved float vertex buffer as produced by the model
+//       importers, and a matching descriptor at `_tangent_attribute_index_in`. Every descriptor is
+//       rewritten with the wider stride. A mesh that already has tangents has them rewritten,
+//       keeping its layout. POSITION, NORMAL and TEXTURE attributes are required.
+//
+//       Split vertices follow the vertex they were copied from, so `_vertex_count_in_out` may
+//       grow and `_elements_in_out` is renumbered; run before optimizing the mesh.
+//
+//       Vertices are processed in chunks, one job each, on `_job_system_in` when provided; see
+//       RunJobPerIndex(...) in job_system.h. The calling thread does the work otherwise.
+//       Results do not depend on the chunk count.
+void
+GenerateTangents(bool&                                        _success_out,
+                 size_t&                                      _vertex_count_in_out,
+                 std::vector<GLuint>&                         _elements_in_out,
+                 const GLuint&&                               _tangent_attribute_index_in,
+                 std::vector<float>&                          _vertex_data_in_out,
+                 std::vector<glt::VertexDataType>&            _vertex_data_types_in_out,
+                 std::vector<glt::VertexAttributeDescriptor>& _vertex_attribute_pointers_in_out,
+                 TangentGenerationReport&                     _report_out,
+                 JobSystem* const                             _job_system_in = nullptr);
+
+#endif // tangent_space_h
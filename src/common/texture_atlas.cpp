@@ -0,0 +1,602 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "texture_atlas.h"
+
+#include "fileio.h"
+#include "logging.h"
+
+// Note: Deeper grids waste more of the atlas on gutters than they save in bleeding.
+constexpr int texture_atlas_max_mip_safe_level_count = 8;
+
+struct AtlasRectangle
+{
+    int x      = 0;
+    int y      = 0;
+    int width  = 0;
+    int height = 0;
+};
+
+static inline bool
+IsAtlasRectangleContained(const AtlasRectangle& _inner_in, const AtlasRectangle& _outer_in)
+{
+    return (_inner_in.x >= _outer_in.x) && (_inner_in.y >= _outer_in.y) &&
+           ((_inner_in.x + _inner_in.width) <= (_outer_in.x + _outer_in.width)) &&
+           ((_inner_in.y + _inner_in.height) <= (_outer_in.y + _outer_in.height));
+}
+
+// Note: Splits every free rectangle the placed one overlaps into the (up to four) maximal
+//       rectangles around it, then drops free rectangles contained by another.
+static void
+SplitAtlasFreeRectangles(const AtlasRectangle&        _placed_rectangle_in,
+                         std::vector<AtlasRectangle>& _free_rectangles_in_out)
+{
+    const AtlasRectangle&       placed = _placed_rectangle_in;
+    std::vector<AtlasRectangle> split_rectangles;
+    for (size_t index = 0; index < _free_rectangles_in_out.size();)
+    {
+        const AtlasRectangle free = _free_rectangles_in_out[index];
+        if ((placed.x >= (free.x + free.width)) || ((placed.x + placed.width) <= free.x) ||
+            (placed.y >= (free.y + free.height)) || ((placed.y + placed.height) <= free.y))
+        {
+            index++;
+            continue;
+        }
+
+        if (placed.x > free.x)
+        {
+            split_rectangles.push_back({ free.x, free.y, placed.x - free.x, free.height });
+        }
+
+        if ((placed.x + placed.width) < (free.x + free.width))
+        {
+            split_rectangles.push_back({ placed.x + placed.width,
+                                         free.y,
+                                         (free.x + free.width) - (placed.x + placed.width),
+                                         free.height });
+        }
+
+        if (placed.y > free.y)
+        {
+            split_rectangles.push_back({ free.x, free.y, free.width, placed.y - free.y });
+        }
+
+        if ((placed.y + placed.height) < (free.y + free.height))
+        {
+            split_rectangles.push_back({ free.x,
+                                         placed.y + placed.height,
+                                         free.width,
+                                         (free.y + free.height) - (placed.y + placed.height) });
+        }
+
+        _free_rectangles_in_out[index] = _free_rectangles_in_out.back();
+        _free_rectangles_in_out.pop_back();
+    }
+
+    _free_rectangles_in_out.insert(_free_rectangles_in_out.end(),
+                                   split_rectangles.begin(),
+                                   split_rectangles.end());
+
+    for (size_t index = 0; index < _free_rectangles_in_out.size(); index++)
+    {
+        for (size_t other_index = index + 1; other_index < _free_rectangles_in_out.size();)
+        {
+            if (true == IsAtlasRectangleContained(_free_rectangles_in_out[other_index],
+                                                  _free_rectangles_in_out[index]))
+            {
+                _free_rectangles_in_out.erase(_free_rectangles_in_out.begin() + other_index);
+                continue;
+            }
+
+            if (true == IsAtlasRectangleContained(_free_rectangles_in_out[index],
+                                                  _free_rectangles_in_out[other_index]))
+            {
+                _free_rectangles_in_out.erase(_free_rectangles_in_out.begin() + index);
+                other_index = index + 1;
+                continue;
+            }
+
+            other_index++;
+        }
+    }
+}
+
+// Note: MaxRects, placing each rectangle, largest first, in the free rectangle it leaves the
+//       shortest side of.
+static bool
+TryPackAtlasRectangles(const std::vector<glm::ivec2>& _sizes_in,
+                       const std::vector<size_t>&     _packing_order_in,
+                       const int&                     _atlas_width_in,
+                       const int&                     _atlas_height_in,
+                       std::vector<glm::ivec2>&       _positions_out)
+{
+    std::vector<AtlasRectangle> free_rectangles = { { 0, 0, _atlas_width_in, _atlas_height_in } };
+    for (const size_t index : _packing_order_in)
+    {
+        const glm::ivec2& size = _sizes_in[index];
+
+        const AtlasRectangle* best_free_rectangle = nullptr;
+        int                   best_short_side     = std::numeric_limits<int>::max();
+        int                   best_long_side      = std::numeric_limits<int>::max();
+        for (const AtlasRectangle& free_rectangle : free_rectangles)
+        {
+            if ((size.x > free_rectangle.width) || (size.y > free_rectangle.height))
+            {
+                continue;
+            }
+
+            const int leftover_width  = free_rectangle.width - size.x;
+            const int leftover_height = free_rectangle.height - size.y;
+            const int short_side      = std::min(leftover_width, leftover_height);
+            const int long_side       = std::max(leftover_width, leftover_height);
+            if ((short_side < best_short_side) ||
+                ((short_side == best_short_side) && (long_side < best_long_side)))
+            {
+                best_free_rectangle = &free_rectangle;
+                best_short_side     = short_side;
+                best_long_side      = long_side;
+            }
+        }
+
+        if (nullptr == best_free_rectangle)
+        {
+            return false;
+        }
+
+        const AtlasRectangle placed_rectangle = { best_free_rectangle->x,
+                                                  best_free_rectangle->y,
+                                                  size.x,
+                                                  size.y };
+        _positions_out[index] = glm::ivec2(placed_rectangle.x, placed_rectangle.y);
+        SplitAtlasFreeRectangles(placed_rectangle, free_rectangles);
+    }
+
+    return true;
+}
+
+// Note: Doubles the shorter side, the width of a square atlas.
+static inline void
+GrowAtlas(int& _atlas_width_in_out, int& _atlas_height_in_out)
+{
+    if (_atlas_width_in_out <= _atlas_height_in_out)
+    {
+        _atlas_width_in_out *= 2;
+    }
+    else
+    {
+        _atlas_height_in_out *= 2;
+    }
+}
+
+void
+PackAtlasRectangles(bool&                          _success_out,
+                    const std::vector<glm::ivec2>& _sizes_in,
+                    const int&                     _max_dimension_in,
+                    std::vector<glm::ivec2>&       _positions_out,
+                    int&                           _atlas_width_out,
+                    int&                           _atlas_height_out)
+{
+    _success_out = false;
+
+    uint64_t total_area = 0;
+    int      max_width  = 1;
+    int      max_height = 1;
+    for (const glm::ivec2& size : _sizes_in)
+    {
+        if ((0 >= size.x) || (0 >= size.y))
+        {
+            Log_e("Atlas rectangles must have a positive size.");
+            return;
+        }
+
+        total_area += static_cast<uint64_t>(size.x) * static_cast<uint64_t>(size.y);
+        max_width   = std::max(max_width, size.x);
+        max_height  = std::max(max_height, size.y);
+    }
+
+    if ((max_width > _max_dimension_in) || (max_height > _max_dimension_in))
+    {
+        std::stringstream ss;
+        ss << "An atlas rectangle is larger than the maximum atlas dimension of "
+           << _max_dimension_in << ".";
+        Log_e(ss);
+        return;
+    }
+
+    std::vector<size_t> packing_order(_sizes_in.size());
+    std::iota(packing_order.begin(), packing_order.end(), 0);
+    std::stable_sort(packing_order.begin(),
+                     packing_order.end(),
+                     [&_sizes_in](const size_t& _a_in, const size_t& _b_in)
+                     {
+                         const glm::ivec2& a = _sizes_in[_a_in];
+                         const glm::ivec2& b = _sizes_in[_b_in];
+                         return std::make_pair(std::max(a.x, a.y), a.x * a.y) >
+                                std::make_pair(std::max(b.x, b.y), b.x * b.y);
+                     });
+
+    // Note: Start from the smallest atlas that could hold every rectangle, and grow it until
+    //       they fit.
+    int atlas_width  = static_cast<int>(std::bit_ceil(static_cast<uint32_t>(max_width)));
+    int atlas_height = static_cast<int>(std::bit_ceil(static_cast<uint32_t>(max_height)));
+    while ((static_cast<uint64_t>(atlas_width) * static_cast<uint64_t>(atlas_height)) <
+           total_area)
+    {
+        GrowAtlas(atlas_width, atlas_height);
+    }
+
+    _positions_out.assign(_sizes_in.size(), glm::ivec2(0));
+    while ((atlas_width <= _max_dimension_in) && (atlas_height <= _max_dimension_in))
+    {
+        if (true == TryPackAtlasRectangles(_sizes_in,
+                                           packing_order,
+                                           atlas_width,
+                                           atlas_height,
+                                           _positions_out))
+        {
+            _atlas_width_out  = atlas_width;
+            _atlas_height_out = atlas_height;
+            _success_out      = true;
+            return;
+        }
+
+        GrowAtlas(atlas_width, atlas_height);
+    }
+
+    std::stringstream ss;
+    ss << "Unable to pack " << _sizes_in.size() << " rectangles into an atlas of at most "
+       << _max_dimension_in << "x" << _max_dimension_in << ".";
+    Log_e(ss);
+}
+
+void
+BuildTextureAtlas(bool&                                  _success_out,
+                  const std::vector<TextureAtlasSource>& _sources_in,
+                  const TextureAtlasOptions&             _options_in,
+                  TextureAtlas&                          _texture_atlas_out)
+{
+    _success_out = false;
+
+    if ((0 > _options_in.mip_safe_level_count) ||
+        (texture_atlas_max_mip_safe_level_count < _options_in.mip_safe_level_count))
+    {
+        std::stringstream ss;
+        ss << "Mip safe level count must be within [0, " << texture_atlas_max_mip_safe_level_count
+           << "].";
+        Log_e(ss);
+        return;
+    }
+
+    if (true == _sources_in.empty())
+    {
+        Log_e("A texture atlas requires at least one source image.");
+        return;
+    }
+
+    std::vector<std::string_view> names;
+    for (const TextureAtlasSource& source : _sources_in)
+    {
+        if ((nullptr == source.image_data) || (0 >= source.image_width) ||
+            (0 >= source.image_height))
+        {
+            std::stringstream ss;
+            ss << "Invalid texture atlas source image: " << source.name;
+            Log_e(ss);
+            return;
+        }
+
+        names.push_back(source.name);
+    }
+
+    std::sort(names.begin(), names.end());
+    const auto duplicate_name = std::adjacent_find(names.begin(), names.end());
+    if (names.end() != duplicate_name)
+    {
+        std::stringstream ss;
+        ss << "Texture atlas source images must be uniquely named: " << *duplicate_name;
+        Log_e(ss);
+        return;
+    }
+
+    // Note: Cells are whole grid squares, such that no texel of a mip safe level straddles two,
+    //       and the gutter is a grid square wide, such that filtering at the sub-image's edge
+    //       reads the gutter on every mip safe level.
+    const int               grid_size = 1 << _options_in.mip_safe_level_count;
+    const int               gutter    = grid_size;
+    std::vector<glm::ivec2> cell_sizes;
+    cell_sizes.reserve(_sources_in.size());
+    for (const TextureAtlasSource& source : _sources_in)
+    {
+        cell_sizes.emplace_back(
+          (source.image_width + (2 * gutter) + (grid_size - 1)) & ~(grid_size - 1),
+          (source.image_height + (2 * gutter) + (grid_size - 1)) & ~(grid_size - 1));
+    }
+
+    std::vector<glm::ivec2> cell_positions;
+    int                     atlas_width  = 0;
+    int                     atlas_height = 0;
+    PackAtlasRectangles(_success_out,
+                        cell_sizes,
+                        _options_in.max_dimension,
+                        cell_positions,
+                        atlas_width,
+                        atlas_height);
+    if (false == _success_out)
+    {
+        Log_e("Unable to pack texture atlas.");
+        return;
+    }
+
+    _texture_atlas_out.width                = atlas_width;
+    _texture_atlas_out.height               = atlas_height;
+    _texture_atlas_out.mip_safe_level_count = _options_in.mip_safe_level_count;
+    _texture_atlas_out.sub_images.assign(_sources_in.size(), TextureAtlasSubImage());
+    _texture_atlas_out.image_data.assign(static_cast<size_t>(atlas_width) * atlas_height * 4, 0);
+
+    for (size_t index = 0; index < _sources_in.size(); index++)
+    {
+        const TextureAtlasSource& source    = _sources_in[index];
+        const glm::ivec2&         cell      = cell_positions[index];
+        const glm::ivec2&         cell_size = cell_sizes[index];
+
+        // Note: The gutter, and whatever the cell rounds up to, repeats the nearest edge pixel.
+        for (int row = 0; row < cell_size.y; row++)
+        {
+            const int source_row = std::clamp(row - gutter, 0, source.image_height - 1);
+            const unsigned char* const source_pixels = source.image_data +
+                                                       (static_cast<size_t>(source_row) *
+                                                        source.image_width * 4);
+            unsigned char* const atlas_pixels = _texture_atlas_out.image_data.data() +
+                                                (((static_cast<size_t>(cell.y + row) *
+                                                   atlas_width) +
+                                                  cell.x) *
+                                                 4);
+            for (int column = 0; column < cell_size.x; column++)
+            {
+                const int source_column = std::clamp(column - gutter, 0, source.image_width - 1);
+                std::memcpy(atlas_pixels + (static_cast<size_t>(column) * 4),
+                            source_pixels + (static_cast<size_t>(source_column) * 4),
+                            4);
+            }
+        }
+
+        TextureAtlasSubImage& sub_image         = _texture_atlas_out.sub_images[index];
+        sub_image.name                          = source.name;
+        sub_image.x                             = cell.x + gutter;
+        sub_image.y                             = cell.y + gutter;
+        sub_image.width                         = source.image_width;
+        sub_image.height                        = source.image_height;
+        sub_image.texture_coordinates_transform = glm::vec4(
+          static_cast<float>(sub_image.width) / static_cast<float>(atlas_width),
+          static_cast<float>(sub_image.height) / static_cast<float>(atlas_height),
+          static_cast<float>(sub_image.x) / static_cast<float>(atlas_width),
+          static_cast<float>(sub_image.y) / static_cast<float>(atlas_height));
+    }
+
+    _success_out = true;
+}
+
+// Note: Renames a completely written temporary file into place, and removes it otherwise.
+static void
+RenameTextureAtlasFile(bool&              _success_in_out,
+                       const std::string& _temporary_file_path_in,
+                       const std::string& _file_path_in)
+{
+    std::error_code error_code;
+    if (true == _success_in_out)
+    {
+        std::filesystem::rename(_temporary_file_path_in, _file_path_in, error_code);
+        _success_in_out = (false == static_cast<bool>(error_code));
+    }
+
+    if (false == _success_in_out)
+    {
+        std::filesystem::remove(_temporary_file_path_in, error_code);
+
+        std::stringstream ss;
+        ss << "Unable to write texture atlas file: " << _file_path_in;
+        Log_e(ss);
+    }
+}
+
+void
+WriteTextureAtlas(bool&               _success_out,
+                  const char* const   _atlas_image_file_path_in,
+                  const TextureAtlas& _texture_atlas_in)
+{
+    _success_out = false;
+
+    const size_t image_size_bytes = static_cast<size_t>(_texture_atlas_in.width) *
+                                    _texture_atlas_in.height * 4;
+    if ((0 >= _texture_atlas_in.width) || (0 >= _texture_atlas_in.height) ||
+        (image_size_bytes != _texture_atlas_in.image_data.size()))
+    {
+        Log_e("Texture atlas image data does not match its size.");
+        return;
+    }
+
+    TextureAtlasHeader header;
+    header.source_content_hash  = _texture_atlas_in.source_content_hash;
+    header.width                = static_cast<uint32_t>(_texture_atlas_in.width);
+    header.height               = static_cast<uint32_t>(_texture_atlas_in.height);
+    header.mip_safe_level_count = static_cast<uint32_t>(_texture_atlas_in.mip_safe_level_count);
+    header.sub_image_count      = static_cast<uint32_t>(_texture_atlas_in.sub_images.size());
+
+    std::vector<TextureAtlasEntry> entries;
+    std::string                    names;
+    entries.reserve(_texture_atlas_in.sub_images.size());
+    for (const TextureAtlasSubImage& sub_image : _texture_atlas_in.sub_images)
+    {
+        TextureAtlasEntry entry;
+        entry.texture_coordinates_transform[0] = sub_image.texture_coordinates_transform.x;
+        entry.texture_coordinates_transform[1] = sub_image.texture_coordinates_transform.y;
+        entry.texture_coordinates_transform[2] = sub_image.texture_coordinates_transform.z;
+        entry.texture_coordinates_transform[3] = sub_image.texture_coordinates_transform.w;
+        entry.x                                = static_cast<uint32_t>(sub_image.x);
+        entry.y                                = static_cast<uint32_t>(sub_image.y);
+        entry.width                            = static_cast<uint32_t>(sub_image.width);
+        entry.height                           = static_cast<uint32_t>(sub_image.height);
+        entry.name_offset_bytes                = static_cast<uint32_t>(names.size());
+        entry.name_size_bytes                  = static_cast<uint32_t>(sub_image.name.size());
+        entries.push_back(entry);
+        names += sub_image.name;
+    }
+    header.names_size_bytes = static_cast<uint32_t>(names.size());
+
+    // Note: Unique per thread, as in WriteCookedMesh(...).
+    std::stringstream temporary_suffix_ss;
+    temporary_suffix_ss << "." << std::this_thread::get_id() << ".tmp";
+    const std::string temporary_suffix = temporary_suffix_ss.str();
+
+    // Note: Rows are stored bottom to top, and PNG rows top to bottom; the image is written from
+    //       its last row up.
+    const std::string image_file_path           = _atlas_image_file_path_in;
+    const std::string temporary_image_file_path = image_file_path + temporary_suffix;
+    const int         row_size_bytes            = _texture_atlas_in.width * 4;
+    _success_out = (0 != stbi_write_png(temporary_image_file_path.c_str(),
+                                        _texture_atlas_in.width,
+                                        _texture_atlas_in.height,
+                                        4,
+                                        _texture_atlas_in.image_data.data() +
+                                          (image_size_bytes - row_size_bytes),
+                                        -row_size_bytes));
+    RenameTextureAtlasFile(_success_out, temporary_image_file_path, image_file_path);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    const std::string description_file_path = image_file_path + texture_atlas_file_extension;
+    const std::string temporary_description_file_path = description_file_path + temporary_suffix;
+    {
+        std::ofstream file_stream(temporary_description_file_path,
+                                  std::ios::binary | std::ios::trunc);
+        file_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file_stream.write(reinterpret_cast<const char*>(entries.data()),
+                          entries.size() * sizeof(TextureAtlasEntry));
+        file_stream.write(names.data(), names.size());
+
+        _success_out = file_stream.good();
+    }
+    RenameTextureAtlasFile(_success_out, temporary_description_file_path, description_file_path);
+}
+
+static void
+ReportTextureAtlasError(const std::string& _description_file_path_in, const char* const _note_in)
+{
+    std::stringstream ss;
+    ss << "Ignoring texture atlas file." << std::endl
+       << "   File: " << _description_file_path_in << std::endl
+       << "   Note: " << _note_in;
+    Log_w(ss);
+}
+
+void
+ReadTextureAtlas(bool&             _success_out,
+                 const char* const _atlas_image_file_path_in,
+                 TextureAtlas&     _texture_atlas_out)
+{
+    _success_out = false;
+
+    const std::string description_file_path = std::string(_atlas_image_file_path_in) +
+                                              texture_atlas_file_extension;
+    bool file_exists = false;
+    bool file_empty  = true;
+    FileExistsOrEmpty(description_file_path.c_str(), file_exists, file_empty);
+    if ((false == file_exists) || (true == file_empty))
+    {
+        return;
+    }
+
+    MappedFile description_file;
+    MapFileToMemory(_success_out, description_file_path.c_str(), description_file);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    _success_out = false;
+
+    if (sizeof(TextureAtlasHeader) > description_file.size_bytes)
+    {
+        ReportTextureAtlasError(description_file_path, "File is smaller than its header.");
+        return;
+    }
+
+    TextureAtlasHeader header;
+    std::memcpy(&header, description_file.data, sizeof(header));
+    if ((texture_atlas_magic != header.magic) || (texture_atlas_version != header.version))
+    {
+        ReportTextureAtlasError(description_file_path, "Unrecognized magic or version.");
+        return;
+    }
+
+    const size_t names_offset_bytes = sizeof(TextureAtlasHeader) +
+                                      (static_cast<size_t>(header.sub_image_count) *
+                                       sizeof(TextureAtlasEntry));
+    if ((names_offset_bytes + header.names_size_bytes) != description_file.size_bytes)
+    {
+        ReportTextureAtlasError(description_file_path, "File size does not match its header.");
+        return;
+    }
+
+    const char* const names = description_file.data + names_offset_bytes;
+    _texture_atlas_out.sub_images.assign(header.sub_image_count, TextureAtlasSubImage());
+    for (uint32_t index = 0; index < header.sub_image_count; index++)
+    {
+        TextureAtlasEntry entry;
+        std::memcpy(&entry,
+                    description_file.data + sizeof(TextureAtlasHeader) +
+                      (static_cast<size_t>(index) * sizeof(TextureAtlasEntry)),
+                    sizeof(entry));
+        if (((static_cast<uint64_t>(entry.name_offset_bytes) + entry.name_size_bytes) >
+             header.names_size_bytes) ||
+            ((static_cast<uint64_t>(entry.x) + entry.width) > header.width) ||
+            ((static_cast<uint64_t>(entry.y) + entry.height) > header.height))
+        {
+            ReportTextureAtlasError(description_file_path, "Sub-image is out of bounds.");
+            _texture_atlas_out.sub_images.clear();
+            return;
+        }
+
+        TextureAtlasSubImage& sub_image = _texture_atlas_out.sub_images[index];
+        sub_image.name.assign(names + entry.name_offset_bytes, entry.name_size_bytes);
+        sub_image.x                             = static_cast<int>(entry.x);
+        sub_image.y                             = static_cast<int>(entry.y);
+        sub_image.width                         = static_cast<int>(entry.width);
+        sub_image.height                        = static_cast<int>(entry.height);
+        sub_image.texture_coordinates_transform = glm::vec4(entry.texture_coordinates_transform[0],
+                                                            entry.texture_coordinates_transform[1],
+                                                            entry.texture_coordinates_transform[2],
+                                                            entry.texture_coordinates_transform[3]);
+    }
+
+    _texture_atlas_out.width                = static_cast<int>(header.width);
+    _texture_atlas_out.height               = static_cast<int>(header.height);
+    _texture_atlas_out.mip_safe_level_count = static_cast<int>(header.mip_safe_level_count);
+    _texture_atlas_out.source_content_hash  = header.source_content_hash;
+    _texture_atlas_out.image_data.clear();
+
+    _success_out = true;
+}
+
+void
+FindTextureAtlasSubImage(bool&                        _success_out,
+                         const TextureAtlas&          _texture_atlas_in,
+                         const char* const            _sub_image_name_in,
+                         const TextureAtlasSubImage*& _sub_image_out)
+{
+    _success_out   = false;
+    _sub_image_out = nullptr;
+
+    for (const TextureAtlasSubImage& sub_image : _texture_atlas_in.sub_images)
+    {
+        if (sub_image.name == _sub_image_name_in)
+        {
+            _sub_image_out = &sub_image;
+            _success_out   = true;
+            return;
+        }
+    }
+}
@@ -0,0 +1,154 @@
+#ifndef texture_atlas_h
+#define texture_atlas_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+//
+// Note: A texture atlas packs many small images into one, such that models textured with any of
+//       them share one texture binding and may be drawn together. Each sub-image is sampled by
+//       transforming the texture coordinates of the model drawn with it:
+//
+//       atlas_texture_coordinates = (texture_coordinates * transform.xy) + transform.zw
+//
+//       which maps [0, 1] onto the sub-image. Texture coordinates outside [0, 1] sample the
+//       neighbouring sub-images rather than repeating; atlases are for decals and the like.
+//
+//       Sub-images are placed with the MaxRects packer on a grid of 2^mip_safe_level_count
+//       pixels, each surrounded by a gutter of as many pixels repeating its edge. Its texels in
+//       the first mip_safe_level_count + 1 levels of a box filtered mip chain are then its own,
+//       and bilinear filtering at its edge reads its own edge, down to the coarsest of those
+//       levels. Coarser levels blend neighbouring sub-images, as do the wider windowed sinc
+//       filters of mip_generator.h near the edge of each cell.
+//
+//       The asset cooker packs the images of each `<name>.atlas` directory into the image
+//       `<name>.png`, cooked as any other, and describes the sub-images in `<name>.png.atlas`:
+//
+//       TextureAtlasHeader
+//       TextureAtlasEntry[sub_image_count]
+//       Names of the sub-images, names_size_bytes; paths relative to the atlas directory
+//
+//       As images are loaded (see LoadImageToMemory(...) in image_tools.h), rows and sub-image
+//       positions count from the bottom of the atlas, where texture coordinates start.
+//
+constexpr uint32_t texture_atlas_magic                 = 0x534C5441; // "ATLS"
+constexpr uint32_t texture_atlas_version               = 1;
+constexpr char     texture_atlas_file_extension[]      = ".atlas";
+constexpr char     texture_atlas_directory_extension[] = ".atlas";
+
+struct TextureAtlasHeader
+{
+    uint32_t magic   = texture_atlas_magic;
+    uint32_t version = texture_atlas_version;
+
+    // Note: Of the atlas' source images and options; see TextureAtlas::source_content_hash.
+    uint64_t source_content_hash = 0;
+
+    uint32_t width                = 0;
+    uint32_t height               = 0;
+    uint32_t mip_safe_level_count = 0;
+    uint32_t sub_image_count      = 0;
+    uint32_t names_size_bytes     = 0;
+    uint32_t padding              = 0;
+};
+
+struct TextureAtlasEntry
+{
+    float    texture_coordinates_transform[4] = { 0.0f };
+    uint32_t x                                = 0;
+    uint32_t y                                = 0;
+    uint32_t width                            = 0;
+    uint32_t height                           = 0;
+    uint32_t name_offset_bytes                = 0;
+    uint32_t name_size_bytes                  = 0;
+};
+
+struct TextureAtlasOptions
+{
+    // Note: Atlases grow in powers of two, from the smallest that could hold the sub-images,
+    //       until they fit or a side would exceed this.
+    int max_dimension = 4096;
+
+    int mip_safe_level_count = 3;
+};
+
+// Note: Four channels per pixel, rows bottom to top, as LoadImageToMemory(...) decodes.
+struct TextureAtlasSource
+{
+    std::string          name;
+    const unsigned char* image_data   = nullptr;
+    int                  image_width  = 0;
+    int                  image_height = 0;
+};
+
+struct TextureAtlasSubImage
+{
+    std::string name;
+
+    // Note: The pixels of the sub-image in the atlas, gutter excluded.
+    int x      = 0;
+    int y      = 0;
+    int width  = 0;
+    int height = 0;
+
+    glm::vec4 texture_coordinates_transform = glm::vec4(1.0f, 1.0f, 0.0f, 0.0f);
+};
+
+struct TextureAtlas
+{
+    int width                = 0;
+    int height               = 0;
+    int mip_safe_level_count = 0;
+
+    // Note: Set by the caller of BuildTextureAtlas(...) to identify what the atlas was built
+    //       from, and compared by the caller of ReadTextureAtlas(...) to detect a stale atlas.
+    uint64_t source_content_hash = 0;
+
+    // Note: In the order of the sources the atlas was built from.
+    std::vector<TextureAtlasSubImage> sub_images;
+
+    // Note: Four channels per pixel. Left empty by ReadTextureAtlas(...); the atlas image is
+    //       loaded as any other.
+    std::vector<unsigned char> image_data;
+};
+
+// Note: Places rectangles, without rotating them, in the smallest power of two atlas found
+//       that holds them all. `_positions_out` is in the order of `_sizes_in`.
+void
+PackAtlasRectangles(bool&                          _success_out,
+                    const std::vector<glm::ivec2>& _sizes_in,
+                    const int&                     _max_dimension_in,
+                    std::vector<glm::ivec2>&       _positions_out,
+                    int&                           _atlas_width_out,
+                    int&                           _atlas_height_out);
+
+void
+BuildTextureAtlas(bool&                                  _success_out,
+                  const std::vector<TextureAtlasSource>& _sources_in,
+                  const TextureAtlasOptions&             _options_in,
+                  TextureAtlas&                          _texture_atlas_out);
+
+// Note: Writes `_texture_atlas_in.image_data` as a PNG to `_atlas_image_file_path_in`, and the
+//       description of its sub-images to `<image file>.atlas`. Each file is written to a
+//       temporary path and renamed into place.
+void
+WriteTextureAtlas(bool&               _success_out,
+                  const char* const   _atlas_image_file_path_in,
+                  const TextureAtlas& _texture_atlas_in);
+
+// Note: Reads the description `<image file>.atlas` of the atlas image. Fails without logging an
+//       error if the description does not exist. Malformed descriptions are logged.
+void
+ReadTextureAtlas(bool&             _success_out,
+                 const char* const _atlas_image_file_path_in,
+                 TextureAtlas&     _texture_atlas_out);
+
+// Note: Fails without logging an error if the atlas has no sub-image of that name.
+void
+FindTextureAtlasSubImage(bool&                        _success_out,
+                         const TextureAtlas&          _texture_atlas_in,
+                         const char* const            _sub_image_name_in,
+                         const TextureAtlasSubImage*& _sub_image_out);
+
+#endif // texture_atlas_h
@@ -0,0 +1,153 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "texture_cache.h"
+
+#include "gl_function_wrappers.h"
+#include "logging.h"
+
+std::string
+GetCanonicalTexturePath(const char* const _file_path_in)
+{
+    std::error_code             error_code;
+    const std::filesystem::path canonical_path = std::filesystem::weakly_canonical(_file_path_in,
+                                                                                   error_code);
+    if (!error_code)
+    {
+        return canonical_path.string();
+    }
+
+    const std::filesystem::path absolute_path = std::filesystem::absolute(_file_path_in,
+                                                                          error_code);
+    if (!error_code)
+    {
+        return absolute_path.lexically_normal().string();
+    }
+
+    return std::filesystem::path(_file_path_in).lexically_normal().string();
+}
+
+TextureCache*
+TextureCache::GetInstance() noexcept
+{
+    static TextureCache INSTANCE;
+    return &INSTANCE;
+}
+
+void
+TextureCache::Acquire(bool&                              _success_out,
+                      const char* const                  _file_path_in,
+                      const glt::TextureSamplerSettings& _sampler_settings_in,
+                      GLuint&                            _texture_id_out)
+{
+    _success_out    = false;
+    _texture_id_out = 0;
+
+    if (nullptr == _file_path_in)
+    {
+        Log_e("Null pointer received for file path.");
+        return;
+    }
+
+    const std::string canonical_path = GetCanonicalTexturePath(_file_path_in);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto path_textures = texture_ids_by_path.equal_range(canonical_path);
+    for (auto path_texture = path_textures.first; path_texture != path_textures.second;
+         path_texture++)
+    {
+        CachedTexture& cached_texture = cached_textures.at(path_texture->second);
+        if (cached_texture.sampler_settings == _sampler_settings_in)
+        {
+            cached_texture.reference_count++;
+            statistics.hit_count++;
+
+            _texture_id_out = path_texture->second;
+            _success_out    = true;
+            return;
+        }
+    }
+
+    statistics.miss_count++;
+
+    size_t       texture_size_bytes = 0;
+    const GLuint texture_id         = glt::GetTexture2DFromImage(_success_out,
+                                                                 canonical_path.c_str(),
+                                                                 _sampler_settings_in,
+                                                                 texture_size_bytes);
+    if (false == _success_out)
+    {
+        std::stringstream ss;
+        ss << "Unable to load texture at: " << _file_path_in;
+        Log_e(ss);
+        return;
+    }
+
+    CachedTexture cached_texture;
+    cached_texture.canonical_path   = canonical_path;
+    cached_texture.sampler_settings = _sampler_settings_in;
+    cached_texture.size_bytes       = texture_size_bytes;
+    cached_texture.reference_count  = 1;
+
+    cached_textures.emplace(texture_id, std::move(cached_texture));
+    texture_ids_by_path.emplace(canonical_path, texture_id);
+
+    statistics.resident_texture_count++;
+    statistics.resident_bytes += texture_size_bytes;
+
+    _texture_id_out = texture_id;
+    _success_out    = true;
+}
+
+void
+TextureCache::Release(bool& _success_out, const GLuint&& _texture_id_in)
+{
+    _success_out = false;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto cached_texture = cached_textures.find(_texture_id_in);
+    if (cached_textures.end() == cached_texture)
+    {
+        std::stringstream ss;
+        ss << "The texture with id " << _texture_id_in << " is not in the texture cache.";
+        Log_e(ss);
+        return;
+    }
+
+    assert(0 != cached_texture->second.reference_count);
+    cached_texture->second.reference_count--;
+    if (0 != cached_texture->second.reference_count)
+    {
+        _success_out = true;
+        return;
+    }
+
+    const auto path_textures = texture_ids_by_path.equal_range(
+      cached_texture->second.canonical_path);
+    for (auto path_texture = path_textures.first; path_texture != path_textures.second;
+         path_texture++)
+    {
+        if (_texture_id_in == path_texture->second)
+        {
+            texture_ids_by_path.erase(path_texture);
+            break;
+        }
+    }
+
+    statistics.resident_texture_count--;
+    statistics.resident_bytes -= cached_texture->second.size_bytes;
+    cached_textures.erase(cached_texture);
+
+    glfn::DeleteTextures(1, &_texture_id_in);
+    _success_out = true;
+}
+
+void
+TextureCache::GetStatistics(TextureCacheStatistics& _statistics_out) const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    _statistics_out = statistics;
+}
@@ -0,0 +1,78 @@
+#ifndef texture_cache_h
+#define texture_cache_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "gl_tools.h"
+
+//
+// Note: Shares textures between models. A texture is keyed by the canonical path of its image and
+//       its sampler settings, so that models asking for the same image with the same sampler
+//       settings get the same texture id and the image is decoded and uploaded once. Each
+//       Acquire(...) takes a reference that Release(...) returns; the texture is deleted when the
+//       last reference is returned.
+//
+//       Acquire(...) and Release(...) make OpenGL calls and must be called from the render thread.
+//       The statistics may be read from any thread.
+//
+// Note: Spellings of the same file, such as "./a/../brick.png" and "brick.png", canonicalize to
+//       one path. Paths that cannot be canonicalized are only made absolute; the image loader
+//       reports those that do not exist.
+std::string
+GetCanonicalTexturePath(const char* const _file_path_in);
+
+struct TextureCacheStatistics
+{
+    // Note: Hits and misses are counted over the life of the cache.
+    size_t hit_count              = 0;
+    size_t miss_count             = 0;
+    size_t resident_texture_count = 0;
+    size_t resident_bytes         = 0;
+};
+
+struct TextureCache
+{
+    static TextureCache*
+    GetInstance() noexcept;
+
+    void
+    Acquire(bool&                              _success_out,
+            const char* const                  _file_path_in,
+            const glt::TextureSamplerSettings& _sampler_settings_in,
+            GLuint&                            _texture_id_out);
+
+    // Note: `_texture_id_in` must have been returned by Acquire(...).
+    void
+    Release(bool& _success_out, const GLuint&& _texture_id_in);
+
+    void
+    GetStatistics(TextureCacheStatistics& _statistics_out) const noexcept;
+
+  private:
+    struct CachedTexture
+    {
+        std::string                 canonical_path;
+        glt::TextureSamplerSettings sampler_settings;
+        size_t                      size_bytes      = 0;
+        size_t                      reference_count = 0;
+    };
+
+    TextureCache() {};
+
+    TextureCache(const TextureCache&) = delete;
+
+    TextureCache
+    operator=(const TextureCache&) = delete;
+
+    // Note: Guards every member below.
+    mutable std::mutex mutex;
+
+    // Note: A path maps to one texture per set of sampler settings it was acquired with.
+    std::unordered_multimap<std::string, GLuint> texture_ids_by_path;
+    std::unordered_map<GLuint, CachedTexture>    cached_textures;
+    TextureCacheStatistics                       statistics;
+};
+
+#endif // texture_cache_h
@@ -0,0 +1,443 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "texture_streaming.h"
+
+#include "gl_function_wrappers.h"
+#include "logging.h"
+#include "timer.h"
+
+struct StreamedTexture
+{
+    std::string   file_path;
+    CookedTexture cooked_texture;
+    GLuint        texture_id = 0;
+
+    // Note: The coarsest level streamed; it and every coarser level stay resident.
+    size_t tail_level      = 0;
+    size_t tail_size_bytes = 0;
+
+    std::atomic<size_t> resident_level = 0;
+    std::atomic<float>  priority       = 0.0f;
+
+    // Note: Render thread only. At most one level of a texture is requested at a time, always
+    //       the one above `resident_level`, and a texture is not evicted while it is requested.
+    bool level_requested = false;
+    bool released        = false;
+};
+
+struct TextureStreamer::LevelLoad
+{
+    std::shared_ptr<StreamedTexture> texture;
+    size_t                           level = 0;
+
+    // Note: Written by the reading job, read by the render thread once the load is queued.
+    std::vector<unsigned char> data;
+};
+
+GLuint
+StreamedTextureHandle::GetTextureId() const noexcept
+{
+    assert(nullptr != texture);
+    return texture->texture_id;
+}
+
+void
+StreamedTextureHandle::SetPriority(const float& _priority_in) noexcept
+{
+    assert(nullptr != texture);
+    texture->priority = _priority_in;
+}
+
+size_t
+StreamedTextureHandle::GetResidentLevel() const noexcept
+{
+    assert(nullptr != texture);
+    return texture->resident_level;
+}
+
+size_t
+StreamedTextureHandle::GetLevelCount() const noexcept
+{
+    assert(nullptr != texture);
+    return texture->cooked_texture.levels.size();
+}
+
+bool
+StreamedTextureHandle::IsValid() const noexcept
+{
+    return (nullptr != texture) && (false == texture->released);
+}
+
+TextureStreamer::~TextureStreamer()
+{
+    Stop();
+}
+
+void
+TextureStreamer::Start(bool&          _success_out,
+                       const size_t&& _thread_count_in,
+                       const size_t&& _residency_budget_bytes_in)
+{
+    job_system.Start(_success_out, std::move(_thread_count_in));
+    if (false == _success_out)
+    {
+        Log_e("Unable to start the texture streaming job system.");
+        return;
+    }
+
+    residency_budget_bytes = _residency_budget_bytes_in;
+}
+
+void
+TextureStreamer::Stop() noexcept
+{
+    job_system.Stop();
+
+    {
+        std::lock_guard<std::mutex> lock(loaded_levels_mutex);
+        loaded_levels.clear();
+    }
+
+    for (auto& texture : streamed_textures)
+    {
+        texture->level_requested = false;
+    }
+
+    requested_bytes = 0;
+}
+
+void
+TextureStreamer::SetResidencyBudget(const size_t&& _residency_budget_bytes_in) noexcept
+{
+    residency_budget_bytes = _residency_budget_bytes_in;
+}
+
+void
+TextureStreamer::StreamTexture(bool&                              _success_out,
+                               const char* const                  _file_path_in,
+                               const glt::TextureSamplerSettings& _sampler_settings_in,
+                               StreamedTextureHandle&             _handle_out)
+{
+    _success_out = false;
+    if (0 == job_system.GetThreadCount())
+    {
+        Log_e("The texture streamer has not been started.");
+        return;
+    }
+
+    if (nullptr == _file_path_in)
+    {
+        Log_e("No texture file path was provided.");
+        return;
+    }
+
+    if ((GL_NEAREST == _sampler_settings_in.min_filter) ||
+        (GL_LINEAR == _sampler_settings_in.min_filter))
+    {
+        Log_e("Streamed textures must be sampled with a mipmapped min filter.");
+        return;
+    }
+
+    std::shared_ptr<StreamedTexture> texture = std::make_shared<StreamedTexture>();
+    MapCurrentCookedTexture(_success_out, _file_path_in, texture->cooked_texture);
+    if (false == _success_out)
+    {
+        return;
+    }
+
+    // Note: Cooked mip chains are complete and end in a 1x1 level, which is always in the tail.
+    const std::vector<CookedTextureLevel>& levels = texture->cooked_texture.levels;
+    texture->tail_level                           = levels.size() - 1;
+    for (size_t level = 0; level < levels.size(); level++)
+    {
+        if (texture_streaming_tail_dimension >= std::max(levels[level].width, levels[level].height))
+        {
+            texture->tail_level = level;
+            break;
+        }
+    }
+
+    texture->texture_id = glt::GetTexture2DFromCookedTextureLevels(_success_out,
+                                                                   texture->cooked_texture,
+                                                                   _sampler_settings_in,
+                                                                   texture->tail_level,
+                                                                   texture->tail_size_bytes);
+    if (false == _success_out)
+    {
+        std::stringstream ss;
+        ss << "Unable to upload the mip tail of: " << _file_path_in;
+        Log_e(ss);
+        return;
+    }
+
+    texture->file_path      = _file_path_in;
+    texture->resident_level = texture->tail_level;
+
+    resident_bytes += texture->tail_size_bytes;
+    tail_bytes += texture->tail_size_bytes;
+    streamed_textures.push_back(texture);
+
+    _handle_out.texture = texture;
+    _success_out        = true;
+}
+
+void
+TextureStreamer::ReleaseTexture(bool& _success_out, StreamedTextureHandle& _handle_in_out)
+{
+    _success_out = false;
+    if (false == _handle_in_out.IsValid())
+    {
+        Log_e("Invalid streamed texture provided.");
+        return;
+    }
+
+    const auto streamed_texture = std::find(streamed_textures.begin(),
+                                            streamed_textures.end(),
+                                            _handle_in_out.texture);
+    if (streamed_textures.end() == streamed_texture)
+    {
+        Log_e("The texture was not streamed by this texture streamer.");
+        return;
+    }
+
+    StreamedTexture&                       texture = *_handle_in_out.texture;
+    const std::vector<CookedTextureLevel>& levels  = texture.cooked_texture.levels;
+    for (size_t level = texture.resident_level; level < texture.tail_level; level++)
+    {
+        resident_bytes -= levels[level].size_bytes;
+    }
+
+    resident_bytes -= texture.tail_size_bytes;
+    tail_bytes -= texture.tail_size_bytes;
+
+    // Note: A level still being read is discarded, and its bytes released, by Update(...).
+    glfn::DeleteTextures(1, &texture.texture_id);
+    texture.texture_id = 0;
+    texture.released   = true;
+    streamed_textures.erase(streamed_texture);
+
+    _handle_in_out.texture.reset();
+    _success_out = true;
+}
+
+void
+TextureStreamer::EvictLevel(StreamedTexture&        _texture_in_out,
+                            TextureStreamingReport& _report_in_out) noexcept
+{
+    assert(_texture_in_out.resident_level < _texture_in_out.tail_level);
+    assert(false == _texture_in_out.level_requested);
+
+    // Note: The base level is raised before the level is emptied, such that the texture is never
+    //       incomplete.
+    const size_t level      = _texture_in_out.resident_level;
+    const size_t size_bytes = _texture_in_out.cooked_texture.levels[level].size_bytes;
+    {
+        glt::ScopedTextureBinding scoped_texture_binding = glt::ScopedTextureBinding(
+          std::move(GL_TEXTURE_2D), std::move(_texture_in_out.texture_id));
+        glfn::TexParameter(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(level + 1));
+        glt::SpecifyCookedTextureLevel(_texture_in_out.cooked_texture, level, nullptr);
+    }
+
+    _texture_in_out.resident_level = level + 1;
+    resident_bytes -= size_bytes;
+
+    _report_in_out.evicted_level_count++;
+    _report_in_out.evicted_bytes += size_bytes;
+}
+
+StreamedTexture*
+TextureStreamer::FindEvictionCandidate(const float& _priority_ceiling_in) const noexcept
+{
+    StreamedTexture* candidate          = nullptr;
+    float            candidate_priority = _priority_ceiling_in;
+    for (auto& texture : streamed_textures)
+    {
+        const float priority = texture->priority;
+        if ((true == texture->level_requested) ||
+            (texture->resident_level >= texture->tail_level) || (priority >= candidate_priority))
+        {
+            continue;
+        }
+
+        candidate          = texture.get();
+        candidate_priority = priority;
+    }
+
+    return candidate;
+}
+
+size_t
+TextureStreamer::GetEvictableBytes(const float& _priority_ceiling_in) const noexcept
+{
+    size_t evictable_bytes = 0;
+    for (auto& texture : streamed_textures)
+    {
+        if ((true == texture->level_requested) || (texture->priority >= _priority_ceiling_in))
+        {
+            continue;
+        }
+
+        for (size_t level = texture->resident_level; level < texture->tail_level; level++)
+        {
+            evictable_bytes += texture->cooked_texture.levels[level].size_bytes;
+        }
+    }
+
+    return evictable_bytes;
+}
+
+void
+TextureStreamer::Update(const size_t&&          _max_upload_bytes_in,
+                        const float&&           _max_upload_milliseconds_in,
+                        TextureStreamingReport& _report_out) noexcept
+{
+    _report_out = {};
+
+    Timer timer;
+    timer.StartTimer();
+    while (true)
+    {
+        std::shared_ptr<LevelLoad> load;
+        {
+            std::lock_guard<std::mutex> lock(loaded_levels_mutex);
+            if (true == loaded_levels.empty())
+            {
+                break;
+            }
+
+            const size_t upload_bytes = loaded_levels.front()->data.size();
+            if ((0 != _report_out.uploaded_level_count) &&
+                (((_report_out.uploaded_bytes + upload_bytes) > _max_upload_bytes_in) ||
+                 (_report_out.elapsed_milliseconds >= _max_upload_milliseconds_in)))
+            {
+                break;
+            }
+
+            load = loaded_levels.front();
+            loaded_levels.pop_front();
+        }
+
+        StreamedTexture& texture    = *load->texture;
+        const size_t     size_bytes = load->data.size();
+        requested_bytes -= size_bytes;
+        texture.level_requested = false;
+        if (true == texture.released)
+        {
+            continue;
+        }
+
+        // Note: The level is specified before the base level is lowered to it, such that the
+        //       texture is never incomplete.
+        {
+            glt::ScopedTextureBinding scoped_texture_binding = glt::ScopedTextureBinding(
+              std::move(GL_TEXTURE_2D), std::move(texture.texture_id));
+            glt::SpecifyCookedTextureLevel(texture.cooked_texture, load->level, load->data.data());
+            glfn::TexParameter(
+              GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(load->level));
+        }
+
+        texture.resident_level = load->level;
+        resident_bytes += size_bytes;
+
+        _report_out.uploaded_level_count++;
+        _report_out.uploaded_bytes += size_bytes;
+
+        timer.StopTimer();
+        timer.TimerElapsedMs(_report_out.elapsed_milliseconds);
+    }
+
+    // Note: Should the budget have been lowered.
+    while ((resident_bytes - tail_bytes + requested_bytes) > residency_budget_bytes)
+    {
+        StreamedTexture* const candidate = FindEvictionCandidate(
+          std::numeric_limits<float>::infinity());
+        if (nullptr == candidate)
+        {
+            break;
+        }
+
+        EvictLevel(*candidate, _report_out);
+    }
+
+    std::vector<std::pair<float, std::shared_ptr<StreamedTexture>>> requestable_textures;
+    for (auto& texture : streamed_textures)
+    {
+        const float priority = texture->priority;
+        if ((0.0f < priority) && (false == texture->level_requested) &&
+            (0 != texture->resident_level))
+        {
+            requestable_textures.emplace_back(priority, texture);
+        }
+    }
+
+    std::sort(requestable_textures.begin(),
+              requestable_textures.end(),
+              [](const std::pair<float, std::shared_ptr<StreamedTexture>>& _lhs_in,
+                 const std::pair<float, std::shared_ptr<StreamedTexture>>& _rhs_in)
+              { return _lhs_in.first > _rhs_in.first; });
+
+    for (auto& requestable_texture : requestable_textures)
+    {
+        const float                      priority = requestable_texture.first;
+        std::shared_ptr<StreamedTexture> texture  = requestable_texture.second;
+
+        const size_t level      = texture->resident_level - 1;
+        const size_t size_bytes = texture->cooked_texture.levels[level].size_bytes;
+
+        // Note: Nothing is evicted unless it makes room, such that a level which cannot fit does
+        //       not cost textures of lower priority their levels every frame.
+        const size_t streamed_bytes = resident_bytes - tail_bytes + requested_bytes;
+        if ((streamed_bytes + size_bytes) > (residency_budget_bytes + GetEvictableBytes(priority)))
+        {
+            continue;
+        }
+
+        while ((resident_bytes - tail_bytes + requested_bytes + size_bytes) >
+               residency_budget_bytes)
+        {
+            StreamedTexture* const candidate = FindEvictionCandidate(priority);
+            if (nullptr == candidate)
+            {
+                break;
+            }
+
+            EvictLevel(*candidate, _report_out);
+        }
+
+        // Note: Priorities may have changed from another thread since the evictable bytes were
+        //       counted.
+        if ((resident_bytes - tail_bytes + requested_bytes + size_bytes) > residency_budget_bytes)
+        {
+            continue;
+        }
+
+        std::shared_ptr<LevelLoad> load = std::make_shared<LevelLoad>();
+        load->texture                   = texture;
+        load->level                     = level;
+
+        texture->level_requested = true;
+        requested_bytes += size_bytes;
+
+        // Note: Reading the level out of the mapped file is what pages it in from disk.
+        job_system.Submit(
+          [this, load]()
+          {
+              const CookedTextureLevel& cooked_texture_level =
+                load->texture->cooked_texture.levels[load->level];
+              load->data.assign(cooked_texture_level.data,
+                                cooked_texture_level.data + cooked_texture_level.size_bytes);
+
+              std::lock_guard<std::mutex> lock(loaded_levels_mutex);
+              loaded_levels.push_back(load);
+          });
+    }
+
+    timer.StopTimer();
+    timer.TimerElapsedMs(_report_out.elapsed_milliseconds);
+
+    _report_out.streamed_texture_count = streamed_textures.size();
+    _report_out.resident_bytes         = resident_bytes;
+    _report_out.requested_bytes        = requested_bytes;
+}
@@ -0,0 +1,167 @@
+#ifndef texture_streaming_h
+#define texture_streaming_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "cooked_texture.h"
+#include "gl_tools.h"
+#include "job_system.h"
+
+//
+// Note: Streams the mip levels of cooked textures (see cooked_texture.h) under a residency budget,
+//       such that creating a large texture does not block the frame. A texture is created with
+//       only its mip tail, the levels no larger than texture_streaming_tail_dimension, and can be
+//       drawn immediately. Finer levels are read from the cooked file on a JobSystem and uploaded
+//       by the render thread, a few per frame, one level per texture at a time:
+//
+//       TextureStreamer       texture_streamer;
+//       StreamedTextureHandle handle;
+//       texture_streamer.Start(success, 0, 64 << 20);
+//       texture_streamer.StreamTexture(success, "brick.png", {}, handle);
+//
+//       // Once per frame, on the render thread:
+//       handle.SetPriority(projected_size_in_pixels);
+//       texture_streamer.Update(4 << 20, 1.0f, streaming_report);
+//
+//       The resident levels of a texture are those from GL_TEXTURE_BASE_LEVEL down. Streaming a
+//       finer level lowers the base level; evicting one raises it and releases the level's
+//       storage. When a level does not fit the budget, the finest levels of textures with a
+//       lower priority are evicted to make room, lowest priority first; textures of equal
+//       priority do not evict each other. Mip tails are neither counted against the budget nor
+//       evicted, such that every streamed texture can always be drawn.
+//
+//       Only textures sampled with a mipmapped min filter are streamed.
+//
+constexpr GLsizei texture_streaming_tail_dimension = 64;
+
+struct TextureStreamingReport
+{
+    size_t uploaded_level_count = 0;
+    size_t uploaded_bytes       = 0;
+    size_t evicted_level_count  = 0;
+    size_t evicted_bytes        = 0;
+    float  elapsed_milliseconds = 0.0f;
+
+    // Note: Resident bytes include every mip tail; requested bytes are levels being read or
+    //       waiting to be uploaded, which count against the budget as if resident.
+    size_t streamed_texture_count = 0;
+    size_t resident_bytes         = 0;
+    size_t requested_bytes        = 0;
+};
+
+// Note: Defined in texture_streaming.cpp; shared by the handle, the streamer and the jobs reading
+//       its levels.
+struct StreamedTexture;
+
+// Note: Observes one streamed texture. Copies observe the same texture.
+struct StreamedTextureHandle
+{
+    GLuint
+    GetTextureId() const noexcept;
+
+    // Note: Higher priorities stream first and are evicted last; a texture at zero or below
+    //       streams no further levels. Typically the size the texture is drawn at, in pixels.
+    //       May be set from any thread.
+    void
+    SetPriority(const float& _priority_in) noexcept;
+
+    // Note: The finest resident level, zero once the texture is fully resident, out of
+    //       GetLevelCount() levels.
+    size_t
+    GetResidentLevel() const noexcept;
+
+    size_t
+    GetLevelCount() const noexcept;
+
+    // Note: False for a default constructed or released handle.
+    bool
+    IsValid() const noexcept;
+
+  private:
+    friend struct TextureStreamer;
+
+    std::shared_ptr<StreamedTexture> texture;
+};
+
+struct TextureStreamer
+{
+    TextureStreamer() = default;
+    ~TextureStreamer();
+
+    // Note: Zero selects std::thread::hardware_concurrency() workers. The budget bounds the
+    //       bytes of every resident and requested level, mip tails aside.
+    void
+    Start(bool&          _success_out,
+          const size_t&& _thread_count_in,
+          const size_t&& _residency_budget_bytes_in);
+
+    // Note: Waits for the reads in progress; levels not yet uploaded are discarded. Textures are
+    //       not deleted; release them first, while the OpenGL context is current.
+    void
+    Stop() noexcept;
+
+    // Note: Levels over a lowered budget are evicted by the next Update(...).
+    void
+    SetResidencyBudget(const size_t&& _residency_budget_bytes_in) noexcept;
+
+    // Note: Call from the render thread. `<file>.ktx2` must have been cooked from the current
+    //       contents of the image (see asset_cooker.cpp); fails without logging an error
+    //       otherwise, such that the caller may fall back to loading the image. The mip tail is
+    //       uploaded before returning, and the file stays mapped while the texture is streamed.
+    //       Textures streamed here are not shared through the TextureCache.
+    void
+    StreamTexture(bool&                              _success_out,
+                  const char* const                  _file_path_in,
+                  const glt::TextureSamplerSettings& _sampler_settings_in,
+                  StreamedTextureHandle&             _handle_out);
+
+    // Note: Call from the render thread. Deletes the texture; `_handle_in_out` is invalidated,
+    //       and copies of it observe a texture id of zero.
+    void
+    ReleaseTexture(bool& _success_out, StreamedTextureHandle& _handle_in_out);
+
+    // Note: Call once per frame from the render thread. Uploads the levels read since the last
+    //       call until either budget is spent, the first always, then evicts and requests levels
+    //       by priority as the residency budget allows.
+    void
+    Update(const size_t&&          _max_upload_bytes_in,
+           const float&&           _max_upload_milliseconds_in,
+           TextureStreamingReport& _report_out) noexcept;
+
+  private:
+    // Note: Defined in texture_streaming.cpp.
+    struct LevelLoad;
+
+    TextureStreamer(const TextureStreamer&) = delete;
+
+    TextureStreamer
+    operator=(const TextureStreamer&) = delete;
+
+    void
+    EvictLevel(StreamedTexture& _texture_in_out, TextureStreamingReport& _report_in_out) noexcept;
+
+    // Note: The texture with an evictable level and the lowest priority below
+    //       `_priority_ceiling_in`; nullptr when there is none.
+    StreamedTexture*
+    FindEvictionCandidate(const float& _priority_ceiling_in) const noexcept;
+
+    // Note: The bytes evicting every evictable level below `_priority_ceiling_in` would free.
+    size_t
+    GetEvictableBytes(const float& _priority_ceiling_in) const noexcept;
+
+    JobSystem job_system;
+
+    // Note: Render thread only.
+    std::vector<std::shared_ptr<StreamedTexture>> streamed_textures;
+    size_t                                        residency_budget_bytes = 0;
+    size_t                                        resident_bytes         = 0;
+    size_t                                        requested_bytes        = 0;
+    size_t                                        tail_bytes             = 0;
+
+    std::mutex                             loaded_levels_mutex;
+    std::deque<std::shared_ptr<LevelLoad>> loaded_levels;
+};
+
+#endif // texture_streaming_h
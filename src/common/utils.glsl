@@ -70,3 +70,24 @@ mat4 GetScaleMatrix(float x, float y, float z)
 
     return scale;
 }
+
+
+//
+// Returns the unit normal stored as a two component
+// octahedral encoding (see QuantizeVertices(...) in
+// mesh_tools.h).
+//
+vec3 OctahedralDecode(vec2 encoded)
+{
+    vec3 normal = vec3(encoded.x,
+                       encoded.y,
+                       1.0 - abs(encoded.x) - abs(encoded.y));
+    if (normal.z < 0.0)
+    {
+        vec2 sign_not_zero = vec2((normal.x >= 0.0) ? 1.0 : -1.0,
+                                  (normal.y >= 0.0) ? 1.0 : -1.0);
+        normal.xy = (1.0 - abs(normal.yx)) * sign_not_zero;
+    }
+
+    return normalize(normal);
+}
@@ -0,0 +1,35 @@
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+#include "vertex_layout.h"
+
+#include "gl_enum_tools.h"
+
+glt::VertexAttributeDescriptor::VertexAttributeDescriptor(
+  const GLuint&&         _vertex_array_object_id_in,
+  const GLuint&&         _vertex_attribute_index_in,
+  const GLint&&          _component_count_in,
+  const GLenum&&         _data_type_in,
+  const GLboolean&&      _should_be_normalized_by_gpu_in,
+  const GLsizei&&        _byte_stride_between_elements_in,
+  const GLvoid*&&        _first_component_byte_offset_in,
+  const VertexDataType&& _vertex_data_type_in)
+  : vertex_array_object_id(_vertex_array_object_id_in)
+  , vertex_attribute_index(_vertex_attribute_index_in)
+  , component_count(_component_count_in)
+  , data_type(_data_type_in)
+  , should_be_normalized_by_gpu(_should_be_normalized_by_gpu_in)
+  , byte_stride_between_elements(_byte_stride_between_elements_in)
+  , first_component_byte_offset(_first_component_byte_offset_in)
+  , vertex_data_type(_vertex_data_type_in)
+{
+    assert(0 != _component_count_in);
+    assert(0 != GLDataTypeSizeBytes(_data_type_in));
+
+    // Note: Only integer types may be normalized, mapping their range onto [0, 1] or [-1, 1].
+    assert((false == _should_be_normalized_by_gpu_in) ||
+           ((GL_FLOAT != _data_type_in) && (GL_HALF_FLOAT != _data_type_in) &&
+            (GL_DOUBLE != _data_type_in)));
+    assert(VertexDataType::COUNT != _vertex_data_type_in);
+}
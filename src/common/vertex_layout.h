@@ -0,0 +1,53 @@
+#ifndef vertex_layout_h
+#define vertex_layout_h
+
+// clang-format off
+#include "pch.h"
+// clang-format on
+
+//
+// Note: Vertex layout descriptions shared by the model importers, the mesh tools and the buffer
+//       store. Nothing here calls OpenGL, so that offline tools may describe and cook vertex data
+//       without a context (see src/asset_cooker).
+//
+namespace glt
+{
+    // Note: `COUNT` enum int value determines size of `array_buffers` array in BufferStore.
+    //       See declaration of `glt::array_buffer_count` and `glt::BufferStore::array_buffers`
+    enum class VertexDataType
+    {
+        POSITION = 0,
+        TEXTURE,
+        NORMAL,
+        TANGENT,
+        COUNT
+    };
+
+    constexpr size_t array_buffer_count = static_cast<size_t>(VertexDataType::COUNT);
+
+    struct VertexAttributeDescriptor
+    {
+        VertexAttributeDescriptor() = delete;
+        VertexAttributeDescriptor(const GLuint&&         _vertex_array_object_id_in,
+                                  const GLuint&&         _vertex_attribute_index_in,
+                                  const GLint&&          _component_count_in,
+                                  const GLenum&&         _data_type_in,
+                                  const GLboolean&&      _should_be_normalized_by_gpu_in,
+                                  const GLsizei&&        _byte_stride_between_elements_in,
+                                  const GLvoid*&&        _first_component_byte_offset_in,
+                                  const VertexDataType&& _vertex_data_type_in);
+
+        const GLuint vertex_array_object_id;
+
+        const GLuint    vertex_attribute_index;
+        const GLint     component_count;
+        const GLenum    data_type;
+        const GLboolean should_be_normalized_by_gpu;
+        const GLsizei   byte_stride_between_elements;
+        const GLvoid*   first_component_byte_offset;
+
+        const VertexDataType vertex_data_type;
+    };
+} // namespace glt
+
+#endif // vertex_layout_h
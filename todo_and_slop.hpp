@@ -22,7 +22,6 @@
 
     // TODO::Eventually
     {
-      // # Implement binary portion of PLY loader.
       // # Dont' query gl functions with glew, use a static fnptr member within each of the Impl_<> functions that can be referenced there: static fnptr glClear = GetTheFnPtr() ... then call it rather than the glew version
     }
 }